@@ -0,0 +1,257 @@
+/*
+ * gui_cover_spin.c
+ * 旋转封面图标的预旋转帧缓存: 定点旋转、圆形裁剪与直接映射的帧槽
+ *
+ * 第 k 级的角度为 k * 360 / GUI_COVER_SPIN_FRAMES 度, 存放在第 k % slots 个槽中。动画按顺序经过各级,
+ * 槽数少于级数时每一级每圈生成一次; 有两个以上的槽时, 显示一帧后在空闲时提前生成下一帧。
+ */
+
+#include "gui_cover_spin.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define SPIN_PREFETCH_MS 30  // 提前生成下一帧的检查周期
+
+// RGB565 展开为 0x07E0F81F 形式后每个分量上方有 5 位余量, 可以直接乘以 0~32 的权重
+#define SPIN_SPREAD(p) (((uint32_t)(p) | ((uint32_t)(p) << 16)) & 0x07E0F81FU)
+#define SPIN_PACK(v) ((uint16_t)(((v) & 0x07E0F81FU) | (((v) & 0x07E0F81FU) >> 16)))
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    lv_image_dsc_t dsc;
+    int16_t index;  // 槽中帧的角度级, -1 表示空
+} Spin_Slot;
+
+/* Private variables ---------------------------------------------------------*/
+static lv_obj_t *spin_img = NULL;
+static const lv_image_dsc_t *spin_src = NULL;
+static uint16_t spin_bg;  // 背景色 (RGB565)
+static Spin_Slot spin_slot[GUI_COVER_SPIN_CACHE];
+static uint8_t spin_slots = 0;
+static int16_t spin_shown = -1;  // 正在显示的角度级
+static int32_t spin_angle = 0;
+static lv_timer_t *spin_timer = NULL;
+static Gui_Cover_Spin_Stats spin_stats;
+
+/* Function implementations --------------------------------------------------*/
+
+/**
+ * @brief  sin in 0.1 degree steps, scaled by 32767 (相邻整数度之间线性插值)
+ */
+static int32_t spin_sin(int32_t angle)
+{
+    int32_t deg = angle / 10;
+    int32_t a = lv_trigo_sin((int16_t)deg);
+    int32_t b = lv_trigo_sin((int16_t)(deg + 1));
+
+    return a + (b - a) * (angle % 10) / 10;
+}
+
+/**
+ * @brief  Blend two spread pixels, w = 0..32 (weight of b)
+ */
+static inline uint32_t spin_lerp(uint32_t a, uint32_t b, uint32_t w)
+{
+    return ((a * (32 - w) + b * w) >> 5) & 0x07E0F81FU;
+}
+
+/**
+ * @brief  Bilinear sample of the source at 16.16 coordinates (超出边缘时取边缘像素)
+ */
+static uint16_t spin_sample(const uint16_t *in, int32_t n, int32_t sx, int32_t sy)
+{
+    int32_t x0 = sx >> 16, y0 = sy >> 16;
+    uint32_t fx = (uint32_t)(sx >> 11) & 31, fy = (uint32_t)(sy >> 11) & 31;
+
+    if (x0 < 0)
+    {
+        x0 = 0;
+        fx = 0;
+    }
+    else if (x0 >= n - 1)
+    {
+        x0 = n - 2;
+        fx = 32;
+    }
+    if (y0 < 0)
+    {
+        y0 = 0;
+        fy = 0;
+    }
+    else if (y0 >= n - 1)
+    {
+        y0 = n - 2;
+        fy = 32;
+    }
+
+    const uint16_t *p = in + y0 * n + x0;
+    uint32_t top = spin_lerp(SPIN_SPREAD(p[0]), SPIN_SPREAD(p[1]), fx);
+    uint32_t bottom = spin_lerp(SPIN_SPREAD(p[n]), SPIN_SPREAD(p[n + 1]), fx);
+    return SPIN_PACK(spin_lerp(top, bottom, fy));
+}
+
+/**
+ * @brief  Rotate the source into a slot, clipped to the inscribed circle over the background
+ */
+static void spin_build(Spin_Slot *slot, int16_t index)
+{
+    const uint16_t *in = (const uint16_t *)spin_src->data;
+    uint16_t *out = (uint16_t *)slot->dsc.data;
+    int32_t n = spin_src->header.w;
+    int32_t angle = index * 3600 / GUI_COVER_SPIN_FRAMES;
+    int32_t s = spin_sin(angle), c = spin_sin(angle + 900);
+    int32_t center = (n - 1) << 15;  // (n - 1) / 2, 16.16
+
+    // 坐标以半像素为单位 (d = 2 * (x - 中心)), d * sin 正好是 16.16 定点数;
+    // 半径为 n / 2, 最外一圈像素按到圆心距离的平方线性淡出
+    int32_t r_out = n * n;
+    int32_t r_in = (n - 2) * (n - 2);
+
+    for (int32_t y = 0; y < n; y++)
+    {
+        int32_t dy = 2 * y - (n - 1);
+        int32_t dx = -(n - 1);
+        // 目标点绕中心反向旋转得到源图坐标 (lv_image 的正角度为顺时针)
+        int32_t sx = center + dx * c + dy * s;
+        int32_t sy = center - dx * s + dy * c;
+
+        for (int32_t x = 0; x < n; x++, dx += 2, sx += 2 * c, sy -= 2 * s)
+        {
+            int32_t d2 = dx * dx + dy * dy;
+            if (d2 >= r_out)
+            {
+                *out++ = spin_bg;
+                continue;
+            }
+
+            uint16_t px = spin_sample(in, n, sx, sy);
+            if (d2 > r_in)
+            {
+                uint32_t w = (uint32_t)((r_out - d2) * 32 / (r_out - r_in));
+                px = SPIN_PACK(spin_lerp(SPIN_SPREAD(spin_bg), SPIN_SPREAD(px), w));
+            }
+            *out++ = px;
+        }
+    }
+
+    slot->index = index;
+    spin_stats.builds++;
+}
+
+/**
+ * @brief  Build the next angle step ahead of time (槽数不少于 2 时)
+ */
+static void spin_prefetch_cb(lv_timer_t *t)
+{
+    if (spin_shown < 0) return;
+
+    int16_t next = (int16_t)((spin_shown + 1) % GUI_COVER_SPIN_FRAMES);
+    Spin_Slot *slot = &spin_slot[next % spin_slots];
+    if (slot->index != next && next % spin_slots != spin_shown % spin_slots) spin_build(slot, next);
+}
+
+bool gui_cover_spin_start(lv_obj_t *img, const lv_image_dsc_t *src)
+{
+    if (spin_slots) return true;
+    if (src->header.cf != LV_COLOR_FORMAT_RGB565 || src->header.w != src->header.h || src->header.w < 2) return false;
+    if (src->header.flags & LV_IMAGE_FLAGS_USER_MASK) return false;  // 压缩的图片 (gui_image_rle) 不能随机读取像素
+
+    // 帧预先混合到背景上, 背景必须是不透明的纯色
+    lv_obj_t *parent = lv_obj_get_parent(img);
+    if (!parent || lv_obj_get_style_bg_opa(parent, LV_PART_MAIN) != LV_OPA_COVER ||
+        lv_obj_get_style_bg_grad_dir(parent, LV_PART_MAIN) != LV_GRAD_DIR_NONE)
+        return false;
+    spin_bg = lv_color_to_u16(lv_obj_get_style_bg_color(parent, LV_PART_MAIN));
+
+    // 按堆的剩余空间决定帧数
+    uint32_t n = src->header.w;
+    uint32_t size = n * n * 2;
+    for (uint8_t i = 0; i < GUI_COVER_SPIN_CACHE; i++)
+    {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        if (mon.free_biggest_size < size + GUI_COVER_SPIN_HEAP_RESERVE) break;
+
+        uint8_t *data = lv_malloc(size);
+        if (!data) break;
+
+        Spin_Slot *slot = &spin_slot[i];
+        memset(&slot->dsc, 0, sizeof(slot->dsc));
+        slot->dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+        slot->dsc.header.cf = LV_COLOR_FORMAT_RGB565;
+        slot->dsc.header.w = n;
+        slot->dsc.header.h = n;
+        slot->dsc.header.stride = n * 2;
+        slot->dsc.data_size = size;
+        slot->dsc.data = data;
+        slot->index = -1;
+        spin_slots++;
+    }
+    spin_stats.slots = spin_slots;
+    if (!spin_slots) return false;
+
+    spin_img = img;
+    spin_src = src;
+    spin_shown = -1;
+    spin_angle = lv_image_get_rotation(img);
+    lv_image_set_rotation(img, 0);
+    if (spin_slots > 1) spin_timer = lv_timer_create(spin_prefetch_cb, SPIN_PREFETCH_MS, NULL);
+    gui_cover_spin_set_angle(spin_angle);
+    return true;
+}
+
+void gui_cover_spin_set_angle(int32_t angle)
+{
+    if (!spin_slots) return;
+
+    spin_angle = angle;
+    angle %= 3600;
+    if (angle < 0) angle += 3600;
+    int16_t index = (int16_t)(((angle * GUI_COVER_SPIN_FRAMES + 1800) / 3600) % GUI_COVER_SPIN_FRAMES);
+    if (index == spin_shown) return;  // 同一级, 不刷新
+
+    Spin_Slot *slot = &spin_slot[index % spin_slots];
+    if (slot->index == index)
+    {
+        spin_stats.hits++;
+    }
+    else
+    {
+        spin_build(slot, index);
+    }
+    spin_shown = index;
+    lv_image_set_src(spin_img, &slot->dsc);  // 同一个源时 LVGL 也会重绘 (LV_CACHE_DEF_SIZE 为 0, 不缓存解码结果)
+}
+
+void gui_cover_spin_stop(void)
+{
+    if (!spin_slots) return;
+
+    if (spin_timer) lv_timer_delete(spin_timer);
+    spin_timer = NULL;
+
+    lv_image_set_src(spin_img, spin_src);
+    lv_image_set_rotation(spin_img, spin_angle % 3600);
+
+    for (uint8_t i = 0; i < spin_slots; i++)
+    {
+        lv_free((void *)spin_slot[i].dsc.data);
+        spin_slot[i].dsc.data = NULL;
+    }
+    spin_slots = 0;
+    spin_shown = -1;
+    spin_img = NULL;
+}
+
+bool gui_cover_spin_active(void)
+{
+    return spin_slots > 0;
+}
+
+void gui_cover_spin_get_stats(Gui_Cover_Spin_Stats *stats)
+{
+    *stats = spin_stats;
+    stats->slots = spin_slots;
+}
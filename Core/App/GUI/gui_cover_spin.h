@@ -0,0 +1,67 @@
+/*
+ * gui_cover_spin.h
+ * 旋转封面图标的预旋转帧缓存
+ *
+ * lv_image_set_rotation() 让 LVGL 在每次刷新时对整张图做软件变换 (逐像素重采样),
+ * 动画每帧只转很小的角度却要付出完整变换的代价。这里把角度量化为 GUI_COVER_SPIN_FRAMES 级,
+ * 每一级的图像只在第一次用到时旋转一次 (定点双线性插值, 80x80 约 1~2ms), 之后直接作为普通图片显示;
+ * 角度级没有变化时不刷新屏幕。
+ *
+ * 图标是圆形的, 帧裁成内切圆 (边缘抗锯齿) 并预先混合到背景色上, 保存为不透明的 RGB565,
+ * 显示时不需要逐像素混合。帧缓存从 LVGL 堆分配, 张数由 GUI_COVER_SPIN_CACHE 设置,
+ * 堆空间不够时减少张数, 一张都分配不了时返回失败, 调用者继续使用 lv_image_set_rotation()。
+ * 只在 GUI 任务中使用。
+ */
+
+#ifndef GUI_COVER_SPIN_H
+#define GUI_COVER_SPIN_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "../../Gui/lvgl/lvgl.h"
+
+#define GUI_COVER_SPIN_FRAMES 64           // 一圈的角度级数
+#define GUI_COVER_SPIN_CACHE 2             // 最多缓存的帧数 (每帧 w*h*2 字节)
+#define GUI_COVER_SPIN_HEAP_RESERVE 12288  // 分配帧缓存后 LVGL 堆至少保留的连续空间 (弹窗等使用)
+
+    typedef struct
+    {
+        uint8_t slots;    // 实际分配的帧数, 0 表示没有使用缓存
+        uint32_t builds;  // 生成帧的次数
+        uint32_t hits;    // 直接使用已缓存帧的次数
+    } Gui_Cover_Spin_Stats;
+
+    /**
+     * @brief  开始使用帧缓存 (已经开始时直接返回 true)
+     * @param  img: 显示图标的 lv_image, 之后由本模块设置它的图片源
+     * @param  src: 源图, 必须是宽高相等、没有压缩的 RGB565
+     * @retval true: 使用缓存; false: 源图格式不支持、背景不是不透明纯色或内存不够
+     */
+    bool gui_cover_spin_start(lv_obj_t *img, const lv_image_dsc_t *src);
+
+    /**
+     * @brief  显示最接近 angle 的帧
+     * @param  angle: 角度 (0.1 度, 与 lv_image_set_rotation() 相同)
+     */
+    void gui_cover_spin_set_angle(int32_t angle);
+
+    /**
+     * @brief  释放帧缓存, 图片源恢复为原图 (旋转角度为当前角度)
+     */
+    void gui_cover_spin_stop(void);
+
+    /**
+     * @brief  是否正在使用帧缓存
+     */
+    bool gui_cover_spin_active(void);
+
+    void gui_cover_spin_get_stats(Gui_Cover_Spin_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUI_COVER_SPIN_H
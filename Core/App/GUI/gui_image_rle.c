@@ -0,0 +1,315 @@
+/*
+ * gui_image_rle.c
+ * 按行 RLE 压缩图片的解码器: 小缓存 (命中 / 未命中) 与按渲染条带的流式解码
+ *
+ * LVGL 在一个绘制线程中打开、解码和关闭图片, 缓存只在这个线程中修改; 统计可以在任何地方读取。
+ */
+
+#include "gui_image_rle.h"
+#include "../../Gui/lvgl/src/draw/lv_image_decoder_private.h"
+
+#include <string.h>
+
+#ifdef USE_HAL_DRIVER
+// 目标板: DWT 周期计数
+#include "dwt.h"
+
+static inline uint32_t rle_now(void)
+{
+    return DWT_GetCycles();
+}
+
+static inline uint32_t rle_to_us(uint64_t t)
+{
+    return (uint32_t)(t / (SystemCoreClock / 1000000U));
+}
+#else
+// 主机: 单调时钟, 以微秒计
+#include <time.h>
+
+static uint32_t rle_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000U + (uint32_t)(ts.tv_nsec / 1000);
+}
+
+static inline uint32_t rle_to_us(uint64_t t)
+{
+    return (uint32_t)t;
+}
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define RLE_RUN 0x8000U  // 控制字: 重复
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    const lv_image_dsc_t *src;  // NULL 表示空
+    lv_draw_buf_t *buf;
+    uint16_t refs;      // 正在使用的次数, 不为 0 时不能释放
+    uint32_t last_use;  // 最近一次命中的序号 (淘汰最久没有用到的)
+} Rle_Cache_Entry;
+
+/* Private variables ---------------------------------------------------------*/
+static lv_image_decoder_t *rle_decoder = NULL;
+static Rle_Cache_Entry rle_cache[GUI_IMAGE_RLE_CACHE_SLOTS];
+static uint32_t rle_use_count = 0;
+static Gui_Image_Rle_Stats rle_stats;
+static uint64_t rle_decode_time;  // 解压用时累计 (时钟单位, 读取统计时换算)
+
+/* Function implementations --------------------------------------------------*/
+
+/**
+ * @brief  Decode columns x1..x2 of one compressed row
+ */
+static void rle_decode_row(const uint16_t *p, int32_t x1, int32_t x2, uint16_t *out)
+{
+    int32_t x = 0;
+
+    while (x <= x2)
+    {
+        uint16_t ctrl = *p++;
+        int32_t n = ctrl & ~RLE_RUN;
+        int32_t a = (x < x1) ? x1 : x;                  // 本段中需要的第一个像素
+        int32_t b = (x + n - 1 > x2) ? x2 : x + n - 1;  // 本段中需要的最后一个像素
+
+        if (ctrl & RLE_RUN)
+        {
+            uint16_t color = *p++;
+            for (int32_t i = a; i <= b; i++) out[i - x1] = color;
+        }
+        else
+        {
+            if (a <= b) memcpy(&out[a - x1], p + (a - x), (size_t)(b - a + 1) * 2);
+            p += n;
+        }
+        x += n;
+    }
+}
+
+/**
+ * @brief  Decode rows y1..y2, columns x1..x2 into buf (starting at its first row)
+ */
+static void rle_decode(const lv_image_dsc_t *img, const lv_area_t *area, lv_draw_buf_t *buf)
+{
+    const uint16_t *data = (const uint16_t *)img->data;
+    uint32_t start = rle_now();
+
+    for (int32_t y = area->y1; y <= area->y2; y++)
+    {
+        rle_decode_row(data + data[y], area->x1, area->x2,
+                       (uint16_t *)(buf->data + (uint32_t)(y - area->y1) * buf->header.stride));
+    }
+
+    rle_decode_time += rle_now() - start;
+    rle_stats.pixels += (uint32_t)lv_area_get_size(area);
+}
+
+static bool rle_is_valid(const lv_image_dsc_t *img)
+{
+    return (img->header.flags & GUI_IMAGE_RLE_FLAG) && img->header.magic == LV_IMAGE_HEADER_MAGIC &&
+           img->header.cf == LV_COLOR_FORMAT_RGB565 && img->header.w > 0 && img->header.h > 0 && img->data &&
+           img->data_size >= (uint32_t)img->header.h * 2;
+}
+
+static lv_result_t rle_info_cb(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc, lv_image_header_t *header)
+{
+    LV_UNUSED(decoder);
+
+    if (dsc->src_type != LV_IMAGE_SRC_VARIABLE) return LV_RESULT_INVALID;
+
+    const lv_image_dsc_t *img = dsc->src;
+    if (!rle_is_valid(img)) return LV_RESULT_INVALID;
+
+    *header = img->header;
+    header->stride = img->header.w * 2;
+    return LV_RESULT_OK;
+}
+
+/**
+ * @brief  Make room for size bytes by evicting unused entries (最久没有用到的先淘汰)
+ * @retval Free slot, NULL if the image can't be cached now
+ */
+static Rle_Cache_Entry *rle_cache_reserve(uint32_t size)
+{
+    if (size > GUI_IMAGE_RLE_CACHE_MAX || size > GUI_IMAGE_RLE_CACHE_SIZE) return NULL;
+
+    while (1)
+    {
+        Rle_Cache_Entry *free_slot = NULL;
+        Rle_Cache_Entry *victim = NULL;
+
+        for (uint32_t i = 0; i < GUI_IMAGE_RLE_CACHE_SLOTS; i++)
+        {
+            Rle_Cache_Entry *e = &rle_cache[i];
+            if (!e->src)
+            {
+                if (!free_slot) free_slot = e;
+            }
+            else if (!e->refs && (!victim || e->last_use < victim->last_use))
+            {
+                victim = e;
+            }
+        }
+
+        if (free_slot && rle_stats.cache_bytes + size <= GUI_IMAGE_RLE_CACHE_SIZE) return free_slot;
+        if (!victim) return NULL;
+
+        rle_stats.cache_bytes -= victim->buf->data_size;
+        lv_draw_buf_destroy(victim->buf);
+        victim->src = NULL;
+        victim->buf = NULL;
+    }
+}
+
+static lv_result_t rle_open_cb(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+
+    const lv_image_dsc_t *img = dsc->src;
+    lv_area_t full;
+    lv_area_set(&full, 0, 0, img->header.w - 1, img->header.h - 1);
+
+    for (uint32_t i = 0; i < GUI_IMAGE_RLE_CACHE_SLOTS; i++)
+    {
+        Rle_Cache_Entry *e = &rle_cache[i];
+        if (e->src == img)
+        {
+            e->refs++;
+            e->last_use = ++rle_use_count;
+            dsc->decoded = e->buf;
+            rle_stats.hits++;
+            return LV_RESULT_OK;
+        }
+    }
+
+    Rle_Cache_Entry *e = rle_cache_reserve((uint32_t)img->header.w * img->header.h * 2);
+    lv_draw_buf_t *buf = e ? lv_draw_buf_create(img->header.w, img->header.h, LV_COLOR_FORMAT_RGB565,
+                                                LV_STRIDE_AUTO)
+                           : NULL;
+    if (buf)
+    {
+        rle_decode(img, &full, buf);
+        e->src = img;
+        e->buf = buf;
+        e->refs = 1;
+        e->last_use = ++rle_use_count;
+        rle_stats.cache_bytes += buf->data_size;
+        rle_stats.misses++;
+        dsc->decoded = buf;
+        return LV_RESULT_OK;
+    }
+
+    // 流式: decoded 为 NULL 时 LVGL 通过 get_area_cb 逐段取像素, 条带缓冲在第一次取时分配
+    dsc->decoded = NULL;
+    dsc->user_data = NULL;
+    rle_stats.streams++;
+    return LV_RESULT_OK;
+}
+
+static lv_result_t rle_get_area_cb(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc,
+                                   const lv_area_t *full_area, lv_area_t *decoded_area)
+{
+    LV_UNUSED(decoder);
+
+    const lv_image_dsc_t *img = dsc->src;
+    int32_t w = lv_area_get_width(full_area);
+
+    if (decoded_area->y1 == LV_COORD_MIN)
+    {
+        // full_area 已经裁剪到当前渲染条带, 部分渲染时通常只有几行
+        int32_t rows = lv_area_get_height(full_area);
+        if (rows > GUI_IMAGE_RLE_STRIPE_ROWS) rows = GUI_IMAGE_RLE_STRIPE_ROWS;
+
+        lv_draw_buf_t *stripe = lv_draw_buf_reshape(dsc->user_data, LV_COLOR_FORMAT_RGB565, w, rows, LV_STRIDE_AUTO);
+        if (!stripe)
+        {
+            if (dsc->user_data) lv_draw_buf_destroy(dsc->user_data);
+            stripe = lv_draw_buf_create(w, rows, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+            dsc->user_data = stripe;
+            if (!stripe) return LV_RESULT_INVALID;
+        }
+
+        *decoded_area = *full_area;
+        decoded_area->y2 = full_area->y1 + rows - 1;
+    }
+    else
+    {
+        int32_t rows = lv_area_get_height(decoded_area);
+        decoded_area->y1 += rows;
+        decoded_area->y2 += rows;
+    }
+
+    if (decoded_area->y1 > full_area->y2) return LV_RESULT_INVALID;
+    if (decoded_area->y2 > full_area->y2) decoded_area->y2 = full_area->y2;
+    if (full_area->x1 < 0 || full_area->x2 >= img->header.w || full_area->y1 < 0 || full_area->y2 >= img->header.h)
+        return LV_RESULT_INVALID;
+
+    lv_draw_buf_t *stripe = dsc->user_data;
+    stripe->header.h = lv_area_get_height(decoded_area);
+    rle_decode(img, decoded_area, stripe);
+    dsc->decoded = stripe;
+    return LV_RESULT_OK;
+}
+
+static void rle_close_cb(lv_image_decoder_t *decoder, lv_image_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+
+    if (dsc->user_data)
+    {
+        // 流式解码的条带缓冲
+        lv_draw_buf_destroy(dsc->user_data);
+        dsc->user_data = NULL;
+        return;
+    }
+
+    for (uint32_t i = 0; i < GUI_IMAGE_RLE_CACHE_SLOTS; i++)
+    {
+        Rle_Cache_Entry *e = &rle_cache[i];
+        if (e->src && e->buf == dsc->decoded && e->refs)
+        {
+            e->refs--;
+            break;
+        }
+    }
+}
+
+void gui_image_rle_init(void)
+{
+    if (rle_decoder) return;
+
+#ifdef USE_HAL_DRIVER
+    DWT_Init();
+#endif
+
+    rle_decoder = lv_image_decoder_create();  // 插在解码器链表头, 先于内置的 bin 解码器检查
+    lv_image_decoder_set_info_cb(rle_decoder, rle_info_cb);
+    lv_image_decoder_set_open_cb(rle_decoder, rle_open_cb);
+    lv_image_decoder_set_get_area_cb(rle_decoder, rle_get_area_cb);
+    lv_image_decoder_set_close_cb(rle_decoder, rle_close_cb);
+}
+
+void gui_image_rle_cache_drop(void)
+{
+    for (uint32_t i = 0; i < GUI_IMAGE_RLE_CACHE_SLOTS; i++)
+    {
+        Rle_Cache_Entry *e = &rle_cache[i];
+        if (e->src && !e->refs)
+        {
+            rle_stats.cache_bytes -= e->buf->data_size;
+            lv_draw_buf_destroy(e->buf);
+            e->src = NULL;
+            e->buf = NULL;
+        }
+    }
+}
+
+void gui_image_rle_get_stats(Gui_Image_Rle_Stats *stats)
+{
+    *stats = rle_stats;
+    stats->decode_us = rle_to_us(rle_decode_time);
+    stats->kpixel_per_s = stats->decode_us ? (uint32_t)((uint64_t)stats->pixels * 1000 / stats->decode_us) : 0;
+}
@@ -0,0 +1,66 @@
+/*
+ * gui_image_rle.h
+ * 按行 RLE 压缩的 RGB565 图片与对应的 LVGL 解码器
+ *
+ * Core/App/Res 中的图标由 Tools/image_rle/image_rle_tool 从 PNG 或 LVGL 生成的 C 数组转换而来,
+ * 仍然是 lv_image_dsc_t, 用法与原来相同 (LV_IMG_DECLARE + lv_image_set_src), 用 header.flags 中的
+ * GUI_IMAGE_RLE_FLAG 标记。data 的格式 (uint16_t 数组, 小端):
+ *   row_ofs[h]   每一行数据相对 data 开头的偏移 (单位: uint16_t)
+ *   行数据        若干个控制字, 每行正好 w 个像素:
+ *                bit15 = 1: 重复, 后跟 1 个像素, 重复 (ctrl & 0x7FFF) 次
+ *                bit15 = 0: 原样, 后跟 ctrl 个像素
+ * 每行单独编码, 可以直接从任意一行开始解码, 不需要先解压整张图。
+ *
+ * 解码器打开图片时, 缓存中有这张图就直接使用 (命中); 不超过 GUI_IMAGE_RLE_CACHE_MAX 字节的图
+ * 整张解压到缓存 (未命中); 更大的图或缓存分配失败时不占用整张图的内存, 绘制时只把当前渲染条带
+ * 覆盖的行解压到一个最多 GUI_IMAGE_RLE_STRIPE_ROWS 行的小缓冲中 (流式)。
+ * 流式解码不支持旋转和缩放, 需要旋转的图 (如封面图标) 保持原始格式。
+ * 缓存与 LVGL 的图片缓存 (LV_CACHE_DEF_SIZE) 无关, 后者仍然关闭: 它按图片源的地址缓存,
+ * 会让 gui_cover_spin 这类原地改写像素的图片显示旧内容。
+ */
+
+#ifndef GUI_IMAGE_RLE_H
+#define GUI_IMAGE_RLE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "../../Gui/lvgl/lvgl.h"
+
+#define GUI_IMAGE_RLE_FLAG LV_IMAGE_FLAGS_USER1  // header.flags 中的压缩标记 (与转换工具一致)
+
+#define GUI_IMAGE_RLE_CACHE_SIZE 8192   // 解压缓存的总大小 (字节, 从 LVGL 堆分配), 0 表示不缓存
+#define GUI_IMAGE_RLE_CACHE_MAX 8192    // 可以进入缓存的单张图上限 (字节)
+#define GUI_IMAGE_RLE_CACHE_SLOTS 4     // 缓存的图片数上限
+#define GUI_IMAGE_RLE_STRIPE_ROWS 8     // 流式解码一次最多解压的行数
+
+    typedef struct
+    {
+        uint32_t hits;          // 打开时缓存命中
+        uint32_t misses;        // 整张解压后放入缓存
+        uint32_t streams;       // 流式解码
+        uint32_t cache_bytes;   // 当前缓存占用
+        uint32_t pixels;        // 解压的像素数
+        uint32_t decode_us;     // 解压用时
+        uint32_t kpixel_per_s;  // pixels / decode_us, 与 disp_get_flush_stats() 的写屏速度对比
+    } Gui_Image_Rle_Stats;
+
+    /**
+     * @brief  注册解码器 (lv_init() 之后, 创建界面之前调用)
+     */
+    void gui_image_rle_init(void);
+
+    /**
+     * @brief  释放缓存中所有没有在使用的图片 (需要大块 LVGL 堆内存之前调用)
+     */
+    void gui_image_rle_cache_drop(void);
+
+    void gui_image_rle_get_stats(Gui_Image_Rle_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUI_IMAGE_RLE_H
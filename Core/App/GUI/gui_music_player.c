@@ -1,7 +1,14 @@
 #include "gui_music_player.h"
 
 #include "gui_app.h"
+#include "gui_cover_spin.h"
+#include "gui_image_rle.h"
 #include "../Player/music_player.h"
+#include "../Player/audio_eq.h"
+#include "../Player/audio_spectrum.h"
+#include "../Player/music_cover.h"
+#include "../Player/music_lyric.h"
+#include "../Player/music_playlist.h"
 #include <string.h>
 #include "cmsis_os.h"
 
@@ -28,6 +35,40 @@ static lv_anim_t cover_anim;    // 封面旋转动画
 static bool is_playing = false;
 static int32_t current_cover_angle = 0;
 
+// 封面缩略图与标签 (见 music_cover.h)
+#define COVER_Y 100                                         // 封面区域顶部, 区域大小为 MUSIC_COVER_SIZE
+#define COVER_ICON_Y (COVER_Y + (MUSIC_COVER_SIZE - 80) / 2)  // 默认图标 (80x80) 居中
+#define COVER_POLL_MS 200
+static lv_obj_t *label_song_title = NULL;
+static lv_obj_t *label_song_info = NULL;  // 艺术家 - 专辑
+static lv_timer_t *cover_timer = NULL;
+static uint32_t cover_seq = 0;
+static bool cover_has_art = false;  // 显示缩略图时不旋转 (文件图片旋转需要整张解码到 RAM)
+
+// 歌词: 上一行 / 当前行 / 下一行, 换到下一行时三行一起上移一行; 行号不变时不更新标签, 不产生重绘
+#define LYRIC_Y (COVER_Y + MUSIC_COVER_SIZE + 62)
+#define LYRIC_ROWS 3
+#define LYRIC_ROW_H 22
+#define LYRIC_POLL_MS 50
+#define LYRIC_SCROLL_MS 250
+#define LYRIC_UNSHOWN (-2)  // 还没有显示任何一行 (与 MUSIC_LYRIC_NONE 区分)
+static lv_obj_t *lyric_box = NULL;    // 裁剪区域
+static lv_obj_t *lyric_strip = NULL;  // 三行标签的容器, 滚动时移动它
+static lv_obj_t *lyric_rows[LYRIC_ROWS];
+static lv_timer_t *lyric_timer = NULL;
+static uint32_t lyric_song = MUSIC_COVER_NO_TRACK;  // 已加载歌词的曲库序号
+static int32_t lyric_index = LYRIC_UNSHOWN;         // 当前显示的行
+
+// 进度条: 按固定的低频率读取播放位置, 只有像素或秒数变化时才更新控件
+#define PROGRESS_W 400
+#define PROGRESS_POLL_MS 250
+static lv_obj_t *progress_bar = NULL;
+static lv_obj_t *label_curr_time = NULL;
+static lv_obj_t *label_total_time = NULL;
+static lv_timer_t *progress_timer = NULL;
+static uint32_t progress_sec = UINT32_MAX;       // 当前显示的位置 (秒)
+static uint32_t progress_total_sec = UINT32_MAX;  // 当前显示的时长 (秒)
+
 // 音量变量 (0-100)
 static int32_t vol_speaker = 90;
 static int32_t vol_headphone = 90;
@@ -36,9 +77,46 @@ static int32_t vol_headphone = 90;
 static lv_obj_t *label_spk_val = NULL;
 static lv_obj_t *label_hp_val = NULL;
 
+// 均衡器页面
+#define BASS_STEP 2
+static int32_t bass_boost = 0;
+static lv_obj_t *label_bass_val = NULL;
+static lv_obj_t *label_dsp_load = NULL;
+static lv_timer_t *dsp_load_timer = NULL;
+static const char *eq_btnm_map[AUDIO_EQ_PRESET_COUNT + 2];  // 两行预设, 中间为 "\n", 以 "" 结尾
+
+// 频谱柱状图: 只重绘高度变化的柱子
+#define SPECTRUM_W 384
+#define SPECTRUM_H 104
+#define SPECTRUM_BAR_PITCH (SPECTRUM_W / AUDIO_SPECTRUM_BARS)
+#define SPECTRUM_BAR_W (SPECTRUM_BAR_PITCH - 3)
+#define SPECTRUM_FALL 4  // 每帧最多下降的像素, 上升立即跟随
+static lv_obj_t *spectrum = NULL;
+static lv_timer_t *spectrum_timer = NULL;
+static uint8_t spectrum_target[AUDIO_SPECTRUM_BARS];  // 最新频谱对应的高度 (像素)
+static uint8_t spectrum_height[AUDIO_SPECTRUM_BARS];  // 当前显示的高度
+static uint32_t spectrum_seq = 0;
+
+// 歌曲列表: 只创建可见的几行加上下各 SONG_LIST_MARGIN 行, 滚动时按位置重新绑定
+#define SONG_LIST_W 360
+#define SONG_LIST_H 525
+#define SONG_ROW_PITCH 75  // 行距 (按钮高 60 + 间隔)
+#define SONG_LIST_MARGIN 2
+#define SONG_LIST_POOL (SONG_LIST_H / SONG_ROW_PITCH + 1 + 2 * SONG_LIST_MARGIN)
+static lv_obj_t *list_mask = NULL;
+static lv_obj_t *list_cont = NULL;
+static lv_obj_t *list_rows[SONG_LIST_POOL];
+static uint32_t list_row_index[SONG_LIST_POOL];  // 每行当前显示的列表位置
+static uint32_t list_count = 0;
+static lv_style_t list_row_style;
+static lv_style_t list_row_pressed_style;
+static lv_style_t list_row_checked_style;
+static bool list_style_ready = false;
+
 // 前向声明
 static void close_settings_cb(lv_event_t *e);
 static void vol_btn_cb(lv_event_t *e);
+static void eq_page_open(void);
 static void list_event_cb(lv_event_t *e);
 static void close_list_simple_cb(lv_event_t *e);
 static void song_click_simple_cb(lv_event_t *e);
@@ -46,13 +124,269 @@ static void song_click_simple_cb(lv_event_t *e);
 // 音量步进值 (更细的步进，便于调节)
 #define VOL_STEP 15
 
-// 封面旋转动画回调函数
+// 封面旋转动画回调函数: 有帧缓存时显示最接近的预旋转帧, 否则由 LVGL 每次刷新时变换
 static void cover_anim_cb(void *obj, int32_t value)
 {
-    lv_image_set_rotation(obj, value);
+    if (gui_cover_spin_active())
+    {
+        gui_cover_spin_set_angle(value);
+    }
+    else
+    {
+        lv_image_set_rotation(obj, value);
+    }
     current_cover_angle = value;
 }
 
+// 开始旋转: 只有默认图标旋转
+static void cover_spin_start(void)
+{
+    if (cover_has_art) return;
+    if (!gui_cover_spin_active()) gui_image_rle_cache_drop();  // 先让出图标解压缓存, 帧缓存按剩余的堆空间分配
+    gui_cover_spin_start(cover, &music_player);  // 内存不够时返回 false, 退回到 lv_image_set_rotation()
+    int32_t start = current_cover_angle % 3600;
+    lv_anim_set_values(&cover_anim, start, start + 3600);
+    lv_anim_start(&cover_anim);
+}
+
+// 切歌时加载新曲目的歌词
+static void lyric_load(uint32_t id)
+{
+    // 标签引用的是歌词内存中的文字, 释放前先清空
+    for (uint32_t i = 0; i < LYRIC_ROWS; i++) lv_label_set_text_static(lyric_rows[i], "");
+    lv_anim_del(lyric_strip, NULL);
+    lv_obj_set_style_translate_y(lyric_strip, 0, 0);
+
+    Music_Lyric_Load(id);
+    lyric_song = id;
+    lyric_index = LYRIC_UNSHOWN;
+}
+
+static void lyric_scroll_cb(void *obj, int32_t value)
+{
+    lv_obj_set_style_translate_y(obj, value, 0);
+}
+
+// 显示第 index 行: 顺序前进一行时从下方滚动上来, 定位等跳转直接切换
+static void lyric_show(int32_t index)
+{
+    bool scroll = (lyric_index != LYRIC_UNSHOWN && index == lyric_index + 1);
+
+    for (uint32_t i = 0; i < LYRIC_ROWS; i++)
+    {
+        lv_label_set_text_static(lyric_rows[i], Music_Lyric_GetText(index - 1 + (int32_t)i));
+    }
+    lyric_index = index;
+
+    lv_anim_del(lyric_strip, NULL);
+    if (!scroll)
+    {
+        lv_obj_set_style_translate_y(lyric_strip, 0, 0);
+        return;
+    }
+
+    // 新的三行先下移一行 (看起来与换行前相同), 再移回原位
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, lyric_strip);
+    lv_anim_set_exec_cb(&a, lyric_scroll_cb);
+    lv_anim_set_values(&a, LYRIC_ROW_H, 0);
+    lv_anim_set_time(&a, LYRIC_SCROLL_MS);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_start(&a);
+}
+
+// 歌词刷新: 按播放位置二分查找当前行, 只有行号变化时才更新
+static void lyric_timer_cb(lv_timer_t *t)
+{
+    if (!lyric_strip) return;
+
+    int32_t index = Music_Lyric_Find(music_player_get_position_ms());
+    if (index != lyric_index) lyric_show(index);
+}
+
+static void lyric_delete_cb(lv_event_t *e)
+{
+    if (lyric_timer)
+    {
+        lv_timer_delete(lyric_timer);
+        lyric_timer = NULL;
+    }
+    Music_Lyric_Unload();
+    lyric_song = MUSIC_COVER_NO_TRACK;
+    lyric_box = NULL;
+    lyric_strip = NULL;
+}
+
+// 封面刷新: 有新结果时更新标签, 缩略图生成后切换图片源; 曲目变化时加载歌词
+static void cover_timer_cb(lv_timer_t *t)
+{
+    Music_Cover_Info info;
+
+    if (!cover || !Music_Cover_Read(&info, &cover_seq)) return;
+
+    if (lyric_strip && info.id != MUSIC_COVER_NO_TRACK && info.id != lyric_song) lyric_load(info.id);
+
+    const char *title = info.title[0] ? info.title : music_player_get_currentName();
+    lv_label_set_text(label_song_title, title ? title : "");
+    if (info.artist[0] && info.album[0])
+    {
+        lv_label_set_text_fmt(label_song_info, "%s - %s", info.artist, info.album);
+    }
+    else
+    {
+        lv_label_set_text(label_song_info, info.artist[0] ? info.artist : info.album);
+    }
+
+    bool has_art = (info.state == MUSIC_COVER_READY);
+    if (has_art)
+    {
+        lv_anim_del(cover, NULL);
+        gui_cover_spin_stop();
+        lv_image_set_rotation(cover, 0);
+        lv_image_set_src(cover, info.path);
+        lv_obj_align(cover, LV_ALIGN_TOP_MID, 0, COVER_Y);
+    }
+    else if (cover_has_art)
+    {
+        lv_image_set_src(cover, &music_player);
+        lv_obj_align(cover, LV_ALIGN_TOP_MID, 0, COVER_ICON_Y);
+    }
+    if (has_art == cover_has_art) return;
+
+    cover_has_art = has_art;
+    if (!has_art && is_playing) cover_spin_start();
+}
+
+static void cover_delete_cb(lv_event_t *e)
+{
+    gui_cover_spin_stop();
+    if (cover_timer)
+    {
+        lv_timer_delete(cover_timer);
+        cover_timer = NULL;
+    }
+    cover = NULL;
+}
+
+static void progress_format(lv_obj_t *label, uint32_t sec)
+{
+    lv_label_set_text_fmt(label, "%02lu:%02lu", (unsigned long)(sec / 60), (unsigned long)(sec % 60));
+}
+
+// 进度刷新: 位置来自 DMA 采样计数 (music_player_get_position_ms), 不读取文件偏移
+static void progress_timer_cb(lv_timer_t *t)
+{
+    if (!progress_bar) return;
+
+    uint32_t duration = music_player_get_duration_ms();
+    uint32_t position = music_player_get_position_ms();
+
+    uint32_t total_sec = duration / 1000;
+    if (total_sec != progress_total_sec)
+    {
+        progress_total_sec = total_sec;
+        if (duration > 0)
+        {
+            progress_format(label_total_time, total_sec);
+        }
+        else
+        {
+            lv_label_set_text(label_total_time, "--:--");
+        }
+    }
+
+    uint32_t sec = position / 1000;
+    if (sec != progress_sec)
+    {
+        progress_sec = sec;
+        progress_format(label_curr_time, sec);
+    }
+
+    // 值与像素一一对应, 值不变时 lv_bar_set_value 不会使控件失效
+    int32_t value = (duration > 0) ? (int32_t)((uint64_t)position * PROGRESS_W / duration) : 0;
+    lv_bar_set_value(progress_bar, value, LV_ANIM_OFF);
+}
+
+static void progress_delete_cb(lv_event_t *e)
+{
+    if (progress_timer)
+    {
+        lv_timer_delete(progress_timer);
+        progress_timer = NULL;
+    }
+    progress_bar = NULL;
+}
+
+// 第 i 根柱子高度为 h 时的区域 (屏幕坐标)
+static void spectrum_bar_area(uint32_t i, int32_t h, lv_area_t *area)
+{
+    lv_area_t coords;
+    lv_obj_get_coords(spectrum, &coords);
+    area->x1 = coords.x1 + (int32_t)i * SPECTRUM_BAR_PITCH;
+    area->x2 = area->x1 + SPECTRUM_BAR_W - 1;
+    area->y2 = coords.y2;
+    area->y1 = coords.y2 - h + 1;
+}
+
+// 频谱绘制: 只画非零的柱子, 其余区域由背景覆盖
+static void spectrum_draw_cb(lv_event_t *e)
+{
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_palette_main(LV_PALETTE_BLUE);
+    dsc.bg_opa = LV_OPA_COVER;
+
+    for (uint32_t i = 0; i < AUDIO_SPECTRUM_BARS; i++)
+    {
+        if (spectrum_height[i] == 0) continue;
+        lv_area_t area;
+        spectrum_bar_area(i, spectrum_height[i], &area);
+        lv_draw_rect(layer, &dsc, &area);
+    }
+}
+
+// 频谱刷新: 读取音频任务发布的结果, 按下降速度更新高度, 只使变化的柱子失效
+static void spectrum_timer_cb(lv_timer_t *t)
+{
+    uint8_t level[AUDIO_SPECTRUM_BARS];
+
+    if (!spectrum) return;
+    if (Audio_Spectrum_Read(level, &spectrum_seq))
+    {
+        for (uint32_t i = 0; i < AUDIO_SPECTRUM_BARS; i++)
+        {
+            spectrum_target[i] = (uint8_t)(level[i] * SPECTRUM_H / AUDIO_SPECTRUM_LEVEL_MAX);
+        }
+    }
+
+    for (uint32_t i = 0; i < AUDIO_SPECTRUM_BARS; i++)
+    {
+        int32_t old_h = spectrum_height[i];
+        int32_t new_h = old_h - SPECTRUM_FALL;
+        if (new_h < spectrum_target[i]) new_h = spectrum_target[i];
+        if (new_h < 0) new_h = 0;
+        if (new_h == old_h) continue;
+
+        // 失效区域取新旧高度中较高的那个, 覆盖变长或变短的部分
+        lv_area_t area;
+        spectrum_bar_area(i, LV_MAX(old_h, new_h), &area);
+        spectrum_height[i] = (uint8_t)new_h;
+        lv_obj_invalidate_area(spectrum, &area);
+    }
+}
+
+static void spectrum_delete_cb(lv_event_t *e)
+{
+    if (spectrum_timer)
+    {
+        lv_timer_delete(spectrum_timer);
+        spectrum_timer = NULL;
+    }
+    spectrum = NULL;
+}
+
 static void back_event_cb(lv_event_t *e)
 {
     lv_event_code_t code = lv_event_get_code(e);
@@ -73,9 +407,7 @@ static void play_event_cb(lv_event_t *e)
         if (is_playing)
         {
             lv_image_set_src(img_play, &pause_btn);
-            int32_t start = current_cover_angle % 3600;
-            lv_anim_set_values(&cover_anim, start, start + 3600);
-            lv_anim_start(&cover_anim);
+            cover_spin_start();
             if (music_player_get_currentName()) event.type = MUSIC_RESUME;
         }
         else
@@ -98,10 +430,9 @@ static void close_list_simple_cb(lv_event_t *e)
 // 简单的歌曲点击回调
 static void song_click_simple_cb(lv_event_t *e)
 {
-    int index = (int)(intptr_t)lv_event_get_user_data(e);
+    lv_obj_t *row = lv_event_get_current_target(e);
+    uint32_t index = (uint32_t)(uintptr_t)lv_obj_get_user_data(row);
 
-    // 设置当前歌曲名称
-    // strcpy(music_player_get_currentName(), song->name);
     music_player_set_currentIndex(index);
     Music_Event event = {0};
     event.type = MUSIC_RELOAD;
@@ -111,17 +442,10 @@ static void song_click_simple_cb(lv_event_t *e)
     lv_image_set_src(img_play, &pause_btn);
 
     // 旋转动画
-    int32_t start = current_cover_angle % 3600;
-    lv_anim_set_values(&cover_anim, start, start + 3600);
-    lv_anim_start(&cover_anim);
+    cover_spin_start();
 
-    // 关闭列表弹窗（新层级：按钮 -> 遮罩）
-    lv_obj_t *btn = lv_event_get_target(e);
-    if (btn)
-    {
-        lv_obj_t *mask = lv_obj_get_parent(btn);
-        if (mask) lv_obj_del(mask);
-    }
+    // 关闭列表弹窗 (行 -> 列表 -> 遮罩), 在事件处理结束后删除
+    if (list_mask) lv_obj_del_async(list_mask);
 }
 
 // 音量按钮回调 (+/-)
@@ -160,6 +484,149 @@ static void vol_btn_cb(lv_event_t *e)
     osMessageQueuePut(music_eventQueueHandle, &event, 0, 0);
 }
 
+// 均衡器预设按钮矩阵回调
+static void eq_preset_cb(lv_event_t *e)
+{
+    lv_obj_t *btnm = lv_event_get_target(e);
+    uint32_t id = lv_buttonmatrix_get_selected_button(btnm);
+    if (id == LV_BUTTONMATRIX_BUTTON_NONE || id >= AUDIO_EQ_PRESET_COUNT) return;
+
+    Music_Event event = {0};
+    event.type = MUSIC_SET_EQ_PRESET;
+    event.param = (uint8_t)id;
+    osMessageQueuePut(music_eventQueueHandle, &event, 0, 0);
+}
+
+// 低音增强按钮回调 (+/-)
+static void bass_btn_cb(lv_event_t *e)
+{
+    int is_increase = (int)(intptr_t)lv_event_get_user_data(e);
+
+    bass_boost += is_increase ? BASS_STEP : -BASS_STEP;
+    if (bass_boost > AUDIO_EQ_MAX_BASS_DB) bass_boost = AUDIO_EQ_MAX_BASS_DB;
+    if (bass_boost < 0) bass_boost = 0;
+
+    if (label_bass_val) lv_label_set_text_fmt(label_bass_val, "+%d dB", (int)bass_boost);
+
+    Music_Event event = {0};
+    event.type = MUSIC_SET_BASS_BOOST;
+    event.param = (uint8_t)bass_boost;
+    osMessageQueuePut(music_eventQueueHandle, &event, 0, 0);
+}
+
+// 刷新解码 / DSP 占用
+static void dsp_load_timer_cb(lv_timer_t *t)
+{
+    Music_DSP_Stats stats;
+    music_player_get_dsp_stats(&stats);
+
+    if (!label_dsp_load) return;
+    lv_label_set_text_fmt(label_dsp_load, "Decoder %d.%d%%  DSP %d.%d%%  Bands %d\n%s", stats.decoder_load / 10,
+                          stats.decoder_load % 10, stats.dsp_load / 10, stats.dsp_load % 10, stats.eq_bands,
+                          stats.overload ? "EQ bypassed: over CPU budget" : "");
+}
+
+// 均衡器页面关闭时释放定时器
+static void eq_page_delete_cb(lv_event_t *e)
+{
+    if (dsp_load_timer)
+    {
+        lv_timer_delete(dsp_load_timer);
+        dsp_load_timer = NULL;
+    }
+    label_bass_val = NULL;
+    label_dsp_load = NULL;
+}
+
+// 设置弹窗中的 "Equalizer" 按钮: 关闭设置弹窗, 打开均衡器页面
+static void eq_open_cb(lv_event_t *e)
+{
+    lv_obj_t *mask = (lv_obj_t *)lv_event_get_user_data(e);
+    if (mask) lv_obj_del_async(mask);
+    eq_page_open();
+}
+
+// 均衡器页面: 预设选择 + 低音增强 + CPU 占用
+static void eq_page_open(void)
+{
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < AUDIO_EQ_PRESET_COUNT; i++)
+    {
+        if (i == AUDIO_EQ_PRESET_COUNT / 2) eq_btnm_map[n++] = "\n";
+        eq_btnm_map[n++] = Audio_EQ_GetPresetName((Audio_EQ_Preset)i);
+    }
+    eq_btnm_map[n] = "";
+    bass_boost = music_player_get_bass_boost();
+
+    // 1. 全屏半透明遮罩, 点击空白处关闭
+    lv_obj_t *mask = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(mask, 480, 800);
+    lv_obj_set_style_bg_opa(mask, LV_OPA_50, 0);
+    lv_obj_set_style_bg_color(mask, lv_color_black(), 0);
+    lv_obj_set_style_border_width(mask, 0, 0);
+    lv_obj_add_event_cb(mask, close_settings_cb, LV_EVENT_CLICKED, mask);
+    lv_obj_add_event_cb(mask, eq_page_delete_cb, LV_EVENT_DELETE, NULL);
+
+    // 2. 面板
+    lv_obj_t *panel = lv_obj_create(mask);
+    lv_obj_set_size(panel, 440, 360);
+    lv_obj_center(panel);
+    lv_obj_set_style_bg_color(panel, lv_color_white(), 0);
+    lv_obj_set_style_radius(panel, 20, 0);
+    lv_obj_clear_flag(panel, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *title = lv_label_create(panel);
+    lv_label_set_text(title, "Equalizer");
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 0);
+
+    // 预设: 单选按钮矩阵
+    lv_obj_t *btnm = lv_buttonmatrix_create(panel);
+    lv_buttonmatrix_set_map(btnm, eq_btnm_map);
+    lv_buttonmatrix_set_button_ctrl_all(btnm, LV_BUTTONMATRIX_CTRL_CHECKABLE);
+    lv_buttonmatrix_set_one_checked(btnm, true);
+    lv_buttonmatrix_set_button_ctrl(btnm, music_player_get_eq_preset(), LV_BUTTONMATRIX_CTRL_CHECKED);
+    lv_obj_set_size(btnm, 400, 130);
+    lv_obj_align(btnm, LV_ALIGN_TOP_MID, 0, 30);
+    lv_obj_add_event_cb(btnm, eq_preset_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    // 低音增强: [-] [值] [+]
+    lv_obj_t *label_bass = lv_label_create(panel);
+    lv_label_set_text(label_bass, "Bass Boost");
+    lv_obj_align(label_bass, LV_ALIGN_TOP_LEFT, 10, 190);
+
+    lv_obj_t *btn_dec = lv_btn_create(panel);
+    lv_obj_set_size(btn_dec, 50, 40);
+    lv_obj_align(btn_dec, LV_ALIGN_TOP_RIGHT, -150, 180);
+    lv_obj_t *lbl = lv_label_create(btn_dec);
+    lv_label_set_text(lbl, "-");
+    lv_obj_center(lbl);
+    lv_obj_add_event_cb(btn_dec, bass_btn_cb, LV_EVENT_CLICKED, (void *)(intptr_t)0);
+
+    label_bass_val = lv_label_create(panel);
+    lv_label_set_text_fmt(label_bass_val, "+%d dB", (int)bass_boost);
+    lv_obj_set_style_text_align(label_bass_val, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_width(label_bass_val, 70);
+    lv_obj_align(label_bass_val, LV_ALIGN_TOP_RIGHT, -75, 190);
+
+    lv_obj_t *btn_inc = lv_btn_create(panel);
+    lv_obj_set_size(btn_inc, 50, 40);
+    lv_obj_align(btn_inc, LV_ALIGN_TOP_RIGHT, -10, 180);
+    lbl = lv_label_create(btn_inc);
+    lv_label_set_text(lbl, "+");
+    lv_obj_center(lbl);
+    lv_obj_add_event_cb(btn_inc, bass_btn_cb, LV_EVENT_CLICKED, (void *)(intptr_t)1);
+
+    // CPU 占用 (每 500ms 刷新)
+    label_dsp_load = lv_label_create(panel);
+    lv_obj_set_style_text_color(label_dsp_load, lv_color_hex(0x606060), 0);
+    lv_obj_align(label_dsp_load, LV_ALIGN_TOP_LEFT, 10, 250);
+    dsp_load_timer = lv_timer_create(dsp_load_timer_cb, 500, NULL);
+    dsp_load_timer_cb(dsp_load_timer);
+
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_EVENT_BUBBLE);
+}
+
 // 下一首按钮回调
 static void next_cb(lv_event_t *e)
 {
@@ -203,7 +670,7 @@ static void settings_event_cb(lv_event_t *e)
 
         // 2. 创建设置面板 (Panel)
         lv_obj_t *panel = lv_obj_create(mask);
-        lv_obj_set_size(panel, 360, 280);
+        lv_obj_set_size(panel, 360, 330);
         lv_obj_center(panel);
         lv_obj_set_style_bg_color(panel, lv_color_white(), 0);
         lv_obj_set_style_radius(panel, 20, 0);
@@ -272,11 +739,117 @@ static void settings_event_cb(lv_event_t *e)
         lv_obj_add_event_cb(btn_hp_inc, vol_btn_cb, LV_EVENT_CLICKED,
                             (void *)(intptr_t)(0x0001));  // headphone=0, inc=1
 
+        // --- 均衡器入口 ---
+        lv_obj_t *btn_eq = lv_btn_create(panel);
+        lv_obj_set_size(btn_eq, 200, 40);
+        lv_obj_align(btn_eq, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lbl = lv_label_create(btn_eq);
+        lv_label_set_text(lbl, "Equalizer");
+        lv_obj_center(lbl);
+        lv_obj_add_event_cb(btn_eq, eq_open_cb, LV_EVENT_CLICKED, mask);
+
         // 阻止点击面板时触发遮罩的关闭事件
         lv_obj_add_flag(panel, LV_OBJ_FLAG_EVENT_BUBBLE);
     }
 }
 
+// 把列表位置 index 绑定到一行 (位置、文字、当前歌曲高亮)
+static void song_list_bind_row(lv_obj_t *row, uint32_t index)
+{
+    MusicSong_TypeDef song;
+    lv_obj_t *label = lv_obj_get_child(row, 0);
+
+    lv_obj_set_y(row, (int32_t)(index * SONG_ROW_PITCH));
+    lv_obj_set_user_data(row, (void *)(uintptr_t)index);
+    if (Music_Playlist_Get(index, &song) == 0)
+    {
+        lv_label_set_text_fmt(label, LV_SYMBOL_AUDIO " %s", song.name);
+    }
+    else
+    {
+        lv_label_set_text(label, LV_SYMBOL_AUDIO " ...");
+    }
+
+    if (index == music_player_get_currentIndex())
+    {
+        lv_obj_add_state(row, LV_STATE_CHECKED);
+    }
+    else
+    {
+        lv_obj_remove_state(row, LV_STATE_CHECKED);
+    }
+}
+
+// 按滚动位置重新分配各行: 位置 i 总是由第 i % SONG_LIST_POOL 行显示, 已经绑定的行不重复读取
+static void song_list_update(void)
+{
+    int32_t first = lv_obj_get_scroll_y(list_cont) / SONG_ROW_PITCH - SONG_LIST_MARGIN;
+    if (first < 0) first = 0;
+
+    for (uint32_t i = 0; i < SONG_LIST_POOL; i++)
+    {
+        uint32_t index = (uint32_t)first + i;
+        lv_obj_t *row = list_rows[index % SONG_LIST_POOL];
+        uint32_t *bound = &list_row_index[index % SONG_LIST_POOL];
+
+        if (index >= list_count)
+        {
+            lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+            *bound = UINT32_MAX;
+            continue;
+        }
+        if (*bound != index)
+        {
+            song_list_bind_row(row, index);
+            *bound = index;
+        }
+        lv_obj_remove_flag(row, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void song_list_event_cb(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_SCROLL)
+    {
+        song_list_update();
+    }
+    else if (code == LV_EVENT_GET_SELF_SIZE)
+    {
+        // 内容高度由曲目数决定, 不依赖子对象, 滚动条和惯性滚动按完整列表计算
+        lv_point_t *size = lv_event_get_param(e);
+        int32_t h = (int32_t)(list_count * SONG_ROW_PITCH);
+        if (size->y < h) size->y = h;
+    }
+    else if (code == LV_EVENT_DELETE)
+    {
+        list_cont = NULL;
+        list_mask = NULL;
+    }
+}
+
+static void song_list_init_styles(void)
+{
+    if (list_style_ready) return;
+
+    lv_style_init(&list_row_style);
+    lv_style_set_radius(&list_row_style, 12);
+    lv_style_set_bg_color(&list_row_style, lv_palette_main(LV_PALETTE_BLUE));
+    lv_style_set_bg_grad_color(&list_row_style, lv_palette_darken(LV_PALETTE_BLUE, 2));
+    lv_style_set_bg_grad_dir(&list_row_style, LV_GRAD_DIR_HOR);
+    lv_style_set_text_color(&list_row_style, lv_color_white());
+
+    lv_style_init(&list_row_pressed_style);
+    lv_style_set_bg_color(&list_row_pressed_style, lv_palette_darken(LV_PALETTE_BLUE, 3));
+
+    lv_style_init(&list_row_checked_style);
+    lv_style_set_bg_color(&list_row_checked_style, lv_palette_main(LV_PALETTE_ORANGE));
+    lv_style_set_bg_grad_color(&list_row_checked_style, lv_palette_darken(LV_PALETTE_ORANGE, 2));
+
+    list_style_ready = true;
+}
+
 // 音乐列表回调：美观且轻量
 static void list_event_cb(lv_event_t *e)
 {
@@ -292,6 +865,7 @@ static void list_event_cb(lv_event_t *e)
         lv_obj_set_style_bg_opa(mask, LV_OPA_80, 0);
         lv_obj_set_style_border_width(mask, 0, 0);
         lv_obj_set_style_pad_all(mask, 0, 0);
+        lv_obj_clear_flag(mask, LV_OBJ_FLAG_SCROLLABLE);
         lv_obj_add_event_cb(mask, close_list_simple_cb, LV_EVENT_CLICKED, mask);
 
         // 标题
@@ -305,36 +879,48 @@ static void list_event_cb(lv_event_t *e)
         lv_obj_set_style_text_color(title, lv_color_white(), 0);
         lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 150);
 
-        // 创建3个按钮
-        int y_start = 220;
-        const MusicSong_TypeDef *playlist = music_player_get_playlist();
-        for (int i = 0; i < music_player_get_song_count(); i++)
+        // 滚动容器: 只有 SONG_LIST_POOL 个按钮, 内容高度按曲目数报告 (见 song_list_event_cb)
+        song_list_init_styles();
+        list_count = music_player_get_song_count();
+        list_mask = mask;
+        list_cont = lv_obj_create(mask);
+        lv_obj_set_size(list_cont, SONG_LIST_W, SONG_LIST_H);
+        lv_obj_align(list_cont, LV_ALIGN_TOP_MID, 0, 200);
+        lv_obj_set_style_bg_opa(list_cont, LV_OPA_TRANSP, 0);
+        lv_obj_set_style_border_width(list_cont, 0, 0);
+        lv_obj_set_style_pad_all(list_cont, 0, 0);
+        lv_obj_set_scroll_dir(list_cont, LV_DIR_VER);
+        lv_obj_add_event_cb(list_cont, song_list_event_cb, LV_EVENT_ALL, NULL);
+
+        for (uint32_t i = 0; i < SONG_LIST_POOL; i++)
         {
-            lv_obj_t *btn = lv_btn_create(mask);
-            if (!btn) break;
+            lv_obj_t *btn = lv_btn_create(list_cont);
+            lv_obj_remove_style_all(btn);
+            lv_obj_add_style(btn, &list_row_style, 0);
+            lv_obj_add_style(btn, &list_row_pressed_style, LV_STATE_PRESSED);
+            lv_obj_add_style(btn, &list_row_checked_style, LV_STATE_CHECKED);
+            lv_obj_set_size(btn, SONG_LIST_W - 20, SONG_ROW_PITCH - 15);
+            lv_obj_set_x(btn, 10);
+            lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_add_event_cb(btn, song_click_simple_cb, LV_EVENT_CLICKED, NULL);
 
-            lv_obj_set_size(btn, 340, 60);
-            lv_obj_set_pos(btn, 70, y_start + i * 75);
-            lv_obj_set_style_radius(btn, 12, 0);
+            lv_obj_t *label = lv_label_create(btn);
+            lv_obj_set_width(label, SONG_LIST_W - 40);
+            lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+            lv_obj_center(label);
 
-            lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_BLUE), LV_PART_MAIN);
-            lv_obj_set_style_bg_grad_color(btn, lv_palette_darken(LV_PALETTE_BLUE, 2), LV_PART_MAIN);
-            lv_obj_set_style_bg_grad_dir(btn, LV_GRAD_DIR_HOR, LV_PART_MAIN);
-            lv_obj_set_style_bg_color(btn, lv_palette_darken(LV_PALETTE_BLUE, 3), LV_STATE_PRESSED);
-            // 直接传递下标即可 ，不用传递MusicSong_TypeDef
-            lv_obj_add_event_cb(btn, song_click_simple_cb, LV_EVENT_CLICKED, (void *)(intptr_t)i);
+            list_rows[i] = btn;
+            list_row_index[i] = UINT32_MAX;
+        }
 
-            // 单个标签显示所有信息
-            lv_obj_t *label = lv_label_create(btn);
-            if (label)
-            {
-                char text[64];
-                lv_snprintf(text, sizeof(text), LV_SYMBOL_AUDIO "%s", playlist[i].name);
-                lv_label_set_text(label, text);
-                lv_obj_set_style_text_color(label, lv_color_white(), 0);
-                lv_obj_center(label);
-            }
+        // 打开时滚动到当前歌曲
+        lv_obj_refresh_self_size(list_cont);
+        uint32_t current = music_player_get_currentIndex();
+        if (current < list_count)
+        {
+            lv_obj_scroll_to_y(list_cont, (int32_t)(current * SONG_ROW_PITCH), LV_ANIM_OFF);
         }
+        song_list_update();
     }
 }
 
@@ -384,7 +970,8 @@ void gui_music_player_open(void)
     // --- 4. 封面 ---
     cover = lv_image_create(scr_player);
     lv_image_set_src(cover, &music_player);
-    lv_obj_align(cover, LV_ALIGN_TOP_MID, 0, 150);
+    lv_obj_align(cover, LV_ALIGN_TOP_MID, 0, COVER_ICON_Y);
+    lv_obj_add_event_cb(cover, cover_delete_cb, LV_EVENT_DELETE, NULL);
 
     lv_anim_init(&cover_anim);
     lv_anim_set_var(&cover_anim, cover);
@@ -393,24 +980,95 @@ void gui_music_player_open(void)
     lv_anim_set_time(&cover_anim, 10000);
     lv_anim_set_repeat_count(&cover_anim, LV_ANIM_REPEAT_INFINITE);
 
+    // --- 4.1 歌曲标签 (标题 / 艺术家 - 专辑), 由封面任务读取 ---
+    label_song_title = lv_label_create(scr_player);
+    lv_obj_set_width(label_song_title, 400);
+    lv_label_set_long_mode(label_song_title, LV_LABEL_LONG_DOT);
+    lv_obj_set_style_text_align(label_song_title, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_text_color(label_song_title, lv_color_black(), 0);
+    lv_label_set_text(label_song_title, "");
+    lv_obj_align(label_song_title, LV_ALIGN_TOP_MID, 0, COVER_Y + MUSIC_COVER_SIZE + 12);
+
+    label_song_info = lv_label_create(scr_player);
+    lv_obj_set_width(label_song_info, 400);
+    lv_label_set_long_mode(label_song_info, LV_LABEL_LONG_DOT);
+    lv_obj_set_style_text_align(label_song_info, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_text_color(label_song_info, lv_palette_main(LV_PALETTE_GREY), 0);
+    lv_label_set_text(label_song_info, "");
+    lv_obj_align(label_song_info, LV_ALIGN_TOP_MID, 0, COVER_Y + MUSIC_COVER_SIZE + 40);
+
+    // --- 4.2 歌词 ---
+    // 裁剪区域只显示三行; 滚动动画只移动容器, 重绘范围限于这块区域
+    lyric_box = lv_obj_create(scr_player);
+    lv_obj_remove_style_all(lyric_box);
+    lv_obj_set_size(lyric_box, 400, LYRIC_ROWS * LYRIC_ROW_H);
+    lv_obj_align(lyric_box, LV_ALIGN_TOP_MID, 0, LYRIC_Y);
+    lv_obj_clear_flag(lyric_box, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(lyric_box, lyric_delete_cb, LV_EVENT_DELETE, NULL);
+
+    lyric_strip = lv_obj_create(lyric_box);
+    lv_obj_remove_style_all(lyric_strip);
+    lv_obj_set_size(lyric_strip, 400, LYRIC_ROWS * LYRIC_ROW_H);
+    lv_obj_clear_flag(lyric_strip, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    for (uint32_t i = 0; i < LYRIC_ROWS; i++)
+    {
+        lv_obj_t *row = lv_label_create(lyric_strip);
+        lv_obj_set_width(row, 400);
+        lv_obj_set_pos(row, 0, (int32_t)i * LYRIC_ROW_H + (LYRIC_ROW_H - 16) / 2);
+        lv_label_set_long_mode(row, LV_LABEL_LONG_DOT);
+        lv_obj_set_style_text_align(row, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_set_style_text_color(row, (i == 1) ? lv_color_black() : lv_palette_main(LV_PALETTE_GREY), 0);
+        lv_label_set_text_static(row, "");
+        lyric_rows[i] = row;
+    }
+    lyric_song = MUSIC_COVER_NO_TRACK;
+    lyric_index = LYRIC_UNSHOWN;
+    lyric_timer = lv_timer_create(lyric_timer_cb, LYRIC_POLL_MS, NULL);
+
+    cover_has_art = false;
+    cover_seq = 0;
+    cover_timer = lv_timer_create(cover_timer_cb, COVER_POLL_MS, NULL);
+    cover_timer_cb(cover_timer);
+
+    // --- 4.3 频谱 ---
+    // 不带样式的空对象, 只在 DRAW_MAIN 中画柱子; 刷新时按柱子使局部区域失效, 不会整屏重绘
+    spectrum = lv_obj_create(scr_player);
+    lv_obj_remove_style_all(spectrum);
+    lv_obj_set_size(spectrum, SPECTRUM_W, SPECTRUM_H);
+    lv_obj_set_pos(spectrum, (480 - SPECTRUM_W) / 2, LYRIC_Y + LYRIC_ROWS * LYRIC_ROW_H + 8);
+    lv_obj_clear_flag(spectrum, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(spectrum, spectrum_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(spectrum, spectrum_delete_cb, LV_EVENT_DELETE, NULL);
+    memset(spectrum_target, 0, sizeof(spectrum_target));
+    memset(spectrum_height, 0, sizeof(spectrum_height));
+    spectrum_timer = lv_timer_create(spectrum_timer_cb, 1000 / AUDIO_SPECTRUM_MAX_FPS, NULL);
+
     // --- 5. 进度条 ---
-    lv_obj_t *slider = lv_slider_create(scr_player);
-    lv_obj_set_size(slider, 400, 10);
-    lv_obj_set_pos(slider, (480 - 400) / 2, 550);
-    lv_obj_set_style_bg_color(slider, lv_palette_lighten(LV_PALETTE_GREY, 2), LV_PART_MAIN);
-    lv_obj_set_style_bg_color(slider, lv_palette_main(LV_PALETTE_BLUE), LV_PART_INDICATOR);
-    lv_obj_remove_style(slider, NULL, LV_PART_KNOB);
-
-    lv_obj_t *label_curr_time = lv_label_create(scr_player);
+    // 只显示进度 (不响应触摸), 范围与宽度相同
+    progress_bar = lv_bar_create(scr_player);
+    lv_obj_set_size(progress_bar, PROGRESS_W, 10);
+    lv_obj_set_pos(progress_bar, (480 - PROGRESS_W) / 2, 550);
+    lv_bar_set_range(progress_bar, 0, PROGRESS_W);
+    lv_obj_set_style_bg_color(progress_bar, lv_palette_lighten(LV_PALETTE_GREY, 2), LV_PART_MAIN);
+    lv_obj_set_style_bg_color(progress_bar, lv_palette_main(LV_PALETTE_BLUE), LV_PART_INDICATOR);
+    lv_obj_add_event_cb(progress_bar, progress_delete_cb, LV_EVENT_DELETE, NULL);
+
+    label_curr_time = lv_label_create(scr_player);
     lv_label_set_text(label_curr_time, "00:00");
     lv_obj_set_pos(label_curr_time, 40, 570);
     lv_obj_set_style_text_color(label_curr_time, lv_color_black(), 0);
 
-    lv_obj_t *label_total_time = lv_label_create(scr_player);
-    lv_label_set_text(label_total_time, "03:45");
+    label_total_time = lv_label_create(scr_player);
+    lv_label_set_text(label_total_time, "--:--");
     lv_obj_set_pos(label_total_time, 480 - 40 - 50, 570);
     lv_obj_set_style_text_color(label_total_time, lv_color_black(), 0);
 
+    progress_sec = UINT32_MAX;
+    progress_total_sec = UINT32_MAX;
+    progress_timer = lv_timer_create(progress_timer_cb, PROGRESS_POLL_MS, NULL);
+    progress_timer_cb(progress_timer);
+
     // --- 6. 控制按钮 ---
     // 播放 (居中)
     btn_play = lv_btn_create(scr_player);
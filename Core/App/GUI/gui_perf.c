@@ -0,0 +1,366 @@
+/*
+ * gui_perf.c
+ * GUI 性能统计: 显示事件计时、环形缓冲区、任务占用与屏幕统计层
+ *
+ * 一次刷新中 flush_cb 可能被调用多次 (部分渲染时每块缓冲一次), 等待 flush 也可能发生多次,
+ * 两者分别累加; 剩下的时间是布局与绘制。没有无效区域 (什么都没画) 的刷新不记录。
+ */
+
+#include "gui_perf.h"
+
+#include <string.h>
+
+#ifdef USE_HAL_DRIVER
+// 目标板: DWT 周期计数 (168MHz 下约 25.5 秒回绕, 单次刷新远小于此)
+#include "dwt.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#define PERF_TASK_STATS 1
+
+static inline uint32_t perf_now(void)
+{
+    return DWT_GetCycles();
+}
+
+static inline uint32_t perf_to_us(uint32_t t)
+{
+    return DWT_CyclesToUs(t);
+}
+#else
+// 主机: 单调时钟, 以微秒计 (约 71 分钟回绕)
+#include <stdio.h>
+#include <time.h>
+#define PERF_TASK_STATS 0
+
+static uint32_t perf_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000U + (uint32_t)(ts.tv_nsec / 1000);
+}
+
+static inline uint32_t perf_to_us(uint32_t t)
+{
+    return t;
+}
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define PERF_OVERLAY_MS 500  // 统计层更新周期
+#define PERF_OVERLAY_TASKS 5  // 统计层显示的任务数 (按占用从高到低)
+
+/* Private variables ---------------------------------------------------------*/
+Gui_Perf_Frame gui_perf_ring[GUI_PERF_RING_SIZE];
+static uint32_t perf_head = 0;   // 下一条记录的位置
+static uint32_t perf_count = 0;  // 启动以来的记录数
+
+// 当前刷新 (时钟单位)
+static uint32_t perf_refr_start;
+static uint32_t perf_mark;  // FLUSH_START / FLUSH_WAIT_START 的时间
+static uint32_t perf_flush;
+static uint32_t perf_wait;
+static uint32_t perf_pixels;
+static bool perf_rendered;
+static uint32_t perf_input;  // 上次记录以来读取输入的时间
+
+static struct
+{
+    lv_indev_t *indev;
+    lv_indev_read_cb_t read_cb;  // 原来的读取函数
+} perf_indev[GUI_PERF_MAX_INDEV];
+
+static lv_obj_t *perf_label = NULL;
+static lv_timer_t *perf_timer = NULL;
+static uint32_t perf_overlay_count;  // 上次更新统计层时的 perf_count
+static uint32_t perf_overlay_tick;
+
+#if PERF_TASK_STATS
+static struct
+{
+    UBaseType_t number;
+    uint32_t run;
+} perf_task_prev[GUI_PERF_MAX_TASKS];
+static uint32_t perf_task_prev_count = 0;
+static uint32_t perf_task_prev_total = 0;
+#endif
+
+/* Function implementations --------------------------------------------------*/
+
+static uint16_t perf_us16(uint32_t t)
+{
+    uint32_t us = perf_to_us(t);
+    return (us > 0xFFFF) ? 0xFFFF : (uint16_t)us;
+}
+
+/**
+ * @brief  Store one rendered refresh in the ring
+ */
+static void perf_record(uint32_t now)
+{
+    Gui_Perf_Frame *f = &gui_perf_ring[perf_head];
+    uint32_t frame = now - perf_refr_start;
+
+    f->tick_ms = lv_tick_get();
+    f->frame_us = perf_to_us(frame);
+    f->render_us = perf_us16(frame - perf_flush - perf_wait);
+    f->flush_us = perf_us16(perf_flush);
+    f->wait_us = perf_us16(perf_wait);
+    f->input_us = perf_us16(perf_input);
+    f->pixels = perf_pixels;
+
+    perf_head = (perf_head + 1) % GUI_PERF_RING_SIZE;
+    perf_count++;
+    perf_input = 0;
+}
+
+static void perf_disp_event_cb(lv_event_t *e)
+{
+    uint32_t now = perf_now();
+
+    switch (lv_event_get_code(e))
+    {
+        case LV_EVENT_REFR_START:
+            perf_refr_start = now;
+            perf_flush = 0;
+            perf_wait = 0;
+            perf_pixels = 0;
+            perf_rendered = false;
+            break;
+        case LV_EVENT_RENDER_START:
+            perf_rendered = true;
+            break;
+        case LV_EVENT_FLUSH_START:
+            perf_mark = now;
+            perf_pixels += lv_area_get_size((const lv_area_t *)lv_event_get_param(e));
+            break;
+        case LV_EVENT_FLUSH_FINISH:
+            perf_flush += now - perf_mark;
+            break;
+        case LV_EVENT_FLUSH_WAIT_START:
+            perf_mark = now;
+            break;
+        case LV_EVENT_FLUSH_WAIT_FINISH:
+            perf_wait += now - perf_mark;
+            break;
+        case LV_EVENT_REFR_READY:
+            if (perf_rendered) perf_record(now);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief  Timed wrapper around the original read_cb
+ */
+static void perf_indev_read(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    uint32_t t0 = perf_now();
+
+    for (uint32_t i = 0; i < GUI_PERF_MAX_INDEV; i++)
+    {
+        if (perf_indev[i].indev == indev)
+        {
+            perf_indev[i].read_cb(indev, data);
+            break;
+        }
+    }
+    perf_input += perf_now() - t0;
+}
+
+void gui_perf_init(lv_display_t *disp)
+{
+    static const lv_event_code_t codes[] = {
+        LV_EVENT_REFR_START,       LV_EVENT_RENDER_START, LV_EVENT_FLUSH_START, LV_EVENT_FLUSH_FINISH,
+        LV_EVENT_FLUSH_WAIT_START, LV_EVENT_FLUSH_WAIT_FINISH, LV_EVENT_REFR_READY,
+    };
+
+#ifdef USE_HAL_DRIVER
+    DWT_Init();
+#endif
+
+    for (uint32_t i = 0; i < sizeof(codes) / sizeof(codes[0]); i++)
+    {
+        lv_display_add_event_cb(disp, perf_disp_event_cb, codes[i], NULL);
+    }
+
+    uint32_t n = 0;
+    for (lv_indev_t *indev = lv_indev_get_next(NULL); indev && n < GUI_PERF_MAX_INDEV;
+         indev = lv_indev_get_next(indev))
+    {
+        lv_indev_read_cb_t read_cb = lv_indev_get_read_cb(indev);
+        if (!read_cb || lv_indev_get_display(indev) != disp) continue;
+        perf_indev[n].indev = indev;
+        perf_indev[n].read_cb = read_cb;
+        lv_indev_set_read_cb(indev, perf_indev_read);
+        n++;
+    }
+
+#if GUI_PERF_OVERLAY
+    gui_perf_show(true);
+#endif
+}
+
+uint32_t gui_perf_get_tasks(Gui_Perf_Task *tasks, uint32_t max)
+{
+#if PERF_TASK_STATS
+    TaskStatus_t status[GUI_PERF_MAX_TASKS];
+    uint32_t total = 0;
+    UBaseType_t n = uxTaskGetSystemState(status, GUI_PERF_MAX_TASKS, &total);
+    uint32_t elapsed = total - perf_task_prev_total;
+
+    if (n == 0) return 0;  // 任务数超过 GUI_PERF_MAX_TASKS
+
+    for (UBaseType_t i = 0; i < n; i++)
+    {
+        uint32_t run = status[i].ulRunTimeCounter;
+
+        // 上次统计时已经存在的任务取差值, 新任务取全部运行时间
+        for (uint32_t j = 0; j < perf_task_prev_count; j++)
+        {
+            if (perf_task_prev[j].number == status[i].xTaskNumber)
+            {
+                run -= perf_task_prev[j].run;
+                break;
+            }
+        }
+        if (i < max)
+        {
+            strncpy(tasks[i].name, status[i].pcTaskName, sizeof(tasks[i].name) - 1);
+            tasks[i].name[sizeof(tasks[i].name) - 1] = '\0';
+            tasks[i].load = elapsed ? (uint16_t)((uint64_t)run * 1000U / elapsed) : 0;
+            tasks[i].stack_free = status[i].usStackHighWaterMark;
+        }
+    }
+
+    for (UBaseType_t i = 0; i < n; i++)
+    {
+        perf_task_prev[i].number = status[i].xTaskNumber;
+        perf_task_prev[i].run = status[i].ulRunTimeCounter;
+    }
+    perf_task_prev_count = n;
+    perf_task_prev_total = total;
+    return (n < max) ? n : max;
+#else
+    (void)tasks;
+    (void)max;
+    return 0;
+#endif
+}
+
+static void perf_default_output(const char *line, void *ctx)
+{
+    (void)ctx;
+#ifdef USE_HAL_DRIVER
+    // ITM_SendChar() 在调试器没有打开 ITM 端口 0 时直接返回
+    while (*line) ITM_SendChar((uint32_t)*line++);
+#else
+    fputs(line, stdout);
+#endif
+}
+
+void gui_perf_dump(Gui_Perf_Output out, void *ctx)
+{
+    char line[80];
+    uint32_t n = (perf_count < GUI_PERF_RING_SIZE) ? perf_count : GUI_PERF_RING_SIZE;
+    uint32_t idx = (perf_head + GUI_PERF_RING_SIZE - n) % GUI_PERF_RING_SIZE;
+
+    if (!out) out = perf_default_output;
+    out("tick_ms,frame_us,render_us,flush_us,wait_us,input_us,pixels\n", ctx);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        const Gui_Perf_Frame *f = &gui_perf_ring[idx];
+        lv_snprintf(line, sizeof(line), "%lu,%lu,%u,%u,%u,%u,%lu\n", (unsigned long)f->tick_ms,
+                    (unsigned long)f->frame_us, f->render_us, f->flush_us, f->wait_us, f->input_us,
+                    (unsigned long)f->pixels);
+        out(line, ctx);
+        idx = (idx + 1) % GUI_PERF_RING_SIZE;
+    }
+}
+
+/**
+ * @brief  Refresh the overlay with the frames recorded since the last update
+ */
+static void perf_timer_cb(lv_timer_t *t)
+{
+    char text[256];
+    uint32_t len = 0;
+    uint32_t now = lv_tick_get();
+    uint32_t elapsed = lv_tick_diff(now, perf_overlay_tick);
+    uint32_t n = perf_count - perf_overlay_count;
+    uint32_t frame = 0, frame_max = 0, render = 0, flush = 0, wait = 0, input = 0;
+
+    if (n > GUI_PERF_RING_SIZE) n = GUI_PERF_RING_SIZE;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        const Gui_Perf_Frame *f = &gui_perf_ring[(perf_head + GUI_PERF_RING_SIZE - 1 - i) % GUI_PERF_RING_SIZE];
+        frame += f->frame_us;
+        if (f->frame_us > frame_max) frame_max = f->frame_us;
+        render += f->render_us;
+        flush += f->flush_us;
+        wait += f->wait_us;
+        input += f->input_us;
+    }
+    perf_overlay_count = perf_count;
+    perf_overlay_tick = now;
+
+    // 平均值以 0.1ms 为单位
+    uint32_t d = n ? n * 100U : 1;
+    uint32_t fps10 = elapsed ? n * 10000U / elapsed : 0;
+    len += lv_snprintf(text + len, sizeof(text) - len,
+                       "FPS %lu.%lu  frame %lu.%lu ms (max %lu.%lu)\n"
+                       "render %lu.%lu  flush %lu.%lu  wait %lu.%lu  input %lu.%lu",
+                       (unsigned long)(fps10 / 10), (unsigned long)(fps10 % 10), (unsigned long)(frame / d / 10),
+                       (unsigned long)(frame / d % 10), (unsigned long)(frame_max / 1000),
+                       (unsigned long)(frame_max / 100 % 10), (unsigned long)(render / d / 10),
+                       (unsigned long)(render / d % 10), (unsigned long)(flush / d / 10),
+                       (unsigned long)(flush / d % 10), (unsigned long)(wait / d / 10), (unsigned long)(wait / d % 10),
+                       (unsigned long)(input / d / 10), (unsigned long)(input / d % 10));
+
+    Gui_Perf_Task tasks[GUI_PERF_MAX_TASKS];
+    uint32_t count = gui_perf_get_tasks(tasks, GUI_PERF_MAX_TASKS);
+
+    // 占用从高到低, 只显示前几个
+    for (uint32_t i = 0; i < count && i < PERF_OVERLAY_TASKS; i++)
+    {
+        uint32_t top = i;
+        for (uint32_t j = i + 1; j < count; j++)
+        {
+            if (tasks[j].load > tasks[top].load) top = j;
+        }
+        Gui_Perf_Task tmp = tasks[i];
+        tasks[i] = tasks[top];
+        tasks[top] = tmp;
+
+        if (len >= sizeof(text)) break;
+        len += lv_snprintf(text + len, sizeof(text) - len, "%s%s %u.%u%%", (i % 2) ? "  " : "\n", tasks[i].name,
+                           tasks[i].load / 10, tasks[i].load % 10);
+    }
+
+    if (perf_label) lv_label_set_text(perf_label, text);
+}
+
+void gui_perf_show(bool show)
+{
+    if (!show)
+    {
+        if (perf_timer) lv_timer_delete(perf_timer);
+        if (perf_label) lv_obj_delete(perf_label);
+        perf_timer = NULL;
+        perf_label = NULL;
+        return;
+    }
+    if (perf_label) return;
+
+    perf_label = lv_label_create(lv_layer_sys());
+    lv_obj_set_style_bg_color(perf_label, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(perf_label, LV_OPA_60, 0);
+    lv_obj_set_style_text_color(perf_label, lv_color_white(), 0);
+    lv_obj_set_style_pad_all(perf_label, 4, 0);
+    lv_obj_align(perf_label, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+    lv_label_set_text(perf_label, "");
+
+    perf_overlay_count = perf_count;
+    perf_overlay_tick = lv_tick_get();
+    perf_timer = lv_timer_create(perf_timer_cb, PERF_OVERLAY_MS, NULL);
+}
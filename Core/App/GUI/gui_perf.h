@@ -0,0 +1,82 @@
+/*
+ * gui_perf.h
+ * GUI 性能统计: 每次刷新的耗时分解 (布局+绘制 / flush / 等待 flush / 读取输入) 与 FreeRTOS 任务占用
+ *
+ * 通过 LVGL 显示事件 (REFR_START、RENDER_START、FLUSH_START ... REFR_READY) 计时, 输入设备的 read_cb
+ * 换成计时的包装函数, 不需要修改 LVGL 和驱动。目标板使用 DWT 周期计数, 主机 (PC 上的 LVGL 模拟)
+ * 使用单调时钟, 同一份代码在两边都能运行。
+ * 有绘制的刷新记录到一个环形缓冲区, 可以用 gui_perf_dump() 输出 (目标板默认 ITM/SWO, 主机默认 stdout),
+ * 也可以在调试器中直接查看 gui_perf_ring。屏幕上的统计层 (gui_perf_show) 每 500ms 更新一次。
+ * 所有函数只在 GUI 任务中调用。
+ */
+
+#ifndef GUI_PERF_H
+#define GUI_PERF_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "../../Gui/lvgl/lvgl.h"
+
+#define GUI_PERF_RING_SIZE 32  // 记录的刷新次数
+#define GUI_PERF_MAX_TASKS 10  // 任务统计上限
+#define GUI_PERF_MAX_INDEV 4   // 计时的输入设备上限
+
+#ifndef GUI_PERF_OVERLAY
+#define GUI_PERF_OVERLAY 0  // 1: 启动时显示统计层
+#endif
+
+    /* 一次有绘制的刷新, 时间单位为微秒 (超过 65535 的分项记为 65535) */
+    typedef struct
+    {
+        uint32_t tick_ms;    // 刷新结束时的 lv_tick
+        uint32_t frame_us;   // 整次刷新 (REFR_START -> REFR_READY)
+        uint16_t render_us;  // 布局与绘制 (整次刷新去掉下面两项)
+        uint16_t flush_us;   // flush_cb 中 (设置窗口、启动 DMA 或 CPU 写屏)
+        uint16_t wait_us;    // 等待上一块缓冲传输完成
+        uint16_t input_us;   // 上次记录以来读取输入设备的时间
+        uint32_t pixels;     // 送往屏幕的像素数
+    } Gui_Perf_Frame;
+
+    /* 任务占用 (两次 gui_perf_get_tasks() 之间) */
+    typedef struct
+    {
+        char name[16];
+        uint16_t load;        // 千分比
+        uint16_t stack_free;  // 栈剩余的最小值 (字)
+    } Gui_Perf_Task;
+
+    /* 输出一行文字 (包括换行符) */
+    typedef void (*Gui_Perf_Output)(const char *line, void *ctx);
+
+    /**
+     * @brief  开始统计 (lv_port_disp_init() 和 lv_port_indev_init() 之后调用)
+     */
+    void gui_perf_init(lv_display_t *disp);
+
+    /**
+     * @brief  显示 / 隐藏屏幕上的统计层 (在 lv_layer_sys() 上, 切换页面时保留)
+     */
+    void gui_perf_show(bool show);
+
+    /**
+     * @brief  读取任务占用, 返回任务数。主机上没有 FreeRTOS 统计, 返回 0
+     * @note   占用按上次调用以来的运行时间计算, 第一次调用时是启动以来的平均值
+     */
+    uint32_t gui_perf_get_tasks(Gui_Perf_Task *tasks, uint32_t max);
+
+    /**
+     * @brief  按时间顺序输出环形缓冲区中的记录 (CSV, 第一行为表头)
+     * @param  out: 输出函数, NULL 时目标板写 ITM 端口 0 (没有连接调试器时不输出), 主机写 stdout
+     */
+    void gui_perf_dump(Gui_Perf_Output out, void *ctx);
+
+    extern Gui_Perf_Frame gui_perf_ring[GUI_PERF_RING_SIZE];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GUI_PERF_H
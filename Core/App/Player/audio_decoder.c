@@ -0,0 +1,128 @@
+/*
+ * audio_decoder.c
+ * 解码器注册表与 CPU 占用统计
+ */
+
+#include "audio_decoder.h"
+#include "dwt.h"
+
+#include <ctype.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t frames;
+    uint32_t cycles_max;
+    uint64_t cycles;       // decode_frame() 累计周期数
+    uint64_t play_cycles;  // 输出的 PCM 播放所需时间 (同样以 CPU 周期计)
+} Audio_Decoder_Counter;
+
+/* Private variables ---------------------------------------------------------*/
+// 按 MusicSong_Format 排列
+static const Audio_Decoder *const decoders[MUSIC_FORMAT_COUNT] = {
+    [MUSIC_FORMAT_WAV] = &Audio_Decoder_WAV,
+    [MUSIC_FORMAT_MP3] = &Audio_Decoder_MP3,
+    [MUSIC_FORMAT_FLAC] = &Audio_Decoder_FLAC,
+    [MUSIC_FORMAT_APE] = &Audio_Decoder_APE,
+};
+
+static Audio_Decoder_Counter counters[MUSIC_FORMAT_COUNT];
+
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+static uint32_t pcm_checksum = FNV_OFFSET_BASIS;
+
+/* Function implementations --------------------------------------------------*/
+
+const Audio_Decoder *Audio_Decoder_Get(MusicSong_Format format)
+{
+    if ((unsigned)format >= MUSIC_FORMAT_COUNT) return NULL;
+    return decoders[format];
+}
+
+const Audio_Decoder *Audio_Decoder_FindByName(const char *filename)
+{
+    const char *dot = strrchr(filename, '.');
+    if (!dot) return NULL;
+
+    for (int i = 0; i < MUSIC_FORMAT_COUNT; i++)
+    {
+        const char *ext = decoders[i]->ext;
+        const char *p = dot;
+
+        while (*p && *ext && tolower((unsigned char)*p) == *ext)
+        {
+            p++;
+            ext++;
+        }
+        if (*p == '\0' && *ext == '\0') return decoders[i];
+    }
+    return NULL;
+}
+
+const Audio_Decoder *Audio_Decoder_Probe(const uint8_t *header, uint32_t len)
+{
+    for (int i = 0; i < MUSIC_FORMAT_COUNT; i++)
+    {
+        if (decoders[i]->probe(header, len)) return decoders[i];
+    }
+    return NULL;
+}
+
+int Audio_Decoder_Run(const Audio_Decoder *dec, int16_t *dst, uint32_t space, uint32_t sample_rate)
+{
+    uint32_t t0 = DWT_GetCycles();
+    int ret = dec->decode_frame(dst, space);
+    uint32_t cycles = DWT_GetCycles() - t0;
+
+    if (ret > 0)
+    {
+        Audio_Decoder_Counter *c = &counters[dec->format];
+        c->frames++;
+        c->cycles += cycles;
+        if (cycles > c->cycles_max) c->cycles_max = cycles;
+        if (sample_rate > 0)
+        {
+            // ret 为左右声道合计的采样数
+            c->play_cycles += (uint64_t)(ret / 2) * SystemCoreClock / sample_rate;
+        }
+
+#if AUDIO_DEC_PCM_CHECKSUM
+        // 每个左右声道对 (32 位) 参与一次 FNV-1a, dst 总是 4 字节对齐
+        const uint32_t *p = (const uint32_t *)dst;
+        uint32_t h = pcm_checksum;
+        for (int i = 0; i < ret / 2; i++) h = (h ^ p[i]) * FNV_PRIME;
+        pcm_checksum = h;
+#endif
+    }
+    return ret;
+}
+
+void Audio_Decoder_GetStats(MusicSong_Format format, Audio_Decoder_Stats *stats)
+{
+    if (!stats) return;
+    memset(stats, 0, sizeof(Audio_Decoder_Stats));
+    if ((unsigned)format >= MUSIC_FORMAT_COUNT) return;
+
+    const Audio_Decoder_Counter *c = &counters[format];
+    stats->frames = c->frames;
+    stats->cycles_max = c->cycles_max;
+    if (c->frames > 0) stats->cycles_per_frame = (uint32_t)(c->cycles / c->frames);
+    if (c->play_cycles > 0) stats->load_permille = (uint32_t)(c->cycles * 1000U / c->play_cycles);
+}
+
+void Audio_Decoder_ResetStats(void)
+{
+    memset(counters, 0, sizeof(counters));
+}
+
+uint32_t Audio_Decoder_GetChecksum(void)
+{
+    return pcm_checksum;
+}
+
+void Audio_Decoder_ResetChecksum(void)
+{
+    pcm_checksum = FNV_OFFSET_BASIS;
+}
@@ -0,0 +1,153 @@
+/*
+ * audio_decoder.h
+ * 统一的解码器接口 (WAV / MP3 / FLAC / APE)
+ *
+ * 播放引擎 (music_player.c) 只通过这里的函数表驱动解码器:
+ *   1. Stream_Open() 打开文件后调用 probe() / open() 解析文件头
+ *   2. 反复调用 decode_frame(), 解码器把 16 位立体声 PCM 直接写入环形缓冲区的当前块
+ *   3. seek() 定位, close() 结束
+ * 文件数据一律从 stream_reader 读取, 内部缓冲区从 codec_mem 分配 (打开前已复位)。
+ */
+
+#ifndef APP_PLAYER_AUDIO_DECODER_H_
+#define APP_PLAYER_AUDIO_DECODER_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "music_player.h"
+
+/* 为 1 时 Audio_Decoder_Run() 计算输出 PCM 的校验和 (不计入解码器周期数), 默认关闭;
+ * 比较解码器修改前后的输出时打开, 或在电脑上用 Tools/helix_bench 计算 */
+#ifndef AUDIO_DEC_PCM_CHECKSUM
+#define AUDIO_DEC_PCM_CHECKSUM 0
+#endif
+
+/* decode_frame() 返回值 (>0 表示写入的采样数) */
+#define AUDIO_DEC_EOF (-1)         // 文件结束或无法继续解码
+#define AUDIO_DEC_NEED_BLOCK (-2)  // 当前块剩余空间放不下一帧, 需要补零提交后换一个新块
+
+    /* 文件信息 */
+    typedef struct
+    {
+        uint32_t sample_rate;     // 采样率 (Hz)
+        uint8_t channels;         // 源文件声道数 (输出总是立体声)
+        uint8_t bits_per_sample;  // 源文件位深 (输出总是 16 位)
+        uint32_t bitrate;         // 平均比特率 (bps)
+        uint32_t total_samples;   // 总采样数 (每声道), 0 表示未知
+    } Audio_Info;
+
+    /* 解码器函数表 */
+    typedef struct
+    {
+        const char *name;         // 显示名称
+        const char *ext;          // 文件扩展名 (小写, 含 '.')
+        MusicSong_Format format;  // 对应的播放列表格式
+
+        /**
+         * @brief  检查文件头是否属于本格式
+         * @param  header: 文件开头的数据
+         * @param  len: header 的有效字节数
+         * @retval 1: 是, 0: 否
+         */
+        int (*probe)(const uint8_t *header, uint32_t len);
+
+        /**
+         * @brief  解析文件头并分配解码器内存 (流位于文件开头)
+         * @retval 0: 成功, 其他: 不支持的文件
+         */
+        int (*open)(Audio_Info *info);
+
+        /**
+         * @brief  解码下一段 PCM
+         * @param  dst: 输出位置 (环形缓冲区当前块内)
+         * @param  space: dst 处可写入的采样数 (左右声道合计, 总是偶数)
+         * @retval >0: 写入的采样数, 0: 本次没有输出 (跳过坏数据等), AUDIO_DEC_EOF, AUDIO_DEC_NEED_BLOCK
+         */
+        int (*decode_frame)(int16_t *dst, uint32_t space);
+
+        /**
+         * @brief  定位到指定采样 (每声道计数), 精度取决于格式
+         * @retval 0: 成功
+         */
+        int (*seek)(uint32_t sample);
+
+        /**
+         * @brief  读取文件信息
+         */
+        void (*get_info)(Audio_Info *info);
+
+        /**
+         * @brief  结束解码 (内存由 codec_mem 统一回收)
+         */
+        void (*close)(void);
+    } Audio_Decoder;
+
+    /* 每种解码器的 CPU 占用统计 (DWT 周期计数) */
+    typedef struct
+    {
+        uint32_t frames;            // decode_frame() 有输出的调用次数
+        uint32_t cycles_per_frame;  // 平均每次调用的周期数
+        uint32_t cycles_max;        // 单次调用最长周期数
+        uint32_t load_permille;     // 平均 CPU 占用 (‰, 按输出采样的播放时长计算)
+    } Audio_Decoder_Stats;
+
+    extern const Audio_Decoder Audio_Decoder_WAV;
+    extern const Audio_Decoder Audio_Decoder_MP3;
+    extern const Audio_Decoder Audio_Decoder_FLAC;
+    extern const Audio_Decoder Audio_Decoder_APE;
+
+    /**
+     * @brief  按播放列表格式取得解码器
+     * @retval 解码器, 不支持时返回 NULL
+     */
+    const Audio_Decoder *Audio_Decoder_Get(MusicSong_Format format);
+
+    /**
+     * @brief  按文件扩展名查找解码器 (不区分大小写)
+     * @retval 解码器, 不支持时返回 NULL
+     */
+    const Audio_Decoder *Audio_Decoder_FindByName(const char *filename);
+
+    /**
+     * @brief  按文件头查找解码器 (扩展名不正确时使用)
+     * @retval 解码器, 无法识别时返回 NULL
+     */
+    const Audio_Decoder *Audio_Decoder_Probe(const uint8_t *header, uint32_t len);
+
+    /**
+     * @brief  调用 decode_frame() 并累计该解码器的周期数
+     * @param  sample_rate: 当前文件采样率 (用于计算 CPU 占用)
+     */
+    int Audio_Decoder_Run(const Audio_Decoder *dec, int16_t *dst, uint32_t space, uint32_t sample_rate);
+
+    /**
+     * @brief  读取 CPU 占用统计
+     */
+    void Audio_Decoder_GetStats(MusicSong_Format format, Audio_Decoder_Stats *stats);
+
+    /**
+     * @brief  清零全部统计
+     */
+    void Audio_Decoder_ResetStats(void);
+
+    /**
+     * @brief  当前歌曲已输出 PCM 的校验和 (FNV-1a, 按 32 位左右声道对计算)
+     * @note   用于比较解码器修改前后的输出是否逐位一致; 定位后继续累计, 只有从头连续播放的结果可比较。
+     *         AUDIO_DEC_PCM_CHECKSUM 为 0 时总是返回初值
+     */
+    uint32_t Audio_Decoder_GetChecksum(void);
+
+    /**
+     * @brief  复位 PCM 校验和 (打开新歌曲时调用)
+     */
+    void Audio_Decoder_ResetChecksum(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_AUDIO_DECODER_H_ */
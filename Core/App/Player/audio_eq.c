@@ -0,0 +1,334 @@
+/*
+ * audio_eq.c
+ * 多段参数均衡器 + 低音增强 + 限幅器
+ *
+ * 二阶节采用直接 I 型 (每个频段、每个声道各自保存 x1 x2 y1 y2), 系数按 RBJ Audio EQ Cookbook 计算:
+ *   y = b0*x + b1*x1 + b2*x2 + na1*y1 + na2*y2   (na1 = -a1, na2 = -a2, 全部为 Q28)
+ * 限幅器逐采样检查左右声道的峰值, 超过门限时立即把增益降到刚好不超过门限, 然后按指数曲线恢复。
+ * 输出增益以 Q30 保存, 渐变时每个采样对加一次步长, 与限幅器增益相乘后作用于左右声道。
+ */
+
+#include "audio_eq.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+    EQ_LOW_SHELF,
+    EQ_PEAKING,
+    EQ_HIGH_SHELF,
+} EQ_FilterType;
+
+typedef struct
+{
+    EQ_FilterType type;
+    uint16_t freq;  // 中心 / 转折频率 (Hz)
+    uint16_t q100;  // Q x 100 (架型滤波器为斜率 S x 100)
+} EQ_Band_TypeDef;
+
+typedef struct
+{
+    int32_t b0, b1, b2, na1, na2;  // Q28
+} EQ_Coef_TypeDef;
+
+typedef struct
+{
+    int32_t x1, x2, y1, y2;
+} EQ_State_TypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define EQ_COEF_FRAC 28
+#define EQ_HEADROOM_BITS 12                         // 16 位输入左移到 Q27, 中间结果可超出满幅约 24dB
+#define EQ_LIMIT_LEVEL (32112 << EQ_HEADROOM_BITS)  // 限幅门限 -0.18dBFS
+#define EQ_GAIN_ONE (1 << 30)                       // 限幅器增益 Q30
+#define EQ_RELEASE_SHIFT 12                         // 释放时间常数 4096 个采样 (48kHz 下约 85ms)
+#define EQ_PI 3.14159265358979f
+
+/* Private variables ---------------------------------------------------------*/
+// 频段布局固定, 预设只改变各频段增益
+static const EQ_Band_TypeDef eq_bands[AUDIO_EQ_BANDS] = {
+    {EQ_LOW_SHELF, 60, 70},   {EQ_PEAKING, 150, 100},  {EQ_PEAKING, 400, 100},   {EQ_PEAKING, 1000, 100},
+    {EQ_PEAKING, 2500, 100},  {EQ_PEAKING, 6000, 100}, {EQ_PEAKING, 10000, 100}, {EQ_HIGH_SHELF, 14000, 70},
+};
+
+// 各预设的频段增益 (dB)
+static const int8_t eq_presets[AUDIO_EQ_PRESET_COUNT][AUDIO_EQ_BANDS] = {
+    [AUDIO_EQ_FLAT] = {0, 0, 0, 0, 0, 0, 0, 0},
+    [AUDIO_EQ_BASS] = {6, 4, 1, 0, 0, 0, 0, 0},
+    [AUDIO_EQ_ROCK] = {4, 3, -2, -3, -1, 2, 4, 4},
+    [AUDIO_EQ_POP] = {-1, 2, 4, 4, 2, 0, -1, -1},
+    [AUDIO_EQ_JAZZ] = {3, 2, 0, 1, -1, -1, 1, 3},
+    [AUDIO_EQ_VOCAL] = {-2, -3, 0, 3, 4, 3, 1, 0},
+    [AUDIO_EQ_CLASSICAL] = {4, 3, 0, 0, 0, 0, 2, 3},
+    [AUDIO_EQ_TREBLE] = {0, 0, 0, 0, 1, 3, 5, 6},
+};
+
+static const char *const eq_preset_names[AUDIO_EQ_PRESET_COUNT] = {
+    [AUDIO_EQ_FLAT] = "Flat",   [AUDIO_EQ_BASS] = "Bass",   [AUDIO_EQ_ROCK] = "Rock",
+    [AUDIO_EQ_POP] = "Pop",     [AUDIO_EQ_JAZZ] = "Jazz",   [AUDIO_EQ_VOCAL] = "Vocal",
+    [AUDIO_EQ_CLASSICAL] = "Classical", [AUDIO_EQ_TREBLE] = "Treble",
+};
+
+static EQ_Coef_TypeDef eq_coef[AUDIO_EQ_BANDS];  // 只包含增益不为 0 的频段, 按频率顺序
+static uint8_t eq_map[AUDIO_EQ_BANDS];           // eq_coef[n] 对应的频段号
+static EQ_State_TypeDef eq_state[AUDIO_EQ_BANDS][2];
+static uint8_t eq_active = 0;
+static uint8_t eq_bypass = 0;
+static Audio_EQ_Preset eq_preset = AUDIO_EQ_FLAT;
+static uint8_t eq_bass_db = 0;
+static uint32_t eq_sample_rate = 48000;
+static int32_t eq_limit_gain = EQ_GAIN_ONE;
+static int32_t eq_gain = EQ_GAIN_ONE;  // 当前输出增益 (Q30)
+static int32_t eq_gain_target = EQ_GAIN_ONE;
+static int32_t eq_gain_step = 0;     // 每个采样对的增量
+static uint32_t eq_gain_frames = 0;  // 渐变剩余的采样对
+
+/* Function implementations --------------------------------------------------*/
+
+static int32_t eq_to_q28(float v)
+{
+    return (int32_t)lrintf(v * (float)(1 << EQ_COEF_FRAC));
+}
+
+/**
+ * @brief  RBJ cookbook biquad for one band, normalized by a0
+ */
+static void eq_design_band(const EQ_Band_TypeDef *band, float gain_db, EQ_Coef_TypeDef *c)
+{
+    float A = powf(10.0f, gain_db / 40.0f);
+    float w0 = 2.0f * EQ_PI * (float)band->freq / (float)eq_sample_rate;
+    float cw = cosf(w0);
+    float sw = sinf(w0);
+    float q = (float)band->q100 / 100.0f;
+    float b0, b1, b2, a0, a1, a2;
+
+    if (band->type == EQ_PEAKING)
+    {
+        float alpha = sw / (2.0f * q);
+        b0 = 1.0f + alpha * A;
+        b1 = -2.0f * cw;
+        b2 = 1.0f - alpha * A;
+        a0 = 1.0f + alpha / A;
+        a1 = -2.0f * cw;
+        a2 = 1.0f - alpha / A;
+    }
+    else
+    {
+        // 架型: q100 为斜率 S
+        float alpha = sw / 2.0f * sqrtf((A + 1.0f / A) * (1.0f / q - 1.0f) + 2.0f);
+        float sa = 2.0f * sqrtf(A) * alpha;
+        float s = (band->type == EQ_LOW_SHELF) ? 1.0f : -1.0f;  // 高架把 cos 项取反
+
+        b0 = A * ((A + 1.0f) - s * (A - 1.0f) * cw + sa);
+        b1 = s * 2.0f * A * ((A - 1.0f) - s * (A + 1.0f) * cw);
+        b2 = A * ((A + 1.0f) - s * (A - 1.0f) * cw - sa);
+        a0 = (A + 1.0f) + s * (A - 1.0f) * cw + sa;
+        a1 = -s * 2.0f * ((A - 1.0f) + s * (A + 1.0f) * cw);
+        a2 = (A + 1.0f) + s * (A - 1.0f) * cw - sa;
+    }
+
+    c->b0 = eq_to_q28(b0 / a0);
+    c->b1 = eq_to_q28(b1 / a0);
+    c->b2 = eq_to_q28(b2 / a0);
+    c->na1 = eq_to_q28(-a1 / a0);
+    c->na2 = eq_to_q28(-a2 / a0);
+}
+
+/**
+ * @brief  Recompute coefficients of the bands that are not flat
+ * @note   状态按频段号保存, 切换预设时仍在工作的频段保留状态, 只有新加入的频段从零开始
+ */
+static void eq_update(void)
+{
+    uint8_t was_active[AUDIO_EQ_BANDS] = {0};
+    uint8_t n = 0;
+
+    for (uint8_t b = 0; b < eq_active; b++) was_active[eq_map[b]] = 1;
+
+    for (uint8_t i = 0; i < AUDIO_EQ_BANDS; i++)
+    {
+        int gain = eq_presets[eq_preset][i];
+        if (i == 0) gain += eq_bass_db;
+        if (gain == 0) continue;
+
+        eq_design_band(&eq_bands[i], (float)gain, &eq_coef[n]);
+        if (!was_active[i]) memset(eq_state[i], 0, sizeof(eq_state[i]));
+        eq_map[n++] = i;
+    }
+    eq_active = n;
+}
+
+void Audio_EQ_SetSampleRate(uint32_t sample_rate)
+{
+    if (sample_rate == 0 || sample_rate == eq_sample_rate) return;
+    eq_sample_rate = sample_rate;
+    eq_update();
+}
+
+void Audio_EQ_SetPreset(Audio_EQ_Preset preset)
+{
+    if ((unsigned)preset >= AUDIO_EQ_PRESET_COUNT) return;
+    eq_preset = preset;
+    eq_update();
+}
+
+void Audio_EQ_SetBassBoost(uint8_t db)
+{
+    if (db > AUDIO_EQ_MAX_BASS_DB) db = AUDIO_EQ_MAX_BASS_DB;
+    eq_bass_db = db;
+    eq_update();
+}
+
+void Audio_EQ_SetBypass(uint8_t bypass)
+{
+    if (eq_bypass && !bypass) Audio_EQ_Reset();
+    eq_bypass = bypass;
+}
+
+Audio_EQ_Preset Audio_EQ_GetPreset(void)
+{
+    return eq_preset;
+}
+
+uint8_t Audio_EQ_GetBassBoost(void)
+{
+    return eq_bass_db;
+}
+
+uint8_t Audio_EQ_IsBypassed(void)
+{
+    return eq_bypass;
+}
+
+const char *Audio_EQ_GetPresetName(Audio_EQ_Preset preset)
+{
+    if ((unsigned)preset >= AUDIO_EQ_PRESET_COUNT) return "";
+    return eq_preset_names[preset];
+}
+
+uint8_t Audio_EQ_GetActiveBands(void)
+{
+    return eq_bypass ? 0 : eq_active;
+}
+
+void Audio_EQ_SetGain(uint16_t gain, uint32_t ramp_frames)
+{
+    if (gain > AUDIO_EQ_GAIN_UNITY) gain = AUDIO_EQ_GAIN_UNITY;
+    eq_gain_target = (int32_t)gain << 15;
+
+    if (ramp_frames == 0 || eq_gain == eq_gain_target)
+    {
+        eq_gain = eq_gain_target;
+        eq_gain_frames = 0;
+        return;
+    }
+    eq_gain_step = (eq_gain_target - eq_gain) / (int32_t)ramp_frames;
+    eq_gain_frames = ramp_frames;
+}
+
+uint8_t Audio_EQ_IsRamping(void)
+{
+    return eq_gain_frames > 0;
+}
+
+/**
+ * @brief  Advance the output gain ramp by one stereo frame
+ * @retval 本采样对使用的增益 (Q30)
+ */
+static inline int32_t eq_gain_next(void)
+{
+    int32_t g = eq_gain;
+
+    if (eq_gain_frames > 0)
+    {
+        eq_gain = (--eq_gain_frames == 0) ? eq_gain_target : eq_gain + eq_gain_step;
+    }
+    return g;
+}
+
+/**
+ * @brief  Output gain only (EQ flat or bypassed): one 16x16 multiply per sample
+ */
+static void eq_apply_gain(int16_t *pcm, uint32_t samples)
+{
+    for (uint32_t i = 0; i + 1 < samples; i += 2)
+    {
+        int32_t g = eq_gain_next() >> 15;  // Q15, 最大 32768, 乘积不会溢出
+        pcm[i] = (int16_t)((pcm[i] * g + (1 << 14)) >> 15);
+        pcm[i + 1] = (int16_t)((pcm[i + 1] * g + (1 << 14)) >> 15);
+    }
+}
+
+void Audio_EQ_Reset(void)
+{
+    memset(eq_state, 0, sizeof(eq_state));
+    eq_limit_gain = EQ_GAIN_ONE;
+}
+
+void Audio_EQ_Process(int16_t *pcm, uint32_t samples)
+{
+    const uint8_t active = eq_active;
+    int32_t gain = eq_limit_gain;
+
+    if (active == 0 || eq_bypass)
+    {
+        if (eq_gain_frames > 0 || eq_gain != EQ_GAIN_ONE) eq_apply_gain(pcm, samples);
+        return;
+    }
+
+    for (uint32_t i = 0; i + 1 < samples; i += 2)
+    {
+        int32_t y[2];
+
+        for (int ch = 0; ch < 2; ch++)
+        {
+            int32_t x = (int32_t)pcm[i + ch] << EQ_HEADROOM_BITS;
+
+            for (uint8_t b = 0; b < active; b++)
+            {
+                const EQ_Coef_TypeDef *c = &eq_coef[b];
+                EQ_State_TypeDef *s = &eq_state[eq_map[b]][ch];
+
+                int64_t acc = (int64_t)c->b0 * x;  // 编译为 SMULL / SMLAL
+                acc += (int64_t)c->b1 * s->x1;
+                acc += (int64_t)c->b2 * s->x2;
+                acc += (int64_t)c->na1 * s->y1;
+                acc += (int64_t)c->na2 * s->y2;
+                int32_t out = (int32_t)(acc >> EQ_COEF_FRAC);
+
+                s->x2 = s->x1;
+                s->x1 = x;
+                s->y2 = s->y1;
+                s->y1 = out;
+                x = out;
+            }
+            y[ch] = x;
+        }
+
+        // 限幅: 左右声道共用增益, 声像不变
+        int32_t peak = (y[0] < 0) ? -y[0] : y[0];
+        int32_t pr = (y[1] < 0) ? -y[1] : y[1];
+        if (pr > peak) peak = pr;
+        if ((int32_t)(((int64_t)peak * gain) >> 30) > EQ_LIMIT_LEVEL)
+        {
+            gain = (int32_t)(((int64_t)EQ_LIMIT_LEVEL << 30) / peak);
+        }
+
+        // 限幅器增益与输出增益合并, 每个采样仍只乘一次
+        int32_t g = (int32_t)(((int64_t)gain * eq_gain_next()) >> 30);
+        for (int ch = 0; ch < 2; ch++)
+        {
+            int32_t v = (int32_t)(((int64_t)y[ch] * g) >> 30);
+            v = (v + (1 << (EQ_HEADROOM_BITS - 1))) >> EQ_HEADROOM_BITS;
+            if (v > 32767) v = 32767;
+            if (v < -32768) v = -32768;
+            pcm[i + ch] = (int16_t)v;
+        }
+
+        gain += (EQ_GAIN_ONE - gain) >> EQ_RELEASE_SHIFT;
+    }
+
+    eq_limit_gain = gain;
+}
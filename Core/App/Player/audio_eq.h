@@ -0,0 +1,106 @@
+/*
+ * audio_eq.h
+ * 多段参数均衡器 + 低音增强 + 限幅器 (播放链路中的 DSP 级)
+ *
+ * 8 段二阶 IIR (低架 / 峰值 / 高架) 级联, 系数只在切换预设、低音增强或采样率时计算 (浮点),
+ * 每个采样只做定点运算: Q28 系数、32 位状态 (输入左移 12 位, 留 4 位余量给提升的频段), 64 位累加。
+ * 增益为 0dB 的频段直接跳过; 所有频段都为 0dB 时整个模块直通, 输出与解码器逐位一致。
+ * 输出经过限幅器 (立即起控、指数释放), 提升的频段不会削波。
+ * 最后乘以输出增益 (暂停、停止、切歌和定位时的渐弱 / 渐强), 增益逐采样线性插值, 没有台阶噪声;
+ * 均衡器开启时并入限幅器的增益, 直通时每个采样只多一次 16x16 乘法, 增益为 1 且不在渐变时不做任何处理。
+ *
+ * 本模块不依赖 HAL / RTOS, 可以直接在主机上编译。
+ */
+
+#ifndef APP_PLAYER_AUDIO_EQ_H_
+#define APP_PLAYER_AUDIO_EQ_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#define AUDIO_EQ_BANDS 8
+#define AUDIO_EQ_MAX_BASS_DB 12  // 低音增强上限 (叠加在 60Hz 低架上)
+#define AUDIO_EQ_GAIN_UNITY 32768  // 输出增益 Q15, 0dB
+
+    /* 预设 */
+    typedef enum
+    {
+        AUDIO_EQ_FLAT,
+        AUDIO_EQ_BASS,
+        AUDIO_EQ_ROCK,
+        AUDIO_EQ_POP,
+        AUDIO_EQ_JAZZ,
+        AUDIO_EQ_VOCAL,
+        AUDIO_EQ_CLASSICAL,
+        AUDIO_EQ_TREBLE,
+        AUDIO_EQ_PRESET_COUNT,
+    } Audio_EQ_Preset;
+
+    /**
+     * @brief  设置输出采样率并重新计算系数
+     */
+    void Audio_EQ_SetSampleRate(uint32_t sample_rate);
+
+    /**
+     * @brief  选择预设并重新计算系数 (滤波器状态保留, 切换时不会有爆音)
+     */
+    void Audio_EQ_SetPreset(Audio_EQ_Preset preset);
+
+    /**
+     * @brief  设置低音增强
+     * @param  db: 0 ~ AUDIO_EQ_MAX_BASS_DB
+     */
+    void Audio_EQ_SetBassBoost(uint8_t db);
+
+    /**
+     * @brief  强制直通 (CPU 预算不足时由播放器调用), 恢复时清空滤波器状态
+     */
+    void Audio_EQ_SetBypass(uint8_t bypass);
+
+    Audio_EQ_Preset Audio_EQ_GetPreset(void);
+    uint8_t Audio_EQ_GetBassBoost(void);
+    uint8_t Audio_EQ_IsBypassed(void);
+
+    /**
+     * @brief  预设名称 (用于 GUI)
+     */
+    const char *Audio_EQ_GetPresetName(Audio_EQ_Preset preset);
+
+    /**
+     * @brief  当前参与运算的频段数, 0 表示直通
+     */
+    uint8_t Audio_EQ_GetActiveBands(void);
+
+    /**
+     * @brief  从当前增益线性渐变到目标增益
+     * @param  gain: 目标增益 (Q15, 0 ~ AUDIO_EQ_GAIN_UNITY)
+     * @param  ramp_frames: 渐变长度 (立体声采样对), 0 表示立即生效
+     */
+    void Audio_EQ_SetGain(uint16_t gain, uint32_t ramp_frames);
+
+    /**
+     * @brief  输出增益是否正在渐变
+     */
+    uint8_t Audio_EQ_IsRamping(void);
+
+    /**
+     * @brief  清空滤波器状态和限幅器增益 (不影响输出增益) (开始播放或定位后调用)
+     */
+    void Audio_EQ_Reset(void);
+
+    /**
+     * @brief  原地处理一段立体声交织 PCM
+     * @param  pcm: 16 位立体声交织采样
+     * @param  samples: 采样数 (左右声道合计)
+     */
+    void Audio_EQ_Process(int16_t *pcm, uint32_t samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_AUDIO_EQ_H_ */
@@ -0,0 +1,287 @@
+/*
+ * audio_spectrum.c
+ * 频谱分析: 512 点实数 FFT, Q15 定点
+ *
+ * 左右声道平均、加 Hann 窗后, 偶数 / 奇数采样分别作为实部 / 虚部组成 256 点复数序列,
+ * 基 4 按频率抽取 FFT (与 CMSIS-DSP arm_cfft_radix4_q15 相同, 每级右移 2 位防止溢出, 共缩小 256 倍),
+ * 再按 X[k] = (Z[k] + Z*[N-k]) / 2 - j W^k (Z[k] - Z*[N-k]) / 2 拆出实数序列的频谱。
+ * 旋转因子和窗函数都由 1/4 周期余弦表 (129 个 Q15) 按对称性得到。
+ */
+
+#include "audio_spectrum.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define SPEC_N AUDIO_SPECTRUM_FFT_SIZE  // 实数点数
+#define SPEC_NC (SPEC_N / 2)            // 复数点数 (4 的幂)
+#define SPEC_QUARTER (SPEC_N / 4)
+#define SPEC_F_LOW 50U
+#define SPEC_F_HIGH 16000U
+#define SPEC_LOG2_FLOOR (4 * 16)  // 低于此功率 (log2, Q4) 显示为 0
+#define SPEC_LOG2_TOP (28 * 16)   // 满幅正弦约为 2^28, 以上显示为满格 (显示范围约 72dB)
+#define SPEC_PI 3.14159265358979f
+
+/* Private variables ---------------------------------------------------------*/
+static int16_t spec_cos[SPEC_QUARTER + 1];                     // cos(2*pi*k/SPEC_N), k = 0 ~ N/4
+static int16_t spec_work[SPEC_N] __attribute__((aligned(4)));  // 复数 FFT 工作区 (实部, 虚部交替)
+static uint16_t spec_edge[AUDIO_SPECTRUM_BARS + 1];            // 每根柱子的起始频点
+static uint32_t spec_rate = 0;                                 // spec_edge 对应的采样率
+
+// 双缓冲: 最新结果在 spec_bars[spec_seq & 1], 写入另一块后再递增序号
+static uint8_t spec_bars[2][AUDIO_SPECTRUM_BARS];
+static volatile uint32_t spec_seq = 0;
+
+/* Function implementations --------------------------------------------------*/
+
+/**
+ * @brief  cos / sin of 2*pi*k/SPEC_N from the quarter-wave table
+ */
+static void spec_twiddle(uint32_t k, int32_t *c, int32_t *s)
+{
+    k &= SPEC_N - 1;
+    uint32_t q = k / SPEC_QUARTER;
+    uint32_t r = k % SPEC_QUARTER;
+    int32_t a = spec_cos[r];                 // cos(r)
+    int32_t b = spec_cos[SPEC_QUARTER - r];  // sin(r)
+
+    switch (q)
+    {
+        case 0:
+            *c = a;
+            *s = b;
+            break;
+        case 1:
+            *c = -b;
+            *s = a;
+            break;
+        case 2:
+            *c = -a;
+            *s = -b;
+            break;
+        default:
+            *c = b;
+            *s = -a;
+            break;
+    }
+}
+
+/**
+ * @brief  (re + j*im) * (c - j*s), Q15
+ */
+static inline void spec_cmul(int32_t re, int32_t im, int32_t c, int32_t s, int16_t *out)
+{
+    out[0] = (int16_t)((re * c + im * s) >> 15);
+    out[1] = (int16_t)((im * c - re * s) >> 15);
+}
+
+/**
+ * @brief  In-place radix-4 DIF complex FFT, output in base-4 digit-reversed order
+ * @note   每级输入右移 2 位, 结果为真实 FFT 的 1/SPEC_NC
+ */
+static void spec_cfft_radix4(int16_t *x)
+{
+    for (uint32_t n1 = SPEC_NC; n1 > 1; n1 >>= 2)
+    {
+        uint32_t n2 = n1 >> 2;
+        uint32_t ie = SPEC_NC / n1;  // 本级旋转因子步长 (复数 FFT 的 W_NC)
+
+        for (uint32_t j = 0; j < n2; j++)
+        {
+            int32_t c1, s1, c2, s2, c3, s3;
+            // W_NC^m = W_N^(2m)
+            spec_twiddle(2 * j * ie, &c1, &s1);
+            spec_twiddle(4 * j * ie, &c2, &s2);
+            spec_twiddle(6 * j * ie, &c3, &s3);
+
+            for (uint32_t i = j; i < SPEC_NC; i += n1)
+            {
+                int16_t *p0 = x + 2 * i;
+                int16_t *p1 = p0 + 2 * n2;
+                int16_t *p2 = p1 + 2 * n2;
+                int16_t *p3 = p2 + 2 * n2;
+
+                int32_t t0r = (p0[0] >> 2) + (p2[0] >> 2), t0i = (p0[1] >> 2) + (p2[1] >> 2);
+                int32_t t1r = (p0[0] >> 2) - (p2[0] >> 2), t1i = (p0[1] >> 2) - (p2[1] >> 2);
+                int32_t t2r = (p1[0] >> 2) + (p3[0] >> 2), t2i = (p1[1] >> 2) + (p3[1] >> 2);
+                int32_t t3r = (p1[0] >> 2) - (p3[0] >> 2), t3i = (p1[1] >> 2) - (p3[1] >> 2);
+
+                p0[0] = (int16_t)(t0r + t2r);
+                p0[1] = (int16_t)(t0i + t2i);
+                // X1 = t1 - j*t3, X2 = t0 - t2, X3 = t1 + j*t3
+                spec_cmul(t1r + t3i, t1i - t3r, c1, s1, p1);
+                spec_cmul(t0r - t2r, t0i - t2i, c2, s2, p2);
+                spec_cmul(t1r - t3i, t1i + t3r, c3, s3, p3);
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Reverse the base-4 digits of a complex index
+ */
+static uint32_t spec_digit_reverse(uint32_t i)
+{
+    uint32_t r = 0;
+    for (uint32_t n = SPEC_NC; n > 1; n >>= 2)
+    {
+        r = (r << 2) | (i & 3);
+        i >>= 2;
+    }
+    return r;
+}
+
+/**
+ * @brief  log2 of a power value in Q4 (16 steps per octave)
+ */
+static int32_t spec_log2_q4(uint64_t p)
+{
+    if (p == 0) return 0;
+    int32_t e = 63 - __builtin_clzll(p);
+    uint32_t frac = (uint32_t)((e >= 4) ? (p >> (e - 4)) : (p << (4 - e))) & 15;
+    return e * 16 + (int32_t)frac;
+}
+
+/**
+ * @brief  Log-spaced bar edges (FFT bin indices) for a sample rate
+ * @note   低频处每根柱子至少一个频点
+ */
+static void spec_update_edges(uint32_t sample_rate)
+{
+    float f_high = (float)sample_rate * 0.5f;
+    if (f_high > (float)SPEC_F_HIGH) f_high = (float)SPEC_F_HIGH;
+    float ratio = f_high / (float)SPEC_F_LOW;
+    uint32_t prev = 0;
+
+    for (uint32_t b = 0; b <= AUDIO_SPECTRUM_BARS; b++)
+    {
+        float f = (float)SPEC_F_LOW * powf(ratio, (float)b / AUDIO_SPECTRUM_BARS);
+        uint32_t bin = (uint32_t)lrintf(f * SPEC_N / (float)sample_rate);
+
+        if (b > 0 && bin <= prev) bin = prev + 1;
+        if (bin > SPEC_NC) bin = SPEC_NC;
+        spec_edge[b] = (uint16_t)bin;
+        prev = bin;
+    }
+    spec_rate = sample_rate;
+}
+
+/**
+ * @brief  Publish one set of bars
+ */
+static void spec_publish(const uint8_t *bars)
+{
+    uint32_t next = spec_seq + 1;
+
+    memcpy(spec_bars[next & 1], bars, AUDIO_SPECTRUM_BARS);
+    __sync_synchronize();  // 数据写完后再更新序号
+    spec_seq = next;
+}
+
+void Audio_Spectrum_Init(void)
+{
+    for (uint32_t k = 0; k <= SPEC_QUARTER; k++)
+    {
+        int32_t v = (int32_t)lrintf(cosf(2.0f * SPEC_PI * (float)k / SPEC_N) * 32768.0f);
+        spec_cos[k] = (int16_t)(v > 32767 ? 32767 : v);
+    }
+    spec_rate = 0;
+}
+
+void Audio_Spectrum_Analyze(const int16_t *pcm, uint32_t frames, uint32_t sample_rate)
+{
+    uint8_t bars[AUDIO_SPECTRUM_BARS];
+    uint32_t start = 0;
+    uint32_t pad = 0;
+
+    if (sample_rate == 0) return;
+    if (sample_rate != spec_rate) spec_update_edges(sample_rate);
+
+    if (frames >= SPEC_N)
+    {
+        start = frames - SPEC_N;
+    }
+    else
+    {
+        pad = SPEC_N - frames;
+    }
+
+    // 左右平均 + Hann 窗: w[n] = (1 - cos(2*pi*n/N)) / 2
+    for (uint32_t n = 0; n < SPEC_N; n++)
+    {
+        int32_t v = 0;
+        if (n >= pad)
+        {
+            const int16_t *s = pcm + 2 * (start + n - pad);
+            int32_t c, sn;
+            spec_twiddle(n, &c, &sn);
+            v = (((int32_t)s[0] + s[1]) >> 1) * ((32768 - c) >> 1) >> 15;
+        }
+        spec_work[n] = (int16_t)v;
+    }
+
+    spec_cfft_radix4(spec_work);
+
+    // 拆分出实数频谱, 按柱子取最大功率
+    uint32_t b = 0;
+    uint64_t peak = 0;
+    memset(bars, 0, sizeof(bars));
+    for (uint32_t k = spec_edge[0]; k < spec_edge[AUDIO_SPECTRUM_BARS] && k < SPEC_NC; k++)
+    {
+        const int16_t *zk = spec_work + 2 * spec_digit_reverse(k);
+        const int16_t *zn = spec_work + 2 * spec_digit_reverse((SPEC_NC - k) & (SPEC_NC - 1));
+
+        // A = (Z[k] + Z*[N-k]) / 2, B = (Z[k] - Z*[N-k]) / 2, X[k] = A - j * W^k * B
+        int32_t ar = (zk[0] + zn[0]) >> 1, ai = (zk[1] - zn[1]) >> 1;
+        int32_t br = (zk[0] - zn[0]) >> 1, bi = (zk[1] + zn[1]) >> 1;
+        int32_t c, s;
+        spec_twiddle(k, &c, &s);
+        int32_t wbr = (br * c + bi * s) >> 15;  // W^k * B
+        int32_t wbi = (bi * c - br * s) >> 15;
+        int32_t xr = ar + wbi;
+        int32_t xi = ai - wbr;
+        uint64_t p = (uint64_t)((int64_t)xr * xr) + (uint64_t)((int64_t)xi * xi);
+
+        while (b < AUDIO_SPECTRUM_BARS && k >= spec_edge[b + 1])
+        {
+            b++;
+            peak = 0;
+        }
+        if (b >= AUDIO_SPECTRUM_BARS) break;
+        if (p > peak)
+        {
+            peak = p;
+            int32_t l = spec_log2_q4(p);
+            l = (l - SPEC_LOG2_FLOOR) * AUDIO_SPECTRUM_LEVEL_MAX / (SPEC_LOG2_TOP - SPEC_LOG2_FLOOR);
+            if (l < 0) l = 0;
+            if (l > AUDIO_SPECTRUM_LEVEL_MAX) l = AUDIO_SPECTRUM_LEVEL_MAX;
+            bars[b] = (uint8_t)l;
+        }
+    }
+
+    spec_publish(bars);
+}
+
+void Audio_Spectrum_Clear(void)
+{
+    uint8_t bars[AUDIO_SPECTRUM_BARS] = {0};
+    spec_publish(bars);
+}
+
+uint8_t Audio_Spectrum_Read(uint8_t *bars, uint32_t *seq)
+{
+    uint32_t s;
+
+    do
+    {
+        s = spec_seq;
+        if (s == *seq) return 0;
+        memcpy(bars, spec_bars[s & 1], AUDIO_SPECTRUM_BARS);
+        __sync_synchronize();
+        // 复制期间又发布了两次 (写到了正在读的那一块) 时重读
+    } while (spec_seq - s >= 2);
+
+    *seq = s;
+    return 1;
+}
@@ -0,0 +1,56 @@
+/*
+ * audio_spectrum.h
+ * 频谱分析 (播放界面的柱状频谱)
+ *
+ * 音频任务对正在播放的 PCM 块做 512 点实数 FFT (256 点复数 Q15 基 4 FFT + 拆分), 按对数频率合并成
+ * AUDIO_SPECTRUM_BARS 根柱子, 写入双缓冲后切换序号发布; GUI 任务随时读取, 双方都不加锁、不等待。
+ *
+ * 本模块不依赖 HAL / RTOS, 可以直接在主机上编译。
+ */
+
+#ifndef APP_PLAYER_AUDIO_SPECTRUM_H_
+#define APP_PLAYER_AUDIO_SPECTRUM_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#define AUDIO_SPECTRUM_FFT_SIZE 512  // 实数 FFT 点数 (帧), 48kHz 下每个频点 94Hz
+#define AUDIO_SPECTRUM_BARS 32       // 柱子数量 (50Hz ~ 16kHz 对数分布)
+#define AUDIO_SPECTRUM_MAX_FPS 30    // 每秒最多分析次数
+#define AUDIO_SPECTRUM_LEVEL_MAX 255
+
+    /**
+     * @brief  生成旋转因子和窗函数表 (启动时调用一次)
+     */
+    void Audio_Spectrum_Init(void);
+
+    /**
+     * @brief  分析一段立体声交织 PCM 并发布结果 (音频任务中调用)
+     * @param  pcm: 16 位立体声交织采样, 使用最后 AUDIO_SPECTRUM_FFT_SIZE 帧 (不足时补零)
+     * @param  frames: 立体声采样对数
+     * @param  sample_rate: 采样率, 决定柱子对应的频点范围
+     */
+    void Audio_Spectrum_Analyze(const int16_t *pcm, uint32_t frames, uint32_t sample_rate);
+
+    /**
+     * @brief  发布全零频谱 (暂停或停止时调用, 柱子按衰减速度落下由 GUI 完成)
+     */
+    void Audio_Spectrum_Clear(void);
+
+    /**
+     * @brief  读取最新的频谱 (任意任务调用, 不阻塞)
+     * @param  bars: 输出 AUDIO_SPECTRUM_BARS 个电平 (0 ~ AUDIO_SPECTRUM_LEVEL_MAX)
+     * @param  seq: 输入上次读取的序号, 返回当前序号
+     * @retval 1: 有新的结果, 0: 与上次相同 (bars 未修改)
+     */
+    uint8_t Audio_Spectrum_Read(uint8_t *bars, uint32_t *seq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_AUDIO_SPECTRUM_H_ */
@@ -0,0 +1,278 @@
+/*
+ * audio_src.c
+ * 采样率转换 (多相 FIR, Q15 定点)
+ *
+ * 把输入按 L 倍插零上采样、经原型低通滤波后按 M 倍抽取, 只计算被抽取到的输出:
+ *   y = sum(h[p + t*L] * x[n - t]), t = 0..taps-1, p 为当前相位
+ * 每输出一个采样 p += M, p >= L 时读入一个新的输入采样并 p -= L。
+ * 原型滤波器线性相位 (对称), 相位 L-1-p 的系数正好是相位 p 倒序, 所以只存前一半相位,
+ * 后一半用 SMLADX (交叉乘加) 读取。系数表和历史采样只有 CPU 访问, 放在 CCM。
+ */
+
+#include "audio_src.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define SRC_ROLLOFF 0.91f    // -6dB 截止频率 = 0.5 * min(输入, 输出采样率) * SRC_ROLLOFF
+#define SRC_KAISER_BETA 7.0f  // 阻带约 -70dB
+#define SRC_PI 3.14159265358979f
+
+/* Private variables ---------------------------------------------------------*/
+// .ccmram 段不会被启动代码清零, Audio_SRC_Configure() / Audio_SRC_Reset() 中初始化
+#if defined(__GNUC__)
+__attribute__((section(".ccmram")))
+#endif
+static int16_t src_coef[AUDIO_SRC_COEF_SIZE] __attribute__((aligned(4)));
+
+// 每个声道的历史采样存两份 (hist[i] == hist[i + taps]), 任意位置起始的 taps 个采样总是连续的
+#if defined(__GNUC__)
+__attribute__((section(".ccmram")))
+#endif
+static int16_t src_hist[2][2 * AUDIO_SRC_MAX_TAPS] __attribute__((aligned(4)));
+
+static Audio_SRC_Info src_info = {0};
+static int8_t src_result = -1;  // 当前输入采样率的 Audio_SRC_Configure() 结果
+static uint16_t src_stored = 0;  // 系数表中存放的相位数 (L + 1) / 2
+static uint16_t src_pos = 0;     // 下一个输入采样写入 src_hist 的位置
+static uint32_t src_phase = 0;   // 当前相位, >= L 时需要读入新的输入采样
+
+/* Function implementations --------------------------------------------------*/
+
+static uint32_t src_gcd(uint32_t a, uint32_t b)
+{
+    while (b)
+    {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/**
+ * @brief  Zeroth-order modified Bessel function (Kaiser window)
+ */
+static float src_bessel_i0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+    float q = x * x * 0.25f;
+
+    for (int k = 1; k < 32 && term > sum * 1e-8f; k++)
+    {
+        term *= q / (float)(k * k);
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief  Read two adjacent Q15 values as one word (history windows are not word aligned)
+ */
+static inline uint32_t src_read_pair(const int16_t *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));  // Cortex-M4 上编译为一条 LDR (允许非对齐访问)
+    return v;
+}
+
+#if defined(__ARM_FEATURE_DSP)
+static inline int32_t src_smlad(uint32_t x, uint32_t y, int32_t acc)
+{
+    __asm__("smlad %0, %1, %2, %0" : "+r"(acc) : "r"(x), "r"(y));
+    return acc;
+}
+
+static inline int32_t src_smladx(uint32_t x, uint32_t y, int32_t acc)
+{
+    __asm__("smladx %0, %1, %2, %0" : "+r"(acc) : "r"(x), "r"(y));
+    return acc;
+}
+#else
+static inline int32_t src_smlad(uint32_t x, uint32_t y, int32_t acc)
+{
+    return acc + (int16_t)x * (int16_t)y + (int16_t)(x >> 16) * (int16_t)(y >> 16);
+}
+
+static inline int32_t src_smladx(uint32_t x, uint32_t y, int32_t acc)
+{
+    return acc + (int16_t)x * (int16_t)(y >> 16) + (int16_t)(x >> 16) * (int16_t)y;
+}
+#endif
+
+/**
+ * @brief  Dot product of one history window with one polyphase branch
+ * @param  w: 最早的采样在前, 共 taps 个
+ * @param  c: 系数 (已按 w 的顺序排列, reverse = 1 时倒序使用)
+ */
+static inline int16_t src_dot(const int16_t *w, const int16_t *c, uint32_t taps, uint8_t reverse)
+{
+    int32_t acc = 1 << 14;  // 舍入
+
+    if (!reverse)
+    {
+        for (uint32_t i = 0; i < taps; i += 2) acc = src_smlad(src_read_pair(w + i), src_read_pair(c + i), acc);
+    }
+    else
+    {
+        // w[i] * c[taps-1-i] + w[i+1] * c[taps-2-i]: 系数字 (c[taps-2-i], c[taps-1-i]) 交叉相乘
+        for (uint32_t i = 0; i < taps; i += 2)
+        {
+            acc = src_smladx(src_read_pair(w + i), src_read_pair(c + taps - 2 - i), acc);
+        }
+    }
+
+    acc >>= 15;
+    if (acc > 32767) acc = 32767;
+    if (acc < -32768) acc = -32768;
+    return (int16_t)acc;
+}
+
+/**
+ * @brief  Design the prototype low-pass and store the first half of its polyphase branches
+ * @note   分支 p 的第 i 个系数 (对应 src_hist 窗口中第 i 个采样) 为 h[p + (taps-1-i) * L];
+ *         每个分支单独归一化到直流增益 1, 避免不同相位之间的增益波动
+ */
+static void src_design(uint32_t in_rate)
+{
+    uint32_t L = src_info.phases;
+    uint32_t taps = src_info.taps;
+    uint32_t n = L * taps;
+    float center = (float)(n - 1) * 0.5f;
+    uint32_t min_rate = (in_rate < AUDIO_SRC_OUT_RATE) ? in_rate : AUDIO_SRC_OUT_RATE;
+    float fc = 0.5f * SRC_ROLLOFF * (float)min_rate / ((float)in_rate * (float)L);  // 周期/原型采样
+    float i0_beta = src_bessel_i0(SRC_KAISER_BETA);
+    float h[AUDIO_SRC_MAX_TAPS];
+
+    for (uint32_t p = 0; p < src_stored; p++)
+    {
+        float sum = 0.0f;
+        for (uint32_t i = 0; i < taps; i++)
+        {
+            float t = (float)(p + (taps - 1 - i) * L) - center;
+            float x = 2.0f * fc * t;
+            float r = 2.0f * t / (float)(n - 1);
+            float sinc = (x == 0.0f) ? 1.0f : sinf(SRC_PI * x) / (SRC_PI * x);
+            float win = src_bessel_i0(SRC_KAISER_BETA * sqrtf(fmaxf(0.0f, 1.0f - r * r))) / i0_beta;
+            h[i] = sinc * win;
+            sum += h[i];
+        }
+
+        int16_t *c = src_coef + p * taps;
+        for (uint32_t i = 0; i < taps; i++)
+        {
+            int32_t q = (int32_t)lrintf(h[i] / sum * 32768.0f);
+            if (q > 32767) q = 32767;
+            if (q < -32768) q = -32768;
+            c[i] = (int16_t)q;
+        }
+    }
+}
+
+int Audio_SRC_Configure(uint32_t in_rate)
+{
+    if (in_rate == src_info.in_rate) return src_result;
+
+    uint16_t old_taps = src_info.taps;
+    src_info.in_rate = in_rate;
+    src_info.out_rate = AUDIO_SRC_OUT_RATE;
+    src_info.phases = 1;
+    src_info.step = 1;
+    src_info.taps = 0;
+    src_result = -1;
+
+    if (in_rate == AUDIO_SRC_OUT_RATE) src_result = 0;
+    if (in_rate == 0 || in_rate == AUDIO_SRC_OUT_RATE) return src_result;
+
+    uint32_t g = src_gcd(AUDIO_SRC_OUT_RATE, in_rate);
+    uint32_t L = AUDIO_SRC_OUT_RATE / g;
+    uint32_t M = in_rate / g;
+    uint32_t stored = (L + 1) / 2;
+    uint32_t taps = AUDIO_SRC_MAX_TAPS;
+
+    while (taps >= AUDIO_SRC_MIN_TAPS && stored * taps > AUDIO_SRC_COEF_SIZE) taps -= 2;
+    if (taps < AUDIO_SRC_MIN_TAPS || M > 0xFFFF) return -1;  // 例如 11.025kHz (L = 640): 直通, 由 I2S 按原采样率输出
+
+    src_info.phases = (uint16_t)L;
+    src_info.step = (uint16_t)M;
+    src_info.taps = (uint16_t)taps;
+    src_stored = (uint16_t)stored;
+    src_design(in_rate);
+
+    // 抽头数不变时保留历史采样 (无缝衔接), 否则窗口长度变了, 只能清空
+    if (taps != old_taps) Audio_SRC_Reset();
+    src_phase = L;  // 第一个输出之前先读入一个输入采样
+    src_result = 0;
+    return 0;
+}
+
+void Audio_SRC_Reset(void)
+{
+    memset(src_hist, 0, sizeof(src_hist));
+    src_pos = 0;
+    src_phase = src_info.phases;
+}
+
+uint8_t Audio_SRC_IsBypass(void)
+{
+    return src_info.taps == 0;
+}
+
+uint32_t Audio_SRC_Process(const int16_t *in, uint32_t *in_samples, int16_t *out, uint32_t out_samples)
+{
+    uint32_t in_frames = *in_samples / 2;
+    uint32_t out_frames = out_samples / 2;
+
+    if (src_info.taps == 0)
+    {
+        uint32_t n = (in_frames < out_frames) ? in_frames : out_frames;
+        memcpy(out, in, n * 2 * sizeof(int16_t));
+        *in_samples = n * 2;
+        return n * 2;
+    }
+
+    const uint32_t L = src_info.phases;
+    const uint32_t M = src_info.step;
+    const uint32_t taps = src_info.taps;
+    uint32_t phase = src_phase;
+    uint32_t pos = src_pos;
+    uint32_t used = 0;
+    uint32_t produced = 0;
+
+    while (produced < out_frames)
+    {
+        while (phase >= L)
+        {
+            if (used == in_frames) goto done;
+
+            // 新采样同时写入两份, 窗口起点后移一位
+            src_hist[0][pos] = src_hist[0][pos + taps] = in[2 * used];
+            src_hist[1][pos] = src_hist[1][pos + taps] = in[2 * used + 1];
+            if (++pos == taps) pos = 0;
+            used++;
+            phase -= L;
+        }
+
+        const int16_t *c;
+        uint8_t reverse = (phase >= src_stored);
+        c = src_coef + (reverse ? (L - 1 - phase) : phase) * taps;
+
+        out[2 * produced] = src_dot(&src_hist[0][pos], c, taps, reverse);
+        out[2 * produced + 1] = src_dot(&src_hist[1][pos], c, taps, reverse);
+        produced++;
+        phase += M;
+    }
+
+done:
+    src_phase = phase;
+    src_pos = (uint16_t)pos;
+    *in_samples = used * 2;
+    return produced * 2;
+}
+
+void Audio_SRC_GetInfo(Audio_SRC_Info *info)
+{
+    if (info) *info = src_info;
+}
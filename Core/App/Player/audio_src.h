@@ -0,0 +1,80 @@
+/*
+ * audio_src.h
+ * 采样率转换 (多相 FIR, Q15 定点)
+ *
+ * 解码器输出的 22.05/32/44.1/48kHz 等采样率统一转换为 AUDIO_SRC_OUT_RATE, I2S 始终工作在同一个采样率:
+ * 切歌时不需要重新配置 PLLI2S, 不同采样率的歌曲之间也可以无缝衔接。
+ * 转换比 L/M = 输出采样率/输入采样率 (约分后), 原型滤波器为 Kaiser 窗 sinc, 按相位拆成 L 组,
+ * 每组 taps 个 Q15 系数按历史采样顺序连续存放, Cortex-M4 上每条 SMLAD 完成两次乘加。
+ *
+ * 本模块不依赖 HAL / RTOS, 可以直接在主机上编译。
+ */
+
+#ifndef APP_PLAYER_AUDIO_SRC_H_
+#define APP_PLAYER_AUDIO_SRC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/* 为 0 时不做采样率转换, I2S 按每首歌的采样率重新配置 (原来的做法) */
+#ifndef AUDIO_SRC_ENABLE
+#define AUDIO_SRC_ENABLE 1
+#endif
+
+#define AUDIO_SRC_OUT_RATE 48000  // I2S 固定输出采样率
+#define AUDIO_SRC_MAX_TAPS 32     // 每个相位的最大抽头数 (必须为偶数)
+#define AUDIO_SRC_MIN_TAPS 16     // 系数表放不下这么多抽头时不支持该采样率
+#define AUDIO_SRC_COEF_SIZE 2560  // 系数表大小 (Q15 个数, 5KB): 对称性只存一半相位, 44.1k -> 48k 为 80 x 32
+
+    /* 当前转换参数 */
+    typedef struct
+    {
+        uint32_t in_rate;
+        uint32_t out_rate;
+        uint16_t phases;  // L
+        uint16_t step;    // M
+        uint16_t taps;    // 每个相位的抽头数, 0 表示直通
+    } Audio_SRC_Info;
+
+    /**
+     * @brief  按输入采样率生成多相系数 (与当前采样率相同时直接返回)
+     * @note   历史采样不清除, 连续播放不同采样率的歌曲时不会在衔接处产生突变
+     * @param  in_rate: 输入采样率
+     * @retval 0: 成功 (输出为 AUDIO_SRC_OUT_RATE), -1: 不支持该采样率 (已切换为直通)
+     */
+    int Audio_SRC_Configure(uint32_t in_rate);
+
+    /**
+     * @brief  清空历史采样和相位 (开始播放或定位后调用)
+     */
+    void Audio_SRC_Reset(void);
+
+    /**
+     * @brief  输入输出采样率相同或不支持转换时为直通
+     */
+    uint8_t Audio_SRC_IsBypass(void);
+
+    /**
+     * @brief  转换一段立体声交织 PCM
+     * @param  in: 输入采样
+     * @param  in_samples: 输入采样数 (左右声道合计), 返回时为实际消耗的采样数
+     * @param  out: 输出缓冲区
+     * @param  out_samples: 输出空间 (左右声道合计)
+     * @retval 写入的采样数 (左右声道合计); 输入用完或输出写满时返回
+     */
+    uint32_t Audio_SRC_Process(const int16_t *in, uint32_t *in_samples, int16_t *out, uint32_t out_samples);
+
+    /**
+     * @brief  读取当前转换参数
+     */
+    void Audio_SRC_GetInfo(Audio_SRC_Info *info);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_AUDIO_SRC_H_ */
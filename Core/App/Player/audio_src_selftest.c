@@ -0,0 +1,182 @@
+/*
+ * audio_src_selftest.c
+ * 采样率转换自检 (说明见 audio_src_selftest.h)
+ */
+
+#include "audio_src_selftest.h"
+#include "audio_src.h"
+
+#include <math.h>
+#include <string.h>
+
+#ifdef USE_HAL_DRIVER
+#include "dwt.h"
+
+#define SELFTEST_CLOCK() DWT_GetCycles()
+#else
+#include <time.h>
+
+static uint32_t selftest_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000000U + (uint32_t)ts.tv_nsec;
+}
+
+#define SELFTEST_CLOCK() selftest_clock()
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define SELFTEST_IN_SAMPLES 576      // 每次送入的采样数, 与 music_player.c 的 SRC_IN_SAMPLES 相同
+#define SELFTEST_OUT_SAMPLES 2304    // 每次输出空间, 与 PCM_RING_BLOCK_SAMPLES 相同
+#define SELFTEST_SETTLE_PAIRS 256    // 跳过的输出 (滤波器建立)
+#define SELFTEST_MEASURE_PAIRS 9600  // 参与拟合的输出 (0.2 秒)
+#define SELFTEST_AMPLITUDE 0.9
+#define SELFTEST_GAIN_TOLERANCE_DB 0.5f
+#define SELFTEST_PI 3.14159265358979323846
+
+/* Private typedef -----------------------------------------------------------*/
+// 最小二乘拟合 y = a * sin(wn) + b * cos(wn) + c 的累加量
+typedef struct
+{
+    double s[3][3];
+    double r[3];
+    double yy;
+} Sine_Fit;
+
+/* Private variables ---------------------------------------------------------*/
+// 用例: 每个采样率一个中频和一个通带上部的频率 (-6dB 截止频率为 0.455 * min(输入, 输出采样率));
+// 22.05kHz 只有 16 个抽头, 过渡带较宽, 9kHz 已衰减约 1.8dB, 所以上部频率取 8kHz
+static const struct
+{
+    uint32_t in_rate;
+    uint32_t freq;
+    float limit_db;
+} selftest_cases[AUDIO_SRC_SELFTEST_CASES] = {
+    {22050, 1000, -70.0f}, {22050, 8000, -70.0f}, {32000, 1000, -70.0f},
+    {32000, 13000, -70.0f}, {44100, 1000, -70.0f}, {44100, 18000, -70.0f},
+};
+
+static int16_t selftest_in[SELFTEST_IN_SAMPLES] __attribute__((aligned(4)));
+static int16_t selftest_out[SELFTEST_OUT_SAMPLES] __attribute__((aligned(4)));
+
+/* Function implementations --------------------------------------------------*/
+
+static void fit_add(Sine_Fit *fit, double w, uint32_t n, double y)
+{
+    double v[3] = {sin(w * n), cos(w * n), 1.0};
+
+    for (int a = 0; a < 3; a++)
+    {
+        fit->r[a] += v[a] * y;
+        for (int b = 0; b < 3; b++) fit->s[a][b] += v[a] * v[b];
+    }
+    fit->yy += y * y;
+}
+
+/**
+ * @brief  Solve the normal equations and split the energy into sine and residual
+ * @retval THD+N (dB)
+ */
+static float fit_solve(Sine_Fit *fit, double *amplitude)
+{
+    double x[3];
+
+    // 3x3 高斯消元 (法方程矩阵对称正定, 不需要选主元)
+    for (int k = 0; k < 3; k++)
+    {
+        for (int j = k + 1; j < 3; j++)
+        {
+            double m = fit->s[j][k] / fit->s[k][k];
+            for (int l = k; l < 3; l++) fit->s[j][l] -= m * fit->s[k][l];
+            fit->r[j] -= m * fit->r[k];
+        }
+    }
+    for (int k = 2; k >= 0; k--)
+    {
+        x[k] = fit->r[k];
+        for (int l = k + 1; l < 3; l++) x[k] -= fit->s[k][l] * x[l];
+        x[k] /= fit->s[k][k];
+    }
+
+    // 正弦能量按幅度计算, 残差 = 总能量 - 拟合能量 (不含直流)
+    double sine = (x[0] * x[0] + x[1] * x[1]) * 0.5 * SELFTEST_MEASURE_PAIRS;
+    double residual = fit->yy - sine - x[2] * x[2] * SELFTEST_MEASURE_PAIRS;
+    if (residual < 1e-9) residual = 1e-9;
+
+    *amplitude = sqrt(x[0] * x[0] + x[1] * x[1]);
+    return (float)(10.0 * log10(residual / sine));
+}
+
+static void run_case(Audio_SRC_Selftest_Case *tc, uint32_t *mismatch)
+{
+    Sine_Fit fit;
+    double w_in = 2.0 * SELFTEST_PI * tc->freq / tc->in_rate;
+    double w_out = 2.0 * SELFTEST_PI * tc->freq / AUDIO_SRC_OUT_RATE;
+    uint32_t n_in = 0, n_out = 0, time = 0;
+
+    memset(&fit, 0, sizeof(fit));
+    Audio_SRC_Configure(tc->in_rate);
+    Audio_SRC_Reset();
+
+    while (n_out < SELFTEST_SETTLE_PAIRS + SELFTEST_MEASURE_PAIRS)
+    {
+        for (uint32_t i = 0; i < SELFTEST_IN_SAMPLES / 2; i++)
+        {
+            int16_t v = (int16_t)lrint(SELFTEST_AMPLITUDE * 32767.0 * sin(w_in * (n_in + i)));
+            selftest_in[2 * i] = v;
+            selftest_in[2 * i + 1] = v;
+        }
+        n_in += SELFTEST_IN_SAMPLES / 2;
+
+        const int16_t *in = selftest_in;
+        uint32_t left = SELFTEST_IN_SAMPLES;
+        while (left > 0)
+        {
+            uint32_t used = left;
+            uint32_t t0 = SELFTEST_CLOCK();
+            uint32_t out = Audio_SRC_Process(in, &used, selftest_out, SELFTEST_OUT_SAMPLES);
+            time += SELFTEST_CLOCK() - t0;
+            in += used;
+            left -= used;
+
+            for (uint32_t i = 0; i < out / 2; i++, n_out++)
+            {
+                if (selftest_out[2 * i] != selftest_out[2 * i + 1]) (*mismatch)++;
+                if (n_out >= SELFTEST_SETTLE_PAIRS && n_out < SELFTEST_SETTLE_PAIRS + SELFTEST_MEASURE_PAIRS)
+                {
+                    fit_add(&fit, w_out, n_out, selftest_out[2 * i]);
+                }
+            }
+        }
+    }
+
+    double amplitude;
+    tc->thdn_db = fit_solve(&fit, &amplitude);
+    tc->gain_db = (float)(20.0 * log10(amplitude / (SELFTEST_AMPLITUDE * 32767.0)));
+    tc->out_pairs = SELFTEST_MEASURE_PAIRS;
+    tc->time = n_out ? time / n_out : 0;
+}
+
+int32_t Audio_SRC_Selftest_Run(Audio_SRC_Selftest_Result *result)
+{
+    result->failed = 0;
+    for (int i = 0; i < AUDIO_SRC_SELFTEST_CASES; i++)
+    {
+        Audio_SRC_Selftest_Case *tc = &result->cases[i];
+        uint32_t mismatch = 0;
+
+        tc->in_rate = selftest_cases[i].in_rate;
+        tc->freq = selftest_cases[i].freq;
+        tc->limit_db = selftest_cases[i].limit_db;
+        run_case(tc, &mismatch);
+
+        if (tc->thdn_db > tc->limit_db || fabsf(tc->gain_db) > SELFTEST_GAIN_TOLERANCE_DB || mismatch)
+        {
+            result->failed++;
+        }
+    }
+
+    Audio_SRC_Reset();
+    return result->failed;
+}
@@ -0,0 +1,59 @@
+/*
+ * audio_src_selftest.h
+ * 采样率转换自检: 正弦信号经 Audio_SRC_Process() 转换到 48kHz 后测量 THD+N 和每个输出采样的用时
+ *
+ * 对每个用例 (输入采样率 + 频率) 生成 0.9 满幅的立体声正弦, 按音频任务的方式分段送入 (每次最多
+ * 576 个采样, 与 music_player.c 的 SRC_IN_SAMPLES 相同), 跳过开头的滤波器建立过程后, 对输出做
+ * 最小二乘正弦拟合 (已知频率, 拟合幅度、相位和直流): 拟合残差与正弦能量之比即为 THD+N,
+ * 同时包含谐波、量化噪声和没有滤干净的镜像。
+ *
+ * 本模块不依赖 RTOS: 板上由 music_player_init() 运行 (AUDIO_SRC_SELFTEST 为 1 时), 用时为 DWT 周期数;
+ * 电脑上由 Tools/audio_src_test 运行, 用时为纳秒。
+ */
+
+#ifndef APP_PLAYER_AUDIO_SRC_SELFTEST_H_
+#define APP_PLAYER_AUDIO_SRC_SELFTEST_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/* 为 1 时 music_player_init() 运行一次自检, 结果保存在 src_selftest_result 中供调试器查看 */
+#ifndef AUDIO_SRC_SELFTEST
+#define AUDIO_SRC_SELFTEST 0
+#endif
+
+#define AUDIO_SRC_SELFTEST_CASES 6
+
+    typedef struct
+    {
+        uint32_t in_rate;
+        uint32_t freq;       // 正弦频率 (Hz)
+        float limit_db;      // THD+N 上限
+        float thdn_db;       // 测得的 THD+N (dB, 相对正弦能量)
+        float gain_db;       // 拟合幅度相对输入幅度
+        uint32_t out_pairs;  // 参与测量的输出采样对
+        uint32_t time;       // 每个输出采样对的 Audio_SRC_Process() 用时: 板上为 DWT 周期数, 电脑上为纳秒
+    } Audio_SRC_Selftest_Case;
+
+    typedef struct
+    {
+        int32_t failed;  // THD+N 超出上限、增益偏差超过 0.5dB 或左右声道不同的用例数
+        Audio_SRC_Selftest_Case cases[AUDIO_SRC_SELFTEST_CASES];
+    } Audio_SRC_Selftest_Result;
+
+    /**
+     * @brief  运行全部用例
+     * @note   会改变 audio_src 的当前采样率, 结束时清空历史采样; 必须在没有播放时调用
+     * @retval 失败的用例数
+     */
+    int32_t Audio_SRC_Selftest_Run(Audio_SRC_Selftest_Result *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_AUDIO_SRC_SELFTEST_H_ */
@@ -0,0 +1,182 @@
+/*
+ * codec_ape.c
+ * APE (Monkey's Audio) 解码器 (移植自正点原子 apeplay.c / Rockbox libdemac), 接入统一解码器接口
+ *
+ * 与正点原子实现相同, 只支持 16 位、压缩等级不高于 3000 (Normal) 的文件, 更高等级 F407 无法实时解码。
+ * 每次解码 APE_BLOCKS_PER_LOOP 个 block, 交织后的 PCM 直接写入环形缓冲区;
+ * 解码器状态、滤波器缓冲、中间结果和输入缓冲区都从 codec_mem (CCM) 分配。
+ */
+
+#include "audio_decoder.h"
+#include "codec_mem.h"
+#include "stream_reader.h"
+#include "ape/apedecoder.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define APE_BLOCKS_PER_LOOP 1152      // 每次解码的 block 数, 输出 2304 个采样 = 环形缓冲区一块
+#define APE_FILE_BUF_SZ (16 * 1024)  // 输入缓冲区 (正点原子为 48KB)
+#define APE_REFILL_LEVEL (4 * APE_BLOCKS_PER_LOOP)
+#define APE_FILTERBUF64_SIZE ((64 * 3 + FILTER_HISTORY_SIZE) * 2)
+
+/* External variables --------------------------------------------------------*/
+extern filter_int *filterbuf64;  // apedecoder.c
+
+/* Private variables ---------------------------------------------------------*/
+static struct ape_ctx_t *apex = NULL;
+static uint8_t *apeBuffer = NULL;
+static uint8_t *apeReadPtr = NULL;
+static int apeBytesInBuffer = 0;
+static int apeFirstByte = 3;
+static int32_t *apeDecoded0 = NULL;
+static int32_t *apeDecoded1 = NULL;
+static uint32_t apeCurrentFrame = 0;
+static int apeBlocksLeft = 0;  // 当前帧剩余的 block 数, 0 表示需要初始化下一帧
+static Audio_Info ape_info;
+
+/* Function implementations --------------------------------------------------*/
+
+/**
+ * @brief  Restart decoding at a frame boundary
+ * @param  frame: 帧序号
+ * @param  fpos: 4 字节对齐的文件位置
+ * @param  firstbyte: 帧起始字节在 32 位字内的位置 (小端字节序)
+ */
+static int ape_start_at(uint32_t frame, uint32_t fpos, int firstbyte)
+{
+    if (Stream_Seek(fpos) != FR_OK) return -1;
+
+    apeBytesInBuffer = Stream_Read(apeBuffer, APE_FILE_BUF_SZ);
+    apeReadPtr = apeBuffer;
+    apeFirstByte = firstbyte;
+    apeCurrentFrame = frame;
+    apeBlocksLeft = 0;
+    return 0;
+}
+
+static void ape_refill_input(void)
+{
+    if (apeBytesInBuffer >= APE_REFILL_LEVEL) return;
+
+    memmove(apeBuffer, apeReadPtr, apeBytesInBuffer);
+    apeReadPtr = apeBuffer;
+    apeBytesInBuffer += Stream_Read(apeBuffer + apeBytesInBuffer, APE_FILE_BUF_SZ - apeBytesInBuffer);
+}
+
+static int ape_probe(const uint8_t *header, uint32_t len)
+{
+    return len >= 4 && memcmp(header, "MAC ", 4) == 0;
+}
+
+static int ape_open(Audio_Info *info)
+{
+    apex = Codec_Mem_Alloc(sizeof(struct ape_ctx_t));
+    if (!apex) return -1;
+
+    if (ape_parseheader(apex) != 0) return -1;
+
+    // 压缩率不支持/版本不支持/不是16位音频格式
+    if (apex->compressiontype > 3000 || apex->fileversion < APE_MIN_VERSION || apex->fileversion > APE_MAX_VERSION ||
+        apex->bps != 16 || apex->channels < 1 || apex->channels > 2 || apex->samplerate == 0)
+    {
+        return -2;
+    }
+
+    filterbuf64 = Codec_Mem_Alloc(APE_FILTERBUF64_SIZE * sizeof(filter_int));
+    apeDecoded0 = Codec_Mem_Alloc(APE_BLOCKS_PER_LOOP * sizeof(int32_t));
+    apeDecoded1 = Codec_Mem_Alloc(APE_BLOCKS_PER_LOOP * sizeof(int32_t));
+    apeBuffer = Codec_Mem_Alloc(APE_FILE_BUF_SZ);
+    if (!filterbuf64 || !apeDecoded0 || !apeDecoded1 || !apeBuffer) return -3;
+
+    if (ape_start_at(0, apex->firstframe, 3) != 0) return -1;
+
+    ape_info.sample_rate = apex->samplerate;
+    ape_info.channels = apex->channels;
+    ape_info.bits_per_sample = apex->bps;
+    ape_info.total_samples = apex->totalsamples;
+    ape_info.bitrate = 0;
+    if (apex->totalsamples > 0)
+    {
+        ape_info.bitrate =
+            (uint32_t)((uint64_t)(Stream_Size() - apex->firstframe) * 8U * apex->samplerate / apex->totalsamples);
+    }
+
+    if (info) *info = ape_info;
+    return 0;
+}
+
+static int ape_decode_frame(int16_t *dst, uint32_t space)
+{
+    int bytesconsumed;
+
+    if (apeBlocksLeft == 0)
+    {
+        if (apeCurrentFrame >= apex->totalframes) return AUDIO_DEC_EOF;
+
+        // 计算一帧里面有多少个 blocks, 然后初始化帧解码
+        int nblocks = (apeCurrentFrame == apex->totalframes - 1) ? apex->finalframeblocks : apex->blocksperframe;
+        apex->currentframeblocks = nblocks;
+
+        init_frame_decoder(apex, apeReadPtr, &apeFirstByte, &bytesconsumed);
+        apeReadPtr += bytesconsumed;
+        apeBytesInBuffer -= bytesconsumed;
+        apeBlocksLeft = nblocks;
+    }
+
+    int count = space / 2;
+    if (count > APE_BLOCKS_PER_LOOP) count = APE_BLOCKS_PER_LOOP;
+    if (count > apeBlocksLeft) count = apeBlocksLeft;
+    if (count == 0) return AUDIO_DEC_NEED_BLOCK;
+
+    if (decode_chunk(apex, apeReadPtr, &apeFirstByte, &bytesconsumed, apeDecoded0, apeDecoded1, dst, count) != 0 ||
+        bytesconsumed > 4 * APE_BLOCKS_PER_LOOP || bytesconsumed > apeBytesInBuffer)
+    {
+        return AUDIO_DEC_EOF;  // 数据损坏, 无法继续
+    }
+
+    apeReadPtr += bytesconsumed;
+    apeBytesInBuffer -= bytesconsumed;
+    apeBlocksLeft -= count;
+    if (apeBlocksLeft == 0) apeCurrentFrame++;
+
+    ape_refill_input();
+    return count * 2;
+}
+
+static int ape_seek(uint32_t sample)
+{
+    // 只能定位到帧起始位置 (每帧通常 73728 x 4 个采样, 约 6.7 秒)
+    if (!apex->seektable || apex->blocksperframe == 0) return -1;
+
+    uint32_t frame = sample / apex->blocksperframe;
+    if (frame >= apex->totalframes) frame = apex->totalframes - 1;
+
+    uint32_t fpos = apex->seektable[frame];
+    return ape_start_at(frame, fpos & ~3U, 3 - (fpos & 3));
+}
+
+static void ape_get_info(Audio_Info *info)
+{
+    *info = ape_info;
+}
+
+static void ape_close(void)
+{
+    apex = NULL;
+    apeBuffer = NULL;
+    filterbuf64 = NULL;
+    apeBlocksLeft = 0;
+}
+
+const Audio_Decoder Audio_Decoder_APE = {
+    .name = "APE",
+    .ext = ".ape",
+    .format = MUSIC_FORMAT_APE,
+    .probe = ape_probe,
+    .open = ape_open,
+    .decode_frame = ape_decode_frame,
+    .seek = ape_seek,
+    .get_info = ape_get_info,
+    .close = ape_close,
+};
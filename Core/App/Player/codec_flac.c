@@ -0,0 +1,237 @@
+/*
+ * codec_flac.c
+ * FLAC 解码器 (移植自正点原子 flacplay.c / Rockbox libffmpegFLAC), 接入统一解码器接口
+ *
+ * 一帧通常为 4096 点, 比环形缓冲区的一块 (1152 点) 大。解码结果保留在 decoded0/decoded1 中,
+ * 再按块剩余空间分段交织输出到环形缓冲区, 不需要额外的整帧 PCM 缓冲区。
+ * 输入缓冲区 (max_framesize) 与 decoded0/decoded1 都从 codec_mem (CCM) 分配。
+ * 24 位文件截断为 16 位输出。
+ */
+
+#include "audio_decoder.h"
+#include "codec_mem.h"
+#include "stream_reader.h"
+#include "flac/flacdecoder.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define FLAC_DEFAULT_FRAMESIZE 0x4000  // STREAMINFO 中帧长未知时使用的输入缓冲区大小
+#define FLAC_STREAMINFO_SIZE 34
+
+/* Private variables ---------------------------------------------------------*/
+static FLACContext *fc = NULL;
+static uint8_t *flacBuffer = NULL;
+static int flacBufSize = 0;
+static int flacBytesLeft = 0;
+static uint8_t flacEof = 0;  // 文件数据已全部读入缓冲区
+static int flacPending = 0;  // 当前帧尚未输出的采样数 (每声道)
+static int flacOffset = 0;   // 当前帧下一个待输出的采样
+static uint32_t flacDataStart = 0;
+static Audio_Info flac_info;
+
+/* Function implementations --------------------------------------------------*/
+
+/**
+ * @brief  Append file data behind the unread bytes
+ */
+static void flac_refill_input(void)
+{
+    if (flacEof || flacBytesLeft >= flacBufSize) return;
+
+    uint32_t want = flacBufSize - flacBytesLeft;
+    uint32_t br = Stream_Read(flacBuffer + flacBytesLeft, want);
+    flacBytesLeft += br;
+    if (br < want) flacEof = 1;
+}
+
+/**
+ * @brief  Drop consumed bytes from the front of the input buffer
+ */
+static void flac_consume(int bytes)
+{
+    if (bytes > flacBytesLeft) bytes = flacBytesLeft;
+    flacBytesLeft -= bytes;
+    memmove(flacBuffer, flacBuffer + bytes, flacBytesLeft);
+}
+
+static int flac_probe(const uint8_t *header, uint32_t len)
+{
+    return len >= 4 && memcmp(header, "fLaC", 4) == 0;
+}
+
+static int flac_open(Audio_Info *info)
+{
+    uint8_t buf[FLAC_STREAMINFO_SIZE];
+    uint8_t have_streaminfo = 0;
+    uint8_t endofmetadata = 0;
+
+    if (Stream_Read(buf, 4) != 4 || !flac_probe(buf, 4)) return -1;
+
+    fc = Codec_Mem_Alloc(sizeof(FLACContext));
+    if (!fc) return -1;
+
+    // 遍历 metadata 块, 只解析 STREAMINFO
+    while (!endofmetadata)
+    {
+        if (Stream_Read(buf, 4) != 4) return -1;
+
+        endofmetadata = buf[0] & 0x80;  // 判断是不是最后一个 block
+        uint32_t blocklength = ((uint32_t)buf[1] << 16) | ((uint16_t)buf[2] << 8) | buf[3];
+        uint32_t next = Stream_Tell() + blocklength;
+
+        if ((buf[0] & 0x7F) == 0 && blocklength >= FLAC_STREAMINFO_SIZE)
+        {
+            if (Stream_Read(buf, FLAC_STREAMINFO_SIZE) != FLAC_STREAMINFO_SIZE) return -1;
+
+            fc->min_blocksize = ((uint16_t)buf[0] << 8) | buf[1];
+            fc->max_blocksize = ((uint16_t)buf[2] << 8) | buf[3];
+            fc->min_framesize = ((uint32_t)buf[4] << 16) | ((uint16_t)buf[5] << 8) | buf[6];
+            fc->max_framesize = ((uint32_t)buf[7] << 16) | ((uint16_t)buf[8] << 8) | buf[9];
+            fc->samplerate = ((uint32_t)buf[10] << 12) | ((uint16_t)buf[11] << 4) | ((buf[12] & 0xF0) >> 4);
+            fc->channels = ((buf[12] & 0x0E) >> 1) + 1;
+            fc->bps = ((((uint16_t)buf[12] & 0x01) << 4) | ((buf[13] & 0xF0) >> 4)) + 1;
+            fc->totalsamples = ((uint32_t)buf[14] << 24) | ((uint32_t)buf[15] << 16) | ((uint16_t)buf[16] << 8) | buf[17];
+            have_streaminfo = 1;
+        }
+        Stream_Seek(next);
+    }
+    flacDataStart = Stream_Tell();
+
+    // 与正点原子实现相同, 只支持固定块长; 输出为立体声 16 位
+    if (!have_streaminfo || fc->samplerate == 0) return -2;
+    if (fc->min_blocksize != fc->max_blocksize || fc->max_blocksize == 0) return -2;
+    if (fc->channels > 2 || fc->bps < 16 || fc->bps > 24) return -2;
+
+    if (fc->max_framesize == 0) fc->max_framesize = FLAC_DEFAULT_FRAMESIZE;
+
+    fc->decoded0 = Codec_Mem_Alloc(fc->max_blocksize * sizeof(int));
+    fc->decoded1 = (fc->channels == 2) ? Codec_Mem_Alloc(fc->max_blocksize * sizeof(int)) : fc->decoded0;
+    flacBufSize = fc->max_framesize;
+    flacBuffer = Codec_Mem_Alloc(flacBufSize);
+    if (!fc->decoded0 || !fc->decoded1 || !flacBuffer) return -3;  // 块长太大, CCM 放不下
+
+    flacBytesLeft = 0;
+    flacEof = 0;
+    flacPending = 0;
+    flacOffset = 0;
+    flac_refill_input();
+
+    flac_info.sample_rate = fc->samplerate;
+    flac_info.channels = fc->channels;
+    flac_info.bits_per_sample = fc->bps;
+    flac_info.total_samples = fc->totalsamples;
+    flac_info.bitrate = 0;
+    if (fc->totalsamples > 0)
+    {
+        flac_info.bitrate =
+            (uint32_t)((uint64_t)(Stream_Size() - flacDataStart) * 8U * fc->samplerate / fc->totalsamples);
+    }
+
+    if (info) *info = flac_info;
+    return 0;
+}
+
+/**
+ * @brief  Skip to the next frame header after a decode error
+ * @retval 0: 找到帧头, -1: 剩余数据中没有帧头
+ */
+static int flac_resync(void)
+{
+    while (1)
+    {
+        if (flacBytesLeft > 4)
+        {
+            int offset = flac_seek_frame(flacBuffer + 1, flacBytesLeft - 1, fc);
+            if (offset >= 0)
+            {
+                flac_consume(offset + 1);
+                return 0;
+            }
+            // 保留最后 3 字节, 防止帧头跨越缓冲区边界
+            flac_consume(flacBytesLeft - 3);
+        }
+        if (flacEof) return -1;
+        flac_refill_input();
+    }
+}
+
+static int flac_decode_frame(int16_t *dst, uint32_t space)
+{
+    if (flacPending == 0)
+    {
+        flac_refill_input();
+        if (flacBytesLeft == 0) return AUDIO_DEC_EOF;
+
+        if (flac_decode_frame_raw(fc, flacBuffer, flacBytesLeft) != 0)
+        {
+            // 坏帧或文件末尾的标签: 寻找下一帧
+            if (flac_resync() != 0)
+            {
+                flacBytesLeft = 0;
+                return AUDIO_DEC_EOF;
+            }
+            return 0;
+        }
+
+        flac_consume(fc->gb.index / 8);
+        flacPending = fc->blocksize;
+        flacOffset = 0;
+    }
+
+    int n = space / 2;
+    if (n > flacPending) n = flacPending;
+
+    flac_interleave16(fc, flacOffset, n, dst);
+    flacOffset += n;
+    flacPending -= n;
+    return n * 2;
+}
+
+static int flac_seek(uint32_t sample)
+{
+    if (fc->totalsamples == 0) return -1;
+    if (sample > fc->totalsamples) sample = fc->totalsamples;
+
+    // 按文件位置比例估算, 然后搜索下一个帧头
+    uint32_t pos = flacDataStart +
+                   (uint32_t)((uint64_t)(Stream_Size() - flacDataStart) * sample / fc->totalsamples);
+    if (Stream_Seek(pos) != FR_OK) return -1;
+
+    flacBytesLeft = 0;
+    flacEof = 0;
+    flacPending = 0;
+    flacOffset = 0;
+    flac_refill_input();
+
+    int offset = (flacBytesLeft > 4) ? flac_seek_frame(flacBuffer, flacBytesLeft, fc) : -1;
+    if (offset < 0) return flac_resync();
+
+    flac_consume(offset);
+    return 0;
+}
+
+static void flac_get_info(Audio_Info *info)
+{
+    *info = flac_info;
+}
+
+static void flac_close(void)
+{
+    fc = NULL;
+    flacBuffer = NULL;
+    flacBytesLeft = 0;
+    flacPending = 0;
+}
+
+const Audio_Decoder Audio_Decoder_FLAC = {
+    .name = "FLAC",
+    .ext = ".flac",
+    .format = MUSIC_FORMAT_FLAC,
+    .probe = flac_probe,
+    .open = flac_open,
+    .decode_frame = flac_decode_frame,
+    .seek = flac_seek,
+    .get_info = flac_get_info,
+    .close = flac_close,
+};
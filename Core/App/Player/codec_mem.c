@@ -0,0 +1,45 @@
+/*
+ * codec_mem.c
+ * 解码器工作内存 (CCM RAM, 所有解码器共用)
+ */
+
+#include "codec_mem.h"
+#include <string.h>
+
+// .ccmram 段不会被启动代码清零, 分配时再清零
+#if defined(__GNUC__)
+__attribute__((section(".ccmram")))
+#endif
+static uint8_t codec_memory_pool[CODEC_MEM_SIZE] __attribute__((aligned(4)));
+static size_t codec_pool_offset = 0;
+
+void Codec_Mem_Reset(void)
+{
+    codec_pool_offset = 0;
+}
+
+void *Codec_Mem_Alloc(size_t size)
+{
+    // 4-byte alignment
+    size = (size + 3U) & ~(size_t)3U;
+
+    if (codec_pool_offset + size > sizeof(codec_memory_pool))
+    {
+        return NULL;  // Out of memory
+    }
+
+    void *ptr = &codec_memory_pool[codec_pool_offset];
+    codec_pool_offset += size;
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+size_t Codec_Mem_Used(void)
+{
+    return codec_pool_offset;
+}
+
+size_t Codec_Mem_Free(void)
+{
+    return sizeof(codec_memory_pool) - codec_pool_offset;
+}
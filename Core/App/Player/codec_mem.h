@@ -0,0 +1,48 @@
+/*
+ * codec_mem.h
+ * 解码器工作内存 (CCM RAM, 所有解码器共用)
+ *
+ * 同一时间只有一个解码器在工作, 所以各解码器的内部缓冲区都从这块内存顺序分配,
+ * 打开新文件前整体复位。CCM 不能被 DMA 访问, 只能存放 CPU 使用的数据
+ * (解码器状态、输入缓冲、中间结果), PCM 输出仍然写入 SRAM 中的环形缓冲区。
+ */
+
+#ifndef APP_PLAYER_CODEC_MEM_H_
+#define APP_PLAYER_CODEC_MEM_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CODEC_MEM_SIZE (56 * 1024)  // CCM 共 64KB, 取代原来 Helix 专用的 30KB 内存池
+
+    /**
+     * @brief  释放全部已分配的内存 (打开新文件前调用)
+     */
+    void Codec_Mem_Reset(void);
+
+    /**
+     * @brief  分配一块 4 字节对齐、已清零的内存
+     * @retval 内存地址, 空间不足时返回 NULL
+     */
+    void *Codec_Mem_Alloc(size_t size);
+
+    /**
+     * @brief  已使用字节数
+     */
+    size_t Codec_Mem_Used(void);
+
+    /**
+     * @brief  剩余字节数
+     */
+    size_t Codec_Mem_Free(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_CODEC_MEM_H_ */
@@ -0,0 +1,713 @@
+/*
+ * codec_mp3.c
+ * MP3 解码器 (Helix), 接入统一解码器接口
+ *
+ * Helix 的内部状态和 MP3 输入缓冲区都从 codec_mem (CCM) 分配,
+ * 每帧 (1152 点 x 2 声道 = 2304 个采样) 直接解码到环形缓冲区的当前块;
+ * 当前块剩余空间不足一帧时 (换曲或裁剪后块内位置不再对齐) 先解码到帧缓冲区再分段输出。
+ *
+ * 无缝播放: 按 Xing 帧中 LAME 扩展的编码器延迟/结尾填充裁掉开头和结尾的静音,
+ * 开头另外裁掉解码器本身的 529 点延迟。
+ *
+ * 定位:
+ *   1. 播放过程中每隔约 1 秒记录一帧的文件偏移 (稀疏帧索引), 索引内的目标只需一次 Stream_Seek
+ *      加最多约 1 秒的帧头解析, 可精确到采样
+ *   2. 目标在索引末尾之后不远时逐帧解析帧头扫描过去 (只读 4 字节帧头, 同时补全索引)
+ *   3. 更远的目标按 Xing/Info TOC 或 VBRI 表估算位置, 没有 VBR 头时按 CBR 计算
+ *   定位后先解码并丢弃目标之前的几帧, 重新积累 bit reservoir (main_data_begin 最多向前引用 511 字节)
+ *   和 IMDCT 重叠数据, 保证目标帧输出干净, 再丢弃目标帧内目标采样之前的部分。
+ */
+
+#include "audio_decoder.h"
+#include "codec_mem.h"
+#include "mp3_decoder.h"
+#include "stream_reader.h"
+
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+// Layer III 帧头解析结果
+typedef struct
+{
+    uint32_t sample_rate;
+    uint32_t bitrate;      // bps, 0 表示自由格式码率
+    uint16_t frame_bytes;  // 整帧长度 (含帧头), 自由格式时为 0
+    uint16_t samples;      // 每帧每声道采样数 (MPEG1: 1152, MPEG2/2.5: 576)
+    uint8_t mpeg1;
+    uint8_t mono;
+    uint8_t crc;
+} MP3_Header;
+
+/* Private define ------------------------------------------------------------*/
+#define MP3_INBUF_SIZE 5120     // MP3 输入缓冲区大小 (5KB, 与正点原子 MP3_FILE_BUF_SZ 一致)
+#define MP3_REFILL_LEVEL 2000   // 剩余数据少于该值时补充 (MAINBUF_SIZE = 1940)
+#define MP3_PROBE_RETRIES 100   // 打开或定位时寻找帧头的最大尝试次数
+
+#define MP3_INDEX_SIZE 512            // 稀疏帧索引项数 (2KB), 写满后间隔加倍
+#define MP3_SCAN_LIMIT (256 * 1024)   // 目标距离索引末尾不超过该字节数时逐帧扫描, 否则按 TOC 估算
+#define MP3_RESERVOIR_BYTES 511       // main_data_begin 的最大值
+#define MP3_MAX_PRIME_FRAMES 8        // 定位后最多预解码并丢弃的帧数
+#define MP3_XING_TOC_SIZE 100
+#define MP3_DECODER_DELAY 529         // MDCT + 多相滤波器组引入的固定延迟 (采样)
+#define MP3_MAX_FRAME_SAMPLES 2304    // 一帧输出的最大采样数 (1152 x 2 声道)
+
+/* Private variables ---------------------------------------------------------*/
+static MP3_DecoderHandle mp3Decoder = NULL;
+static uint8_t *mp3InBuffer = NULL;
+static int mp3BytesLeft = 0;
+static uint8_t *mp3ReadPtr = NULL;
+static uint32_t mp3DataStart = 0;  // 第一个音频帧的文件偏移 (ID3 标签和 Xing/VBRI 帧之后)
+static Audio_Info mp3_info;
+
+static uint16_t mp3SamplesPerFrame = 1152;
+static uint32_t mp3TotalFrames = 0;    // 来自 Xing/VBRI 头, 0 表示未知
+static uint16_t mp3EncDelay = 0;       // LAME 扩展: 编码器在开头加入的采样数
+static uint16_t mp3EncPadding = 0;     // LAME 扩展: 编码器在结尾补齐整帧的采样数
+static uint32_t mp3AvgFrameBytes = 0;  // 平均帧长, 0 表示自由格式码率 (不支持索引)
+
+// Xing/Info TOC: toc[i] * bytes / 256 为 i% 时长处的文件偏移 (相对 Xing 帧)
+static uint8_t *mp3Toc = NULL;
+static uint32_t mp3TocBase = 0;
+static uint32_t mp3TocBytes = 0;
+
+// VBRI 表 (已换算为绝对偏移): mp3Vbri[k] 为第 k * mp3VbriFrames 帧的位置
+static uint32_t *mp3Vbri = NULL;
+static uint16_t mp3VbriCount = 0;
+static uint16_t mp3VbriFrames = 0;
+
+// 稀疏帧索引: mp3Index[k] 为第 k * mp3IndexStep 帧的文件偏移, 只从文件开头连续向后记录
+static uint32_t *mp3Index = NULL;
+static uint16_t mp3IndexCount = 0;
+static uint32_t mp3IndexStep = 1;
+
+static uint32_t mp3CurFrame = 0;       // 下一个待解码帧的序号
+static uint8_t mp3FrameExact = 0;      // mp3CurFrame 是否准确 (按 TOC 估算定位后不再记录索引)
+static uint32_t mp3DiscardFrames = 0;  // 定位后需要解码并丢弃的帧数
+static uint32_t mp3SkipSamples = 0;    // 接下来的输出中需要丢弃的采样数 (每声道, 可跨越多帧)
+
+// 无缝播放裁剪 (解码器采样序号, 从第一个音频帧开始计数)
+static uint32_t mp3StartSkip = 0;  // 开头丢弃的采样数 (编码器延迟 + 解码器延迟)
+static uint32_t mp3EndSample = 0;  // 有效数据的结束位置, 0 表示不裁剪结尾
+
+// 当前块放不下的帧: 解码到 mp3PcmBuffer, 下次调用继续输出
+static int16_t *mp3PcmBuffer = NULL;
+static int mp3PcmPending = 0;
+static int mp3PcmOffset = 0;
+
+static const uint16_t mp3_bitrates[2][15] = {
+    {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160},      // MPEG2/2.5
+    {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320},  // MPEG1
+};
+static const uint16_t mp3_samplerates[3] = {44100, 48000, 32000};
+
+/* Function implementations --------------------------------------------------*/
+
+static uint32_t get_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint16_t get_be16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+/**
+ * @brief  Parse a Layer III frame header
+ * @param  p: 指向同步头的 4 字节
+ * @retval 0: 有效帧头, -1: 无效
+ */
+static int mp3_parse_header(const uint8_t *p, MP3_Header *h)
+{
+    if (p[0] != 0xFF || (p[1] & 0xE0) != 0xE0) return -1;
+
+    uint8_t version = (p[1] >> 3) & 0x03;  // 0: MPEG2.5, 1: 保留, 2: MPEG2, 3: MPEG1
+    uint8_t layer = (p[1] >> 1) & 0x03;    // 1: Layer III
+    uint8_t br_idx = p[2] >> 4;
+    uint8_t sr_idx = (p[2] >> 2) & 0x03;
+    if (version == 1 || layer != 1 || br_idx == 15 || sr_idx == 3) return -1;
+
+    h->mpeg1 = (version == 3);
+    h->sample_rate = mp3_samplerates[sr_idx] >> (version == 3 ? 0 : (version == 2 ? 1 : 2));
+    h->samples = h->mpeg1 ? 1152 : 576;
+    h->bitrate = mp3_bitrates[h->mpeg1][br_idx] * 1000U;
+    h->frame_bytes = 0;
+    if (h->bitrate > 0)
+    {
+        h->frame_bytes = (uint16_t)((h->samples / 8) * h->bitrate / h->sample_rate + ((p[2] >> 1) & 0x01));
+    }
+    h->mono = ((p[3] >> 6) == 3);
+    h->crc = !(p[1] & 0x01);
+    return 0;
+}
+
+/**
+ * @brief  Read and parse the frame header at a file position
+ * @retval 0: 有效且与当前文件采样率一致, -1: 无效
+ */
+static int mp3_read_header(uint32_t pos, MP3_Header *h)
+{
+    uint8_t buf[4];
+
+    if (Stream_Seek(pos) != FR_OK || Stream_Read(buf, sizeof(buf)) != sizeof(buf)) return -1;
+    if (mp3_parse_header(buf, h) != 0 || h->frame_bytes == 0) return -1;
+    return (h->sample_rate == mp3_info.sample_rate) ? 0 : -1;
+}
+
+/**
+ * @brief  Move unread MP3 bytes to the buffer start and append file data
+ * @retval Number of bytes read from file (0 = EOF)
+ */
+static uint32_t mp3_refill_input(void)
+{
+    memmove(mp3InBuffer, mp3ReadPtr, mp3BytesLeft);
+    mp3ReadPtr = mp3InBuffer;
+
+    uint32_t br = Stream_Read(mp3InBuffer + mp3BytesLeft, MP3_INBUF_SIZE - mp3BytesLeft);
+    mp3BytesLeft += br;
+    return br;
+}
+
+/**
+ * @brief  Drop buffered input and continue reading at a file position
+ */
+static void mp3_restart_input(uint32_t pos)
+{
+    Stream_Seek(pos);
+    mp3BytesLeft = 0;
+    mp3ReadPtr = mp3InBuffer;
+}
+
+/**
+ * @brief  File offset of mp3ReadPtr
+ */
+static uint32_t mp3_input_pos(void)
+{
+    return Stream_Tell() - mp3BytesLeft;
+}
+
+/**
+ * @brief  Find the next frame header in the input buffer
+ * @param  h: 输出帧头
+ * @note   下一帧的帧头 (数据足够时) 也要有效且采样率一致, 排除伪同步头;
+ *         mp3_info.sample_rate 不为 0 (已打开) 时还要求与文件采样率一致
+ * @retval 0: mp3ReadPtr 指向帧头, -1: 文件剩余部分没有有效帧
+ */
+static int mp3_find_frame(MP3_Header *h)
+{
+    for (int retries = 0; retries < MP3_PROBE_RETRIES; retries++)
+    {
+        if (mp3BytesLeft < MP3_REFILL_LEVEL && mp3_refill_input() == 0 && mp3BytesLeft < 4) return -1;
+
+        int offset = MP3_FindSyncWord(mp3ReadPtr, mp3BytesLeft);
+        if (offset < 0)
+        {
+            // 保留最后一个字节, 防止同步头跨越缓冲区边界
+            mp3ReadPtr += mp3BytesLeft - 1;
+            mp3BytesLeft = 1;
+            continue;
+        }
+        mp3ReadPtr += offset;
+        mp3BytesLeft -= offset;
+
+        if (mp3BytesLeft >= 4 && mp3_parse_header(mp3ReadPtr, h) == 0)
+        {
+            MP3_Header next;
+            int n = h->frame_bytes;
+            uint32_t sr = mp3_info.sample_rate ? mp3_info.sample_rate : h->sample_rate;
+
+            if (h->sample_rate == sr &&
+                (n == 0 || n + 4 > mp3BytesLeft ||
+                 (mp3_parse_header(mp3ReadPtr + n, &next) == 0 && next.sample_rate == sr)))
+            {
+                return 0;
+            }
+        }
+
+        // 伪同步头: 跳过一个字节继续寻找
+        mp3ReadPtr++;
+        mp3BytesLeft--;
+    }
+    return -1;
+}
+
+/**
+ * @brief  Parse a Xing/Info or VBRI header inside the first frame
+ * @param  p: 第一帧的帧头
+ * @param  len: p 处可用的字节数
+ * @param  pos: 第一帧的文件偏移
+ * @retval 1: 第一帧是 VBR 信息帧 (不含音频), 0: 普通音频帧
+ */
+static int mp3_parse_vbr_header(const uint8_t *p, int len, const MP3_Header *h, uint32_t pos)
+{
+    // Xing/Info 位于 side info 之后
+    int off = 4 + (h->crc ? 2 : 0) + (h->mpeg1 ? (h->mono ? 17 : 32) : (h->mono ? 9 : 17));
+    if (off + 8 <= len && (memcmp(p + off, "Xing", 4) == 0 || memcmp(p + off, "Info", 4) == 0))
+    {
+        const uint8_t *x = p + off + 8;
+        uint32_t flags = get_be32(p + off + 4);
+        uint32_t bytes = 0;
+
+        if ((flags & 0x01) && x + 4 <= p + len)
+        {
+            mp3TotalFrames = get_be32(x);
+            x += 4;
+        }
+        if ((flags & 0x02) && x + 4 <= p + len)
+        {
+            bytes = get_be32(x);
+            x += 4;
+        }
+        if ((flags & 0x04) && x + MP3_XING_TOC_SIZE <= p + len)
+        {
+            if (bytes > 0 && mp3TotalFrames > 0) mp3Toc = Codec_Mem_Alloc(MP3_XING_TOC_SIZE);
+            if (mp3Toc)
+            {
+                memcpy(mp3Toc, x, MP3_XING_TOC_SIZE);
+                mp3TocBase = pos;
+                mp3TocBytes = bytes;
+            }
+            x += MP3_XING_TOC_SIZE;
+        }
+        if (flags & 0x08) x += 4;  // quality
+
+        // LAME 扩展 (ffmpeg 写入 "Lavc"/"Lavf"): 第 21~23 字节为编码器延迟和结尾填充, 各 12 位
+        if (x + 24 <= p + len &&
+            (memcmp(x, "LAME", 4) == 0 || memcmp(x, "Lavc", 4) == 0 || memcmp(x, "Lavf", 4) == 0))
+        {
+            mp3EncDelay = (uint16_t)((x[21] << 4) | (x[22] >> 4));
+            mp3EncPadding = (uint16_t)(((x[22] & 0x0F) << 8) | x[23]);
+        }
+        if (bytes > 0 && mp3TotalFrames > 0) mp3AvgFrameBytes = bytes / mp3TotalFrames;
+        return 1;
+    }
+
+    // VBRI 固定位于帧头之后 32 字节
+    off = 4 + 32;
+    if (off + 26 <= len && memcmp(p + off, "VBRI", 4) == 0)
+    {
+        const uint8_t *v = p + off;
+        uint32_t bytes = get_be32(v + 10);
+        uint16_t entries = get_be16(v + 18);
+        uint16_t scale = get_be16(v + 20);
+        uint16_t entry_bytes = get_be16(v + 22);
+
+        mp3TotalFrames = get_be32(v + 14);
+        mp3VbriFrames = get_be16(v + 24);
+        if (bytes > 0 && mp3TotalFrames > 0) mp3AvgFrameBytes = bytes / mp3TotalFrames;
+
+        if (entries > 0 && entry_bytes >= 1 && entry_bytes <= 4 && mp3VbriFrames > 0 &&
+            off + 26 + entries * entry_bytes <= len)
+        {
+            mp3Vbri = Codec_Mem_Alloc(entries * sizeof(uint32_t));
+            if (mp3Vbri)
+            {
+                // 表项为每段 (mp3VbriFrames 帧) 的字节数, 累加为绝对偏移
+                const uint8_t *e = v + 26;
+                uint32_t acc = pos + h->frame_bytes;
+                for (uint16_t i = 0; i < entries; i++)
+                {
+                    mp3Vbri[i] = acc;
+                    uint32_t size = 0;
+                    for (uint16_t b = 0; b < entry_bytes; b++) size = (size << 8) | *e++;
+                    acc += size * scale;
+                }
+                mp3VbriCount = entries;
+            }
+        }
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Record the offset of a frame in the sparse index
+ * @note   只接受紧接在最后一项之后的位置, 保证索引从文件开头连续
+ */
+static void mp3_index_add(uint32_t frame, uint32_t pos)
+{
+    if (!mp3Index || frame != mp3IndexCount * mp3IndexStep) return;
+
+    if (mp3IndexCount == MP3_INDEX_SIZE)
+    {
+        // 索引已满: 间隔加倍, 保留偶数项
+        for (uint16_t i = 0; i < MP3_INDEX_SIZE / 2; i++) mp3Index[i] = mp3Index[2 * i];
+        mp3IndexCount = MP3_INDEX_SIZE / 2;
+        mp3IndexStep *= 2;
+        if (frame != mp3IndexCount * mp3IndexStep) return;
+    }
+    mp3Index[mp3IndexCount++] = pos;
+}
+
+/**
+ * @brief  Walk frame headers forward until a frame number is reached
+ * @param  pos: 输入为 frame 帧的偏移, 输出为 target 帧的偏移
+ * @param  frame: 输入为起始帧序号, 输出为 target
+ * @retval 0: 成功, -1: 遇到无效帧头
+ */
+static int mp3_scan_frames(uint32_t *pos, uint32_t *frame, uint32_t target)
+{
+    MP3_Header h;
+
+    while (*frame < target)
+    {
+        if (mp3_read_header(*pos, &h) != 0) return -1;
+
+        *pos += h.frame_bytes;
+        (*frame)++;
+        mp3_index_add(*frame, *pos);
+    }
+    return 0;
+}
+
+/**
+ * @brief  Estimate the file offset of a frame from the VBR header (or CBR)
+ */
+static uint32_t mp3_estimate_pos(uint32_t frame)
+{
+    if (mp3Toc)
+    {
+        // TOC 按 1% 时长分段, 段内线性插值
+        uint64_t p = (uint64_t)frame * 100U;
+        uint32_t i = (uint32_t)(p / mp3TotalFrames);
+        if (i > 99) return mp3TocBase + mp3TocBytes;
+
+        uint32_t frac = (uint32_t)(p % mp3TotalFrames);
+        uint32_t a = mp3Toc[i];
+        uint32_t b = (i < 99) ? mp3Toc[i + 1] : 256;
+        uint64_t pos256 = (uint64_t)a * mp3TotalFrames + (uint64_t)(b - a) * frac;
+        return mp3TocBase + (uint32_t)(pos256 * mp3TocBytes / (256ULL * mp3TotalFrames));
+    }
+
+    if (mp3Vbri)
+    {
+        uint32_t k = frame / mp3VbriFrames;
+        if (k >= mp3VbriCount) k = mp3VbriCount - 1;
+        return mp3Vbri[k] + (frame - k * mp3VbriFrames) * mp3AvgFrameBytes;
+    }
+
+    return mp3DataStart + (uint32_t)((uint64_t)frame * mp3SamplesPerFrame * mp3_info.bitrate / 8U / mp3_info.sample_rate);
+}
+
+/**
+ * @brief  Frames to decode and drop before the target so it starts with a full bit reservoir
+ */
+static uint32_t mp3_prime_frames(void)
+{
+    uint32_t avg = mp3AvgFrameBytes ? mp3AvgFrameBytes : 1;
+    uint32_t n = (MP3_RESERVOIR_BYTES + avg - 1) / avg + 1;  // 填满 reservoir, 再加一帧 IMDCT 重叠
+    return (n > MP3_MAX_PRIME_FRAMES) ? MP3_MAX_PRIME_FRAMES : n;
+}
+
+/**
+ * @brief  Trim encoder delay / padding and the samples before a seek target from a decoded frame
+ * @param  out: 本帧输出 (mp3CurFrame 已指向下一帧)
+ * @param  samples: 本帧输出的采样数 (左右声道合计)
+ * @retval 保留的采样数
+ */
+static int mp3_trim_output(int16_t *out, int samples)
+{
+    uint32_t frames = samples / 2;
+
+    // 结尾填充: 帧序号准确时才能确定结束位置
+    if (mp3EndSample > 0 && mp3FrameExact)
+    {
+        uint32_t first = (mp3CurFrame - 1) * mp3SamplesPerFrame;
+        if (first >= mp3EndSample) return 0;
+        if (first + frames > mp3EndSample) frames = mp3EndSample - first;
+    }
+
+    uint32_t skip = (mp3SkipSamples < frames) ? mp3SkipSamples : frames;
+    mp3SkipSamples -= skip;
+    frames -= skip;
+    if (skip > 0 && frames > 0) memmove(out, out + skip * 2, frames * 2 * sizeof(int16_t));
+    return (int)(frames * 2);
+}
+
+/**
+ * @brief  Copy the part of a decoded frame that did not fit into the previous block
+ * @retval 输出的采样数
+ */
+static int mp3_output_pending(int16_t *dst, uint32_t space)
+{
+    int n = (mp3PcmPending < (int)space) ? mp3PcmPending : (int)space;
+
+    memcpy(dst, mp3PcmBuffer + mp3PcmOffset, n * sizeof(int16_t));
+    mp3PcmOffset += n;
+    mp3PcmPending -= n;
+    return n;
+}
+
+/**
+ * @brief  Skip the ID3v2 tag at the current stream position
+ * @retval None
+ */
+static void mp3_skip_id3(void)
+{
+    uint8_t header[10];
+    uint32_t start = Stream_Tell();
+
+    if (Stream_Read(header, sizeof(header)) != sizeof(header))
+    {
+        Stream_Seek(start);
+        return;
+    }
+    // 没有 ID3 标签时回到原位置 (仍在预读缓冲区内, 不会重新读卡)
+    Stream_Seek(start + MP3_GetID3TagSize(header));
+}
+
+static int mp3_probe(const uint8_t *header, uint32_t len)
+{
+    if (len < 3) return 0;
+    if (header[0] == 'I' && header[1] == 'D' && header[2] == '3') return 1;
+    return header[0] == 0xFF && (header[1] & 0xE0) == 0xE0;
+}
+
+static int mp3_open(Audio_Info *info)
+{
+    MP3_Header hdr;
+
+    mp3Decoder = MP3_Decoder_Init();
+    mp3InBuffer = Codec_Mem_Alloc(MP3_INBUF_SIZE);
+    mp3PcmBuffer = Codec_Mem_Alloc(MP3_MAX_FRAME_SAMPLES * sizeof(int16_t));
+    mp3Index = Codec_Mem_Alloc(MP3_INDEX_SIZE * sizeof(uint32_t));
+    if (!mp3Decoder || !mp3InBuffer || !mp3PcmBuffer) return -1;
+
+    memset(&mp3_info, 0, sizeof(mp3_info));
+    mp3TotalFrames = 0;
+    mp3EncDelay = 0;
+    mp3EncPadding = 0;
+    mp3Toc = NULL;
+    mp3Vbri = NULL;
+    mp3VbriCount = 0;
+
+    mp3_skip_id3();
+    mp3BytesLeft = 0;
+    mp3ReadPtr = mp3InBuffer;
+
+    // 只解析第一帧的帧头, 不解码, 数据留在缓冲区中由 decode_frame 继续使用
+    if (mp3_find_frame(&hdr) != 0) return -2;
+    mp3DataStart = mp3_input_pos();
+    mp3SamplesPerFrame = hdr.samples;
+    mp3AvgFrameBytes = hdr.frame_bytes;
+
+    // 第一帧是 Xing/Info/VBRI 信息帧时跳过它, 音频从下一帧开始
+    if (mp3_parse_vbr_header(mp3ReadPtr, mp3BytesLeft, &hdr, mp3DataStart) && hdr.frame_bytes > 0)
+    {
+        mp3DataStart += hdr.frame_bytes;
+        mp3_restart_input(mp3DataStart);
+    }
+
+    mp3_info.sample_rate = hdr.sample_rate;
+    mp3_info.channels = hdr.mono ? 1 : 2;
+    mp3_info.bits_per_sample = 16;
+    mp3_info.bitrate = hdr.bitrate;
+    mp3StartSkip = 0;
+    mp3EndSample = 0;
+    if (mp3TotalFrames > 0)
+    {
+        uint32_t decoded = mp3TotalFrames * mp3SamplesPerFrame;
+
+        mp3_info.total_samples = decoded;
+        if (mp3AvgFrameBytes > 0) mp3_info.bitrate = mp3AvgFrameBytes * 8U * hdr.sample_rate / hdr.samples;
+
+        // 有效数据为 [编码器延迟 + 解码器延迟, 总采样数 - 结尾填充 + 解码器延迟)
+        if ((mp3EncDelay || mp3EncPadding) && mp3EncDelay + mp3EncPadding < decoded)
+        {
+            mp3StartSkip = mp3EncDelay + MP3_DECODER_DELAY;
+            mp3EndSample = decoded - mp3EncPadding + MP3_DECODER_DELAY;
+            if (mp3EndSample > decoded) mp3EndSample = decoded;
+            mp3_info.total_samples = mp3EndSample - mp3StartSkip;
+        }
+    }
+    else if (mp3_info.bitrate > 0)
+    {
+        // 按 CBR 估算
+        mp3_info.total_samples =
+            (uint32_t)((uint64_t)(Stream_Size() - mp3DataStart) * 8U * hdr.sample_rate / mp3_info.bitrate);
+    }
+
+    // 自由格式码率无法按帧头计算帧长, 不建立索引
+    if (mp3AvgFrameBytes == 0) mp3Index = NULL;
+    mp3IndexCount = 0;
+    mp3IndexStep = (hdr.sample_rate + hdr.samples / 2) / hdr.samples;  // 约 1 秒
+    if (mp3IndexStep == 0) mp3IndexStep = 1;
+    mp3_index_add(0, mp3DataStart);
+
+    mp3CurFrame = 0;
+    mp3FrameExact = 1;
+    mp3DiscardFrames = 0;
+    mp3SkipSamples = mp3StartSkip;
+    mp3PcmPending = 0;
+
+    if (info) *info = mp3_info;
+    return 0;
+}
+
+static int mp3_decode_frame(int16_t *dst, uint32_t space)
+{
+    if (mp3PcmPending > 0) return mp3_output_pending(dst, space);
+
+    // 已到有效数据末尾, 剩下的是编码器填充
+    if (mp3EndSample > 0 && mp3FrameExact && mp3CurFrame * mp3SamplesPerFrame >= mp3EndSample) return AUDIO_DEC_EOF;
+
+    // Refill input buffer if needed (参考正点原子: bytesleft < MAINBUF_SIZE * 2)
+    uint32_t br = 1;
+    if (mp3BytesLeft < MP3_REFILL_LEVEL)
+    {
+        br = mp3_refill_input();
+        if (br == 0 && mp3BytesLeft == 0) return AUDIO_DEC_EOF;
+    }
+
+    int offset = MP3_FindSyncWord(mp3ReadPtr, mp3BytesLeft);
+    if (offset < 0)
+    {
+        if (br == 0) return AUDIO_DEC_EOF;  // 文件剩余部分没有有效帧
+
+        // 保留最后一个字节, 防止同步头跨越缓冲区边界
+        mp3ReadPtr += mp3BytesLeft - 1;
+        mp3BytesLeft = 1;
+        return 0;
+    }
+    mp3ReadPtr += offset;
+    mp3BytesLeft -= offset;
+
+    // 先只解析帧头, 确认本帧输出能放进当前块, 能放下时让解码器直接写入环形缓冲区
+    MP3_FrameInfo frameInfo;
+    if (MP3_Decoder_GetNextFrameInfo(mp3Decoder, mp3ReadPtr, &frameInfo) != MP3_OK)
+    {
+        // 伪同步头: 跳过一个字节继续寻找
+        mp3ReadPtr++;
+        mp3BytesLeft--;
+        return 0;
+    }
+
+    int16_t *out = (frameInfo.outputSamps > space) ? mp3PcmBuffer : dst;
+
+    if (mp3FrameExact) mp3_index_add(mp3CurFrame, mp3_input_pos());
+
+    MP3_Error err = MP3_Decoder_DecodeFrame(mp3Decoder, &mp3ReadPtr, &mp3BytesLeft, out, &frameInfo);
+    if (err == MP3_OK || err == MP3_ERR_MAINDATA_UNDERFLOW)
+    {
+        mp3CurFrame++;
+
+        // 定位后的预解码帧: 只用于积累 bit reservoir, 输出丢弃
+        if (mp3DiscardFrames > 0)
+        {
+            mp3DiscardFrames--;
+            return 0;
+        }
+        // MAINDATA_UNDERFLOW: bit reservoir 还未积累够 (通常是开头几帧), 该帧已被消耗, 继续下一帧即可
+        if (err != MP3_OK) return 0;
+
+        int n = mp3_trim_output(out, (int)frameInfo.outputSamps);
+        if (out == dst) return n;
+
+        mp3PcmPending = n;
+        mp3PcmOffset = 0;
+        return mp3_output_pending(dst, space);
+    }
+    else if (err == MP3_ERR_INDATA_UNDERFLOW)
+    {
+        // 数据不足，需要更多数据 - 强制触发 refill
+        if (mp3_refill_input() == 0) return AUDIO_DEC_EOF;
+    }
+    else if (mp3BytesLeft > 0)
+    {
+        // 其他错误: 跳过损坏数据, 之后的帧序号不再可靠
+        mp3ReadPtr++;
+        mp3BytesLeft--;
+        mp3FrameExact = 0;
+    }
+    return 0;
+}
+
+static int mp3_seek(uint32_t sample)
+{
+    if (mp3_info.sample_rate == 0) return -1;
+    if (mp3_info.total_samples > 0 && sample >= mp3_info.total_samples) sample = mp3_info.total_samples - 1;
+    sample += mp3StartSkip;  // 对外的采样位置不含编码器延迟
+
+    uint32_t target = sample / mp3SamplesPerFrame;
+    uint32_t prime = mp3_prime_frames();
+    uint32_t start = (target > prime) ? target - prime : 0;
+    uint32_t pos = mp3DataStart;
+    uint32_t frame = 0;
+    uint8_t exact = 0;
+
+    // 1. 从不晚于 start 的最近索引项开始扫描帧头 (目标在索引之外但不远时同时补全索引)
+    if (mp3Index && mp3IndexCount > 0)
+    {
+        uint32_t k = start / mp3IndexStep;
+        if (k >= mp3IndexCount) k = mp3IndexCount - 1;
+        frame = k * mp3IndexStep;
+        pos = mp3Index[k];
+
+        if ((uint64_t)(start - frame) * mp3AvgFrameBytes <= MP3_SCAN_LIMIT)
+        {
+            exact = (mp3_scan_frames(&pos, &frame, start) == 0);
+        }
+    }
+
+    // 2. 按 TOC/VBRI/CBR 估算位置, 再对齐到帧头
+    if (!exact)
+    {
+        if (mp3_info.bitrate == 0) return -1;
+
+        MP3_Header hdr;
+        mp3_restart_input(mp3_estimate_pos(start));
+        if (mp3_find_frame(&hdr) != 0) return -1;
+        pos = mp3_input_pos();
+        frame = start;
+
+        if (!mp3Toc && !mp3Vbri && mp3AvgFrameBytes > 0)
+        {
+            // CBR: 由文件偏移反算帧序号 (填充位只影响 1 字节, 四舍五入后准确)
+            uint64_t bits_per_frame = (uint64_t)mp3SamplesPerFrame * mp3_info.bitrate;
+            frame = (uint32_t)(((uint64_t)(pos - mp3DataStart) * 8U * mp3_info.sample_rate + bits_per_frame / 2) /
+                               bits_per_frame);
+            exact = 1;
+        }
+    }
+
+    mp3CurFrame = frame;
+    mp3FrameExact = exact;
+    mp3DiscardFrames = (target > frame) ? target - frame : 0;
+    mp3SkipSamples = (target >= frame) ? sample - target * mp3SamplesPerFrame : 0;
+    mp3PcmPending = 0;
+
+    MP3_Decoder_Reset(mp3Decoder);
+    mp3_restart_input(pos);
+    return 0;
+}
+
+static void mp3_get_info(Audio_Info *info)
+{
+    *info = mp3_info;
+}
+
+static void mp3_close(void)
+{
+    MP3_Decoder_Free(mp3Decoder);
+    mp3Decoder = NULL;
+    mp3InBuffer = NULL;
+    mp3BytesLeft = 0;
+    mp3PcmBuffer = NULL;
+    mp3PcmPending = 0;
+    mp3Index = NULL;
+    mp3IndexCount = 0;
+    mp3Toc = NULL;
+    mp3Vbri = NULL;
+}
+
+const Audio_Decoder Audio_Decoder_MP3 = {
+    .name = "MP3",
+    .ext = ".mp3",
+    .format = MUSIC_FORMAT_MP3,
+    .probe = mp3_probe,
+    .open = mp3_open,
+    .decode_frame = mp3_decode_frame,
+    .seek = mp3_seek,
+    .get_info = mp3_get_info,
+    .close = mp3_close,
+};
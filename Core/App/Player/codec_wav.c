@@ -0,0 +1,165 @@
+/*
+ * codec_wav.c
+ * WAV (16 位 PCM) 解码器
+ *
+ * 逐个遍历 RIFF 块找到 "fmt " 和 "data", 不再假定固定 44 字节的文件头。
+ * 立体声数据直接从预读缓冲区拷贝到环形缓冲区; 单声道读入块的后半部分后原地展开。
+ */
+
+#include "audio_decoder.h"
+#include "stream_reader.h"
+
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    uint16_t AudioFormat;
+    uint16_t NumChannels;
+    uint32_t SampleRate;
+    uint32_t ByteRate;
+    uint16_t BlockAlign;
+    uint16_t BitsPerSample;
+} WAV_Fmt_TypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define WAV_FORMAT_PCM 0x0001
+#define WAV_FORMAT_EXTENSIBLE 0xFFFE
+
+/* Private variables ---------------------------------------------------------*/
+static Audio_Info wav_info;
+static uint32_t wav_data_start = 0;  // "data" 块数据在文件中的偏移
+static uint32_t wav_data_size = 0;
+static uint32_t wav_data_left = 0;
+static uint16_t wav_block_align = 4;
+
+/* Function implementations --------------------------------------------------*/
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int wav_probe(const uint8_t *header, uint32_t len)
+{
+    return len >= 12 && memcmp(header, "RIFF", 4) == 0 && memcmp(header + 8, "WAVE", 4) == 0;
+}
+
+static int wav_open(Audio_Info *info)
+{
+    uint8_t riff[12];
+    uint8_t chunk[8];
+    WAV_Fmt_TypeDef fmt;
+    uint8_t have_fmt = 0;
+
+    if (Stream_Read(riff, sizeof(riff)) != sizeof(riff) || !wav_probe(riff, sizeof(riff))) return -1;
+
+    while (1)
+    {
+        if (Stream_Read(chunk, sizeof(chunk)) != sizeof(chunk)) return -1;
+        uint32_t size = get_le32(chunk + 4);
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= sizeof(fmt))
+        {
+            if (Stream_Read(&fmt, sizeof(fmt)) != sizeof(fmt)) return -1;
+            Stream_Seek(Stream_Tell() + size - sizeof(fmt) + (size & 1));
+            have_fmt = 1;
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            wav_data_start = Stream_Tell();
+            wav_data_size = size;
+            break;
+        }
+        else
+        {
+            // LIST 等其他块: 跳过 (块长度为奇数时有 1 字节填充)
+            Stream_Seek(Stream_Tell() + size + (size & 1));
+        }
+    }
+
+    if (!have_fmt) return -1;
+    if (fmt.AudioFormat != WAV_FORMAT_PCM && fmt.AudioFormat != WAV_FORMAT_EXTENSIBLE) return -2;
+    if (fmt.BitsPerSample != 16 || fmt.NumChannels < 1 || fmt.NumChannels > 2) return -2;
+
+    // 录音软件中途退出时 data 块长度可能不正确
+    uint32_t file_left = Stream_Size() - wav_data_start;
+    if (wav_data_size == 0 || wav_data_size > file_left) wav_data_size = file_left;
+
+    wav_block_align = fmt.NumChannels * 2;
+    wav_data_size -= wav_data_size % wav_block_align;
+    wav_data_left = wav_data_size;
+
+    wav_info.sample_rate = fmt.SampleRate;
+    wav_info.channels = fmt.NumChannels;
+    wav_info.bits_per_sample = 16;
+    wav_info.bitrate = fmt.ByteRate * 8;
+    wav_info.total_samples = wav_data_size / wav_block_align;
+
+    if (info) *info = wav_info;
+    return 0;
+}
+
+static int wav_decode_frame(int16_t *dst, uint32_t space)
+{
+    if (wav_data_left == 0) return AUDIO_DEC_EOF;
+
+    if (wav_info.channels == 2)
+    {
+        uint32_t want = space * sizeof(int16_t);
+        if (want > wav_data_left) want = wav_data_left;
+
+        uint32_t n = Stream_Read(dst, want);
+        wav_data_left = (n < want) ? 0 : wav_data_left - n;
+        return (n >= sizeof(int16_t)) ? (int)(n / sizeof(int16_t)) : AUDIO_DEC_EOF;
+    }
+
+    // 单声道: 读到块的后半部分, 再从前往后展开为左右声道 (写入位置始终不超过未读位置)
+    uint32_t frames = space / 2;
+    uint32_t want = frames * sizeof(int16_t);
+    if (want > wav_data_left) want = wav_data_left;
+
+    int16_t *src = dst + frames;
+    uint32_t n = Stream_Read(src, want) / sizeof(int16_t);
+    wav_data_left = (n * sizeof(int16_t) < want) ? 0 : wav_data_left - want;
+    if (n == 0) return AUDIO_DEC_EOF;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        int16_t s = src[i];
+        dst[2 * i] = s;
+        dst[2 * i + 1] = s;
+    }
+    return (int)(n * 2);
+}
+
+static int wav_seek(uint32_t sample)
+{
+    uint32_t offset = sample * wav_block_align;
+    if (offset > wav_data_size) offset = wav_data_size;
+
+    wav_data_left = wav_data_size - offset;
+    return Stream_Seek(wav_data_start + offset) == FR_OK ? 0 : -1;
+}
+
+static void wav_get_info(Audio_Info *info)
+{
+    *info = wav_info;
+}
+
+static void wav_close(void)
+{
+    wav_data_left = 0;
+}
+
+const Audio_Decoder Audio_Decoder_WAV = {
+    .name = "WAV",
+    .ext = ".wav",
+    .format = MUSIC_FORMAT_WAV,
+    .probe = wav_probe,
+    .open = wav_open,
+    .decode_frame = wav_decode_frame,
+    .seek = wav_seek,
+    .get_info = wav_get_info,
+    .close = wav_close,
+};
@@ -49,39 +49,17 @@
 #include <string.h>
 #include "coder.h"
 
-/* Redirect to Static CCM RAM Allocation */
-#include "FreeRTOS.h"
-
-// Define CCM RAM section (STM32CubeIDE default supports .ccmram)
-// 26KB should be enough for Helix (approx 20-24KB)
-// Increasing to 30KB for safety
-#if defined(__GNUC__)
-__attribute__((section(".ccmram")))
-#endif
-static uint8_t helix_memory_pool[30 * 1024];
-static size_t helix_pool_offset = 0;
+/* Redirect to the shared codec arena in CCM RAM (see codec_mem.c) */
+#include "codec_mem.h"
 
 static void *helix_malloc(size_t size)
 {
-    // 4-byte alignment
-    if (size % 4 != 0)
-    {
-        size += (4 - (size % 4));
-    }
-
-    if (helix_pool_offset + size > sizeof(helix_memory_pool))
-    {
-        return NULL;  // Out of memory
-    }
-
-    void *ptr = &helix_memory_pool[helix_pool_offset];
-    helix_pool_offset += size;
-    return ptr;
+    return Codec_Mem_Alloc(size);
 }
 
 // Macro replacement for internal use
 #define malloc helix_malloc
-#define free(x) (void)(x)  // Single free is invalid, only FreeBuffers clears all
+#define free(x) (void)(x)  // Single free is invalid, the arena is reset before the next file is opened
 
 /**************************************************************************************
  * Function:    ClearBuffer
@@ -129,14 +107,12 @@ MP3DecInfo *AllocateBuffers(void)
     FrameHeader *fh;
     SideInfo *si;
     ScaleFactorInfo *sfi;
-    HuffmanInfo *hi;
+    MP3FrameData *fd;
     DequantInfo *di;
     IMDCTInfo *mi;
     SubbandInfo *sbi;
 
-    // Reset offset before every allocation sequence
-    // WARNING: This assumes SINGLE INSTANCE usage only!
-    helix_pool_offset = 0;
+    // WARNING: SINGLE INSTANCE usage only, the caller resets the arena (Codec_Mem_Reset) before opening a file
 
     mp3DecInfo = (MP3DecInfo *)malloc(sizeof(MP3DecInfo));
     if (!mp3DecInfo) return 0;
@@ -145,7 +121,7 @@ MP3DecInfo *AllocateBuffers(void)
     fh = (FrameHeader *)malloc(sizeof(FrameHeader));
     si = (SideInfo *)malloc(sizeof(SideInfo));
     sfi = (ScaleFactorInfo *)malloc(sizeof(ScaleFactorInfo));
-    hi = (HuffmanInfo *)malloc(sizeof(HuffmanInfo));
+    fd = (MP3FrameData *)malloc(sizeof(MP3FrameData)); /* holds the HuffmanInfo of both granules */
     di = (DequantInfo *)malloc(sizeof(DequantInfo));
     mi = (IMDCTInfo *)malloc(sizeof(IMDCTInfo));
     sbi = (SubbandInfo *)malloc(sizeof(SubbandInfo));
@@ -153,12 +129,13 @@ MP3DecInfo *AllocateBuffers(void)
     mp3DecInfo->FrameHeaderPS = (void *)fh;
     mp3DecInfo->SideInfoPS = (void *)si;
     mp3DecInfo->ScaleFactorInfoPS = (void *)sfi;
-    mp3DecInfo->HuffmanInfoPS = (void *)hi;
+    mp3DecInfo->FrameDataPS = (void *)fd;
+    mp3DecInfo->HuffmanInfoPS = fd ? (void *)&fd->gran[0] : 0;
     mp3DecInfo->DequantInfoPS = (void *)di;
     mp3DecInfo->IMDCTInfoPS = (void *)mi;
     mp3DecInfo->SubbandInfoPS = (void *)sbi;
 
-    if (!fh || !si || !sfi || !hi || !di || !mi || !sbi)
+    if (!fh || !si || !sfi || !fd || !di || !mi || !sbi)
     {
         FreeBuffers(mp3DecInfo); /* safe to call - only frees memory that was successfully allocated */
         return 0;
@@ -168,7 +145,7 @@ MP3DecInfo *AllocateBuffers(void)
     ClearBuffer(fh, sizeof(FrameHeader));
     ClearBuffer(si, sizeof(SideInfo));
     ClearBuffer(sfi, sizeof(ScaleFactorInfo));
-    ClearBuffer(hi, sizeof(HuffmanInfo));
+    ClearBuffer(fd, sizeof(MP3FrameData));
     ClearBuffer(di, sizeof(DequantInfo));
     ClearBuffer(mi, sizeof(IMDCTInfo));
     ClearBuffer(sbi, sizeof(SubbandInfo));
@@ -202,13 +179,51 @@ void FreeBuffers(MP3DecInfo *mp3DecInfo)
     SAFE_FREE(mp3DecInfo->FrameHeaderPS);
     SAFE_FREE(mp3DecInfo->SideInfoPS);
     SAFE_FREE(mp3DecInfo->ScaleFactorInfoPS);
-    SAFE_FREE(mp3DecInfo->HuffmanInfoPS);
+    SAFE_FREE(mp3DecInfo->FrameDataPS);
+    mp3DecInfo->HuffmanInfoPS = 0; /* points into FrameDataPS */
     SAFE_FREE(mp3DecInfo->DequantInfoPS);
     SAFE_FREE(mp3DecInfo->IMDCTInfoPS);
     SAFE_FREE(mp3DecInfo->SubbandInfoPS);
 
     SAFE_FREE(mp3DecInfo);
+}
+
+/**************************************************************************************
+ * Function:    AllocateFrameData
+ *
+ * Description: allocate an extra handoff buffer between the entropy and synthesis stages
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      pointer to cleared MP3FrameData structure, 0 if out of memory
+ *
+ * Notes:       only needed when the two stages run concurrently (double buffering),
+ *                MP3Decode() uses the one allocated in AllocateBuffers()
+ **************************************************************************************/
+void *AllocateFrameData(void)
+{
+    MP3FrameData *fd;
+
+    fd = (MP3FrameData *)malloc(sizeof(MP3FrameData));
+    if (fd) ClearBuffer(fd, sizeof(MP3FrameData));
 
-    // Explicitly reset offset, though AllocateBuffers does it too
-    helix_pool_offset = 0;
+    return fd;
+}
+
+/**************************************************************************************
+ * Function:    FreeFrameData
+ *
+ * Description: free a handoff buffer allocated with AllocateFrameData()
+ *
+ * Inputs:      pointer to MP3FrameData structure
+ *
+ * Outputs:     none
+ *
+ * Return:      none
+ **************************************************************************************/
+void FreeFrameData(void *frameData)
+{
+    SAFE_FREE(frameData);
 }
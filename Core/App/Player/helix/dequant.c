@@ -170,3 +170,45 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr)
     /* output format Q(DQ_FRACBITS_OUT) */
     return 0;
 }
+
+/**************************************************************************************
+ * Function:    SelectGranule
+ *
+ * Description: point the entropy stage at one granule of a handoff buffer
+ *
+ * Inputs:      MP3DecInfo structure filled by UnpackFrameHeader() and UnpackSideInfo()
+ *              MP3FrameData handoff buffer
+ *              index of granule about to be decoded
+ *
+ * Outputs:     HuffmanInfoPS pointing at frameData->gran[gr], so DecodeHuffman() and
+ *                Dequantize() write straight into the handoff (no copy)
+ *              side info for this granule and the frame parameters copied into the
+ *                handoff, so the synthesis stage doesn't need FrameHeader/SideInfo
+ *
+ * Return:      0 on success, -1 if null input pointers
+ **************************************************************************************/
+int SelectGranule(MP3DecInfo *mp3DecInfo, void *frameData, int gr)
+{
+    int ch;
+    FrameHeader *fh;
+    SideInfo *si;
+    MP3FrameData *fd;
+
+    /* validate pointers */
+    if (!mp3DecInfo || !mp3DecInfo->FrameHeaderPS || !mp3DecInfo->SideInfoPS || !frameData) return -1;
+
+    fh = (FrameHeader *)(mp3DecInfo->FrameHeaderPS);
+    si = (SideInfo *)(mp3DecInfo->SideInfoPS);
+    fd = (MP3FrameData *)frameData;
+
+    fd->params.nGrans = mp3DecInfo->nGrans;
+    fd->params.nChans = mp3DecInfo->nChans;
+    fd->params.nGranSamps = mp3DecInfo->nGranSamps;
+    fd->blockCutoff = fh->sfBand->l[(fh->ver == MPEG1 ? 8 : 6)] / 18; /* same as 3* num short sfb's in spec */
+
+    for (ch = 0; ch < mp3DecInfo->nChans; ch++) fd->sis[gr][ch] = si->sis[gr][ch];
+
+    mp3DecInfo->HuffmanInfoPS = (void *)&fd->gran[gr];
+
+    return 0;
+}
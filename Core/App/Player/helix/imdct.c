@@ -89,7 +89,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-1] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[0] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[0] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
 
         a0 = x[-2];
         c0 = *c;
@@ -98,7 +98,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-2] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[1] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[1] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
 
         a0 = x[-3];
         c0 = *c;
@@ -107,7 +107,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-3] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[2] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[2] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
 
         a0 = x[-4];
         c0 = *c;
@@ -116,7 +116,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-4] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[3] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[3] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
 
         a0 = x[-5];
         c0 = *c;
@@ -125,7 +125,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-5] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[4] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[4] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
 
         a0 = x[-6];
         c0 = *c;
@@ -134,7 +134,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-6] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[5] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[5] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
 
         a0 = x[-7];
         c0 = *c;
@@ -143,7 +143,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-7] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[6] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[6] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
 
         a0 = x[-8];
         c0 = *c;
@@ -152,7 +152,7 @@ static void AntiAlias(int *x, int nBfly)
         c1 = *c;
         c++;
         x[-8] = (MULSHIFT32(c0, a0) - MULSHIFT32(c1, b0)) << 1;
-        x[7] = (MULSHIFT32(c0, b0) + MULSHIFT32(c1, a0)) << 1;
+        x[7] = MULSHIFT32_ADD(MULSHIFT32(c0, b0), c1, a0) << 1;
     }
 }
 
@@ -183,12 +183,12 @@ static void WinPrevious(int *xPrev, int *xPrevWin, int btPrev)
     {
         /* this could be reordered for minimum loads/stores */
         wpLo = imdctWin[btPrev];
-        xPrevWin[0] = MULSHIFT32(wpLo[6], xPrev[2]) + MULSHIFT32(wpLo[0], xPrev[6]);
-        xPrevWin[1] = MULSHIFT32(wpLo[7], xPrev[1]) + MULSHIFT32(wpLo[1], xPrev[7]);
-        xPrevWin[2] = MULSHIFT32(wpLo[8], xPrev[0]) + MULSHIFT32(wpLo[2], xPrev[8]);
-        xPrevWin[3] = MULSHIFT32(wpLo[9], xPrev[0]) + MULSHIFT32(wpLo[3], xPrev[8]);
-        xPrevWin[4] = MULSHIFT32(wpLo[10], xPrev[1]) + MULSHIFT32(wpLo[4], xPrev[7]);
-        xPrevWin[5] = MULSHIFT32(wpLo[11], xPrev[2]) + MULSHIFT32(wpLo[5], xPrev[6]);
+        xPrevWin[0] = MULSHIFT32_ADD(MULSHIFT32(wpLo[6], xPrev[2]), wpLo[0], xPrev[6]);
+        xPrevWin[1] = MULSHIFT32_ADD(MULSHIFT32(wpLo[7], xPrev[1]), wpLo[1], xPrev[7]);
+        xPrevWin[2] = MULSHIFT32_ADD(MULSHIFT32(wpLo[8], xPrev[0]), wpLo[2], xPrev[8]);
+        xPrevWin[3] = MULSHIFT32_ADD(MULSHIFT32(wpLo[9], xPrev[0]), wpLo[3], xPrev[8]);
+        xPrevWin[4] = MULSHIFT32_ADD(MULSHIFT32(wpLo[10], xPrev[1]), wpLo[4], xPrev[7]);
+        xPrevWin[5] = MULSHIFT32_ADD(MULSHIFT32(wpLo[11], xPrev[2]), wpLo[5], xPrev[6]);
         xPrevWin[6] = MULSHIFT32(wpLo[6], xPrev[5]);
         xPrevWin[7] = MULSHIFT32(wpLo[7], xPrev[4]);
         xPrevWin[8] = MULSHIFT32(wpLo[8], xPrev[3]);
@@ -574,8 +574,8 @@ static int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int b
             d = xe - xo;
             (*xPrev++) = xe + xo; /* symmetry - xPrev[i] = xPrev[17-i] for long blocks */
 
-            yLo = (xPrevWin[i] + MULSHIFT32(d, wp[i])) << 2;
-            yHi = (xPrevWin[17 - i] + MULSHIFT32(d, wp[17 - i])) << 2;
+            yLo = MULSHIFT32_ADD(xPrevWin[i], d, wp[i]) << 2;
+            yHi = MULSHIFT32_ADD(xPrevWin[17 - i], d, wp[17 - i]) << 2;
             y[(i)*NBANDS] = yLo;
             y[(17 - i) * NBANDS] = yHi;
             mOut |= FASTABS(yLo);
@@ -722,10 +722,10 @@ static int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, i
         yLo = (xPrevWin[9 + i] << 2) + (MULSHIFT32(wp[3 + i], xBuf[5 - i]));
         mOut |= FASTABS(yLo);
         y[(9 + i) * NBANDS] = yLo;
-        yLo = (xPrevWin[12 + i] << 2) + (MULSHIFT32(wp[6 + i], xBuf[2 - i]) + MULSHIFT32(wp[0 + i], xBuf[(6 + 3) + i]));
+        yLo = (xPrevWin[12 + i] << 2) + MULSHIFT32_ADD(MULSHIFT32(wp[6 + i], xBuf[2 - i]), wp[0 + i], xBuf[(6 + 3) + i]);
         mOut |= FASTABS(yLo);
         y[(12 + i) * NBANDS] = yLo;
-        yLo = (xPrevWin[15 + i] << 2) + (MULSHIFT32(wp[9 + i], xBuf[0 + i]) + MULSHIFT32(wp[3 + i], xBuf[(6 + 5) - i]));
+        yLo = (xPrevWin[15 + i] << 2) + MULSHIFT32_ADD(MULSHIFT32(wp[9 + i], xBuf[0 + i]), wp[3 + i], xBuf[(6 + 5) - i]);
         mOut |= FASTABS(yLo);
         y[(15 + i) * NBANDS] = yLo;
     }
@@ -851,36 +851,35 @@ static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], Si
  *
  * Description: do alias reduction, inverse MDCT, overlap-add, and frequency inversion
  *
- * Inputs:      MP3DecInfo structure filled by UnpackFrameHeader(), UnpackSideInfo(),
- *                UnpackScaleFactors(), and DecodeHuffman() (for this granule, channel)
+ * Inputs:      MP3DecInfo structure (only the IMDCT state is used)
+ *              MP3FrameData filled in by MP3DecodeEntropy() (coefficients and side info
+ *                for this granule, channel)
  *                includes PCM samples in overBuf (from last call to IMDCT) for OLA
  *              index of current granule and channel
  *
  * Outputs:     PCM samples in outBuf, for input to subband transform
  *              PCM samples in overBuf, for OLA next time
- *              updated hi->nonZeroBound index for this channel
+ *              updated nonZeroBound index for this granule, channel
  *
  * Return:      0 on success,  -1 if null input pointers
  **************************************************************************************/
 // a bit faster in RAM
-int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
+int IMDCT(MP3DecInfo *mp3DecInfo, void *frameData, int gr, int ch)
 {
     int nBfly, blockCutoff;
-    FrameHeader *fh;
-    SideInfo *si;
+    MP3FrameData *fd;
+    SideInfoSub *sis;
     HuffmanInfo *hi;
     IMDCTInfo *mi;
     BlockCount bc;
 
     /* validate pointers */
-    if (!mp3DecInfo || !mp3DecInfo->FrameHeaderPS || !mp3DecInfo->SideInfoPS || !mp3DecInfo->HuffmanInfoPS ||
-        !mp3DecInfo->IMDCTInfoPS)
-        return -1;
-
-    /* si is an array of up to 4 structs, stored as gr0ch0, gr0ch1, gr1ch0, gr1ch1 */
-    fh = (FrameHeader *)(mp3DecInfo->FrameHeaderPS);
-    si = (SideInfo *)(mp3DecInfo->SideInfoPS);
-    hi = (HuffmanInfo *)(mp3DecInfo->HuffmanInfoPS);
+    if (!mp3DecInfo || !frameData || !mp3DecInfo->IMDCTInfoPS) return -1;
+
+    /* side info and coefficients come from the handoff, not the decoder (which may hold the next frame already) */
+    fd = (MP3FrameData *)frameData;
+    sis = &fd->sis[gr][ch];
+    hi = &fd->gran[gr];
     mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
 
     /* anti-aliasing done on whole long blocks only
@@ -888,14 +887,14 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
      *   nLongBlocks = number of blocks with (possibly) non-zero power
      *   nBfly = number of butterflies to do (nLongBlocks - 1, unless no long blocks)
      */
-    blockCutoff = fh->sfBand->l[(fh->ver == MPEG1 ? 8 : 6)] / 18; /* same as 3* num short sfb's in spec */
-    if (si->sis[gr][ch].blockType != 2)
+    blockCutoff = fd->blockCutoff;
+    if (sis->blockType != 2)
     {
         /* all long transforms */
         bc.nBlocksLong = MIN((hi->nonZeroBound[ch] + 7) / 18 + 1, 32);
         nBfly = bc.nBlocksLong - 1;
     }
-    else if (si->sis[gr][ch].blockType == 2 && si->sis[gr][ch].mixedBlock)
+    else if (sis->blockType == 2 && sis->mixedBlock)
     {
         /* mixed block - long transforms until cutoff, then short transforms */
         bc.nBlocksLong = blockCutoff;
@@ -918,11 +917,11 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
     bc.nBlocksPrev = mi->numPrevIMDCT[ch];
     bc.prevType = mi->prevType[ch];
     bc.prevWinSwitch = mi->prevWinSwitch[ch];
-    bc.currWinSwitch = (si->sis[gr][ch].mixedBlock ? blockCutoff : 0); /* where WINDOW switches (not nec. transform) */
+    bc.currWinSwitch = (sis->mixedBlock ? blockCutoff : 0); /* where WINDOW switches (not nec. transform) */
     bc.gbIn = hi->gb[ch];
 
-    mi->numPrevIMDCT[ch] = HybridTransform(hi->huffDecBuf[ch], mi->overBuf[ch], mi->outBuf[ch], &si->sis[gr][ch], &bc);
-    mi->prevType[ch] = si->sis[gr][ch].blockType;
+    mi->numPrevIMDCT[ch] = HybridTransform(hi->huffDecBuf[ch], mi->overBuf[ch], mi->outBuf[ch], sis, &bc);
+    mi->prevType[ch] = sis->blockType;
     mi->prevWinSwitch[ch] = bc.currWinSwitch; /* 0 means not a mixed block (either all short or all long) */
     mi->gb[ch] = bc.gbOut;
 
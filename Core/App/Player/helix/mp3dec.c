@@ -46,9 +46,40 @@
 // #include "hlxclib/string.h"		/* for memmove, memcpy (can replace with different implementations if desired) */
 #include "mp3common.h" /* includes mp3dec.h (public API) and internal, platform-independent API */
 
-// #define PROFILE
-#ifdef PROFILE
-#include "systime.h"
+/* per-stage cycle counters, read with MP3GetStageStats()
+ * the counter source is the Cortex-M DWT cycle counter on target and the monotonic clock in ns on a host build
+ * (Tools/helix_bench); define HELIX_STAGE_PROFILE 0 to compile it out
+ */
+#ifndef HELIX_STAGE_PROFILE
+#define HELIX_STAGE_PROFILE 1
+#endif
+
+#if HELIX_STAGE_PROFILE
+#ifdef USE_HAL_DRIVER
+#include "dwt.h"
+
+#define STAGE_CLOCK() DWT_GetCycles()
+#else
+#include <time.h>
+
+static unsigned int StageClock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned int)ts.tv_sec * 1000000000U + (unsigned int)ts.tv_nsec;
+}
+
+#define STAGE_CLOCK() StageClock()
+#endif
+
+static MP3StageStats stageStats;
+
+#define STAGE_START() stageTime = STAGE_CLOCK()
+#define STAGE_END(stage) stageStats.cycles[stage] += STAGE_CLOCK() - stageTime
+#else
+#define STAGE_START()
+#define STAGE_END(stage)
 #endif
 
 /**************************************************************************************
@@ -93,6 +124,42 @@ void MP3FreeDecoder(HMP3Decoder hMP3Decoder)
     FreeBuffers(mp3DecInfo);
 }
 
+/**************************************************************************************
+ * Function:    MP3AllocFrameData
+ *
+ * Description: allocate an extra handoff buffer for pipelined decoding
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      handle to the handoff buffer, 0 if malloc fails
+ *
+ * Notes:       not needed for MP3Decode(), which uses the decoder's own handoff
+ **************************************************************************************/
+HMP3FrameData MP3AllocFrameData(void)
+{
+    return (HMP3FrameData)AllocateFrameData();
+}
+
+/**************************************************************************************
+ * Function:    MP3FreeFrameData
+ *
+ * Description: free a handoff buffer allocated with MP3AllocFrameData
+ *
+ * Inputs:      handle to the handoff buffer
+ *
+ * Outputs:     none
+ *
+ * Return:      none
+ **************************************************************************************/
+void MP3FreeFrameData(HMP3FrameData hFrameData)
+{
+    if (!hFrameData) return;
+
+    FreeFrameData(hFrameData);
+}
+
 /**************************************************************************************
  * Function:    MP3FindSyncWord
  *
@@ -249,78 +316,69 @@ int MP3GetNextFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo, uns
  *
  * Description: zero out pcm buffer if error decoding MP3 frame
  *
- * Inputs:      mp3DecInfo struct with correct frame size parameters filled in
+ * Inputs:      number of pcm samples in the frame (nGrans * nGranSamps * nChans)
  *              pointer pcm output buffer
  *
  * Outputs:     zeroed out pcm buffer
  *
  * Return:      none
  **************************************************************************************/
-static void MP3ClearBadFrame(MP3DecInfo *mp3DecInfo, short *outbuf)
+static void MP3ClearBadFrame(int nSamps, short *outbuf)
 {
     int i;
 
-    if (!mp3DecInfo) return;
-
-    for (i = 0; i < mp3DecInfo->nGrans * mp3DecInfo->nGranSamps * mp3DecInfo->nChans; i++) outbuf[i] = 0;
+    for (i = 0; i < nSamps; i++) outbuf[i] = 0;
 }
 
 /**************************************************************************************
- * Function:    MP3Decode
+ * Function:    MP3DecodeEntropy
  *
- * Description: decode one frame of MP3 data
+ * Description: first decode stage - bitstream, scale factors, Huffman, dequantization
+ *                and stereo processing for one frame
  *
  * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
  *              double pointer to buffer of MP3 data (containing headers + mainData)
  *              number of valid bytes remaining in inbuf
- *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
  *              flag indicating whether MP3 data is normal MPEG format (useSize = 0)
  *                or reformatted as "self-contained" frames (useSize = 1)
+ *              handoff buffer from MP3AllocFrameData(), or 0 for the decoder's own
  *
- * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
- *                number of output samples = nGrans * nGranSamps * nChans
+ * Outputs:     dequantized coefficients, side info and frame layout in the handoff
  *              updated inbuf pointer, updated bytesLeft
  *
  * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
  *
- * Notes:       switching useSize on and off between frames in the same stream
- *                is not supported (bit reservoir is not maintained if useSize on)
+ * Notes:       the handoff is not valid for MP3DecodeSynthesis() unless this returns 0
+ *              Dequantize() fuses stereo processing with the dequantizer (and needs the
+ *                scale factors), so it stays in this stage
  **************************************************************************************/
-int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
+int MP3DecodeEntropy(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, int useSize,
+                     HMP3FrameData hFrameData)
 {
     int offset, bitOffset, mainBits, gr, ch, fhBytes, siBytes, freeFrameBytes;
     int prevBitOffset, sfBlockBits, huffBlockBits;
     unsigned char *mainPtr;
     MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
 
-#ifdef PROFILE
-    long time;
+#if HELIX_STAGE_PROFILE
+    unsigned int stageTime;
 #endif
 
     if (!mp3DecInfo) return ERR_MP3_NULL_POINTER;
+    if (!hFrameData) hFrameData = mp3DecInfo->FrameDataPS;
 
     /* unpack frame header */
     fhBytes = UnpackFrameHeader(mp3DecInfo, *inbuf);
-    if (fhBytes < 0)
-        return ERR_MP3_INVALID_FRAMEHEADER; /* don't clear outbuf since we don't know size (failed to parse header) */
+    if (fhBytes < 0) return ERR_MP3_INVALID_FRAMEHEADER;
     *inbuf += fhBytes;
 
-#ifdef PROFILE
-    time = systime_get();
-#endif
+    STAGE_START();
     /* unpack side info */
     siBytes = UnpackSideInfo(mp3DecInfo, *inbuf);
-    if (siBytes < 0)
-    {
-        MP3ClearBadFrame(mp3DecInfo, outbuf);
-        return ERR_MP3_INVALID_SIDEINFO;
-    }
+    if (siBytes < 0) return ERR_MP3_INVALID_SIDEINFO;
     *inbuf += siBytes;
     *bytesLeft -= (fhBytes + siBytes);
-#ifdef PROFILE
-    time = systime_get() - time;
-    printf("UnpackSideInfo: %i ms\n", time);
-#endif
+    STAGE_END(MP3_STAGE_SIDEINFO);
 
     /* if free mode, need to calculate bitrate and nSlots manually, based on frame size */
     if (mp3DecInfo->bitrate == 0 || mp3DecInfo->freeBitrateFlag)
@@ -330,11 +388,7 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
             /* first time through, need to scan for next sync word and figure out frame size */
             mp3DecInfo->freeBitrateFlag = 1;
             mp3DecInfo->freeBitrateSlots = MP3FindFreeSync(*inbuf, *inbuf - fhBytes - siBytes, *bytesLeft);
-            if (mp3DecInfo->freeBitrateSlots < 0)
-            {
-                MP3ClearBadFrame(mp3DecInfo, outbuf);
-                return ERR_MP3_FREE_BITRATE_SYNC;
-            }
+            if (mp3DecInfo->freeBitrateSlots < 0) return ERR_MP3_FREE_BITRATE_SYNC;
             freeFrameBytes = mp3DecInfo->freeBitrateSlots + fhBytes + siBytes;
             mp3DecInfo->bitrate =
                 (freeFrameBytes * mp3DecInfo->samprate * 8) / (mp3DecInfo->nGrans * mp3DecInfo->nGranSamps);
@@ -354,7 +408,6 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
         if (mp3DecInfo->mainDataBegin != 0 || mp3DecInfo->nSlots <= 0)
         {
             /* error - non self-contained frame, or missing frame (size <= 0), could do loss concealment here */
-            MP3ClearBadFrame(mp3DecInfo, outbuf);
             return ERR_MP3_INVALID_FRAMEHEADER;
         }
 
@@ -367,15 +420,9 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
     else
     {
         /* out of data - assume last or truncated frame */
-        if (mp3DecInfo->nSlots > *bytesLeft)
-        {
-            MP3ClearBadFrame(mp3DecInfo, outbuf);
-            return ERR_MP3_INDATA_UNDERFLOW;
-        }
+        if (mp3DecInfo->nSlots > *bytesLeft) return ERR_MP3_INDATA_UNDERFLOW;
 
-#ifdef PROFILE
-        time = systime_get();
-#endif
+        STAGE_START();
         /* fill main data buffer with enough new data for this frame */
         if (mp3DecInfo->mainDataBytes >= mp3DecInfo->mainDataBegin)
         {
@@ -396,13 +443,9 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
             mp3DecInfo->mainDataBytes += mp3DecInfo->nSlots;
             *inbuf += mp3DecInfo->nSlots;
             *bytesLeft -= (mp3DecInfo->nSlots);
-            MP3ClearBadFrame(mp3DecInfo, outbuf);
             return ERR_MP3_MAINDATA_UNDERFLOW;
         }
-#ifdef PROFILE
-        time = systime_get() - time;
-        printf("data buffer filling: %i ms\n", time);
-#endif
+        STAGE_END(MP3_STAGE_SIDEINFO);
     }
     bitOffset = 0;
     mainBits = mp3DecInfo->mainDataBytes * 8;
@@ -410,94 +453,183 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
     /* decode one complete frame */
     for (gr = 0; gr < mp3DecInfo->nGrans; gr++)
     {
+        /* Huffman output and dequantized coefficients go straight into the handoff */
+        if (SelectGranule(mp3DecInfo, hFrameData, gr) < 0) return ERR_MP3_NULL_POINTER;
+
         for (ch = 0; ch < mp3DecInfo->nChans; ch++)
         {
-#ifdef PROFILE
-            time = systime_get();
-#endif
+            STAGE_START();
             /* unpack scale factors and compute size of scale factor block */
             prevBitOffset = bitOffset;
             offset = UnpackScaleFactors(mp3DecInfo, mainPtr, &bitOffset, mainBits, gr, ch);
-#ifdef PROFILE
-            time = systime_get() - time;
-            printf("UnpackScaleFactors: %i ms\n", time);
-#endif
+            STAGE_END(MP3_STAGE_SCALEFACT);
 
             sfBlockBits = 8 * offset - prevBitOffset + bitOffset;
             huffBlockBits = mp3DecInfo->part23Length[gr][ch] - sfBlockBits;
             mainPtr += offset;
             mainBits -= sfBlockBits;
 
-            if (offset < 0 || mainBits < huffBlockBits)
-            {
-                MP3ClearBadFrame(mp3DecInfo, outbuf);
-                return ERR_MP3_INVALID_SCALEFACT;
-            }
+            if (offset < 0 || mainBits < huffBlockBits) return ERR_MP3_INVALID_SCALEFACT;
 
-#ifdef PROFILE
-            time = systime_get();
-#endif
+            STAGE_START();
             /* decode Huffman code words */
             prevBitOffset = bitOffset;
             offset = DecodeHuffman(mp3DecInfo, mainPtr, &bitOffset, huffBlockBits, gr, ch);
-            if (offset < 0)
-            {
-                MP3ClearBadFrame(mp3DecInfo, outbuf);
-                return ERR_MP3_INVALID_HUFFCODES;
-            }
-#ifdef PROFILE
-            time = systime_get() - time;
-            printf("Huffman: %i ms\n", time);
-#endif
+            if (offset < 0) return ERR_MP3_INVALID_HUFFCODES;
+            STAGE_END(MP3_STAGE_HUFFMAN);
 
             mainPtr += offset;
             mainBits -= (8 * offset - prevBitOffset + bitOffset);
         }
 
-#ifdef PROFILE
-        time = systime_get();
-#endif
+        STAGE_START();
         /* dequantize coefficients, decode stereo, reorder short blocks */
-        if (Dequantize(mp3DecInfo, gr) < 0)
-        {
-            MP3ClearBadFrame(mp3DecInfo, outbuf);
-            return ERR_MP3_INVALID_DEQUANTIZE;
-        }
-#ifdef PROFILE
-        time = systime_get() - time;
-        printf("Dequantize: %i ms\n", time);
+        if (Dequantize(mp3DecInfo, gr) < 0) return ERR_MP3_INVALID_DEQUANTIZE;
+        STAGE_END(MP3_STAGE_DEQUANT);
+    }
+
+    return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3DecodeSynthesis
+ *
+ * Description: second decode stage - alias reduction, IMDCT, overlap-add and
+ *                polyphase synthesis for one frame
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              handoff filled in by MP3DecodeEntropy() (0 for the decoder's own)
+ *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
+ *
+ * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
+ *                number of output samples = nGrans * nGranSamps * nChans
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       only touches the IMDCT/subband state and the handoff, so it can run
+ *                while MP3DecodeEntropy() fills a second handoff with the next frame
+ *              frames must still be synthesized in decode order (overlap-add history)
+ **************************************************************************************/
+int MP3DecodeSynthesis(HMP3Decoder hMP3Decoder, HMP3FrameData hFrameData, short *outbuf)
+{
+    int gr, ch;
+    MP3FrameParams *fp;
+    MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+#if HELIX_STAGE_PROFILE
+    unsigned int stageTime;
 #endif
 
+    if (!mp3DecInfo) return ERR_MP3_NULL_POINTER;
+    if (!hFrameData) hFrameData = mp3DecInfo->FrameDataPS;
+    fp = (MP3FrameParams *)hFrameData;
+
+    for (gr = 0; gr < fp->nGrans; gr++)
+    {
         /* alias reduction, inverse MDCT, overlap-add, frequency inversion */
-        for (ch = 0; ch < mp3DecInfo->nChans; ch++)
+        for (ch = 0; ch < fp->nChans; ch++)
         {
-#ifdef PROFILE
-            time = systime_get();
-#endif
-            if (IMDCT(mp3DecInfo, gr, ch) < 0)
+            STAGE_START();
+            if (IMDCT(mp3DecInfo, hFrameData, gr, ch) < 0)
             {
-                MP3ClearBadFrame(mp3DecInfo, outbuf);
+                MP3ClearBadFrame(fp->nGrans * fp->nGranSamps * fp->nChans, outbuf);
                 return ERR_MP3_INVALID_IMDCT;
             }
-#ifdef PROFILE
-            time = systime_get() - time;
-            printf("IMDCT: %i ms\n", time);
-#endif
+            STAGE_END(MP3_STAGE_IMDCT);
         }
 
-#ifdef PROFILE
-        time = systime_get();
-#endif
+        STAGE_START();
         /* subband transform - if stereo, interleaves pcm LRLRLR */
-        if (Subband(mp3DecInfo, outbuf + gr * mp3DecInfo->nGranSamps * mp3DecInfo->nChans) < 0)
+        if (Subband(mp3DecInfo, fp->nChans, outbuf + gr * fp->nGranSamps * fp->nChans) < 0)
         {
-            MP3ClearBadFrame(mp3DecInfo, outbuf);
+            MP3ClearBadFrame(fp->nGrans * fp->nGranSamps * fp->nChans, outbuf);
             return ERR_MP3_INVALID_SUBBAND;
         }
-#ifdef PROFILE
-        time = systime_get() - time;
-        printf("Subband: %i ms\n", time);
-#endif
+        STAGE_END(MP3_STAGE_SUBBAND);
     }
+#if HELIX_STAGE_PROFILE
+    stageStats.frames++;
+#endif
     return ERR_MP3_NONE;
 }
+
+/**************************************************************************************
+ * Function:    MP3Decode
+ *
+ * Description: decode one frame of MP3 data
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              double pointer to buffer of MP3 data (containing headers + mainData)
+ *              number of valid bytes remaining in inbuf
+ *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
+ *              flag indicating whether MP3 data is normal MPEG format (useSize = 0)
+ *                or reformatted as "self-contained" frames (useSize = 1)
+ *
+ * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
+ *                number of output samples = nGrans * nGranSamps * nChans
+ *              updated inbuf pointer, updated bytesLeft
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       switching useSize on and off between frames in the same stream
+ *                is not supported (bit reservoir is not maintained if useSize on)
+ *              runs both stages back to back through the decoder's own handoff
+ **************************************************************************************/
+int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
+{
+    int err;
+    unsigned char *frameStart;
+    MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+    if (!mp3DecInfo) return ERR_MP3_NULL_POINTER;
+
+    frameStart = *inbuf;
+    err = MP3DecodeEntropy(hMP3Decoder, inbuf, bytesLeft, useSize, mp3DecInfo->FrameDataPS);
+    if (err != ERR_MP3_NONE)
+    {
+        /* don't clear outbuf if we don't know size (failed to parse header, inbuf not advanced) */
+        if (*inbuf != frameStart)
+            MP3ClearBadFrame(mp3DecInfo->nGrans * mp3DecInfo->nGranSamps * mp3DecInfo->nChans, outbuf);
+        return err;
+    }
+
+    return MP3DecodeSynthesis(hMP3Decoder, mp3DecInfo->FrameDataPS, outbuf);
+}
+
+/**************************************************************************************
+ * Function:    MP3GetStageStats
+ *
+ * Description: copy the per-stage cycle counters accumulated by MP3Decode()
+ *
+ * Inputs:      pointer to MP3StageStats struct
+ *
+ * Outputs:     filled-in MP3StageStats struct (all zero if HELIX_STAGE_PROFILE is 0)
+ *
+ * Return:      none
+ **************************************************************************************/
+void MP3GetStageStats(MP3StageStats *stats)
+{
+#if HELIX_STAGE_PROFILE
+    *stats = stageStats;
+#else
+    memset(stats, 0, sizeof(MP3StageStats));
+#endif
+}
+
+/**************************************************************************************
+ * Function:    MP3ResetStageStats
+ *
+ * Description: clear the per-stage cycle counters
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      none
+ **************************************************************************************/
+void MP3ResetStageStats(void)
+{
+#if HELIX_STAGE_PROFILE
+    memset(&stageStats, 0, sizeof(MP3StageStats));
+#endif
+}
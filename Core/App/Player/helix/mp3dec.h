@@ -87,6 +87,7 @@ typedef enum {
 } MPEGVersion;
 
 typedef void *HMP3Decoder;
+typedef void *HMP3FrameData;	/* entropy -> synthesis handoff (one decoded frame of coefficients) */
 
 enum {
 	ERR_MP3_NONE =                  0,
@@ -106,6 +107,22 @@ enum {
 	ERR_UNKNOWN =                  -9999
 };
 
+/* decoding stages timed by MP3Decode() when HELIX_STAGE_PROFILE is enabled (see mp3dec.c) */
+enum {
+	MP3_STAGE_SIDEINFO = 0,		/* frame header, side info, main data buffering */
+	MP3_STAGE_SCALEFACT,
+	MP3_STAGE_HUFFMAN,
+	MP3_STAGE_DEQUANT,			/* dequantize + stereo processing + short block reorder */
+	MP3_STAGE_IMDCT,			/* alias reduction, IMDCT, overlap-add */
+	MP3_STAGE_SUBBAND,			/* FDCT32 + polyphase synthesis */
+	MP3_STAGE_COUNT
+};
+
+typedef struct _MP3StageStats {
+	unsigned int frames;					/* frames fully decoded since last reset */
+	unsigned int cycles[MP3_STAGE_COUNT];	/* accumulated CPU cycles per stage */
+} MP3StageStats;
+
 typedef struct _MP3FrameInfo {
 	int bitrate;
 	int nChans;
@@ -121,10 +138,21 @@ HMP3Decoder MP3InitDecoder(void);
 void MP3FreeDecoder(HMP3Decoder hMP3Decoder);
 int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize);
 
+/* two-stage decode: MP3Decode() == MP3DecodeEntropy() + MP3DecodeSynthesis() on the decoder's own handoff
+ * with two handoffs the stages can be pipelined (entropy of frame n+1 while frame n is synthesized)
+ */
+HMP3FrameData MP3AllocFrameData(void);
+void MP3FreeFrameData(HMP3FrameData hFrameData);
+int MP3DecodeEntropy(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, int useSize, HMP3FrameData hFrameData);
+int MP3DecodeSynthesis(HMP3Decoder hMP3Decoder, HMP3FrameData hFrameData, short *outbuf);
+
 void MP3GetLastFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo);
 int MP3GetNextFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo, unsigned char *buf);
 int MP3FindSyncWord(unsigned char *buf, int nBytes);
 
+void MP3GetStageStats(MP3StageStats *stats);
+void MP3ResetStageStats(void);
+
 #ifdef __cplusplus
 }
 #endif
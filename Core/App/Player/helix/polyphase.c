@@ -71,6 +71,27 @@ static __inline short ClipToShort(int x, int fracBits)
     return (short)x;
 }
 
+#if defined(HELIX_ARM_DSP)
+/* Cortex-M4/M7: SSAT does the shift + clip of ClipToShort() in one instruction,
+ *   and the L/R pair goes out as a single 32-bit store (little-endian, L in the low half)
+ */
+typedef unsigned int __attribute__((may_alias)) PCMPair;
+
+static __inline void StoreStereo(short *pcm, Word64 sumL, Word64 sumR)
+{
+    unsigned int l = (unsigned short)SSAT16_ASR((int)SAR64(sumL, (32 - CSHIFT)), DEF_NFRACBITS);
+    int r = SSAT16_ASR((int)SAR64(sumR, (32 - CSHIFT)), DEF_NFRACBITS);
+
+    *(PCMPair *)pcm = l | ((unsigned int)r << 16);
+}
+#else
+static __inline void StoreStereo(short *pcm, Word64 sumL, Word64 sumR)
+{
+    pcm[0] = ClipToShort((int)SAR64(sumL, (32 - CSHIFT)), DEF_NFRACBITS);
+    pcm[1] = ClipToShort((int)SAR64(sumR, (32 - CSHIFT)), DEF_NFRACBITS);
+}
+#endif
+
 #define MC0M(x)                          \
     {                                    \
         c1 = *coef;                      \
@@ -255,6 +276,8 @@ void PolyphaseMono(short *pcm, int *vbuf, const int *coefBase)
  * Return:      none
  *
  * Notes:       interleaves PCM samples LRLRLR...
+ *              on Cortex-M4/M7 each L/R pair is clipped with SSAT and written with one
+ *                32-bit store (see StoreStereo)
  *
  * TODO:        add 32-bit version for platforms where 64-bit mul-acc is not supported
  **************************************************************************************/
@@ -282,8 +305,7 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
     MC0S(6)
     MC0S(7)
 
-    *(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32 - CSHIFT)), DEF_NFRACBITS);
-    *(pcm + 1) = ClipToShort((int)SAR64(sum1R, (32 - CSHIFT)), DEF_NFRACBITS);
+    StoreStereo(pcm, sum1L, sum1R);
 
     /* special case, output sample 16 */
     coef = coefBase + 256;
@@ -299,8 +321,7 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
     MC1S(6)
     MC1S(7)
 
-    *(pcm + 2 * 16 + 0) = ClipToShort((int)SAR64(sum1L, (32 - CSHIFT)), DEF_NFRACBITS);
-    *(pcm + 2 * 16 + 1) = ClipToShort((int)SAR64(sum1R, (32 - CSHIFT)), DEF_NFRACBITS);
+    StoreStereo(pcm + 2 * 16, sum1L, sum1R);
 
     /* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
     coef = coefBase + 16;
@@ -323,10 +344,8 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
         MC2S(7)
 
         vb1 += 64;
-        *(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32 - CSHIFT)), DEF_NFRACBITS);
-        *(pcm + 1) = ClipToShort((int)SAR64(sum1R, (32 - CSHIFT)), DEF_NFRACBITS);
-        *(pcm + 2 * 2 * i + 0) = ClipToShort((int)SAR64(sum2L, (32 - CSHIFT)), DEF_NFRACBITS);
-        *(pcm + 2 * 2 * i + 1) = ClipToShort((int)SAR64(sum2R, (32 - CSHIFT)), DEF_NFRACBITS);
+        StoreStereo(pcm, sum1L, sum1R);
+        StoreStereo(pcm + 2 * 2 * i, sum2L, sum2R);
         pcm += 2;
     }
 }
@@ -52,27 +52,27 @@
  * Description: do subband transform on all the blocks in one granule, all channels
  *
  * Inputs:      filled MP3DecInfo structure, after calling IMDCT for all channels
+ *              number of channels in the granule (from MP3FrameData, not the decoder,
+ *                which may already hold the next frame's header)
  *              vbuf[ch] and vindex[ch] must be preserved between calls
  *
  * Outputs:     decoded PCM data, interleaved LRLRLR... if stereo
  *
  * Return:      0 on success,  -1 if null input pointers
  **************************************************************************************/
-int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf)
+int Subband(MP3DecInfo *mp3DecInfo, int nChans, short *pcmBuf)
 {
     int b;
-    HuffmanInfo *hi;
     IMDCTInfo *mi;
     SubbandInfo *sbi;
 
     /* validate pointers */
-    if (!mp3DecInfo || !mp3DecInfo->HuffmanInfoPS || !mp3DecInfo->IMDCTInfoPS || !mp3DecInfo->SubbandInfoPS) return -1;
+    if (!mp3DecInfo || !mp3DecInfo->IMDCTInfoPS || !mp3DecInfo->SubbandInfoPS) return -1;
 
-    hi = (HuffmanInfo *)mp3DecInfo->HuffmanInfoPS;
     mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
     sbi = (SubbandInfo *)(mp3DecInfo->SubbandInfoPS);
 
-    if (mp3DecInfo->nChans == 2)
+    if (nChans == 2)
     {
         /* stereo */
         for (b = 0; b < BLOCK_SIZE; b++)
@@ -15,6 +15,7 @@
 // 包含 Helix 库头文件
 // 由于我们已经将头文件复制到了 Core/Inc，直接包含即可
 #include "mp3dec.h"
+#include "mp3common.h"
 
 // Helix 定义的结构体是 MP3FrameInfo，我们需要在内部使用
 typedef MP3FrameInfo MP3FrameInfo_Helix;
@@ -42,6 +43,18 @@ void MP3_Decoder_Free(MP3_DecoderHandle decoder)
     }
 }
 
+void MP3_Decoder_Reset(MP3_DecoderHandle decoder)
+{
+    if (!decoder) return;
+
+    // 丢弃 bit reservoir 中上一位置的主数据, 定位后第一帧会返回 MAINDATA_UNDERFLOW 而不是输出杂音
+    MP3DecInfo *info = (MP3DecInfo *)decoder;
+    info->mainDataBegin = 0;
+    info->mainDataBytes = 0;
+    info->freeBitrateFlag = 0;
+    info->freeBitrateSlots = 0;
+}
+
 MP3_Error MP3_Decoder_DecodeFrame(MP3_DecoderHandle decoder, uint8_t **inBuffer, int *bytesLeft, int16_t *outBuffer,
                                   MP3_FrameInfo *frameInfo)
 {
@@ -100,19 +113,82 @@ MP3_Error MP3_Decoder_DecodeFrame(MP3_DecoderHandle decoder, uint8_t **inBuffer,
     return MP3_OK;
 }
 
+MP3_Error MP3_Decoder_GetNextFrameInfo(MP3_DecoderHandle decoder, uint8_t *buffer, MP3_FrameInfo *frameInfo)
+{
+    if (!decoder || !buffer || !frameInfo)
+    {
+        return MP3_ERR_NULL_POINTER;
+    }
+
+    MP3FrameInfo_Helix helixInfo;
+    int err = MP3GetNextFrameInfo((HMP3Decoder)decoder, &helixInfo, buffer);
+    if (err != 0)
+    {
+        return MP3_ERR_INVALID_FILE;
+    }
+
+    frameInfo->bitrate = helixInfo.bitrate;
+    frameInfo->sampleRate = helixInfo.samprate;
+    frameInfo->channels = 2;  // 单声道在 MP3_Decoder_DecodeFrame 中会扩展为立体声
+    frameInfo->bitsPerSample = helixInfo.bitsPerSample;
+    frameInfo->outputSamps = helixInfo.outputSamps * (helixInfo.nChans == 1 ? 2 : 1);
+
+    return MP3_OK;
+}
+
+_Static_assert((int)MP3_DEC_STAGE_COUNT == (int)MP3_STAGE_COUNT, "MP3_DecoderStage must match mp3dec.h");
+
+void MP3_Decoder_GetStageStats(MP3_StageStats *stats)
+{
+    MP3StageStats helixStats;
+
+    if (!stats) return;
+    memset(stats, 0, sizeof(MP3_StageStats));
+
+    MP3GetStageStats(&helixStats);
+    stats->frames = helixStats.frames;
+    if (helixStats.frames == 0) return;
+
+    for (int i = 0; i < MP3_DEC_STAGE_COUNT; i++)
+    {
+        stats->cycles_per_frame[i] = helixStats.cycles[i] / helixStats.frames;
+        stats->total_per_frame += stats->cycles_per_frame[i];
+    }
+}
+
+void MP3_Decoder_ResetStageStats(void)
+{
+    MP3ResetStageStats();
+}
+
 int MP3_FindSyncWord(uint8_t *buffer, int bufferSize)
 {
     return MP3FindSyncWord(buffer, bufferSize);
 }
 
 /**
- * @brief  跳过 ID3v2 标签
+ * @brief  计算 ID3v2 标签总长度
  * @note   ID3v2 标签在 MP3 文件开头，格式:
  *         - 3 bytes: "ID3"
  *         - 2 bytes: 版本
  *         - 1 byte:  标志
  *         - 4 bytes: 大小 (syncsafe integer)
  */
+uint32_t MP3_GetID3TagSize(const uint8_t *header)
+{
+    if (header[0] != 'I' || header[1] != 'D' || header[2] != '3') return 0;
+
+    // 计算标签大小 (syncsafe integer)
+    uint32_t tagSize =
+        ((header[6] & 0x7F) << 21) | ((header[7] & 0x7F) << 14) | ((header[8] & 0x7F) << 7) | (header[9] & 0x7F);
+
+    // 10 bytes header + tagSize
+    return 10 + tagSize;
+}
+
+/**
+ * @brief  跳过 ID3v2 标签
+ */
 uint32_t MP3_SkipID3Tag(FIL *file)
 {
     uint8_t header[10];
@@ -129,14 +205,9 @@ uint32_t MP3_SkipID3Tag(FIL *file)
     }
 
     // 检查 ID3v2 标签
-    if (header[0] == 'I' && header[1] == 'D' && header[2] == '3')
+    uint32_t totalSkip = MP3_GetID3TagSize(header);
+    if (totalSkip > 0)
     {
-        // 计算标签大小 (syncsafe integer)
-        uint32_t tagSize =
-            ((header[6] & 0x7F) << 21) | ((header[7] & 0x7F) << 14) | ((header[8] & 0x7F) << 7) | (header[9] & 0x7F);
-
-        // 跳过标签 (10 bytes header + tagSize)
-        uint32_t totalSkip = 10 + tagSize;
         f_lseek(file, startPos + totalSkip);
 
         return totalSkip;
@@ -40,6 +40,26 @@ extern "C"
         uint32_t outputSamps;    // 输出采样数
     } MP3_FrameInfo;
 
+    /* Helix 各解码阶段 (与 mp3dec.h 中 MP3_STAGE_* 顺序一致) */
+    typedef enum
+    {
+        MP3_DEC_STAGE_SIDEINFO,   // 帧头、side info、主数据缓冲
+        MP3_DEC_STAGE_SCALEFACT,  // 比例因子
+        MP3_DEC_STAGE_HUFFMAN,    // Huffman 解码
+        MP3_DEC_STAGE_DEQUANT,    // 反量化 + 立体声处理
+        MP3_DEC_STAGE_IMDCT,      // 抗混叠 + IMDCT + 重叠相加
+        MP3_DEC_STAGE_SUBBAND,    // FDCT32 + 多相滤波器组
+        MP3_DEC_STAGE_COUNT,
+    } MP3_DecoderStage;
+
+    /* 各阶段 CPU 周期统计 */
+    typedef struct
+    {
+        uint32_t frames;                                  // 完整解码的帧数
+        uint32_t cycles_per_frame[MP3_DEC_STAGE_COUNT];  // 每帧平均周期数
+        uint32_t total_per_frame;                         // 各阶段合计
+    } MP3_StageStats;
+
     /* MP3 解码器句柄 (不透明类型) */
     typedef void *MP3_DecoderHandle;
 
@@ -55,6 +75,13 @@ extern "C"
      */
     void MP3_Decoder_Free(MP3_DecoderHandle decoder);
 
+    /**
+     * @brief  清空 bit reservoir (定位后调用)
+     * @param  decoder: 解码器句柄
+     * @note   IMDCT 重叠和子带合成的历史数据不清除, 由定位后预解码并丢弃的帧冲掉
+     */
+    void MP3_Decoder_Reset(MP3_DecoderHandle decoder);
+
     /**
      * @brief  解码一帧 MP3 数据
      * @param  decoder: 解码器句柄
@@ -67,6 +94,26 @@ extern "C"
     MP3_Error MP3_Decoder_DecodeFrame(MP3_DecoderHandle decoder, uint8_t **inBuffer, int *bytesLeft, int16_t *outBuffer,
                                       MP3_FrameInfo *frameInfo);
 
+    /**
+     * @brief  只解析帧头, 不解码 (用于在解码前确定本帧输出的采样数)
+     * @param  decoder: 解码器句柄
+     * @param  buffer: 指向帧同步头的输入数据 (至少 6 字节)
+     * @param  frameInfo: 输出帧信息, outputSamps 按立体声输出计算 (单声道已 x2)
+     * @retval MP3_Error 错误码
+     */
+    MP3_Error MP3_Decoder_GetNextFrameInfo(MP3_DecoderHandle decoder, uint8_t *buffer, MP3_FrameInfo *frameInfo);
+
+    /**
+     * @brief  读取各解码阶段的平均周期数 (所有 MP3 解码器实例共用一组计数)
+     * @param  stats: 输出统计
+     */
+    void MP3_Decoder_GetStageStats(MP3_StageStats *stats);
+
+    /**
+     * @brief  清零各阶段统计
+     */
+    void MP3_Decoder_ResetStageStats(void);
+
     /**
      * @brief  查找下一个 MP3 帧同步头
      * @param  buffer: 输入缓冲区
@@ -75,6 +122,13 @@ extern "C"
      */
     int MP3_FindSyncWord(uint8_t *buffer, int bufferSize);
 
+    /**
+     * @brief  计算 ID3v2 标签总长度 (含 10 字节标签头)
+     * @param  header: 文件开头的 10 个字节
+     * @retval 标签总长度, 0 表示没有 ID3v2 标签
+     */
+    uint32_t MP3_GetID3TagSize(const uint8_t *header);
+
     /**
      * @brief  跳过 ID3 标签
      * @param  file: 文件句柄
@@ -0,0 +1,94 @@
+/*
+ * mp3_selftest.c
+ * MP3 解码器自检 (说明见 mp3_selftest.h)
+ */
+
+#include "mp3_selftest.h"
+#include "codec_mem.h"
+#include "mp3dec.h"
+
+#include <string.h>
+
+#ifdef USE_HAL_DRIVER
+#include "dwt.h"
+
+#define SELFTEST_CLOCK() DWT_GetCycles()
+#else
+#include <time.h>
+
+static uint32_t selftest_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000000U + (uint32_t)ts.tv_nsec;
+}
+
+#define SELFTEST_CLOCK() selftest_clock()
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+
+/* Private variables ---------------------------------------------------------*/
+// 一帧的输出 (最多 2 声道 x 2 颗粒 x 576), 4 字节对齐以便按左右声道对计算校验和
+static uint32_t selftest_pcm[MAX_NCHAN * MAX_NGRAN * MAX_NSAMP / 2];
+
+/* Function implementations --------------------------------------------------*/
+
+int32_t MP3_Selftest_Decode(const uint8_t *stream, uint32_t size, MP3_Selftest_Result *result)
+{
+    // Helix 只读输入数据, 内置码流可以直接放在 Flash 中
+    unsigned char *in = (unsigned char *)stream;
+    int left = (int)size;
+    uint32_t h = FNV_OFFSET_BASIS;
+
+    result->status = MP3_SELFTEST_OK;
+    result->frames = 0;
+
+    Codec_Mem_Reset();
+    HMP3Decoder dec = MP3InitDecoder();
+    if (!dec)
+    {
+        result->status = MP3_SELFTEST_ERR_INIT;
+        return result->status;
+    }
+
+    uint32_t t0 = SELFTEST_CLOCK();
+    while (left > 0)
+    {
+        int offset = MP3FindSyncWord(in, left);
+        if (offset < 0) break;
+        in += offset;
+        left -= offset;
+
+        if (MP3Decode(dec, &in, &left, (short *)selftest_pcm, 0) != ERR_MP3_NONE)
+        {
+            result->status = MP3_SELFTEST_ERR_DECODE;
+            break;
+        }
+
+        MP3FrameInfo info;
+        MP3GetLastFrameInfo(dec, &info);
+        // 单声道输出按相邻两个采样一组计算
+        for (int i = 0; i < info.outputSamps / 2; i++) h = (h ^ selftest_pcm[i]) * FNV_PRIME;
+        result->frames++;
+    }
+    result->time = SELFTEST_CLOCK() - t0;
+    result->checksum = h;
+
+    MP3FreeDecoder(dec);
+    Codec_Mem_Reset();
+    return result->status;
+}
+
+int32_t MP3_Selftest_Run(MP3_Selftest_Result *result)
+{
+    result->expected = mp3_selftest_checksum;
+    if (MP3_Selftest_Decode(mp3_selftest_stream, mp3_selftest_stream_size, result) == MP3_SELFTEST_OK &&
+        result->checksum != result->expected)
+    {
+        result->status = MP3_SELFTEST_ERR_CHECKSUM;
+    }
+    return result->status;
+}
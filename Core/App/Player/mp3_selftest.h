@@ -0,0 +1,62 @@
+/*
+ * mp3_selftest.h
+ * MP3 解码器自检: 解码一段内置码流, 输出 PCM 校验和与电脑上通用 C 版本的结果比较
+ *
+ * assembly.h 在 Cortex-M4 上默认使用 DSP 扩展指令 (HELIX_ARM_DSP: SMMUL/SMMLA/SSAT 等),
+ * 加 -DHELIX_NO_ARM_DSP 编译则使用普通 ARMv7 版本。两种编译下自检都必须通过,
+ * 即两者的输出与通用 C 版本逐位一致。内置码流由 Tools/helix_bench/mp3_gen 生成 (随机帧, 覆盖
+ * 长块/短块、MS/强度立体声), 期望校验和由 Tools/helix_bench/helix_selftest 在电脑上计算。
+ */
+
+#ifndef APP_PLAYER_MP3_SELFTEST_H_
+#define APP_PLAYER_MP3_SELFTEST_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/* 为 1 时 music_player_init() 运行一次自检, 结果保存在 mp3_selftest_result 中供调试器查看 */
+#ifndef MP3_SELFTEST
+#define MP3_SELFTEST 0
+#endif
+
+#define MP3_SELFTEST_OK 0
+#define MP3_SELFTEST_ERR_INIT -1      // 解码器内存分配失败
+#define MP3_SELFTEST_ERR_DECODE -2    // 有帧解码出错
+#define MP3_SELFTEST_ERR_CHECKSUM -3  // 校验和与期望值不同
+
+    typedef struct
+    {
+        int32_t status;     // MP3_SELFTEST_OK / MP3_SELFTEST_ERR_*
+        uint32_t checksum;  // 输出 PCM 的 FNV-1a 校验和 (与 AUDIO_DEC_PCM_CHECKSUM 相同的算法)
+        uint32_t expected;  // 电脑上通用 C 版本的校验和
+        uint32_t frames;    // 解码的帧数
+        uint32_t time;      // 解码用时: 板上为 DWT 周期数, 电脑上为纳秒
+    } MP3_Selftest_Result;
+
+    /* 内置码流 (mp3_selftest_vector.c) */
+    extern const uint8_t mp3_selftest_stream[];
+    extern const uint32_t mp3_selftest_stream_size;
+    extern const uint32_t mp3_selftest_checksum;
+
+    /**
+     * @brief  解码内置码流并检查校验和
+     * @note   使用 codec_mem, 必须在没有其他解码器打开时调用
+     * @retval result->status
+     */
+    int32_t MP3_Selftest_Run(MP3_Selftest_Result *result);
+
+    /**
+     * @brief  解码任意一段 MP3 数据, 计算校验和 (不检查, result->expected 不变)
+     * @retval result->status
+     */
+    int32_t MP3_Selftest_Decode(const uint8_t *stream, uint32_t size, MP3_Selftest_Result *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_MP3_SELFTEST_H_ */
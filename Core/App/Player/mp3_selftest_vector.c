@@ -0,0 +1,460 @@
+/*
+ * mp3_selftest_vector.c
+ * MP3 解码器自检的内置码流 (17 帧) 和期望校验和
+ *
+ * 由 Tools/helix_bench 生成, 不要手工修改:
+ *   ./mp3_gen -t 0.4 selftest.mp3 && ./helix_selftest -w selftest.mp3 > mp3_selftest_vector.c
+ */
+
+#include "mp3_selftest.h"
+
+const uint32_t mp3_selftest_checksum = 0xD2B8FC35U;
+const uint32_t mp3_selftest_stream_size = 7105U;
+
+const uint8_t mp3_selftest_stream[] = {
+    0xFF, 0xFB, 0x90, 0x50, 0x00, 0x00, 0x02, 0xF9, 0x02, 0xCD, 0x8E, 0x48, 0xA4, 0x22, 0x55, 0x22,
+    0x8A, 0xE1, 0x4F, 0x2B, 0xF5, 0x8A, 0x7C, 0x2D, 0x5A, 0x84, 0x02, 0x94, 0x99, 0x70, 0x01, 0x67,
+    0xDC, 0x5A, 0x35, 0x5D, 0xB4, 0xD4, 0xD4, 0x54, 0xD3, 0x8D, 0x6D, 0x26, 0x00, 0xC7, 0x60, 0xB0,
+    0xD4, 0x4A, 0xED, 0xCC, 0x8E, 0x91, 0x10, 0x60, 0xDC, 0x05, 0x36, 0xCD, 0x9F, 0xD0, 0x85, 0x14,
+    0xC6, 0xC0, 0x04, 0x4C, 0x07, 0x4F, 0x39, 0x7B, 0x38, 0x5D, 0xBF, 0xC9, 0xC0, 0xDA, 0x9B, 0xE1,
+    0x90, 0xF7, 0xBC, 0xA0, 0x48, 0x0A, 0xBB, 0xD3, 0xEA, 0xA1, 0x70, 0x18, 0x65, 0x0D, 0x79, 0x11,
+    0x71, 0x90, 0x18, 0x5A, 0x57, 0xA6, 0xAA, 0xC6, 0x9D, 0x40, 0xDC, 0xD6, 0x9A, 0x2D, 0xDA, 0x81,
+    0xC1, 0x2D, 0x68, 0xEC, 0x60, 0x0B, 0x2F, 0xEE, 0x92, 0x94, 0xBC, 0x6E, 0x4B, 0x6E, 0xB6, 0xD5,
+    0x02, 0x0A, 0xF9, 0xFD, 0xEE, 0x5D, 0xE0, 0x91, 0xC8, 0x94, 0xDF, 0xF7, 0x2E, 0x59, 0xA8, 0x22,
+    0xA4, 0xFF, 0xA3, 0xCA, 0xC6, 0x32, 0xE7, 0x65, 0x94, 0x16, 0x15, 0x98, 0x4F, 0xD8, 0xAE, 0x45,
+    0x9E, 0xB8, 0x21, 0xF9, 0x33, 0x1B, 0x72, 0xF9, 0x11, 0x50, 0xD7, 0x2F, 0x27, 0x4F, 0x27, 0x3F,
+    0xF6, 0xD6, 0xD3, 0xB8, 0x02, 0xD3, 0x85, 0xD4, 0xC9, 0x2D, 0x6C, 0x12, 0xFA, 0xB0, 0x78, 0x6E,
+    0xC8, 0x60, 0x07, 0xC2, 0xA6, 0x70, 0xF5, 0x76, 0xA8, 0xED, 0x33, 0x2E, 0x57, 0x23, 0xB8, 0x26,
+    0x3B, 0x2E, 0x37, 0xF5, 0xAD, 0x28, 0xE9, 0x26, 0xD6, 0x4B, 0xE7, 0xDB, 0x38, 0x42, 0x2D, 0x57,
+    0x27, 0x96, 0x2B, 0xFD, 0x0E, 0x0B, 0x86, 0x36, 0xFC, 0x67, 0xBB, 0x26, 0xFD, 0x3C, 0x79, 0xDE,
+    0xA6, 0xCA, 0xC3, 0x72, 0xFE, 0xBD, 0xB3, 0x35, 0xE6, 0xD8, 0xE6, 0x5F, 0x72, 0xEA, 0xD7, 0xC6,
+    0x59, 0x22, 0x2A, 0x4D, 0x3D, 0x86, 0x54, 0x57, 0x30, 0x5F, 0x87, 0xFC, 0xBA, 0x90, 0xF0, 0x99,
+    0x22, 0x0E, 0xF4, 0x58, 0x7F, 0xAE, 0xFF, 0xFA, 0x1E, 0xF2, 0x22, 0xF9, 0x70, 0x04, 0x8E, 0xEF,
+    0x48, 0xCB, 0x46, 0x98, 0xC1, 0x66, 0x6B, 0xF3, 0x96, 0xF7, 0xFD, 0x00, 0xDD, 0x1A, 0xB3, 0x3F,
+    0xFC, 0x63, 0x37, 0xFE, 0x18, 0x84, 0xA8, 0xFA, 0x0E, 0xB7, 0xD8, 0x4E, 0xA4, 0x0E, 0x12, 0xF8,
+    0x6E, 0xFB, 0x7F, 0x26, 0x80, 0x00, 0xC0, 0xB2, 0x9F, 0x25, 0x48, 0x3A, 0x89, 0xA6, 0xCF, 0xE5,
+    0x2B, 0xCE, 0x36, 0x04, 0x5F, 0xFE, 0x0E, 0x1B, 0xED, 0x8F, 0x15, 0x76, 0xC0, 0xA2, 0x3D, 0x86,
+    0xFC, 0x52, 0x8F, 0x2B, 0xD5, 0xCC, 0x17, 0x0E, 0x05, 0x3C, 0xAA, 0x14, 0x95, 0x80, 0x65, 0xB6,
+    0xFE, 0x10, 0x28, 0x93, 0xA0, 0xC1, 0xD8, 0x8C, 0x0C, 0x43, 0x29, 0x5F, 0x80, 0x0A, 0x10, 0x5F,
+    0xCE, 0xBC, 0xD6, 0x83, 0x9E, 0xBC, 0xE0, 0xD0, 0x9B, 0xCE, 0x12, 0xC5, 0x3D, 0xFF, 0xBB, 0xD8,
+    0xE1, 0xB3, 0x98, 0xB3, 0x0F, 0xE4, 0x77, 0xAB, 0x4B, 0x2F, 0x55, 0xE1, 0xF3, 0x38, 0x3D, 0x4A,
+    0xF0, 0xFF, 0xFB, 0x92, 0x40, 0x00, 0x00, 0x02, 0x9E, 0x13, 0xD2, 0x1B, 0xDF, 0x64, 0xF2, 0x59,
+    0xA0, 0x0A, 0x89, 0x43, 0x42, 0xAB, 0x0A, 0x80, 0x19, 0x3A, 0xD8, 0x25, 0x84, 0x91, 0x7A, 0x07,
+    0xE7, 0xE1, 0x95, 0xCA, 0x47, 0x24, 0xDF, 0xB5, 0xAA, 0xF1, 0x6B, 0xD7, 0x2D, 0x78, 0xF7, 0x33,
+    0x6E, 0x49, 0x25, 0xEB, 0x0F, 0x03, 0x49, 0xB9, 0x69, 0x45, 0x0C, 0xBE, 0x91, 0x33, 0xEA, 0x75,
+    0x58, 0xD0, 0x04, 0x0C, 0xB9, 0x30, 0xEA, 0xE6, 0xB1, 0xCD, 0x41, 0xBD, 0x9D, 0xE6, 0x16, 0xB9,
+    0xAC, 0xBA, 0xF3, 0xDF, 0x78, 0xD3, 0x42, 0x15, 0x15, 0xF2, 0x4D, 0x23, 0x06, 0xBF, 0x4D, 0x46,
+    0xED, 0xA7, 0x3D, 0xFC, 0x51, 0xC1, 0xF9, 0xB2, 0x6F, 0x1D, 0x44, 0x9F, 0x2D, 0x22, 0x0F, 0x57,
+    0xE1, 0xE1, 0xA8, 0x05, 0xB3, 0x6D, 0x89, 0xFB, 0x7D, 0x8F, 0xE6, 0x3A, 0x5B, 0xF8, 0x5B, 0xDB,
+    0xC3, 0x1D, 0x64, 0x54, 0x77, 0x81, 0x88, 0xE0, 0x03, 0x40, 0x4B, 0x44, 0x92, 0xF5, 0xD1, 0x7D,
+    0xBC, 0xAA, 0xFB, 0x35, 0x37, 0x4F, 0x53, 0x17, 0x7B, 0x6A, 0xBD, 0x2C, 0xFE, 0xB3, 0x0E, 0x92,
+    0xBB, 0x92, 0x3C, 0x90, 0x1D, 0xFE, 0x88, 0xCB, 0x8A, 0x78, 0x2E, 0x64, 0xB1, 0xC8, 0xAB, 0x6C,
+    0xC4, 0xEE, 0xB5, 0x25, 0xDA, 0x7F, 0xAF, 0x60, 0xEF, 0x1D, 0xBE, 0x8F, 0x53, 0x26, 0x77, 0xE5,
+    0x57, 0x45, 0xB7, 0x87, 0x29, 0x4D, 0x53, 0x87, 0x59, 0x1D, 0x55, 0x43, 0xEC, 0xA9, 0xA3, 0xA6,
+    0xF5, 0x85, 0xF0, 0x70, 0xAF, 0xEC, 0xA8, 0xB1, 0x47, 0x61, 0x29, 0x1E, 0x63, 0xD8, 0xCA, 0xA4,
+    0x5A, 0xAF, 0xF7, 0x1E, 0x86, 0x64, 0xFA, 0xED, 0x8B, 0xFB, 0x3D, 0xAE, 0x84, 0x60, 0xBE, 0x85,
+    0xF6, 0x12, 0xB7, 0x54, 0xB4, 0xFA, 0x83, 0xCA, 0xB9, 0x9D, 0x6C, 0xD8, 0xDC, 0x7E, 0xC7, 0x26,
+    0xDF, 0x22, 0x65, 0x7A, 0xAF, 0x95, 0xEF, 0x4E, 0xE5, 0x6B, 0x20, 0x65, 0x1F, 0xCA, 0xA6, 0x32,
+    0x0E, 0x87, 0xCA, 0x2C, 0x03, 0x3F, 0xC6, 0xC5, 0x06, 0x43, 0x63, 0x51, 0xBE, 0x46, 0xAE, 0x56,
+    0x92, 0x6C, 0x7F, 0x7A, 0xDA, 0x5C, 0x4C, 0xBA, 0x4E, 0x34, 0x16, 0x53, 0x98, 0xB6, 0x35, 0xC2,
+    0x9C, 0x2A, 0x69, 0xFC, 0xF3, 0xFA, 0x2D, 0xA6, 0x6D, 0xC0, 0x7B, 0x80, 0x2F, 0x93, 0x01, 0x17,
+    0xAB, 0x2F, 0xAA, 0x7A, 0x33, 0x68, 0xEF, 0x3E, 0x5D, 0x12, 0xF1, 0x30, 0xF1, 0xF0, 0x9F, 0xA0,
+    0xC3, 0x2F, 0xF0, 0x41, 0x3D, 0x5D, 0xFE, 0x66, 0x40, 0x41, 0xEB, 0x82, 0x0F, 0xE4, 0xF0, 0x2D,
+    0x97, 0xAC, 0x92, 0xFE, 0x47, 0xC9, 0xD0, 0xC9, 0xB6, 0x16, 0xC6, 0x29, 0x37, 0xB6, 0x55, 0xB9,
+    0xEF, 0x2A, 0x60, 0x10, 0x2E, 0xE9, 0xD4, 0x74, 0x7D, 0xBA, 0x66, 0x3B, 0x24, 0x9D, 0xF3, 0x2A,
+    0x20, 0x96, 0xBF, 0x8F, 0xC9, 0x8A, 0x77, 0x13, 0x37, 0xD1, 0xA5, 0xB1, 0x11, 0xBD, 0x1A, 0x0C,
+    0xBD, 0x36, 0x38, 0xB7, 0xED, 0x40, 0x78, 0xD7, 0x15, 0xA9, 0x24, 0x17, 0x25, 0x60, 0x8D, 0xD9,
+    0x84, 0xCB, 0x07, 0xFF, 0xFB, 0x92, 0x60, 0x00, 0x00, 0x02, 0xCF, 0x0C, 0x51, 0x8B, 0x95, 0x90,
+    0xC6, 0x58, 0xA1, 0x4A, 0x5D, 0x52, 0x2B, 0x57, 0x4A, 0xB0, 0x65, 0x34, 0x14, 0xD1, 0x20, 0x99,
+    0x7C, 0x8F, 0x29, 0xCD, 0x2A, 0x3E, 0x45, 0xE7, 0x9A, 0x03, 0xD9, 0x62, 0x94, 0xD7, 0xAA, 0xB3,
+    0xEA, 0x9E, 0xCA, 0xA1, 0x18, 0x59, 0xFE, 0x9E, 0x6A, 0xDD, 0xBE, 0xF2, 0x2F, 0x07, 0xEA, 0x66,
+    0x87, 0xDC, 0x05, 0xC0, 0x20, 0x2C, 0x3E, 0xA9, 0x77, 0x00, 0x73, 0xA4, 0x9B, 0x87, 0xFC, 0xD3,
+    0x50, 0xA8, 0x52, 0x66, 0xA8, 0x32, 0xB2, 0x37, 0x00, 0x57, 0x19, 0x1E, 0x81, 0x43, 0x60, 0x22,
+    0x90, 0x99, 0x57, 0xBE, 0x00, 0x71, 0x8B, 0x2F, 0x34, 0x13, 0x8C, 0xFA, 0xF4, 0xD0, 0x63, 0x22,
+    0xF6, 0x27, 0x2E, 0x9F, 0xE9, 0xFD, 0x1E, 0xBB, 0x1C, 0x08, 0x8F, 0x8B, 0x91, 0xC6, 0x29, 0x5D,
+    0xCB, 0x55, 0x66, 0xFD, 0xA1, 0xA0, 0xE2, 0x6B, 0x8E, 0xC2, 0x59, 0x5B, 0x0F, 0xC7, 0x3E, 0x88,
+    0x5B, 0xFD, 0x52, 0x33, 0x5E, 0x9F, 0xF6, 0xB5, 0xE1, 0x22, 0xD0, 0xC1, 0x82, 0xCF, 0x64, 0x13,
+    0x00, 0xE2, 0xA4, 0xFC, 0x41, 0xF8, 0xC3, 0xCE, 0x70, 0x74, 0x09, 0x30, 0x89, 0x70, 0x31, 0xA6,
+    0xFB, 0xA9, 0xD8, 0x11, 0xE8, 0x87, 0x2D, 0xF5, 0xDE, 0xDA, 0x76, 0x8A, 0x52, 0x54, 0x2F, 0xA9,
+    0x2F, 0xF3, 0x10, 0x19, 0xAA, 0xAA, 0x8E, 0x45, 0x10, 0xF4, 0xED, 0x72, 0x24, 0xDE, 0x56, 0xFB,
+    0x70, 0x2B, 0x82, 0xA1, 0x46, 0x53, 0xE8, 0xF5, 0x58, 0x05, 0x81, 0xED, 0x5F, 0xE1, 0xB9, 0xA5,
+    0xE5, 0x0E, 0x80, 0x30, 0xA9, 0xA8, 0x80, 0x3E, 0xA7, 0x4B, 0x2E, 0xDC, 0x8F, 0x52, 0xA5, 0x5A,
+    0x3E, 0x2E, 0x53, 0x6D, 0x6C, 0xE2, 0x33, 0x48, 0x35, 0x33, 0x46, 0x33, 0x38, 0xBE, 0x87, 0x1F,
+    0x4F, 0xF9, 0x73, 0x49, 0x74, 0xEB, 0xE0, 0xC8, 0x97, 0x4B, 0x56, 0xBA, 0xDB, 0x5A, 0x94, 0x4C,
+    0xFA, 0x35, 0x1D, 0xCC, 0xB1, 0xC9, 0x73, 0x59, 0x45, 0xF9, 0x7F, 0x00, 0x01, 0x7C, 0xE8, 0x02,
+    0xA0, 0x0B, 0x0F, 0xE6, 0xF6, 0x51, 0x95, 0x10, 0xE7, 0xEC, 0x4B, 0x8F, 0x4D, 0xAA, 0x41, 0xE0,
+    0xDF, 0x6A, 0x37, 0xF5, 0x84, 0xF4, 0x08, 0xC3, 0xEC, 0x61, 0xFB, 0xC3, 0x25, 0xEE, 0x7E, 0xAC,
+    0xA0, 0xD5, 0x9C, 0x4D, 0x67, 0x53, 0x3E, 0x09, 0x95, 0x99, 0x36, 0x42, 0xFF, 0x8A, 0xC5, 0xAB,
+    0x54, 0x85, 0x23, 0x6E, 0x28, 0x6E, 0xC4, 0x67, 0xE8, 0x09, 0x43, 0x91, 0xAB, 0xBC, 0x52, 0x91,
+    0xE7, 0xDA, 0x11, 0x80, 0xBA, 0x93, 0x78, 0xE5, 0xBA, 0x09, 0xA8, 0x96, 0x22, 0xF5, 0xA0, 0xD5,
+    0x38, 0x17, 0x53, 0x09, 0xFB, 0x11, 0xBF, 0x78, 0x1D, 0x9F, 0xA3, 0xCA, 0xB8, 0xF9, 0x7A, 0x63,
+    0x44, 0x75, 0x36, 0xDF, 0xE9, 0xB1, 0xF6, 0xD5, 0x7D, 0xB8, 0x89, 0x5A, 0xD8, 0x2F, 0xD9, 0x6B,
+    0xC5, 0xAC, 0x11, 0x6B, 0x1F, 0xF8, 0xFF, 0x4C, 0xAD, 0x9F, 0xE2, 0xE7, 0x18, 0x98, 0xC9, 0x55,
+    0x89, 0xE5, 0x47, 0xFB, 0x4C, 0xFF, 0xFB, 0x92, 0x50, 0x00, 0x00, 0x02, 0xE3, 0x18, 0xCD, 0xF8,
+    0x3C, 0x9F, 0xBA, 0x5E, 0x83, 0xC9, 0x9D, 0xEA, 0x31, 0x00, 0xCB, 0x84, 0x31, 0x63, 0x0A, 0x0D,
+    0x5C, 0xF9, 0x74, 0x85, 0xAC, 0x54, 0x3D, 0xBD, 0x3A, 0x97, 0x97, 0x31, 0x52, 0xCB, 0xE2, 0x17,
+    0x51, 0x5C, 0x86, 0x9A, 0x6E, 0x01, 0xEB, 0xE2, 0x6A, 0x15, 0x76, 0x7B, 0x7A, 0x06, 0x63, 0xF6,
+    0xF1, 0x9D, 0xA9, 0x3C, 0x63, 0x00, 0x28, 0x0F, 0x61, 0x9C, 0xB1, 0x78, 0x27, 0xEB, 0x1D, 0x83,
+    0x51, 0x11, 0x83, 0xE4, 0x51, 0x2D, 0x3F, 0x2E, 0x2A, 0x3C, 0x6C, 0xAB, 0x2F, 0x10, 0x67, 0x17,
+    0xD1, 0xD5, 0x79, 0x52, 0x74, 0xBB, 0x0F, 0x59, 0xB8, 0x07, 0xF6, 0xF6, 0x2A, 0xB9, 0x65, 0xA8,
+    0x13, 0x7E, 0xCD, 0x7A, 0x54, 0xD8, 0x2E, 0xCE, 0x5A, 0x45, 0xF8, 0xB6, 0xF4, 0xFC, 0xAB, 0x46,
+    0x51, 0xD4, 0x4C, 0xFA, 0xAB, 0x01, 0x9E, 0xA0, 0x40, 0x1B, 0xD3, 0xD5, 0xE5, 0x8B, 0x82, 0xE5,
+    0x5D, 0xDD, 0xCA, 0x87, 0x82, 0x22, 0xCB, 0x44, 0x68, 0x45, 0xD4, 0x55, 0xD3, 0x85, 0xE6, 0x41,
+    0x83, 0x39, 0xF1, 0x54, 0x3E, 0x25, 0xD6, 0xE0, 0x02, 0x29, 0x80, 0x69, 0x14, 0xAD, 0x4C, 0xED,
+    0xF3, 0xE7, 0x34, 0xF6, 0x4E, 0x66, 0x60, 0x67, 0xF8, 0x0B, 0x59, 0x10, 0xF6, 0xFB, 0xBA, 0x1F,
+    0xD0, 0xCD, 0x57, 0x6D, 0x43, 0x15, 0xDA, 0xF4, 0xE1, 0x91, 0xCE, 0xEA, 0x4C, 0x32, 0x50, 0x56,
+    0x9C, 0xA0, 0xD4, 0x08, 0x9D, 0x72, 0x7F, 0x9B, 0x6A, 0x5C, 0x06, 0x25, 0x98, 0x04, 0xC5, 0xF4,
+    0x0E, 0x71, 0x63, 0xA5, 0xC3, 0xEE, 0xA1, 0xDA, 0x16, 0x98, 0xE4, 0x2E, 0x83, 0xD5, 0x87, 0xF5,
+    0x14, 0x8D, 0x17, 0x9E, 0x42, 0xE5, 0xA0, 0x19, 0xA1, 0x1C, 0x29, 0xDB, 0xE1, 0x51, 0x6F, 0x0C,
+    0xE6, 0x20, 0x42, 0x9B, 0x9A, 0xB6, 0x26, 0xF0, 0xFB, 0xEF, 0xDB, 0xE1, 0x77, 0x36, 0x7F, 0x0A,
+    0x1E, 0x84, 0xCA, 0x00, 0x97, 0x49, 0xBF, 0x67, 0xAC, 0x5D, 0x95, 0x7F, 0xF6, 0x5F, 0x1E, 0xCF,
+    0xCA, 0xB4, 0xC4, 0xE7, 0xDD, 0x03, 0xF9, 0xC3, 0xC6, 0xB9, 0x33, 0x88, 0xEE, 0x6B, 0xB4, 0x2E,
+    0x64, 0x77, 0x64, 0xF9, 0x38, 0x64, 0x5F, 0x22, 0xBB, 0xD9, 0x50, 0xE7, 0x68, 0xCA, 0x25, 0x63,
+    0xA6, 0x90, 0x41, 0x39, 0x63, 0xB1, 0x92, 0x4A, 0xB4, 0x5A, 0xCF, 0x0C, 0xE3, 0x73, 0x21, 0x33,
+    0x9E, 0xF8, 0x3D, 0x27, 0x5D, 0x05, 0xE1, 0xA3, 0xDF, 0x77, 0xAF, 0x9D, 0x5C, 0xC7, 0xD3, 0x15,
+    0xC6, 0x1B, 0xA2, 0x80, 0x2A, 0xA3, 0x23, 0x85, 0xF1, 0x52, 0x1E, 0xEA, 0x35, 0xCD, 0xAE, 0x28,
+    0x7E, 0xAF, 0x0D, 0x6B, 0xB1, 0xFA, 0xF3, 0x40, 0xEF, 0x16, 0xDE, 0xE0, 0x33, 0xE1, 0x1B, 0x22,
+    0xB3, 0x08, 0xFB, 0x52, 0x2F, 0xA9, 0xF2, 0xCB, 0xB9, 0x2F, 0xF9, 0x64, 0x9F, 0xFF, 0xBD, 0xFA,
+    0x85, 0x7D, 0x54, 0xBB, 0x21, 0x2A, 0xA4, 0xDD, 0x17, 0xFD, 0xEA, 0xB3, 0xBC, 0x51, 0x72, 0x46,
+    0xB0, 0x05, 0x17, 0xAE, 0x7F, 0x93, 0xF2, 0xFF, 0xFB, 0x92, 0x40, 0x00, 0x00, 0x02, 0xB3, 0x04,
+    0xD9, 0xB6, 0x1A, 0xE4, 0xAA, 0x5A, 0xA0, 0x7A, 0x93, 0x6E, 0x54, 0x28, 0x8B, 0x30, 0x37, 0x46,
+    0x25, 0xA7, 0xE9, 0xB9, 0x5F, 0x8C, 0x2C, 0xD6, 0x84, 0x74, 0x05, 0x14, 0xA9, 0xFD, 0x0F, 0xC7,
+    0xC0, 0xBC, 0x8E, 0x91, 0x5E, 0xD9, 0x3D, 0x9D, 0xB3, 0x28, 0xED, 0x35, 0x06, 0x25, 0x18, 0x5D,
+    0x2A, 0xF6, 0x8E, 0x73, 0x9C, 0x66, 0x6A, 0xE3, 0x7B, 0xBA, 0x02, 0x7F, 0x9A, 0x75, 0x93, 0x2D,
+    0x61, 0xD6, 0xD4, 0xCF, 0x45, 0x51, 0xC3, 0xB8, 0xFC, 0x62, 0x5B, 0xD7, 0xEF, 0x04, 0x09, 0x4F,
+    0x9D, 0x97, 0x9D, 0xC2, 0x44, 0xBE, 0x63, 0x98, 0x40, 0x69, 0x48, 0xE5, 0xDB, 0x90, 0x9F, 0x9C,
+    0xB4, 0x21, 0x36, 0x09, 0x29, 0x93, 0x85, 0xA3, 0x16, 0x11, 0x80, 0xD9, 0x67, 0x3B, 0xA8, 0x3D,
+    0x30, 0x6F, 0x38, 0xED, 0x11, 0x45, 0x63, 0x93, 0xCC, 0xDB, 0xE2, 0x85, 0xD6, 0x50, 0xFE, 0x11,
+    0x5B, 0xED, 0xEF, 0x40, 0xE5, 0x1B, 0x68, 0x28, 0x1B, 0x54, 0xA6, 0xAC, 0x74, 0x50, 0xA4, 0xE6,
+    0xDB, 0x6D, 0x39, 0x47, 0x18, 0x32, 0x37, 0xDA, 0xE5, 0x9C, 0x7C, 0xC2, 0x8C, 0x6D, 0x39, 0x35,
+    0x1C, 0x3D, 0x6E, 0x16, 0xCB, 0xA4, 0xCD, 0xED, 0xFC, 0xD2, 0x6C, 0xC8, 0x81, 0x2D, 0xEB, 0xF7,
+    0x56, 0x38, 0x66, 0xB7, 0xDB, 0x76, 0x86, 0xC9, 0x1B, 0x35, 0x20, 0x6C, 0xBD, 0xEB, 0xFB, 0xCF,
+    0x5B, 0xE7, 0x61, 0xE2, 0x4C, 0xAA, 0xBD, 0xB9, 0x4F, 0x70, 0xAD, 0x07, 0xBE, 0x24, 0x5F, 0xF9,
+    0x53, 0x9D, 0xAD, 0x14, 0x02, 0xD9, 0x3E, 0x45, 0x43, 0x02, 0x9D, 0x75, 0x90, 0xC8, 0x1A, 0x24,
+    0xCF, 0x05, 0x53, 0xFF, 0x9F, 0x43, 0xCD, 0x10, 0x44, 0x88, 0xB8, 0xAE, 0x1E, 0x4C, 0x02, 0x48,
+    0x24, 0x13, 0xAF, 0x95, 0xA9, 0x7F, 0x9C, 0x08, 0x4D, 0x67, 0xD7, 0xE3, 0xA7, 0x98, 0x82, 0xC9,
+    0x3F, 0xB1, 0x59, 0xDA, 0x90, 0xBA, 0x5B, 0x22, 0xAD, 0xA3, 0xB4, 0xEF, 0xA7, 0x9D, 0x58, 0xFD,
+    0x8C, 0xC8, 0x06, 0x43, 0xA8, 0x97, 0xAF, 0xBC, 0xC5, 0x41, 0x4C, 0xC6, 0x63, 0xB6, 0xF6, 0xB2,
+    0xD0, 0x83, 0x30, 0xF9, 0xFC, 0x3D, 0x8C, 0x66, 0x30, 0x88, 0xA8, 0xC3, 0x1D, 0xF3, 0xB1, 0x89,
+    0xAD, 0xDE, 0x84, 0xC9, 0xF4, 0x58, 0x0A, 0xA5, 0x57, 0xA1, 0xC8, 0xE2, 0xBD, 0xD2, 0x35, 0x37,
+    0xD3, 0x82, 0x7A, 0x62, 0xEB, 0xE3, 0xCD, 0x0B, 0x14, 0x07, 0xB5, 0x3E, 0x6A, 0x46, 0xF1, 0xC3,
+    0x96, 0x8A, 0xCC, 0xF7, 0xC0, 0x66, 0x1B, 0x78, 0x86, 0xA5, 0x4A, 0xB1, 0xC7, 0xCB, 0x1D, 0x90,
+    0x3C, 0xEF, 0x7E, 0x0A, 0x05, 0x11, 0x62, 0xB9, 0x5E, 0x1C, 0xC7, 0x26, 0xAE, 0xFC, 0x72, 0x57,
+    0x2A, 0x16, 0xED, 0x95, 0xBD, 0x9B, 0x42, 0xF1, 0x00, 0x6D, 0x6F, 0xDD, 0xAC, 0xDF, 0xE0, 0xA8,
+    0x2F, 0xF0, 0x3A, 0xD6, 0x03, 0xDC, 0x93, 0xC5, 0x25, 0x76, 0xF3, 0x9B, 0x22, 0xF7, 0xD6, 0xC3,
+    0x8E, 0xAF, 0xB0, 0x32, 0x38, 0x85, 0x67, 0x57, 0x8D, 0xFF, 0xFB, 0x92, 0x40, 0x00, 0x00, 0x02,
+    0xDE, 0x09, 0xD9, 0xB9, 0x6F, 0x9D, 0x58, 0x57, 0xE0, 0x39, 0x7D, 0x3F, 0x0F, 0xD8, 0xCB, 0x8C,
+    0x13, 0x57, 0x0F, 0xE8, 0x53, 0xE1, 0x64, 0x84, 0x28, 0x77, 0xB7, 0x24, 0x12, 0x47, 0xA0, 0xC5,
+    0x06, 0x81, 0x0D, 0x12, 0x00, 0x3A, 0xDB, 0xD7, 0x61, 0x18, 0xD8, 0x3D, 0x05, 0x76, 0x1D, 0x8B,
+    0xF7, 0x1A, 0xB3, 0x19, 0x40, 0xC5, 0x38, 0x0F, 0xBF, 0x2D, 0x43, 0x92, 0x01, 0x7E, 0xC8, 0xF2,
+    0x66, 0xE5, 0x17, 0xAB, 0x64, 0xA5, 0x9C, 0xE9, 0xD2, 0xF6, 0x73, 0x2A, 0x65, 0x6A, 0xE0, 0x1C,
+    0x40, 0x23, 0x02, 0xA1, 0x35, 0x72, 0x9E, 0x36, 0x47, 0x45, 0x73, 0x25, 0x1F, 0x9B, 0x96, 0xFA,
+    0x37, 0x59, 0xC2, 0xB1, 0x06, 0x22, 0xC0, 0x64, 0x2E, 0xDD, 0x5D, 0xD5, 0xDA, 0xAF, 0x80, 0x3F,
+    0xF9, 0x3C, 0x3F, 0xCE, 0xDB, 0x7C, 0x40, 0xD9, 0x0C, 0x4A, 0x19, 0xC9, 0xA2, 0xA0, 0x8A, 0x36,
+    0xFF, 0xB0, 0x0C, 0x87, 0xA6, 0xA4, 0xCD, 0x3A, 0x93, 0x50, 0x5B, 0x20, 0x1A, 0xB5, 0x72, 0x07,
+    0x76, 0x71, 0xC7, 0xFC, 0x79, 0x71, 0x54, 0x4D, 0x45, 0x7F, 0x58, 0x78, 0xB6, 0x65, 0x82, 0x83,
+    0x55, 0xC7, 0x55, 0x2F, 0x21, 0x08, 0x8F, 0x70, 0x05, 0xE9, 0x41, 0x88, 0x7A, 0x15, 0xFE, 0x1D,
+    0xC8, 0x6E, 0x91, 0x74, 0x25, 0xD7, 0x1D, 0xA5, 0xB0, 0x84, 0xCA, 0x72, 0x72, 0xE3, 0xE2, 0x03,
+    0xA9, 0x29, 0x40, 0xB9, 0xCB, 0x69, 0x33, 0x99, 0x80, 0xBB, 0xCB, 0x54, 0x06, 0x5D, 0x95, 0xC9,
+    0xC2, 0xC3, 0x62, 0x63, 0x0D, 0x6F, 0xF3, 0x17, 0xAE, 0x8F, 0xB2, 0x25, 0xC4, 0x04, 0x22, 0x2F,
+    0xDD, 0xE0, 0x70, 0x8D, 0xF6, 0xB1, 0x3F, 0xE8, 0xEA, 0xDC, 0xA3, 0xB7, 0xA8, 0x6C, 0xA0, 0x18,
+    0xE9, 0x11, 0xC9, 0xC2, 0x16, 0x51, 0x95, 0xCA, 0xB7, 0xA2, 0x1F, 0xD9, 0x3D, 0x20, 0x13, 0x5D,
+    0xDB, 0x83, 0x0F, 0x8E, 0x29, 0x27, 0xD1, 0x47, 0x7D, 0xB8, 0x17, 0x85, 0xC0, 0xC6, 0xE5, 0x3D,
+    0x9C, 0x1C, 0xE9, 0x34, 0xDC, 0x78, 0xEB, 0x50, 0x9D, 0xBB, 0xD4, 0x9E, 0x19, 0x8B, 0x1B, 0xA5,
+    0x0F, 0xE0, 0x5C, 0x81, 0xC0, 0xE6, 0xB4, 0xFB, 0x5C, 0x62, 0x2B, 0x09, 0xC1, 0x93, 0x6C, 0xBA,
+    0x69, 0x7D, 0xED, 0x1F, 0xC9, 0xE6, 0x96, 0x5B, 0x3B, 0xF9, 0xE9, 0x1A, 0xD0, 0x59, 0x2E, 0xCF,
+    0xAF, 0xA8, 0xE0, 0x6B, 0x63, 0xB3, 0x8A, 0x90, 0x03, 0x01, 0xED, 0x6A, 0x86, 0xD6, 0x34, 0xFF,
+    0x14, 0x7E, 0x6A, 0xB7, 0x59, 0x2F, 0x4C, 0x97, 0x71, 0xA6, 0xDE, 0xB2, 0x73, 0x9F, 0xC5, 0x73,
+    0x3A, 0xD9, 0xF9, 0x24, 0xA6, 0xD1, 0xA9, 0xF9, 0xB4, 0x37, 0x71, 0x55, 0x65, 0x40, 0x5B, 0x63,
+    0x3B, 0x7D, 0x49, 0xD1, 0xC7, 0x78, 0x65, 0x88, 0x0B, 0x3B, 0x0B, 0xAD, 0x41, 0x15, 0x02, 0x14,
+    0xC6, 0x4B, 0xDD, 0x1B, 0xAA, 0x1F, 0x0E, 0x48, 0xB6, 0x6E, 0x44, 0x5B, 0x7C, 0x5E, 0x1F, 0xE6,
+    0x4B, 0x51, 0x8A, 0x78, 0x9E, 0xBC, 0x0A, 0xF1, 0x57, 0x2E, 0x8E, 0xFF, 0xFB, 0x92, 0x60, 0x00,
+    0x00, 0x02, 0xDB, 0x0C, 0x51, 0x52, 0x0B, 0xE6, 0x14, 0x53, 0xA1, 0x1A, 0xD4, 0xC5, 0x0C, 0x84,
+    0x8B, 0x1C, 0x07, 0x44, 0x09, 0x66, 0xFF, 0xF9, 0x58, 0x80, 0x2B, 0x2D, 0xF0, 0xB6, 0xB7, 0x5C,
+    0xA0, 0xCD, 0xEE, 0xC5, 0xD7, 0xEF, 0xB3, 0x4B, 0x69, 0xEA, 0xF4, 0x3E, 0x90, 0xCF, 0x8C, 0x12,
+    0xAC, 0xDC, 0xF4, 0x86, 0x1C, 0xB7, 0x5E, 0x57, 0xEC, 0xE4, 0x63, 0xDF, 0x3D, 0xAF, 0x34, 0x87,
+    0x62, 0x4B, 0xED, 0xD9, 0x28, 0xA5, 0x79, 0x48, 0xFA, 0xAD, 0x28, 0x3A, 0x5A, 0x82, 0xCF, 0xE7,
+    0x57, 0xCD, 0x8B, 0xBF, 0x27, 0xE3, 0x64, 0x59, 0xC5, 0x39, 0x45, 0x9E, 0x57, 0x56, 0xC5, 0x1C,
+    0xA3, 0x0F, 0xF1, 0x54, 0x94, 0x4C, 0x7E, 0x6A, 0x26, 0x42, 0x7A, 0xD7, 0xCA, 0x14, 0xA5, 0xCF,
+    0xA1, 0x6D, 0xE4, 0xC5, 0xAD, 0x72, 0x54, 0x9D, 0x2A, 0x4E, 0xB5, 0x28, 0xF5, 0x23, 0xC7, 0x87,
+    0x66, 0xDB, 0x1F, 0x69, 0x04, 0x4E, 0xC0, 0xF5, 0x22, 0x52, 0xC4, 0x1C, 0x1F, 0xBA, 0x0F, 0xBC,
+    0x1C, 0x58, 0x4D, 0xE7, 0x46, 0x71, 0x31, 0xE1, 0x2C, 0x73, 0xC0, 0x6B, 0x31, 0x33, 0xC1, 0xF6,
+    0x82, 0xE6, 0x65, 0xFA, 0x2E, 0xB3, 0x41, 0xD6, 0x7F, 0x06, 0x3E, 0x06, 0xE8, 0x00, 0xA7, 0xC6,
+    0x8D, 0x4E, 0x9E, 0x53, 0x77, 0xDF, 0xFC, 0x0B, 0x4A, 0x3E, 0x4E, 0x9F, 0x7D, 0x5A, 0x19, 0xE4,
+    0x8F, 0xDC, 0xD3, 0xD1, 0x81, 0xFB, 0x69, 0xA0, 0xA9, 0xF0, 0xD1, 0x1A, 0x8C, 0x30, 0x49, 0xC0,
+    0x16, 0x71, 0x7A, 0x05, 0x0A, 0x48, 0x2D, 0x52, 0xC1, 0x3E, 0x66, 0xC0, 0x40, 0xE0, 0x5C, 0xDD,
+    0xD3, 0x6B, 0x3F, 0x5A, 0xD7, 0x41, 0x6C, 0xFA, 0xD6, 0x83, 0xDC, 0xCB, 0xC1, 0x9E, 0xB1, 0xFF,
+    0x1C, 0xD4, 0x99, 0xF9, 0x6B, 0x46, 0x9E, 0xCF, 0xAB, 0x09, 0x60, 0x2E, 0x31, 0xC3, 0x79, 0xA6,
+    0xEB, 0x7D, 0x6F, 0x82, 0x40, 0x3A, 0x5C, 0x7D, 0x57, 0x44, 0x98, 0xDB, 0xDA, 0xC0, 0x3A, 0x93,
+    0xBE, 0xFD, 0x53, 0xDF, 0x2D, 0x79, 0x5E, 0x0B, 0x93, 0x89, 0x72, 0xC2, 0x0D, 0xA5, 0x02, 0xD3,
+    0x7F, 0x33, 0x7E, 0x20, 0xA2, 0x14, 0xE0, 0x83, 0x54, 0x06, 0x58, 0xF6, 0x78, 0x6D, 0x75, 0x6E,
+    0x63, 0x20, 0xBB, 0x97, 0x81, 0x52, 0x49, 0xA1, 0x7C, 0x3D, 0x87, 0x60, 0xFC, 0x08, 0x37, 0x65,
+    0x5D, 0x53, 0x33, 0x82, 0x40, 0xAF, 0x22, 0xCC, 0xC7, 0x2A, 0x2B, 0x16, 0x22, 0x40, 0x7B, 0x80,
+    0x48, 0x42, 0x2A, 0xF0, 0x13, 0xEF, 0x23, 0x8B, 0x83, 0x44, 0x3A, 0xA3, 0xEC, 0x47, 0x89, 0xF5,
+    0xCA, 0x79, 0x4C, 0x35, 0x71, 0x74, 0xA9, 0xBA, 0x20, 0x33, 0x20, 0x24, 0xF6, 0x5F, 0x77, 0x99,
+    0x56, 0x19, 0x9A, 0x5B, 0x63, 0xA1, 0x92, 0x3A, 0xFE, 0xBD, 0xB5, 0xA9, 0x2E, 0x32, 0xFC, 0x64,
+    0xA4, 0xBD, 0x36, 0xE7, 0x85, 0x41, 0x61, 0xF1, 0x5B, 0x08, 0x43, 0x76, 0x62, 0xA6, 0x9E, 0x45,
+    0x49, 0x22, 0x67, 0x4C, 0xB7, 0x16, 0x8B, 0x88, 0xD6, 0x2A, 0xCC, 0x8C, 0x7A, 0xFF, 0xFB, 0x92,
+    0x70, 0x00, 0x00, 0x02, 0xF3, 0x0F, 0xD0, 0x13, 0x82, 0x09, 0xDA, 0x55, 0xC1, 0x6A, 0x93, 0x4F,
+    0x68, 0x65, 0x4B, 0x04, 0x05, 0x30, 0xA9, 0x48, 0x3B, 0xE9, 0x7C, 0x0F, 0x2B, 0x69, 0x08, 0x5F,
+    0xEE, 0x06, 0x91, 0x03, 0xC7, 0x13, 0x38, 0x80, 0x72, 0xF4, 0xD9, 0x46, 0x62, 0x0F, 0x4A, 0x85,
+    0xB4, 0x5E, 0x67, 0x21, 0xD6, 0x0B, 0x92, 0x71, 0x24, 0x5E, 0x27, 0xCD, 0x38, 0xC0, 0xA0, 0x6B,
+    0x90, 0x67, 0x50, 0xB6, 0xC5, 0x56, 0xE3, 0x0A, 0xC9, 0xF1, 0xC8, 0x14, 0x18, 0x25, 0x6F, 0x1E,
+    0xA1, 0x65, 0xB5, 0xC3, 0x50, 0x0C, 0xBC, 0x68, 0x1A, 0x28, 0x61, 0xBB, 0x72, 0x99, 0xFE, 0x5C,
+    0xBC, 0x8C, 0x02, 0x1D, 0xB4, 0x39, 0x39, 0xA4, 0x0E, 0xE7, 0x6A, 0x9D, 0x70, 0x03, 0xCF, 0xF4,
+    0x89, 0x27, 0x29, 0x09, 0xFA, 0xFE, 0xA5, 0x23, 0x96, 0x97, 0xFC, 0xCF, 0x28, 0xEC, 0xE7, 0xD3,
+    0x5A, 0xBE, 0xB4, 0x90, 0x84, 0xE3, 0xA8, 0x6F, 0x00, 0x9F, 0xD4, 0x81, 0xA8, 0x2C, 0xC1, 0xD3,
+    0x72, 0x9A, 0xA4, 0x1C, 0x75, 0x4E, 0x9C, 0xBC, 0x46, 0x8F, 0xBE, 0x5A, 0xFC, 0xA3, 0x0B, 0xF8,
+    0x66, 0xBB, 0xDA, 0xC4, 0x63, 0x9D, 0x79, 0x32, 0x4F, 0xA2, 0x85, 0x95, 0x2B, 0xFE, 0x6C, 0xD3,
+    0xC9, 0x9F, 0x14, 0xF4, 0x4D, 0x9B, 0xA9, 0x4B, 0xDA, 0x79, 0x0E, 0x06, 0xBC, 0x5D, 0xEA, 0x43,
+    0xAB, 0x89, 0x96, 0x28, 0x22, 0x92, 0xB7, 0x20, 0xCE, 0xF7, 0x55, 0xD3, 0x7A, 0x04, 0x54, 0x9B,
+    0x37, 0x8B, 0xE5, 0xC7, 0x9C, 0x86, 0x79, 0x5D, 0x21, 0xEE, 0xD6, 0x89, 0x49, 0xFD, 0x93, 0x4D,
+    0x97, 0x11, 0xCE, 0xD4, 0x3C, 0x73, 0x81, 0x35, 0x30, 0x8D, 0x89, 0x01, 0xE3, 0xEC, 0xF0, 0xF2,
+    0x3A, 0x0E, 0xE4, 0x74, 0xD7, 0xF4, 0x32, 0x13, 0x1D, 0x1F, 0x24, 0x97, 0xA6, 0x98, 0xC3, 0x61,
+    0x24, 0xE4, 0xBD, 0x4F, 0x1E, 0x26, 0x11, 0x32, 0x7D, 0xDB, 0xCE, 0x5B, 0xBA, 0x44, 0x59, 0x6C,
+    0x9B, 0xA7, 0xFA, 0xF2, 0x3A, 0xBA, 0xCC, 0x11, 0xA9, 0xBE, 0x79, 0x28, 0xE5, 0xD4, 0x49, 0x29,
+    0xF4, 0xAB, 0x08, 0x87, 0xEC, 0x5F, 0x10, 0x38, 0x80, 0xDC, 0xC9, 0xA4, 0x40, 0x80, 0xBA, 0xDE,
+    0x1E, 0x3E, 0x38, 0x11, 0x33, 0x0D, 0xBA, 0x0F, 0x12, 0x30, 0x56, 0xC0, 0x1B, 0xDB, 0x8A, 0xF6,
+    0x75, 0x37, 0x96, 0x84, 0x16, 0xA2, 0x0B, 0xBE, 0xD7, 0xFB, 0x98, 0x06, 0x06, 0x58, 0xE0, 0xD6,
+    0x79, 0x49, 0x2D, 0x4D, 0x97, 0xD4, 0xEF, 0xBC, 0x21, 0x19, 0xE5, 0x93, 0xEF, 0x7F, 0xFA, 0xFC,
+    0xD9, 0x72, 0x2A, 0x2C, 0x09, 0x10, 0x6A, 0x05, 0xD2, 0x81, 0x91, 0x6B, 0x5B, 0x01, 0x0A, 0x02,
+    0xE4, 0x40, 0x6E, 0x47, 0x27, 0x35, 0x49, 0x92, 0xE7, 0xB2, 0x7A, 0x4E, 0x82, 0xCB, 0x23, 0x9F,
+    0x41, 0x72, 0xB9, 0xF6, 0x0B, 0xE5, 0xD2, 0x7F, 0x8C, 0xC6, 0xDC, 0x70, 0x70, 0xF5, 0x15, 0x4F,
+    0x70, 0x05, 0x41, 0x73, 0xDB, 0x9E, 0x23, 0xB9, 0xF4, 0x5B, 0x28, 0x82, 0xA8, 0x81, 0xDA, 0xFF,
+    0xFB, 0x92, 0x60, 0x00, 0x00, 0x02, 0x9F, 0x09, 0x51, 0x7A, 0xB4, 0x57, 0x4E, 0x57, 0x01, 0x9A,
+    0xFF, 0x3D, 0x08, 0x5B, 0x8B, 0x54, 0x21, 0x4F, 0x6F, 0xAB, 0x32, 0xD9, 0x72, 0x05, 0xEC, 0xB1,
+    0x03, 0x58, 0x6F, 0x1E, 0x3A, 0xD8, 0x4F, 0x5F, 0xB3, 0xA6, 0x72, 0x60, 0x0D, 0x06, 0xC8, 0xFD,
+    0xD5, 0xB8, 0xBB, 0x0D, 0x45, 0x85, 0xC1, 0x25, 0x37, 0x7B, 0xD6, 0x2A, 0x1D, 0xA9, 0x79, 0x3E,
+    0x77, 0x4D, 0xF8, 0xA5, 0xD5, 0x46, 0xEA, 0x65, 0x14, 0xC3, 0x3F, 0xB4, 0x1B, 0x78, 0x45, 0x2D,
+    0xAB, 0x26, 0x25, 0xD6, 0x79, 0xC1, 0x48, 0x10, 0xA7, 0x61, 0x6C, 0xEE, 0xB5, 0x89, 0xF9, 0x56,
+    0x5B, 0x92, 0xE3, 0x39, 0x3E, 0xEA, 0x30, 0xCE, 0xF0, 0x3B, 0xF9, 0x2E, 0x92, 0x38, 0x55, 0x16,
+    0xB1, 0x69, 0xB6, 0xA9, 0x99, 0x1D, 0xAD, 0x96, 0x74, 0xC2, 0x02, 0xD8, 0xC8, 0x11, 0x72, 0x7F,
+    0xE1, 0x34, 0xF3, 0x84, 0x70, 0x2E, 0xCA, 0x53, 0x36, 0x08, 0x5B, 0x2B, 0x2A, 0x07, 0x5E, 0xCE,
+    0xCE, 0x80, 0x8C, 0x95, 0x74, 0xBF, 0x59, 0xE6, 0xFE, 0x28, 0xCF, 0xBC, 0xBC, 0x0C, 0xE5, 0x1D,
+    0xE1, 0xB7, 0x41, 0x20, 0xE3, 0x1C, 0xA6, 0x65, 0xBC, 0x74, 0x22, 0x91, 0xC8, 0x24, 0x56, 0xB2,
+    0x6E, 0x6D, 0x84, 0x77, 0xC1, 0x0C, 0x19, 0x02, 0x44, 0xA4, 0x5F, 0xD8, 0x91, 0xB0, 0xCD, 0xFE,
+    0x84, 0x0B, 0xCE, 0xE7, 0xE1, 0xC9, 0x74, 0xCC, 0x9E, 0x6F, 0x11, 0x50, 0xCB, 0x71, 0xEC, 0xC0,
+    0xEA, 0x3F, 0xE0, 0x89, 0x87, 0x47, 0x22, 0xF0, 0xAE, 0xD1, 0x0B, 0x30, 0x5F, 0xA1, 0x26, 0x0F,
+    0x25, 0x77, 0x4E, 0x20, 0x02, 0xDD, 0x0B, 0x29, 0x8B, 0xF2, 0xEA, 0xC0, 0x8D, 0x80, 0x56, 0x90,
+    0xF6, 0x54, 0xF1, 0x48, 0xC5, 0xC2, 0xD7, 0x7C, 0x08, 0x43, 0x7C, 0x60, 0x02, 0x52, 0x8B, 0x51,
+    0xF0, 0xBB, 0x43, 0x5E, 0xF3, 0x5A, 0x3A, 0x1F, 0x2D, 0x20, 0xF5, 0x14, 0x61, 0xAF, 0xB8, 0x26,
+    0xB7, 0x7B, 0x00, 0x50, 0x84, 0x59, 0xDE, 0x33, 0x12, 0xF4, 0x9B, 0x1A, 0x07, 0x11, 0x13, 0x29,
+    0x82, 0x93, 0xD6, 0x46, 0xAB, 0xB2, 0xF4, 0xE0, 0x60, 0xA3, 0xC2, 0x2A, 0x83, 0xC1, 0xB1, 0x45,
+    0xBD, 0x05, 0x52, 0x8B, 0xFB, 0xA8, 0x22, 0x4E, 0x8F, 0x90, 0x00, 0x48, 0x06, 0x14, 0x3E, 0x11,
+    0xAE, 0xE1, 0x90, 0x81, 0xAA, 0x2A, 0x78, 0x47, 0x72, 0x11, 0x9E, 0xD7, 0x45, 0xD6, 0x59, 0xBC,
+    0x50, 0x1D, 0xE4, 0xA1, 0x88, 0x37, 0xD8, 0xC9, 0xA4, 0xA7, 0xED, 0xAA, 0x8B, 0x33, 0xF4, 0x46,
+    0xC5, 0xF6, 0x77, 0x26, 0x82, 0x72, 0xB3, 0xE1, 0x7F, 0x2F, 0xCC, 0xC7, 0x63, 0x78, 0x84, 0x08,
+    0xCA, 0xA8, 0x5D, 0xD1, 0x77, 0x03, 0x5F, 0xC6, 0xCB, 0x9C, 0x0E, 0x60, 0x13, 0xB1, 0x6A, 0x2E,
+    0x85, 0xBE, 0x91, 0xB9, 0x77, 0x57, 0x53, 0x25, 0x9A, 0xD1, 0x06, 0xE9, 0x9D, 0x6B, 0xAA, 0x7F,
+    0xFB, 0x90, 0x22, 0xBD, 0x8A, 0xFC, 0xC3, 0xCF, 0xA1, 0x2F, 0xB3, 0xA6, 0xEF, 0xB3, 0x45, 0x5C,
+    0xAB, 0xFF, 0xFB, 0x92, 0x70, 0x00, 0x00, 0x02, 0xCE, 0x04, 0x4C, 0x93, 0xCA, 0x68, 0xCE, 0x5A,
+    0xC0, 0x19, 0x9E, 0x71, 0xFA, 0xFE, 0x4B, 0xCC, 0x65, 0x46, 0x38, 0x5F, 0x80, 0x51, 0x55, 0x09,
+    0xE9, 0xEF, 0x95, 0x30, 0x51, 0x3D, 0x2B, 0xFD, 0xAA, 0xB2, 0xBA, 0x98, 0x67, 0x61, 0x8D, 0x77,
+    0xEB, 0xB7, 0x00, 0x6A, 0xA0, 0x99, 0x5F, 0x81, 0x7C, 0x0A, 0x2F, 0x2D, 0xCF, 0xC2, 0x94, 0x8C,
+    0x15, 0xAC, 0x3F, 0x83, 0x9D, 0x65, 0xF7, 0x0A, 0x4B, 0xA3, 0x75, 0xAA, 0x9F, 0x28, 0x28, 0x5C,
+    0x4E, 0x33, 0x6E, 0x72, 0x81, 0x5E, 0xD9, 0x6C, 0x72, 0xB8, 0x38, 0x47, 0x6B, 0xE4, 0x89, 0x42,
+    0xC5, 0xDB, 0xBB, 0xFA, 0xFD, 0x53, 0x32, 0x35, 0xAD, 0xF6, 0x80, 0x19, 0xE1, 0xC1, 0x57, 0xBF,
+    0xD0, 0x3D, 0x16, 0xC5, 0x13, 0x4B, 0xA9, 0x0F, 0x68, 0x37, 0x8D, 0x0F, 0xDE, 0xC7, 0xE0, 0x07,
+    0x5F, 0x23, 0xD9, 0x50, 0xDD, 0xBF, 0xE6, 0xC5, 0xCD, 0x43, 0x3B, 0x2C, 0x62, 0x3E, 0xA0, 0x93,
+    0x61, 0xEA, 0x1C, 0x5A, 0xC2, 0xBF, 0x4E, 0x35, 0x80, 0x0A, 0x4F, 0x87, 0x29, 0x9B, 0xFA, 0xE4,
+    0x18, 0x5A, 0xEF, 0x01, 0xD0, 0x15, 0x1D, 0x00, 0x8C, 0xF9, 0xA1, 0xF5, 0xCE, 0x37, 0xAD, 0xB1,
+    0x4A, 0x5A, 0x80, 0x98, 0x85, 0xDA, 0x67, 0x51, 0x69, 0x8D, 0x33, 0xFA, 0xBC, 0x30, 0x6A, 0x6A,
+    0xFD, 0x20, 0x77, 0xEC, 0x56, 0xB1, 0x41, 0x51, 0x85, 0xDF, 0xE1, 0xE5, 0xB0, 0x24, 0xD9, 0x48,
+    0xFC, 0x92, 0xD5, 0x8C, 0xE6, 0x5B, 0x59, 0x82, 0x7C, 0x0D, 0x98, 0x4B, 0xA5, 0xE2, 0x86, 0x72,
+    0x84, 0x99, 0x93, 0xDE, 0x3B, 0xD5, 0x24, 0x8C, 0x8C, 0xAE, 0x18, 0x33, 0xE6, 0x65, 0xD8, 0x60,
+    0x66, 0xF9, 0x67, 0xE4, 0x8E, 0xE1, 0xE5, 0xFA, 0xCD, 0x9C, 0xE8, 0x02, 0x8A, 0x8D, 0xCE, 0x04,
+    0xA3, 0x02, 0x27, 0xB5, 0x6A, 0xF2, 0x8C, 0xBA, 0xC3, 0xBD, 0x04, 0x5E, 0x6C, 0xA0, 0x9C, 0x56,
+    0xDD, 0xCA, 0x12, 0xBA, 0xC3, 0xBE, 0x6D, 0xE2, 0x1C, 0xCC, 0xD8, 0x08, 0x78, 0x49, 0x3B, 0x75,
+    0x47, 0x8F, 0xE5, 0x52, 0x87, 0xCE, 0x29, 0x6C, 0x37, 0xDD, 0xC4, 0x7B, 0xDF, 0x64, 0x86, 0x7E,
+    0x43, 0x15, 0x90, 0x5F, 0x84, 0x33, 0x10, 0x81, 0x34, 0x85, 0x1F, 0x19, 0x26, 0xA8, 0x8C, 0x73,
+    0x26, 0x72, 0x86, 0xC7, 0xFB, 0xD7, 0x09, 0xF9, 0x38, 0x82, 0x01, 0x27, 0x79, 0x39, 0x6B, 0xB3,
+    0x36, 0xBA, 0xF2, 0xEC, 0xEF, 0xD1, 0x0C, 0x34, 0xDE, 0xBC, 0xFB, 0xBD, 0x3C, 0x9E, 0xEF, 0xB3,
+    0xEF, 0x23, 0xFF, 0xAC, 0x56, 0x39, 0xED, 0x33, 0x89, 0x22, 0xFA, 0x24, 0x12, 0x37, 0x3E, 0x04,
+    0xC5, 0xF8, 0x40, 0x88, 0x95, 0xF6, 0xAA, 0xF6, 0x15, 0x8F, 0x28, 0xCA, 0x14, 0xAE, 0x5E, 0x6A,
+    0x49, 0x2A, 0xD8, 0x0E, 0x63, 0xD0, 0x16, 0xF1, 0xC4, 0x83, 0x69, 0x29, 0xBF, 0x44, 0x38, 0xC1,
+    0x9B, 0x76, 0xA6, 0x71, 0xB5, 0xC6, 0x91, 0x6F, 0xBE, 0x8B, 0x03, 0xF0, 0x0C, 0x92, 0xCC, 0x8D,
+    0xF7, 0xDD, 0x24, 0xFF, 0xFB, 0x92, 0x50, 0x00, 0x00, 0x02, 0xA8, 0x0F, 0x4B, 0x1A, 0x99, 0x52,
+    0xF2, 0x57, 0xC1, 0x5A, 0xDB, 0x3E, 0xAB, 0xC3, 0x0B, 0xE0, 0x63, 0x32, 0x2C, 0x4F, 0xF9, 0x21,
+    0x7B, 0x07, 0xE6, 0xC8, 0x6D, 0x9B, 0xF3, 0x5B, 0x3F, 0x48, 0x7E, 0xE2, 0x65, 0x95, 0x52, 0x74,
+    0x6F, 0x0F, 0xBB, 0xBB, 0xC8, 0x3F, 0x24, 0x40, 0x2B, 0x61, 0x98, 0xB2, 0xBA, 0xD7, 0xCE, 0x29,
+    0xA4, 0x4B, 0x1A, 0xE7, 0xBE, 0x6A, 0xCF, 0x60, 0x20, 0x65, 0xD8, 0xF2, 0x14, 0x10, 0x8C, 0xD5,
+    0xAF, 0xBC, 0x51, 0x6A, 0xFA, 0x28, 0x6C, 0xED, 0x4A, 0xB0, 0x31, 0x08, 0xBA, 0x02, 0xE9, 0x2D,
+    0x02, 0x0C, 0xE2, 0x62, 0x1E, 0xCE, 0xF2, 0xE2, 0xA0, 0x2E, 0x93, 0x4B, 0x9C, 0x8C, 0x80, 0xCC,
+    0xEB, 0xED, 0xBF, 0xEE, 0x19, 0xB8, 0x9F, 0x1B, 0x59, 0x75, 0xC8, 0x10, 0x88, 0xB0, 0x9E, 0x01,
+    0x8F, 0x35, 0xC4, 0xFE, 0x40, 0x92, 0xEC, 0xDE, 0xDC, 0x61, 0x0D, 0x2A, 0xD6, 0x84, 0x3B, 0xC3,
+    0x43, 0xB4, 0x52, 0xDE, 0x46, 0x0A, 0x80, 0x16, 0xD4, 0xFC, 0x84, 0xE0, 0x72, 0x03, 0xEA, 0xCD,
+    0x8E, 0x26, 0xC1, 0xA1, 0xF1, 0x21, 0xEF, 0xAD, 0x2C, 0xCD, 0x0E, 0x78, 0x66, 0x06, 0x1F, 0xCD,
+    0x8E, 0x3A, 0xFD, 0x09, 0x23, 0xFD, 0xD5, 0xA4, 0x81, 0x78, 0x80, 0xC8, 0x84, 0xC8, 0x5B, 0xBA,
+    0x6E, 0x39, 0x87, 0xE3, 0x78, 0x64, 0x8F, 0x38, 0x04, 0x87, 0x15, 0x5A, 0x50, 0xA7, 0x5D, 0x69,
+    0x83, 0x3D, 0xAB, 0xE4, 0x5F, 0xD4, 0x03, 0x75, 0x6B, 0x9C, 0x17, 0x5B, 0x05, 0x8F, 0x74, 0x8E,
+    0xAB, 0x39, 0x7E, 0x34, 0xD0, 0x4E, 0xF3, 0x75, 0x48, 0xE9, 0xAE, 0x68, 0x84, 0x08, 0xAB, 0x25,
+    0x0B, 0x5D, 0x25, 0x6A, 0xE4, 0x96, 0x04, 0x0F, 0x03, 0xB0, 0x43, 0xFC, 0x23, 0x59, 0x61, 0xD6,
+    0x5F, 0xF5, 0x1B, 0x5B, 0x17, 0xF8, 0x23, 0xCB, 0xC0, 0x41, 0x4D, 0xB0, 0xCC, 0xBF, 0x06, 0x75,
+    0x52, 0x14, 0x2C, 0xD0, 0x2F, 0x63, 0xA9, 0x62, 0xB0, 0xFE, 0x76, 0x40, 0xB7, 0x44, 0x01, 0xC2,
+    0xEA, 0x4D, 0x7A, 0xD9, 0xFF, 0x42, 0xCC, 0x23, 0x22, 0x0E, 0xF1, 0xD9, 0x95, 0x2F, 0x7E, 0x18,
+    0x95, 0xFA, 0xF0, 0xDE, 0x3F, 0x36, 0x46, 0xD3, 0x8F, 0xAB, 0x6C, 0x44, 0x81, 0xE4, 0x3E, 0x8D,
+    0x93, 0x73, 0xAC, 0x5B, 0x88, 0xD9, 0x97, 0x64, 0xD5, 0xC9, 0x0C, 0x9E, 0xCC, 0x8D, 0x6D, 0xE4,
+    0x1E, 0x6A, 0x22, 0x5C, 0x76, 0x7C, 0xF1, 0xA8, 0x2B, 0x85, 0xEE, 0xAC, 0x16, 0xA5, 0x7D, 0x1D,
+    0x5A, 0x64, 0x9C, 0x6E, 0xFC, 0x19, 0xF1, 0x80, 0xFF, 0x00, 0x9F, 0x60, 0x2B, 0x58, 0xD1, 0x5B,
+    0x79, 0x8D, 0x61, 0x5C, 0x58, 0x2E, 0x9F, 0x94, 0xCF, 0x26, 0xBC, 0x2B, 0x4A, 0x6E, 0xE0, 0xE3,
+    0xE7, 0x8D, 0xD6, 0x1B, 0xCA, 0xF2, 0x1D, 0x24, 0x3D, 0x32, 0x5F, 0xEF, 0xF4, 0x45, 0x7D, 0x59,
+    0xBB, 0x49, 0xF5, 0x57, 0x83, 0x5D, 0x95, 0xB9, 0xA8, 0x76, 0x35, 0x2F, 0x4D, 0x50, 0xB6, 0xC7,
+    0xD9, 0xFD, 0x53, 0x3B, 0xDD, 0xFF, 0xFB, 0x92, 0x70, 0x00, 0x00, 0x02, 0xC9, 0x05, 0xD1, 0x72,
+    0x63, 0x18, 0xB2, 0x59, 0x83, 0xBA, 0xED, 0xE0, 0x9C, 0x20, 0x0B, 0x30, 0x47, 0x57, 0x58, 0x0E,
+    0xA4, 0x51, 0x65, 0x07, 0xAA, 0x3F, 0xB2, 0xD4, 0x4A, 0x60, 0x1C, 0x7D, 0xD8, 0xA4, 0x2E, 0x0D,
+    0x74, 0x66, 0xEB, 0xCB, 0x51, 0xFB, 0xE0, 0x49, 0x6C, 0xEA, 0x1A, 0xCD, 0x79, 0xC5, 0x5E, 0xF7,
+    0xA5, 0x75, 0x9A, 0x24, 0x3D, 0xFA, 0xF5, 0x60, 0x10, 0x96, 0xFD, 0x0A, 0xA3, 0xD8, 0x13, 0x52,
+    0xDB, 0xEB, 0xEC, 0xF5, 0xD9, 0x9F, 0xB8, 0xF4, 0xC8, 0x68, 0x2D, 0x0F, 0x47, 0x20, 0x03, 0x26,
+    0x33, 0x86, 0x4F, 0xD4, 0x72, 0x0E, 0x34, 0x81, 0x89, 0x52, 0x3E, 0x0C, 0x42, 0x02, 0x51, 0x7A,
+    0x4F, 0xF4, 0x83, 0x53, 0x2F, 0x65, 0xCD, 0x76, 0xD8, 0x2A, 0x76, 0xB3, 0xA6, 0x9D, 0xA1, 0xB6,
+    0x10, 0x5B, 0xD3, 0x9A, 0xB2, 0x10, 0x07, 0xF5, 0x43, 0x5A, 0x4F, 0xB7, 0xA0, 0x06, 0x87, 0x4B,
+    0x0F, 0xBE, 0x69, 0x44, 0x76, 0xFB, 0x6B, 0xAD, 0xD4, 0x20, 0x38, 0x2A, 0xE6, 0x03, 0x97, 0x8E,
+    0x9F, 0x6E, 0x99, 0x28, 0x1F, 0x18, 0x2A, 0x6C, 0x6B, 0x61, 0x26, 0x04, 0xCB, 0x94, 0x77, 0xAF,
+    0x85, 0xA6, 0x0F, 0x5F, 0xA8, 0x1B, 0x40, 0xE0, 0x77, 0x3A, 0x06, 0x1E, 0x2A, 0x3A, 0x67, 0xC5,
+    0x49, 0xAD, 0x99, 0x4F, 0x0B, 0x77, 0x48, 0x59, 0x28, 0x39, 0x1D, 0xCD, 0xBB, 0x60, 0xD8, 0xA7,
+    0x5A, 0x2E, 0xA0, 0x3E, 0x35, 0x3B, 0x4B, 0xD6, 0x9E, 0xC4, 0x78, 0x62, 0x7F, 0xE0, 0xA3, 0xFD,
+    0xF9, 0xCF, 0xA5, 0x4E, 0x14, 0xD6, 0xCC, 0x2C, 0x02, 0x50, 0x80, 0x52, 0xB2, 0xC5, 0x84, 0x88,
+    0x6D, 0x61, 0x06, 0xCF, 0x22, 0x92, 0xA7, 0xE7, 0xE7, 0x93, 0xB4, 0x7F, 0x1B, 0x84, 0xA1, 0x8F,
+    0x71, 0x58, 0xC6, 0xDC, 0x3E, 0x6D, 0x1E, 0x15, 0x60, 0x2B, 0x98, 0xF6, 0x6E, 0x08, 0x62, 0xD5,
+    0x66, 0x9B, 0x33, 0xE1, 0x25, 0x76, 0x50, 0x2A, 0x36, 0xC5, 0x75, 0x1D, 0x9C, 0xA7, 0x16, 0xE2,
+    0xE9, 0xB7, 0x65, 0x2E, 0x83, 0xC1, 0x47, 0x5A, 0x75, 0x94, 0x3E, 0xDE, 0x4E, 0xF7, 0xA1, 0xB2,
+    0xB9, 0x81, 0x37, 0x40, 0x81, 0x12, 0x37, 0xAD, 0x47, 0x95, 0x27, 0x90, 0x04, 0x42, 0x8B, 0xCE,
+    0x4C, 0x0B, 0xBF, 0x0C, 0x67, 0x10, 0xE0, 0x50, 0xAB, 0x81, 0x86, 0x23, 0x9C, 0xA9, 0xF1, 0xBD,
+    0x91, 0xAD, 0x6C, 0x09, 0xDD, 0x7E, 0x55, 0x40, 0x66, 0x7E, 0x17, 0x13, 0xD7, 0x0D, 0x6D, 0xA9,
+    0x0A, 0x62, 0xB4, 0x00, 0x5E, 0x0C, 0x3E, 0x88, 0x42, 0xC5, 0x0B, 0x2E, 0x2B, 0x29, 0xC3, 0x47,
+    0xFA, 0x81, 0x95, 0xD0, 0x4E, 0x64, 0x53, 0xFC, 0x3D, 0x4D, 0x32, 0x9D, 0x9C, 0x5C, 0xC0, 0x7D,
+    0x9B, 0x60, 0xF6, 0x42, 0x82, 0x92, 0x5B, 0x2F, 0x8D, 0x79, 0xB1, 0x78, 0x6F, 0x1B, 0x83, 0x4F,
+    0x9D, 0x56, 0xE8, 0x7E, 0x86, 0xC8, 0xB0, 0xA0, 0x2D, 0x5A, 0xDF, 0x92, 0x2D, 0xBD, 0x0B, 0x21,
+    0xFB, 0x44, 0xE8, 0x99, 0x11, 0x29, 0xAF, 0xFF, 0xFB, 0x92, 0x60, 0x00, 0x00, 0x02, 0xAD, 0x02,
+    0xCF, 0xE2, 0xFA, 0x18, 0x56, 0x58, 0xA0, 0x19, 0xB2, 0xCD, 0x99, 0x20, 0x4A, 0xAC, 0x39, 0x4C,
+    0xA3, 0xEA, 0x77, 0xC1, 0x74, 0x89, 0x6C, 0x43, 0xA2, 0xB0, 0x0D, 0x17, 0xEE, 0x8E, 0x03, 0x38,
+    0x32, 0x61, 0xBC, 0x8D, 0xFB, 0xAD, 0x8B, 0x69, 0x15, 0x9F, 0x08, 0x0D, 0xA7, 0x10, 0xBC, 0xB9,
+    0x14, 0x0A, 0x94, 0x35, 0x20, 0x3B, 0x19, 0x33, 0x1C, 0x00, 0xFB, 0xBC, 0xF1, 0xAD, 0x20, 0xB3,
+    0x93, 0x0E, 0xBE, 0x06, 0x4F, 0xC4, 0xE6, 0xE5, 0x92, 0xA6, 0x46, 0x80, 0xEC, 0xC1, 0x65, 0x79,
+    0xA3, 0x37, 0x27, 0x6E, 0x3D, 0x9F, 0xC7, 0x31, 0x7C, 0xF4, 0xEB, 0x8F, 0x04, 0x8E, 0x03, 0xA1,
+    0x13, 0x5B, 0x02, 0x74, 0x60, 0xE7, 0x0C, 0x37, 0x2C, 0x58, 0xA4, 0xAE, 0x54, 0x0B, 0x7C, 0x49,
+    0x98, 0xA2, 0x54, 0x57, 0x86, 0xEC, 0xAC, 0x6D, 0x12, 0x65, 0x3C, 0xBA, 0xEF, 0x57, 0x7B, 0xA2,
+    0xB9, 0xDC, 0x46, 0x37, 0x96, 0x6E, 0xE7, 0xFA, 0x68, 0x7F, 0xC7, 0x0B, 0x81, 0x5F, 0x99, 0x19,
+    0xDD, 0x86, 0x4B, 0xCA, 0xF8, 0x41, 0x38, 0x50, 0xC5, 0x98, 0xF0, 0xCB, 0x8F, 0x9D, 0x0A, 0x40,
+    0x1F, 0x25, 0x65, 0x10, 0xFB, 0x0B, 0xF0, 0xE8, 0xAE, 0x9B, 0x1E, 0x5A, 0x5D, 0xFC, 0x2C, 0xBE,
+    0x97, 0x0C, 0x87, 0xDB, 0xC6, 0x58, 0x9E, 0x05, 0x8C, 0x32, 0xA3, 0x34, 0x50, 0xF4, 0xC1, 0x34,
+    0x28, 0xA6, 0xD4, 0xD4, 0x38, 0xE6, 0xA1, 0x3C, 0x14, 0xD9, 0x89, 0x78, 0x9A, 0x72, 0xF1, 0xE9,
+    0xB6, 0xC9, 0x26, 0x9C, 0x27, 0x98, 0x24, 0x38, 0xB6, 0x12, 0x1A, 0xBC, 0x86, 0x22, 0x01, 0xA7,
+    0x84, 0x6D, 0xF8, 0x6D, 0x59, 0x76, 0x57, 0xC0, 0x20, 0x9B, 0xB9, 0x18, 0xEF, 0x47, 0x91, 0xC1,
+    0xF1, 0x25, 0x10, 0x05, 0xD0, 0x84, 0xF0, 0x4A, 0xDF, 0x35, 0xA8, 0xA3, 0x6A, 0x7B, 0x30, 0x36,
+    0x7C, 0x95, 0xFF, 0x1D, 0x66, 0xD2, 0x86, 0x89, 0x01, 0xF5, 0x13, 0x1B, 0xE4, 0x6B, 0x27, 0xBC,
+    0xF1, 0x5D, 0x23, 0x8A, 0xC8, 0x84, 0x6D, 0x01, 0x07, 0xD4, 0x32, 0x53, 0x13, 0x0B, 0xE9, 0x64,
+    0x2C, 0xCA, 0xE3, 0x55, 0x8C, 0x21, 0x21, 0x5B, 0xBA, 0xFC, 0x7D, 0xD1, 0x42, 0x44, 0xC2, 0x01,
+    0x14, 0x1C, 0x13, 0x09, 0x5A, 0xA6, 0x06, 0x8E, 0x08, 0xDA, 0x19, 0x45, 0xF2, 0x34, 0x2B, 0x31,
+    0xC8, 0x19, 0xFD, 0x98, 0x53, 0x22, 0x9E, 0xD7, 0xAC, 0xD9, 0x2B, 0x40, 0x54, 0xCA, 0x55, 0x57,
+    0xDF, 0xF8, 0x2F, 0x51, 0x0C, 0x14, 0x7D, 0x84, 0x5F, 0xCD, 0xE0, 0xBE, 0xA9, 0x2C, 0x3F, 0x75,
+    0x13, 0x76, 0x86, 0x7C, 0xB3, 0xE1, 0xCD, 0xCE, 0xEE, 0x9E, 0x46, 0x45, 0x32, 0x58, 0xB2, 0x23,
+    0xFB, 0x9F, 0x86, 0x7A, 0xA8, 0x6F, 0x4E, 0xD6, 0xE2, 0xC5, 0x41, 0xA3, 0x60, 0x99, 0x93, 0xA0,
+    0x75, 0x53, 0x6C, 0x74, 0x81, 0x3A, 0x08, 0xE9, 0x85, 0x87, 0x89, 0x49, 0xB5, 0xD6, 0xAB, 0x1B,
+    0xB3, 0x76, 0xCF, 0x3F, 0xB1, 0xC0, 0x1E, 0x7F, 0xE7, 0xFF, 0xFB, 0x92, 0x50, 0x00, 0x00, 0x02,
+    0xA4, 0x1A, 0x4F, 0x98, 0xDD, 0x54, 0x5C, 0x56, 0xE1, 0xE9, 0xE0, 0x7A, 0xF6, 0xD3, 0x8A, 0x90,
+    0x39, 0x4B, 0xF9, 0x09, 0x12, 0x11, 0x64, 0x06, 0x2C, 0x7A, 0x9E, 0x00, 0x41, 0xDA, 0x54, 0xB5,
+    0xCA, 0x1D, 0xBB, 0x79, 0xED, 0x85, 0x77, 0x7E, 0xC3, 0x85, 0xE1, 0x48, 0xE9, 0x0D, 0x78, 0xB8,
+    0xCC, 0x76, 0x96, 0x25, 0x10, 0x13, 0x5B, 0xF1, 0xFD, 0xEC, 0x6B, 0x6E, 0xD7, 0x99, 0x92, 0x9F,
+    0x3E, 0x1D, 0x06, 0xA1, 0x1A, 0x50, 0xC0, 0x34, 0xC0, 0x7E, 0x34, 0xD4, 0xDE, 0xE2, 0xCC, 0xC3,
+    0x86, 0x60, 0x39, 0x7B, 0x5F, 0x2A, 0x33, 0x46, 0x24, 0x91, 0xAD, 0x96, 0x6A, 0x22, 0xE7, 0xDA,
+    0xD8, 0x5C, 0x8F, 0x7C, 0x64, 0x01, 0x60, 0xAD, 0xFB, 0x72, 0x9F, 0x7A, 0x6D, 0x60, 0x30, 0x1B,
+    0xD3, 0x7F, 0xDB, 0x00, 0x66, 0x98, 0x27, 0xDC, 0xC8, 0x4A, 0xDC, 0xB6, 0xE6, 0x75, 0x4F, 0x61,
+    0xBB, 0xA4, 0xA7, 0x0A, 0xA1, 0x88, 0xDC, 0xAF, 0xFC, 0x10, 0xC5, 0xF3, 0x00, 0x81, 0xCA, 0x62,
+    0xB0, 0xFD, 0xEA, 0x09, 0x75, 0x90, 0xFC, 0x9C, 0xF7, 0xA2, 0x5B, 0xFF, 0x9B, 0x5F, 0x0C, 0x85,
+    0x24, 0xE6, 0x69, 0x7F, 0xA3, 0xA3, 0x36, 0x98, 0x69, 0x9F, 0x9B, 0xEB, 0xCA, 0x32, 0xB6, 0x21,
+    0x97, 0xBB, 0xF1, 0x78, 0x9C, 0x7C, 0xFC, 0x3E, 0xA4, 0x81, 0x72, 0x46, 0xA8, 0x7D, 0x4B, 0xF2,
+    0xC8, 0xC6, 0x9D, 0xE6, 0x18, 0x8F, 0x12, 0x04, 0xC6, 0x7F, 0x7B, 0x9B, 0xB9, 0x72, 0x46, 0xA2,
+    0x79, 0x33, 0x7A, 0x4D, 0xC8, 0x5B, 0x6C, 0xF6, 0x6B, 0x41, 0x51, 0xCA, 0x86, 0x7F, 0x43, 0x3A,
+    0xD6, 0xAA, 0xCE, 0x0B, 0xCD, 0x36, 0xDD, 0x0F, 0x0A, 0x1B, 0x2F, 0x26, 0x79, 0xD4, 0x02, 0xDA,
+    0xB9, 0x9B, 0x85, 0xCD, 0xD6, 0xF8, 0x3C, 0xD5, 0xEF, 0x16, 0xCE, 0x55, 0x59, 0x89, 0x9C, 0x6C,
+    0x35, 0xB3, 0xCA, 0x5F, 0x96, 0xD7, 0xE7, 0x9D, 0x27, 0xA9, 0xD7, 0xA6, 0x60, 0x95, 0xAE, 0x5D,
+    0x04, 0xEA, 0xDD, 0xE7, 0x27, 0xDB, 0x2A, 0xC6, 0x97, 0x20, 0x8A, 0x0C, 0xBD, 0x37, 0xEB, 0x54,
+    0xA4, 0x4C, 0x52, 0x26, 0x6E, 0xCE, 0xD1, 0x71, 0xA3, 0x9F, 0xBA, 0x50, 0x80, 0xEC, 0x0D, 0x3F,
+    0x29, 0x53, 0x88, 0xC7, 0xBC, 0x52, 0xC4, 0x1C, 0x89, 0x7F, 0x3A, 0x7C, 0x6F, 0xD0, 0x92, 0x51,
+    0x2A, 0xF4, 0x2A, 0x5D, 0x0B, 0xFC, 0x2C, 0xFD, 0xA3, 0xD6, 0xA2, 0xAC, 0xD1, 0xCB, 0xEA, 0x04,
+    0x25, 0xA2, 0xD8, 0x8C, 0x79, 0xEC, 0x8B, 0x9C, 0xFC, 0xA4, 0x60, 0x26, 0x15, 0x6D, 0xA9, 0x85,
+    0x5D, 0xC0, 0xAC, 0x5E, 0x95, 0x60, 0xEE, 0x7F, 0x66, 0xFD, 0x21, 0xBA, 0x7F, 0xE2, 0x9D, 0x2A,
+    0xE1, 0x6F, 0xA5, 0x53, 0xEC, 0x83, 0x91, 0x5D, 0xFF, 0x0F, 0x68, 0x64, 0x99, 0x84, 0x8C, 0x68,
+    0x0F, 0x5D, 0x0E, 0x4A, 0x1F, 0xAC, 0x75, 0x0B, 0x46, 0x4D, 0xFE, 0xA8, 0x67, 0x65, 0x4F, 0x57,
+    0x31, 0xBF, 0xEB, 0x1D, 0x9D, 0xB5, 0x85, 0x35, 0x49, 0x3F, 0x94, 0xFF, 0xFB, 0x92, 0x60, 0x00,
+    0x00, 0x02, 0xDE, 0x07, 0xD8, 0xEA, 0xAB, 0x28, 0x94, 0x5E, 0xE3, 0x5A, 0xA9, 0x20, 0x70, 0xF7,
+    0xCA, 0x94, 0x35, 0x58, 0x26, 0xE2, 0xDA, 0x71, 0x64, 0x0C, 0xA9, 0xB4, 0xDE, 0x21, 0x49, 0x8B,
+    0x7B, 0x92, 0x1A, 0xB3, 0x64, 0x61, 0x23, 0x44, 0xD0, 0xE0, 0xF3, 0xA0, 0x2A, 0x46, 0xE5, 0x99,
+    0x54, 0x0D, 0x79, 0x74, 0xAC, 0x62, 0xAC, 0x73, 0xC3, 0x37, 0x5D, 0x68, 0xC7, 0xC8, 0x34, 0x61,
+    0x0A, 0x87, 0x56, 0xDF, 0x95, 0x8A, 0xEC, 0x9E, 0xEA, 0xBE, 0x15, 0x3B, 0x14, 0xBF, 0x50, 0x55,
+    0x8B, 0x32, 0xED, 0xD2, 0x1C, 0x47, 0xF1, 0xB9, 0x39, 0xA1, 0x49, 0xF4, 0x36, 0x85, 0x47, 0x74,
+    0x0B, 0x47, 0xFF, 0x80, 0x97, 0xB6, 0x6A, 0x0F, 0x6F, 0xCF, 0xA0, 0x76, 0xF9, 0xDE, 0x01, 0x4D,
+    0xF1, 0x89, 0xA8, 0xD6, 0xDC, 0x86, 0xEB, 0x64, 0x62, 0xBA, 0x7F, 0xD1, 0x43, 0x7C, 0xB3, 0xA8,
+    0x4F, 0x9B, 0x9D, 0x20, 0x46, 0xE3, 0x96, 0x78, 0x43, 0x0E, 0xAA, 0x8D, 0xCA, 0x23, 0x47, 0x49,
+    0x38, 0xFB, 0xA4, 0x21, 0x22, 0x8B, 0xB7, 0x82, 0x64, 0x3D, 0x37, 0x77, 0xF4, 0xE4, 0x6B, 0x08,
+    0x0E, 0xA3, 0x2D, 0x43, 0xAD, 0x71, 0x27, 0xB2, 0xA7, 0x3E, 0xEE, 0x23, 0x8F, 0xD5, 0x3C, 0x47,
+    0xC0, 0xDD, 0x10, 0x88, 0xE2, 0x9B, 0x71, 0xE5, 0x90, 0xA6, 0xE1, 0x48, 0xD6, 0x5A, 0xEC, 0x50,
+    0x50, 0xE8, 0xD1, 0x42, 0x37, 0x47, 0xEC, 0x04, 0x51, 0xD5, 0xE8, 0x3B, 0xF3, 0x67, 0xCC, 0xE6,
+    0xA0, 0xD6, 0xAA, 0x08, 0xE1, 0xCE, 0xD4, 0xE0, 0xEE, 0xF9, 0xF2, 0xB4, 0xA8, 0xCA, 0x79, 0xD8,
+    0x18, 0x1B, 0xDE, 0xED, 0xF7, 0x88, 0x67, 0x20, 0xA2, 0xCA, 0x20, 0xDC, 0xB9, 0xDB, 0x47, 0xB2,
+    0x7B, 0x2F, 0x26, 0x06, 0x4D, 0x16, 0x6F, 0xF0, 0x9F, 0xA4, 0x24, 0x5E, 0x78, 0xA2, 0x0A, 0x57,
+    0x14, 0xC6, 0x36, 0xCC, 0x9E, 0xD8, 0x86, 0xC0, 0x51, 0x9B, 0xBF, 0xAD, 0xDE, 0x2D, 0x5F, 0x25,
+    0x97, 0x82, 0xF9, 0x7B, 0x65, 0x23, 0x1E, 0x1E, 0x6F, 0xEA, 0x12, 0x3C, 0xC6, 0x0D, 0x15, 0x5E,
+    0x35, 0xD1, 0xE2, 0xDB, 0x28, 0xA3, 0x8E, 0x2A, 0x83, 0xC6, 0x6A, 0x07, 0x88, 0xFF, 0x6C, 0x84,
+    0x4B, 0xD9, 0xBA, 0xC8, 0x01, 0x72, 0x0F, 0xAB, 0xD3, 0x89, 0x21, 0xBD, 0x6F, 0x17, 0x04, 0x0C,
+    0x4D, 0x50, 0xEB, 0xF2, 0x43, 0xDE, 0x9C, 0x4A, 0xFF, 0x60, 0x7E, 0x4A, 0xDE, 0x14, 0xB6, 0x71,
+    0x11, 0x0A, 0x70, 0x21, 0xB9, 0x4D, 0x10, 0xC6, 0xCF, 0x93, 0x46, 0xAC, 0xA6, 0x41, 0xFC, 0x7C,
+    0xD9, 0xB1, 0x46, 0xDB, 0xBF, 0x76, 0xB7, 0x02, 0x0B, 0x99, 0xD9, 0x92, 0xA0, 0x81, 0xA7, 0x04,
+    0xF7, 0xCC, 0xDC, 0x94, 0x72, 0x87, 0xD8, 0xE6, 0xC4, 0x6D, 0xC6, 0x97, 0xC4, 0x5B, 0x17, 0x26,
+    0x25, 0xFC, 0xBB, 0xFD, 0xBF, 0xF4, 0xF8, 0x17, 0xFD, 0xBA, 0x2A, 0x0C, 0x19, 0xCD, 0x15, 0x2B,
+    0x82, 0x1A, 0x0F, 0x23, 0xF5, 0xC7, 0x07, 0xEC, 0x88, 0xFD, 0xBF, 0x2C, 0xC6, 0xFF, 0xFB, 0x92,
+    0x60, 0x00, 0x00, 0x02, 0xC8, 0x05, 0x4D, 0x8E, 0x37, 0x48, 0x18, 0x5D, 0xC1, 0x4A, 0xE1, 0x54,
+    0x0F, 0x08, 0xCB, 0xBC, 0x31, 0x66, 0xB5, 0x1E, 0xA2, 0x99, 0x50, 0x0A, 0x69, 0x87, 0xA6, 0x74,
+    0x86, 0xFF, 0xA0, 0xAC, 0x9F, 0x1E, 0x2F, 0xC2, 0x29, 0xB1, 0x32, 0xB8, 0x29, 0x7C, 0xB5, 0x3C,
+    0x7C, 0xF8, 0xF9, 0x26, 0x0C, 0x8E, 0x82, 0xB1, 0x33, 0x29, 0x59, 0x93, 0x9D, 0x40, 0x44, 0x12,
+    0xFC, 0x90, 0x22, 0xB7, 0xA9, 0x49, 0xD9, 0x83, 0x69, 0xA5, 0x6A, 0x4B, 0xEE, 0xCE, 0x3E, 0xD5,
+    0x64, 0x52, 0x38, 0xF3, 0x5F, 0xBB, 0x83, 0x9E, 0x19, 0xCC, 0x5E, 0xCA, 0xC4, 0x6E, 0x66, 0x60,
+    0x16, 0x64, 0x3C, 0x76, 0xB5, 0x06, 0xD9, 0x94, 0xEA, 0x97, 0x4E, 0x6E, 0xE3, 0xF8, 0x0D, 0xF2,
+    0xB0, 0xC4, 0x11, 0xB7, 0x13, 0xAA, 0x5D, 0x87, 0xFA, 0xD8, 0xC9, 0x96, 0xAD, 0xD6, 0x7C, 0xB8,
+    0x7C, 0xBE, 0x18, 0x4E, 0xF7, 0xF0, 0x8B, 0xFB, 0x05, 0x51, 0x42, 0x6B, 0xD7, 0x37, 0xCE, 0x6B,
+    0x1E, 0x94, 0x86, 0x16, 0x8E, 0x9F, 0xC9, 0xFC, 0xD0, 0x81, 0x81, 0x97, 0x74, 0x06, 0xE1, 0x20,
+    0x16, 0x3A, 0xCE, 0x2E, 0xE9, 0x28, 0x9D, 0xB7, 0x8F, 0x15, 0x3F, 0xD4, 0x33, 0x28, 0x22, 0xE6,
+    0x8C, 0x63, 0x28, 0x73, 0x71, 0xA1, 0x9A, 0x1B, 0xC4, 0x85, 0x28, 0x3D, 0x7A, 0x51, 0xF6, 0x48,
+    0xB2, 0xC9, 0x58, 0xD6, 0xC4, 0x34, 0xD7, 0x06, 0xF4, 0xCC, 0x29, 0x4C, 0x3B, 0x1B, 0xDE, 0x15,
+    0x9A, 0x03, 0x5D, 0xC8, 0x5B, 0xB8, 0x03, 0x7D, 0xA3, 0xFC, 0xD3, 0xA4, 0x3A, 0x28, 0x0D, 0x1A,
+    0x17, 0x1C, 0x2C, 0x41, 0xFA, 0xC7, 0x4F, 0x2E, 0xCE, 0x32, 0x85, 0x29, 0x9D, 0x7E, 0x96, 0xB7,
+    0x3E, 0xBF, 0x4C, 0xAC, 0x97, 0xB2, 0x60, 0x07, 0xAE, 0xF3, 0x92, 0x09, 0xA3, 0x7E, 0xEC, 0x0D,
+    0x31, 0x9B, 0xA4, 0xF1, 0x69, 0xEB, 0x81, 0xD9, 0x35, 0xCA, 0x7F, 0x6D, 0xCD, 0xF7, 0x29, 0xAF,
+    0x00, 0x40, 0x6A, 0x2C, 0x62, 0x17, 0x78, 0x02, 0x63, 0xB7, 0x7C, 0xF2, 0xCF, 0x02, 0xCF, 0x69,
+    0x8F, 0xD9, 0x9F, 0xB0, 0x1E, 0x33, 0xCE, 0xD4, 0xD2, 0xE2, 0x1E, 0x60, 0xCC, 0xF1, 0x94, 0x71,
+    0xB2, 0x14, 0x2A, 0xF7, 0x2A, 0xB0, 0x69, 0xF0, 0xCE, 0x90, 0xCB, 0xA3, 0xAF, 0xB9, 0x32, 0xBC,
+    0x15, 0xFE, 0x7F, 0x6D, 0x5B, 0x16, 0x2F, 0xD7, 0x25, 0xCB, 0x3E, 0x88, 0xE2, 0x79, 0x1D, 0x26,
+    0x64, 0xF6, 0x74, 0xD9, 0x4A, 0x3F, 0xB8, 0xDF, 0x1C, 0x91, 0x75, 0x37, 0xA0, 0x4C, 0x3C, 0x9E,
+    0xE4, 0x35, 0x8B, 0xC8, 0x64, 0x8F, 0x8E, 0x22, 0x96, 0xC8, 0x77, 0x7A, 0xD4, 0x77, 0x68, 0x83,
+    0x72, 0x00, 0x01, 0x87, 0x4D, 0x1D, 0x1C, 0xF1, 0xDF, 0xF6, 0x35, 0xE3, 0x47, 0x3C, 0xAE, 0x21,
+    0x9F, 0x5B, 0x2F, 0xB7, 0x3B, 0xA6, 0x87, 0x9E, 0x48, 0x67, 0xBC, 0x9F, 0x69, 0x2C, 0xD2, 0xB4,
+    0x49, 0xF8, 0xCA, 0x8E, 0x4C, 0x56, 0x75, 0x16, 0x32, 0x9A, 0x8E, 0x32, 0x16, 0xE7, 0x0F, 0xFF,
+    0xFB, 0x92, 0x40, 0x00, 0x00, 0x02, 0xDD, 0x08, 0xD3, 0x01, 0x82, 0xD3, 0x7A, 0x58, 0x42, 0x8A,
+    0x0E, 0x70, 0x66, 0xFF, 0xCA, 0x98, 0x5F, 0x42, 0xD8, 0xA4, 0x92, 0x01, 0x61, 0x80, 0xA6, 0x70,
+    0xB4, 0x82, 0xC6, 0xAB, 0x17, 0xD3, 0x18, 0x82, 0x9E, 0x49, 0xC0, 0xD5, 0x9C, 0x77, 0x51, 0xDB,
+    0x89, 0xD5, 0x32, 0x8E, 0xA8, 0x65, 0xD4, 0x07, 0x40, 0x11, 0xA8, 0xF2, 0x10, 0x7E, 0x7E, 0xA3,
+    0x06, 0x7A, 0xD9, 0xC7, 0xFB, 0x5B, 0x9E, 0xD6, 0xEC, 0xAD, 0xD7, 0xA4, 0x4E, 0xB7, 0x51, 0x67,
+    0x55, 0xFF, 0xD3, 0x28, 0x32, 0x0B, 0x23, 0xC6, 0x2B, 0x8A, 0x43, 0x93, 0xCA, 0x82, 0x9C, 0x91,
+    0x3E, 0xA8, 0xCF, 0xFF, 0x2F, 0xB3, 0x39, 0xA7, 0xB5, 0xF0, 0xDD, 0xDB, 0x5F, 0xB1, 0xDA, 0xD0,
+    0xF5, 0x40, 0x00, 0xB8, 0xAB, 0xD2, 0x00, 0xEC, 0x99, 0xF4, 0xF8, 0x28, 0xBE, 0x7F, 0x27, 0x5A,
+    0x7C, 0x36, 0x39, 0x1C, 0xA8, 0xD8, 0x9E, 0x32, 0x26, 0x63, 0x69, 0xFC, 0x15, 0x91, 0x69, 0x04,
+    0x1F, 0xB9, 0x3B, 0x07, 0x38, 0xE9, 0x76, 0x6C, 0x56, 0xFB, 0xC8, 0x4A, 0x90, 0xE4, 0xA7, 0xFE,
+    0xB8, 0xED, 0x89, 0x75, 0x32, 0x0D, 0x1D, 0x9C, 0xE1, 0x37, 0xBB, 0xDB, 0xAD, 0xBF, 0x1E, 0x63,
+    0xE5, 0x85, 0xB9, 0x57, 0xB2, 0xAF, 0x0D, 0x3B, 0xD8, 0x9D, 0x67, 0x93, 0xD6, 0x5E, 0xF6, 0x8F,
+    0x99, 0xB2, 0xAF, 0x20, 0x04, 0x39, 0x44, 0x03, 0xAD, 0x84, 0x2E, 0x7E, 0x43, 0x5D, 0x34, 0x1C,
+    0x0C, 0x39, 0x83, 0xD6, 0x53, 0xAE, 0x13, 0xBB, 0x11, 0x69, 0xBF, 0xB5, 0x50, 0x99, 0x93, 0x41,
+    0xE0, 0x34, 0xCA, 0x19, 0x5C, 0x99, 0x2F, 0xCD, 0xA2, 0xE1, 0x22, 0x39, 0xFB, 0xB1, 0x53, 0xF2,
+    0x86, 0xA5, 0xCD, 0x94, 0x9E, 0x4E, 0x52, 0xD7, 0xE4, 0x8F, 0xD7, 0x73, 0x2B, 0x22, 0xC0, 0x7C,
+    0xA3, 0x74, 0xB3, 0xDA, 0x36, 0xC0, 0xEE, 0x02, 0xF3, 0x80, 0x9D, 0x4C, 0x95, 0xF7, 0xD1, 0x32,
+    0x0C, 0x0B, 0x4D, 0x1E, 0x5D, 0x13, 0x53, 0x4F, 0x8F, 0xD3, 0x10, 0xA1, 0x9A, 0x66, 0xF0, 0x60,
+    0x38, 0x9B, 0x47, 0x54, 0x5C, 0x4E, 0xA5, 0xCE, 0xAB, 0x82, 0x1E, 0x8D, 0x2F, 0xF5, 0xEF, 0xD4,
+    0x86, 0xA8, 0xED, 0x59, 0x34, 0x16, 0xCF, 0x6F, 0x44, 0x37, 0x39, 0x9D, 0xE0, 0xCD, 0xF6, 0x31,
+    0x1A, 0x40, 0x94, 0x7A, 0xC6, 0xAB, 0xC4, 0x53, 0xF2, 0xEF, 0xC5, 0xEF, 0x20, 0x17, 0x1C, 0xCF,
+    0x7A, 0x92, 0xEE, 0x52, 0x0F, 0x8E, 0x17, 0xC0, 0x97, 0x32, 0x4F, 0xAF, 0xD9, 0x69, 0xCF, 0x38,
+    0x4D, 0x49, 0x65, 0x08, 0x54, 0x38, 0x2F, 0x3B, 0xC9, 0x06, 0xA0, 0x05, 0x3A, 0xB2, 0x32, 0x4D,
+    0xE0, 0x46, 0xA2, 0x24, 0xA7, 0xC9, 0xCB, 0xA3, 0x2E, 0x82, 0x37, 0x03, 0x4A, 0x0A, 0x45, 0xCE,
+    0xB5, 0x5C, 0x2D, 0xF8, 0xCD, 0x7F, 0x0D, 0xB9, 0x23, 0x55, 0x00, 0x2F, 0x0D, 0x5B, 0x84, 0x14,
+    0x19, 0xC3, 0x98, 0xB8, 0xF2, 0x78, 0x1D, 0x3A, 0xAF, 0x06, 0xE5, 0x18, 0x26, 0x0F, 0x89, 0x45,
+    0x14,
+};
@@ -0,0 +1,376 @@
+/*
+ * music_cover.c
+ * 封面缩略图: 后台任务用 TJpgDec 解码内嵌 JPEG, 逐行写入缩略图文件
+ *
+ * 缩略图按最近邻从源图中心的正方形区域取样: 第 n 行 / 列取源图 crop + (2n + 1) * crop_size / (2 * SIZE)。
+ * TJpgDec 按 MCU (8x8 ~ 16x16) 从上到下输出, 每开始新的一行 MCU, 采样点在它上面的缩略图行就已完整,
+ * 从环形行缓存写入文件。源图比缩略图小 (一行 MCU 对应的缩略图行超过 MUSIC_COVER_BAND) 时,
+ * 放不下的行留到下一遍重新解码, 所以无论源图多大, 工作内存都是固定的 (约 9KB, 解码期间从 LVGL 堆借用)。
+ */
+
+#include "music_cover.h"
+#include "music_library.h"
+#include "cmsis_os.h"
+#include "fatfs.h"
+#include "../../Gui/lvgl/lvgl.h"
+#include "../../Gui/lvgl/src/libs/tjpgd/tjpgd.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define COVER_FLAG_REQUEST 0x0001U
+#define COVER_POOL_SIZE 4096  // TJpgDec 工作区 (输入缓冲、哈夫曼表、量化表、MCU), 与 lv_tjpgd 相同
+#define COVER_KEY_BYTES 256   // 文件名由图片大小和最后 256 字节 (熵编码数据) 计算, JPEG 文件头大多相同
+#define COVER_ROW_BYTES (MUSIC_COVER_SIZE * 2)
+#define COVER_FILE_SIZE (sizeof(lv_image_header_t) + MUSIC_COVER_SIZE * COVER_ROW_BYTES)
+#define COVER_TMP_PATH "0:" MUSIC_COVER_DIR "/cover.tmp"
+
+#if defined(__GNUC__)
+#define COVER_BARRIER() __sync_synchronize()
+#else
+#define COVER_BARRIER()
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    FIL src;  // 音频文件
+    FIL dst;  // 缩略图临时文件
+    uint32_t id;
+    uint32_t src_left;                   // 图片数据剩余字节
+    uint32_t crop_x, crop_y;             // 源图中正方形区域的左上角
+    uint32_t crop;                       // 正方形边长
+    uint32_t written;                    // 已写入文件的缩略图行数
+    uint32_t limit;                      // 本遍第一个因行缓存不够而没有取样的行
+    uint32_t row_top;                    // 当前这行 MCU 的起始行 (源图坐标)
+    uint8_t error;                       // 写文件失败
+    uint16_t offset[MUSIC_COVER_SIZE];   // 第 n 行 / 列相对 crop_x / crop_y 的源图坐标
+    uint16_t band[MUSIC_COVER_BAND][MUSIC_COVER_SIZE];  // 缩略图第 n 行在 band[n % MUSIC_COVER_BAND]
+    uint8_t pool[COVER_POOL_SIZE] __attribute__((aligned(4)));
+} Cover_Job;
+
+/* Private variables ---------------------------------------------------------*/
+static osThreadId_t cover_taskHandle = NULL;
+static volatile uint32_t cover_request = MUSIC_COVER_NO_TRACK;
+
+// 双缓冲: 最新结果在 cover_info[cover_seq & 1], 写入另一块后再递增序号 (与 audio_spectrum 相同)
+static Music_Cover_Info cover_info[2];
+static volatile uint32_t cover_seq = 0;
+
+// 只在封面任务中使用, 不放在任务栈上
+static Music_Cover_Info cover_work;
+static Music_Index_Track cover_track;
+static char cover_song_path[sizeof(MUSIC_LIBRARY_ROOT) + MUSIC_INDEX_PATH_LEN + MUSIC_INDEX_NAME_LEN + 1];
+static char cover_file_path[40];
+
+static const osThreadAttr_t coverTask_attributes = {
+    .name = "coverTask",
+    .stack_size = 512 * 4,
+    .priority = (osPriority_t)osPriorityLow,
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void StartCoverTask(void *argument);
+
+/* Function implementations --------------------------------------------------*/
+
+void Music_Cover_Init(void)
+{
+    cover_info[0].id = MUSIC_COVER_NO_TRACK;
+    cover_info[0].state = MUSIC_COVER_NONE;
+    cover_taskHandle = osThreadNew(StartCoverTask, NULL, &coverTask_attributes);
+}
+
+void Music_Cover_Request(uint32_t id)
+{
+    cover_request = id;
+    if (cover_taskHandle) osThreadFlagsSet(cover_taskHandle, COVER_FLAG_REQUEST);
+}
+
+uint8_t Music_Cover_Read(Music_Cover_Info *info, uint32_t *seq)
+{
+    uint32_t s;
+
+    do
+    {
+        s = cover_seq;
+        if (s == *seq) return 0;
+        memcpy(info, &cover_info[s & 1], sizeof(*info));
+        COVER_BARRIER();
+        // 复制期间又发布了两次 (写到了正在读的那一块) 时重读
+    } while (cover_seq - s >= 2);
+
+    *seq = s;
+    return 1;
+}
+
+static void cover_publish(const Music_Cover_Info *info)
+{
+    memcpy(&cover_info[(cover_seq + 1) & 1], info, sizeof(*info));
+    COVER_BARRIER();
+    cover_seq = cover_seq + 1;
+}
+
+/**
+ * @brief  TJpgDec input: read (buf != NULL) or skip n bytes of the picture data
+ */
+static size_t cover_input(JDEC *jd, uint8_t *buf, size_t n)
+{
+    Cover_Job *job = (Cover_Job *)jd->device;
+    UINT br = 0;
+
+    if (n > job->src_left) n = job->src_left;
+    if (buf)
+    {
+        if (f_read(&job->src, buf, n, &br) != FR_OK) return 0;
+    }
+    else
+    {
+        if (f_lseek(&job->src, f_tell(&job->src) + n) != FR_OK) return 0;
+        br = n;
+    }
+    job->src_left -= br;
+    return br;
+}
+
+/**
+ * @brief  Write finished rows: every row sampled above source row `top` (and below limit)
+ * @retval 0: 成功, -1: 写入失败
+ */
+static int cover_flush(Cover_Job *job, uint32_t top)
+{
+    while (job->written < job->limit && job->crop_y + job->offset[job->written] < top)
+    {
+        UINT bw = 0;
+        FRESULT res = f_write(&job->dst, job->band[job->written % MUSIC_COVER_BAND], COVER_ROW_BYTES, &bw);
+        if (res != FR_OK || bw != COVER_ROW_BYTES)
+        {
+            job->error = 1;
+            return -1;
+        }
+        job->written++;
+    }
+    return 0;
+}
+
+/**
+ * @brief  TJpgDec output: sample one MCU (B, G, R per pixel) into the row cache
+ * @retval 1: 继续, 0: 中断解码 (本遍已完成、出错或有了新的请求)
+ */
+static int cover_output(JDEC *jd, void *bitmap, JRECT *rect)
+{
+    Cover_Job *job = (Cover_Job *)jd->device;
+    const uint8_t *bgr = (const uint8_t *)bitmap;
+    uint32_t w = rect->right - rect->left + 1u;
+
+    if (job->error || cover_request != job->id) return 0;
+
+    // 新的一行 MCU: 取样点在上面的行都已完整
+    if (rect->top != job->row_top)
+    {
+        job->row_top = rect->top;
+        if (cover_flush(job, rect->top) != 0) return 0;
+        if (job->written >= job->limit) return 0;
+    }
+
+    // 这一行 MCU 中还有放不下的缩略图行: 记下位置, 本遍只写到它之前
+    uint32_t end = job->written + MUSIC_COVER_BAND;
+    if (end < job->limit && job->crop_y + job->offset[end] <= rect->bottom) job->limit = end;
+    if (end > job->limit) end = job->limit;
+
+    // 第一个落在这块 MCU 中的列
+    uint32_t x0 = 0;
+    if (rect->left > job->crop_x)
+    {
+        x0 = (rect->left - job->crop_x) * MUSIC_COVER_SIZE / job->crop;
+        if (x0 >= MUSIC_COVER_SIZE) x0 = MUSIC_COVER_SIZE - 1;
+        while (x0 > 0 && job->crop_x + job->offset[x0 - 1] >= rect->left) x0--;
+        while (x0 < MUSIC_COVER_SIZE && job->crop_x + job->offset[x0] < rect->left) x0++;
+    }
+
+    for (uint32_t y = job->written; y < end; y++)
+    {
+        uint32_t sy = job->crop_y + job->offset[y];
+        if (sy < rect->top) continue;
+        if (sy > rect->bottom) break;
+
+        const uint8_t *line = bgr + (sy - rect->top) * w * 3;
+        uint16_t *out = job->band[y % MUSIC_COVER_BAND];
+        for (uint32_t x = x0; x < MUSIC_COVER_SIZE; x++)
+        {
+            uint32_t sx = job->crop_x + job->offset[x];
+            if (sx > rect->right) break;
+            const uint8_t *p = line + (sx - rect->left) * 3;
+            out[x] = (uint16_t)(((p[2] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[0] >> 3));
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief  Decode the picture at the current source position into job->dst (header already written)
+ * @retval 0: 成功, -1: 格式不支持、文件错误或被新的请求中断
+ */
+static int cover_decode(Cover_Job *job, uint32_t offset, uint32_t size)
+{
+    JDEC jd;
+    JRESULT rc;
+
+    job->written = 0;
+    job->error = 0;
+    while (job->written < MUSIC_COVER_SIZE)
+    {
+        uint32_t start = job->written;
+
+        if (f_lseek(&job->src, offset) != FR_OK) return -1;
+        job->src_left = size;
+        rc = jd_prepare(&jd, cover_input, job->pool, sizeof(job->pool), job);
+        if (rc != JDR_OK) return -1;  // 不是 JPEG (PNG)、渐进式 JPEG 或数据损坏
+
+        if (start == 0)
+        {
+            job->crop = (jd.width < jd.height) ? jd.width : jd.height;
+            job->crop_x = (jd.width - job->crop) / 2;
+            job->crop_y = (jd.height - job->crop) / 2;
+            for (uint32_t n = 0; n < MUSIC_COVER_SIZE; n++)
+            {
+                job->offset[n] = (uint16_t)((2 * n + 1) * job->crop / (2 * MUSIC_COVER_SIZE));
+            }
+        }
+
+        job->limit = MUSIC_COVER_SIZE;
+        job->row_top = UINT32_MAX;
+        rc = jd_decomp(&jd, cover_output, 0);
+        if (job->error || cover_request != job->id) return -1;
+        if (rc == JDR_OK)
+        {
+            if (cover_flush(job, UINT32_MAX) != 0) return -1;
+        }
+        else if (rc != JDR_INTR)
+        {
+            return -1;
+        }
+        if (job->written == start) return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Find or build the thumbnail of the requested track
+ * @retval 0: info->path 可用, -1: 没有缩略图
+ */
+static int cover_make(Music_Cover_Info *info, const Music_Index_Track *track, uint32_t id)
+{
+    uint32_t root_len = sizeof(MUSIC_LIBRARY_ROOT);  // 包括 '/'
+    FILINFO fno;
+    UINT br = 0;
+    int result = -1;
+
+    memcpy(cover_song_path, MUSIC_LIBRARY_ROOT "/", root_len);
+    if (Music_Library_GetPath(id, cover_song_path + root_len, sizeof(cover_song_path) - root_len) != 0) return -1;
+
+    // 解码期间借用 LVGL 的堆 (lv_malloc 在 LV_USE_OS 下是线程安全的); 内存不够时本首不显示封面
+    Cover_Job *job = lv_malloc(sizeof(Cover_Job));
+    if (!job) return -1;
+    job->id = id;
+
+    if (f_open(&job->src, cover_song_path, FA_READ) != FR_OK)
+    {
+        lv_free(job);
+        return -1;
+    }
+
+    // 文件名: 同一张图 (同一专辑的多首歌) 得到同一个文件
+    uint32_t tail = (track->cover_size < COVER_KEY_BYTES) ? track->cover_size : COVER_KEY_BYTES;
+    uint8_t *key_buf = (uint8_t *)job->band;
+    if (f_lseek(&job->src, track->cover_offset + track->cover_size - tail) != FR_OK ||
+        f_read(&job->src, key_buf, tail, &br) != FR_OK || br != tail)
+    {
+        goto done;
+    }
+    uint32_t key = Music_Index_Hash(MUSIC_INDEX_FNV_BASIS, &track->cover_size, sizeof(track->cover_size));
+    key = Music_Index_Hash(key, key_buf, tail);
+    snprintf(info->path, sizeof(info->path), "S:" MUSIC_COVER_DIR "/%08lx.bin", (unsigned long)key);
+    snprintf(cover_file_path, sizeof(cover_file_path), "0:%s", info->path + 2);
+
+    if (f_stat(cover_file_path, &fno) == FR_OK && fno.fsize == COVER_FILE_SIZE)
+    {
+        result = 0;
+        goto done;
+    }
+
+    // 写入临时文件, 完成后改名 (中途断电或被打断时不会留下不完整的缩略图)
+    uint32_t t0 = osKernelGetTickCount();
+    f_mkdir("0:" MUSIC_COVER_DIR);
+    if (f_open(&job->dst, COVER_TMP_PATH, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) goto done;
+
+    lv_image_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = LV_IMAGE_HEADER_MAGIC;
+    header.cf = LV_COLOR_FORMAT_RGB565;
+    header.w = MUSIC_COVER_SIZE;
+    header.h = MUSIC_COVER_SIZE;
+    header.stride = COVER_ROW_BYTES;
+
+    UINT bw = 0;
+    int ok = (f_write(&job->dst, &header, sizeof(header), &bw) == FR_OK && bw == sizeof(header)) &&
+             cover_decode(job, track->cover_offset, track->cover_size) == 0;
+    ok = (f_close(&job->dst) == FR_OK) && ok;
+
+    if (ok)
+    {
+        f_unlink(cover_file_path);
+        ok = (f_rename(COVER_TMP_PATH, cover_file_path) == FR_OK);
+    }
+    if (!ok)
+    {
+        f_unlink(COVER_TMP_PATH);
+        goto done;
+    }
+    info->build_ms = osKernelGetTickCount() - t0;
+    result = 0;
+
+done:
+    f_close(&job->src);
+    lv_free(job);
+    return result;
+}
+
+static void StartCoverTask(void *argument)
+{
+    uint32_t done_id = MUSIC_COVER_NO_TRACK;
+
+    for (;;)
+    {
+        osThreadFlagsWait(COVER_FLAG_REQUEST, osFlagsWaitAny, osWaitForever);
+        uint32_t id = cover_request;
+        if (id == done_id) continue;  // 单曲循环或重新打开同一首
+        done_id = MUSIC_COVER_NO_TRACK;
+
+        memset(&cover_work, 0, sizeof(cover_work));
+        cover_work.id = id;
+        cover_work.state = MUSIC_COVER_NONE;
+        if (Music_Library_ReadTrack(id, &cover_track) != 0)
+        {
+            cover_publish(&cover_work);
+            done_id = id;
+            continue;
+        }
+
+        // 先发布标签, 缩略图生成后再发布一次
+        memcpy(cover_work.title, cover_track.title, sizeof(cover_work.title));
+        memcpy(cover_work.artist, cover_track.artist, sizeof(cover_work.artist));
+        memcpy(cover_work.album, cover_track.album, sizeof(cover_work.album));
+        if (cover_track.cover_size != 0)
+        {
+            cover_work.state = MUSIC_COVER_PENDING;
+            cover_publish(&cover_work);
+            int res = cover_make(&cover_work, &cover_track, id);
+            if (cover_request != id) continue;  // 已经切到别的歌, 标志位仍然置位, 马上处理新的请求
+            cover_work.state = (res == 0) ? MUSIC_COVER_READY : MUSIC_COVER_NONE;
+        }
+        cover_publish(&cover_work);
+        done_id = id;
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * music_cover.h
+ * 当前曲目的标签与封面缩略图 (后台低优先级任务)
+ *
+ * 切歌时音频任务调用 Music_Cover_Request(), 封面任务从曲库索引读取标题 / 艺术家 / 专辑和封面位置
+ * (music_index.c 建立索引时记录), 把内嵌的 JPEG 解码、居中裁成正方形并缩放为
+ * MUSIC_COVER_SIZE x MUSIC_COVER_SIZE 的 RGB565, 以 LVGL 图片文件 (.bin) 的格式写入
+ * 0:/music/.covers/xxxxxxxx.bin。文件名由封面数据计算, 同一张专辑封面的多首歌共用一个文件,
+ * 以后再播放时不再解码。
+ *
+ * GUI 用 Music_Cover_Read() 读取结果, 直接把路径交给 lv_image (LVGL 按行从文件读取, 不占整张图的 RAM)。
+ * 只支持基线 JPEG (TJpgDec); PNG 和渐进式 JPEG 没有缩略图, 界面显示默认图标。
+ */
+
+#ifndef APP_PLAYER_MUSIC_COVER_H_
+#define APP_PLAYER_MUSIC_COVER_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "music_index.h"
+
+#define MUSIC_COVER_SIZE 200  // 缩略图边长 (像素), 文件 80KB
+#define MUSIC_COVER_BAND 8    // 一次缓存的缩略图行数 (3.2KB), 源图较小、一行 MCU 对应更多行时分多遍解码
+#define MUSIC_COVER_DIR "/music/.covers"
+#define MUSIC_COVER_NO_TRACK 0xFFFFFFFFU
+
+    typedef enum
+    {
+        MUSIC_COVER_NONE,     // 没有可用的封面
+        MUSIC_COVER_PENDING,  // 标签已读取, 正在生成缩略图
+        MUSIC_COVER_READY,    // path 指向缩略图
+    } Music_Cover_State;
+
+    typedef struct
+    {
+        uint32_t id;  // 曲库序号, MUSIC_COVER_NO_TRACK 表示还没有请求
+        char title[sizeof(((Music_Index_Track *)0)->title)];
+        char artist[sizeof(((Music_Index_Track *)0)->artist)];
+        char album[sizeof(((Music_Index_Track *)0)->album)];
+        char path[32];  // LVGL 路径 ("S:/music/.covers/xxxxxxxx.bin"), READY 时有效
+        Music_Cover_State state;
+        uint32_t build_ms;  // 生成缩略图的耗时, 0 表示使用了已有的文件
+    } Music_Cover_Info;
+
+    /**
+     * @brief  创建封面任务 (Music_Library_Update() 之后调用)
+     */
+    void Music_Cover_Init(void);
+
+    /**
+     * @brief  请求一首曲目的标签和封面 (不等待; 新的请求会中断正在进行的解码)
+     * @param  id: 曲库序号
+     */
+    void Music_Cover_Request(uint32_t id);
+
+    /**
+     * @brief  读取最新结果 (不加锁, GUI 任务中调用)
+     * @param  seq: 上次读取时的序号, 有新结果时更新
+     * @retval 1: 有新结果, 0: 与上次相同
+     */
+    uint8_t Music_Cover_Read(Music_Cover_Info *info, uint32_t *seq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_MUSIC_COVER_H_ */
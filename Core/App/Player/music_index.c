@@ -0,0 +1,684 @@
+/*
+ * music_index.c
+ * 曲库索引: 目录签名与文件信息解析 (WAV / MP3 / FLAC / APE)
+ *
+ * 只解析生成索引需要的字段, 不经过解码器, 也不占用解码器内存:
+ *   WAV : fmt / data 块, LIST-INFO 标签 (INAM / IART / IPRD)
+ *   MP3 : ID3v2.2~2.4 文本帧与 APIC / PIC, 第一帧帧头, Xing / Info / VBRI 帧数 (没有时按 CBR 估算), ID3v1 作为后备
+ *   FLAC: STREAMINFO, VORBIS_COMMENT, PICTURE
+ *   APE : 文件头 (3.80 之后的两种布局), 文件末尾的 APEv2 标签
+ * 封面只记录图片数据在文件中的位置, 由 music_cover.c 在后台解码。
+ */
+
+#include "music_index.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define FNV_PRIME 16777619U
+#define PICTURE_TYPE_FRONT 3   // ID3v2 / FLAC 图片类型: 封面
+#define FLAC_PICTURE_HEAD 256  // 读取 PICTURE 块开头的字节数 (MIME 类型和描述应在其中)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    Music_Index_ReadFn read;
+    void *ctx;
+    uint8_t *buf;
+    uint32_t buf_size;
+    uint8_t cover_front;  // 已记录的封面是 front cover
+} Probe_Context;
+
+/* Function implementations --------------------------------------------------*/
+
+uint32_t Music_Index_Hash(uint32_t hash, const void *data, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) hash = (hash ^ *p++) * FNV_PRIME;
+    return hash;
+}
+
+uint32_t Music_Index_FolderSignature(uint32_t hash, const char *name, uint32_t size, uint16_t fdate, uint16_t ftime)
+{
+    uint8_t stamp[8] = {
+        (uint8_t)size,  (uint8_t)(size >> 8),  (uint8_t)(size >> 16), (uint8_t)(size >> 24),
+        (uint8_t)fdate, (uint8_t)(fdate >> 8), (uint8_t)ftime,         (uint8_t)(ftime >> 8),
+    };
+    uint32_t entry = Music_Index_Hash(MUSIC_INDEX_FNV_BASIS, name, (uint32_t)strlen(name) + 1);
+    entry = Music_Index_Hash(entry, stamp, sizeof(stamp));
+    return hash + entry;  // 与目录项顺序无关: 主机上 readdir 的顺序不一定与 FAT 目录表相同
+}
+
+int Music_Index_CheckHeader(const Music_Index_Header *header, uint32_t file_size)
+{
+    if (header->magic != MUSIC_INDEX_MAGIC || header->version != MUSIC_INDEX_VERSION) return -1;
+    if (header->header_size != sizeof(Music_Index_Header) || header->track_size != sizeof(Music_Index_Track) ||
+        header->folder_size != sizeof(Music_Index_Folder))
+    {
+        return -1;
+    }
+    if (header->track_offset != sizeof(Music_Index_Header)) return -1;
+    if (header->folder_offset != header->track_offset + header->track_count * sizeof(Music_Index_Track)) return -1;
+    if (file_size != header->folder_offset + header->folder_count * sizeof(Music_Index_Folder)) return -1;
+    return 0;
+}
+
+static uint32_t rd_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t rd_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t rd_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static uint32_t rd_be24(const uint8_t *p)
+{
+    return (p[0] << 16) | (p[1] << 8) | p[2];
+}
+
+static uint32_t rd_synchsafe(const uint8_t *p)
+{
+    return ((uint32_t)(p[0] & 0x7F) << 21) | ((p[1] & 0x7F) << 14) | ((p[2] & 0x7F) << 7) | (p[3] & 0x7F);
+}
+
+/**
+ * @brief  Append one code point as UTF-8, never splitting a sequence at the end of dst
+ */
+static uint32_t put_utf8(char *dst, uint32_t pos, uint32_t size, uint32_t cp)
+{
+    uint8_t tmp[3];
+    uint32_t n;
+
+    if (cp < 0x80)
+    {
+        tmp[0] = (uint8_t)cp;
+        n = 1;
+    }
+    else if (cp < 0x800)
+    {
+        tmp[0] = (uint8_t)(0xC0 | (cp >> 6));
+        tmp[1] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 2;
+    }
+    else
+    {
+        tmp[0] = (uint8_t)(0xE0 | (cp >> 12));
+        tmp[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        tmp[2] = (uint8_t)(0x80 | (cp & 0x3F));
+        n = 3;
+    }
+    if (pos + n >= size) return pos;
+    memcpy(dst + pos, tmp, n);
+    return pos + n;
+}
+
+/**
+ * @brief  Copy a tag string into a fixed field
+ * @param  enc: 0 = ISO-8859-1, 1 = UTF-16 (BOM), 2 = UTF-16BE, 3 = UTF-8 (与 ID3v2 编码字节相同)
+ */
+static void set_text(char *dst, uint32_t size, const uint8_t *src, uint32_t len, uint8_t enc)
+{
+    uint32_t pos = 0;
+
+    if (dst[0] != '\0') return;  // 已经由优先级更高的标签填写
+
+    if (enc == 1 || enc == 2)
+    {
+        uint8_t be = (enc == 2);
+        if (len >= 2 && src[0] == 0xFF && src[1] == 0xFE)
+        {
+            be = 0;
+            src += 2;
+            len -= 2;
+        }
+        else if (len >= 2 && src[0] == 0xFE && src[1] == 0xFF)
+        {
+            be = 1;
+            src += 2;
+            len -= 2;
+        }
+        for (uint32_t i = 0; i + 1 < len; i += 2)
+        {
+            uint32_t cp = be ? (uint32_t)(src[i] << 8 | src[i + 1]) : (uint32_t)(src[i] | src[i + 1] << 8);
+            if (cp == 0) break;
+            if (cp >= 0xD800 && cp <= 0xDFFF) cp = '?';  // 代理对 (BMP 以外的字符) 不显示
+            pos = put_utf8(dst, pos, size, cp);
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < len && src[i] != 0; i++)
+        {
+            if (enc == 0)
+            {
+                pos = put_utf8(dst, pos, size, src[i]);
+            }
+            else if (pos + 1 < size)
+            {
+                dst[pos++] = (char)src[i];
+            }
+        }
+        // UTF-8 截断时去掉不完整的多字节序列
+        if (enc == 3)
+        {
+            uint32_t k = pos;
+            while (k > 0 && ((uint8_t)dst[k - 1] & 0xC0) == 0x80) k--;
+            if (k > 0 && ((uint8_t)dst[k - 1] & 0x80))
+            {
+                uint8_t lead = (uint8_t)dst[k - 1];
+                uint32_t need = (lead >= 0xF0) ? 4 : (lead >= 0xE0) ? 3 : 2;
+                if (pos - (k - 1) < need) pos = k - 1;
+            }
+        }
+    }
+
+    // 去掉结尾的空格 (ID3v1 用空格填充)
+    while (pos > 0 && dst[pos - 1] == ' ') pos--;
+    dst[pos] = '\0';
+}
+
+/**
+ * @brief  Case-insensitive ASCII compare of a key of known length
+ */
+static int key_equal(const uint8_t *key, uint32_t len, const char *name)
+{
+    uint32_t i = 0;
+    for (; i < len && name[i]; i++)
+    {
+        uint8_t a = key[i], b = (uint8_t)name[i];
+        if (a >= 'a' && a <= 'z') a -= 32;
+        if (b >= 'a' && b <= 'z') b -= 32;
+        if (a != b) return 0;
+    }
+    return i == len && name[i] == '\0';
+}
+
+/**
+ * @brief  "KEY=value" pairs (Vorbis comment) and "Key" items (APEv2) map to the same three fields
+ */
+static void set_tag(Music_Index_Track *t, const uint8_t *key, uint32_t key_len, const uint8_t *val, uint32_t val_len)
+{
+    if (key_equal(key, key_len, "TITLE"))
+    {
+        set_text(t->title, sizeof(t->title), val, val_len, 3);
+    }
+    else if (key_equal(key, key_len, "ARTIST"))
+    {
+        set_text(t->artist, sizeof(t->artist), val, val_len, 3);
+    }
+    else if (key_equal(key, key_len, "ALBUM"))
+    {
+        set_text(t->album, sizeof(t->album), val, val_len, 3);
+    }
+}
+
+/**
+ * @brief  Record an embedded picture; a front cover replaces any other picture found earlier
+ */
+static void set_cover(Music_Index_Track *t, Probe_Context *pc, uint32_t offset, uint32_t size, uint8_t type)
+{
+    if (size == 0 || offset > t->size || size > t->size - offset) return;
+    if (t->cover_size != 0 && (pc->cover_front || type != PICTURE_TYPE_FRONT)) return;
+
+    t->cover_offset = offset;
+    t->cover_size = size;
+    pc->cover_front = (type == PICTURE_TYPE_FRONT);
+}
+
+/* ---------------------------------------------------------------- WAV --- */
+
+static int probe_wav(Music_Index_Track *t, Probe_Context *pc)
+{
+    uint8_t *b = pc->buf;
+    uint32_t byte_rate = 0;
+    uint32_t data_size = 0;
+    uint32_t pos = 12;
+
+    if (pc->read(pc->ctx, 0, b, 12) < 12 || memcmp(b, "RIFF", 4) != 0 || memcmp(b + 8, "WAVE", 4) != 0) return -1;
+
+    while (pos + 8 <= t->size)
+    {
+        if (pc->read(pc->ctx, pos, b, 8) < 8) break;
+        uint32_t id_pos = pos;
+        uint32_t len = rd_le32(b + 4);
+        pos += 8;
+
+        if (memcmp(b, "fmt ", 4) == 0 && len >= 16)
+        {
+            if (pc->read(pc->ctx, pos, b, 16) < 16) break;
+            t->channels = (uint8_t)rd_le16(b + 2);
+            t->sample_rate = rd_le32(b + 4);
+            byte_rate = rd_le32(b + 8);
+        }
+        else if (memcmp(b, "data", 4) == 0)
+        {
+            data_size = (len > t->size - pos) ? t->size - pos : len;
+        }
+        else if (memcmp(b, "LIST", 4) == 0 && len > 4)
+        {
+            uint32_t n = (len < pc->buf_size) ? len : pc->buf_size;
+            n = pc->read(pc->ctx, pos, b, n);
+            if (n > 4 && memcmp(b, "INFO", 4) == 0)
+            {
+                for (uint32_t i = 4; i + 8 <= n;)
+                {
+                    uint32_t sub = rd_le32(b + i + 4);
+                    const uint8_t *v = b + i + 8;
+                    uint32_t vlen = (sub > n - i - 8) ? n - i - 8 : sub;
+                    if (memcmp(b + i, "INAM", 4) == 0) set_text(t->title, sizeof(t->title), v, vlen, 0);
+                    if (memcmp(b + i, "IART", 4) == 0) set_text(t->artist, sizeof(t->artist), v, vlen, 0);
+                    if (memcmp(b + i, "IPRD", 4) == 0) set_text(t->album, sizeof(t->album), v, vlen, 0);
+                    i += 8 + sub + (sub & 1);
+                }
+            }
+        }
+
+        pos += len + (len & 1);  // 块按 2 字节对齐
+        if (pos <= id_pos) break;
+    }
+
+    if (byte_rate == 0 || t->sample_rate == 0) return -1;
+    t->bitrate = byte_rate * 8;
+    t->duration_ms = (uint32_t)((uint64_t)data_size * 1000 / byte_rate);
+    return 0;
+}
+
+/* ---------------------------------------------------------------- MP3 --- */
+
+static const uint16_t mp3_bitrate[2][15] = {
+    {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320},  // MPEG-1 Layer III
+    {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160},      // MPEG-2 / 2.5 Layer III
+};
+static const uint16_t mp3_samplerate[3] = {44100, 48000, 32000};
+
+typedef struct
+{
+    uint32_t sample_rate;
+    uint32_t bitrate;  // kbps
+    uint32_t frame_len;
+    uint16_t samples;  // 每帧采样数
+    uint8_t mpeg1;
+    uint8_t mono;
+} MP3_Header;
+
+static int mp3_parse_header(const uint8_t *p, MP3_Header *h)
+{
+    if (p[0] != 0xFF || (p[1] & 0xE0) != 0xE0) return -1;
+
+    uint8_t ver = (p[1] >> 3) & 3;  // 0: 2.5, 2: 2, 3: 1
+    uint8_t layer = (p[1] >> 1) & 3;
+    uint8_t br = p[2] >> 4;
+    uint8_t sr = (p[2] >> 2) & 3;
+    if (ver == 1 || layer != 1 || br == 0 || br == 15 || sr == 3) return -1;  // 只支持 Layer III
+
+    h->mpeg1 = (ver == 3);
+    h->sample_rate = mp3_samplerate[sr] >> (ver == 3 ? 0 : ver == 2 ? 1 : 2);
+    h->bitrate = mp3_bitrate[h->mpeg1 ? 0 : 1][br];
+    h->samples = h->mpeg1 ? 1152 : 576;
+    h->frame_len = (h->samples / 8) * h->bitrate * 1000 / h->sample_rate + ((p[2] >> 1) & 1);
+    h->mono = ((p[3] >> 6) == 3);
+    return 0;
+}
+
+/**
+ * @brief  APIC (2.3 / 2.4): 编码, MIME 类型\0, 图片类型, 描述\0, 数据
+ *         PIC (2.2)        : 编码, 3 字节格式, 图片类型, 描述\0, 数据
+ * @param  v: 帧内容, avail: 缓冲区中的字节数, size: 帧长度, offset: 帧内容在文件中的偏移
+ */
+static void mp3_parse_picture(Music_Index_Track *t, Probe_Context *pc, const uint8_t *v, uint32_t avail, uint32_t size,
+                              uint32_t offset, uint8_t major)
+{
+    uint8_t wide = (v[0] == 1 || v[0] == 2);  // UTF-16 的描述以两个 0 结尾
+    uint32_t i = 1;
+
+    if (major == 2)
+    {
+        i += 3;
+    }
+    else
+    {
+        const uint8_t *end = memchr(v + 1, 0, avail - 1);
+        if (!end) return;
+        i = (uint32_t)(end - v) + 1;
+    }
+    if (i >= avail) return;
+    uint8_t type = v[i++];
+
+    while (i + wide < avail && (v[i] != 0 || (wide && v[i + 1] != 0))) i += 1 + wide;
+    if (i + wide >= avail) return;
+    i += 1 + wide;
+
+    if (i < size) set_cover(t, pc, offset + i, size - i, type);
+}
+
+/**
+ * @param  b: 标签 (b[0] 为 "ID3"), n: 缓冲区中的字节数, base: 标签在文件中的偏移
+ */
+static void mp3_parse_id3v2(Music_Index_Track *t, Probe_Context *pc, const uint8_t *b, uint32_t n, uint32_t base)
+{
+    uint8_t major = b[3];
+    uint32_t i = 10;
+    uint8_t raw = !(b[5] & 0x80);  // 整个标签做了反同步时图片数据不能直接读取
+
+    if (b[5] & 0x40)  // 扩展头
+    {
+        if (n < 14) return;
+        uint32_t ext = (major == 4) ? rd_synchsafe(b + 10) : rd_be32(b + 10);
+        if (ext > n) return;
+        i += (major == 4) ? ext : ext + 4;
+    }
+
+    while (i + (major == 2 ? 6 : 10) <= n)
+    {
+        const uint8_t *f = b + i;
+        uint32_t hdr = (major == 2) ? 6 : 10;
+        uint32_t size = (major == 2) ? rd_be24(f + 3) : (major == 4) ? rd_synchsafe(f + 4) : rd_be32(f + 4);
+        if (f[0] == 0 || size == 0) break;  // 填充区
+
+        uint32_t avail = (size > n - i - hdr) ? n - i - hdr : size;
+        const uint8_t *v = f + hdr;
+        if (avail > 1)
+        {
+            uint32_t id_len = (major == 2) ? 3 : 4;
+            // 压缩、加密、分组、反同步或带数据长度的帧, 内容与文件中的字节不同
+            uint8_t plain = raw && (major == 2 || (f[9] & (major == 4 ? 0x4F : 0xE0)) == 0);
+            if (memcmp(f, major == 2 ? "TT2" : "TIT2", id_len) == 0)
+            {
+                set_text(t->title, sizeof(t->title), v + 1, avail - 1, v[0]);
+            }
+            else if (memcmp(f, major == 2 ? "TP1" : "TPE1", id_len) == 0)
+            {
+                set_text(t->artist, sizeof(t->artist), v + 1, avail - 1, v[0]);
+            }
+            else if (memcmp(f, major == 2 ? "TAL" : "TALB", id_len) == 0)
+            {
+                set_text(t->album, sizeof(t->album), v + 1, avail - 1, v[0]);
+            }
+            else if (plain && memcmp(f, major == 2 ? "PIC" : "APIC", id_len) == 0)
+            {
+                mp3_parse_picture(t, pc, v, avail, size, base + i + hdr, major);
+            }
+        }
+        if (size > n - i - hdr) break;  // 帧超出缓冲区, 后面的帧读不到 (v2.3 的 32 位长度相加还会回绕)
+        i += hdr + size;
+    }
+}
+
+static int probe_mp3(Music_Index_Track *t, Probe_Context *pc)
+{
+    uint8_t *b = pc->buf;
+    uint32_t start = 0;
+    uint32_t n = pc->read(pc->ctx, 0, b, pc->buf_size);
+    MP3_Header h;
+
+    // ID3v2 (可能有多个连续的标签)
+    while (n >= 10 && memcmp(b, "ID3", 3) == 0)
+    {
+        uint32_t tag = 10 + rd_synchsafe(b + 6) + ((b[5] & 0x10) ? 10 : 0);
+        if (b[3] >= 2 && b[3] <= 4) mp3_parse_id3v2(t, pc, b, n, start);
+        start += tag;
+        n = pc->read(pc->ctx, start, b, pc->buf_size);
+    }
+
+    // 第一帧: 下一帧帧头也有效才认为同步成功
+    uint32_t i = 0;
+    for (; i + 4 <= n; i++)
+    {
+        if (mp3_parse_header(b + i, &h) != 0) continue;
+        MP3_Header next;
+        if (i + h.frame_len + 4 > n || mp3_parse_header(b + i + h.frame_len, &next) == 0) break;
+    }
+    if (i + 4 > n) return -1;
+    start += i;
+
+    t->sample_rate = h.sample_rate;
+    t->channels = h.mono ? 1 : 2;
+
+    // Xing / Info (VBR 或 LAME CBR) 与 VBRI 帧
+    uint32_t frames = 0;
+    uint32_t side = h.mpeg1 ? (h.mono ? 17 : 32) : (h.mono ? 9 : 17);
+    const uint8_t *x = b + i + 4 + side;
+    const uint8_t *v = b + i + 4 + 32;
+    if (i + 4 + side + 12 <= n && (memcmp(x, "Xing", 4) == 0 || memcmp(x, "Info", 4) == 0))
+    {
+        if (rd_be32(x + 4) & 1) frames = rd_be32(x + 8);
+    }
+    else if (i + 4 + 32 + 18 <= n && memcmp(v, "VBRI", 4) == 0)
+    {
+        frames = rd_be32(v + 14);
+    }
+
+    uint32_t audio = t->size - start;
+    if (t->size >= 128)
+    {
+        uint8_t tag[128];
+        if (pc->read(pc->ctx, t->size - 128, tag, 128) == 128 && memcmp(tag, "TAG", 3) == 0)
+        {
+            audio -= 128;
+            set_text(t->title, sizeof(t->title), tag + 3, 30, 0);
+            set_text(t->artist, sizeof(t->artist), tag + 33, 30, 0);
+            set_text(t->album, sizeof(t->album), tag + 63, 30, 0);
+        }
+    }
+
+    if (frames > 0)
+    {
+        uint64_t samples = (uint64_t)frames * h.samples;
+        t->duration_ms = (uint32_t)(samples * 1000 / h.sample_rate);
+        if (t->duration_ms > 0) t->bitrate = (uint32_t)((uint64_t)audio * 8000 / t->duration_ms);
+    }
+    else
+    {
+        t->bitrate = h.bitrate * 1000;
+        t->duration_ms = (uint32_t)((uint64_t)audio * 8 / h.bitrate);
+    }
+    return 0;
+}
+
+/* --------------------------------------------------------------- FLAC --- */
+
+static void flac_parse_vorbis(Music_Index_Track *t, const uint8_t *b, uint32_t n)
+{
+    if (n < 8) return;
+    uint32_t i = 4 + rd_le32(b);  // vendor
+    if (i + 4 > n) return;
+    uint32_t count = rd_le32(b + i);
+    i += 4;
+
+    for (uint32_t c = 0; c < count && i + 4 <= n; c++)
+    {
+        uint32_t len = rd_le32(b + i);
+        const uint8_t *s = b + i + 4;
+        if (len > n - i - 4) len = n - i - 4;
+
+        const uint8_t *eq = memchr(s, '=', len);
+        if (eq) set_tag(t, s, (uint32_t)(eq - s), eq + 1, len - (uint32_t)(eq - s) - 1);
+        i += 4 + len;
+    }
+}
+
+static int probe_flac(Music_Index_Track *t, Probe_Context *pc)
+{
+    uint8_t *b = pc->buf;
+    uint32_t pos = 4;
+    uint8_t last = 0;
+    uint64_t total = 0;
+
+    if (pc->read(pc->ctx, 0, b, 4) < 4 || memcmp(b, "fLaC", 4) != 0) return -1;
+
+    // 逐个读取元数据块头, 图片只读取开头, 数据部分跳过
+    while (!last && pos + 4 <= t->size)
+    {
+        if (pc->read(pc->ctx, pos, b, 4) < 4) break;
+        uint8_t type = b[0] & 0x7F;
+        uint32_t len = rd_be24(b + 1);
+        last = b[0] >> 7;
+        pos += 4;
+
+        if (type == 0 && len >= 18)
+        {
+            if (pc->read(pc->ctx, pos, b, 18) < 18) return -1;
+            t->sample_rate = (b[10] << 12) | (b[11] << 4) | (b[12] >> 4);
+            t->channels = ((b[12] >> 1) & 7) + 1;
+            total = ((uint64_t)(b[13] & 0x0F) << 32) | rd_be32(b + 14);
+        }
+        else if (type == 4)
+        {
+            uint32_t n = pc->read(pc->ctx, pos, b, (len < pc->buf_size) ? len : pc->buf_size);
+            flac_parse_vorbis(t, b, n);
+        }
+        else if (type == 6 && len >= 32)
+        {
+            // 图片类型, MIME 长度, MIME, 描述长度, 描述, 宽, 高, 色深, 颜色数, 数据长度, 数据 (大端序)
+            uint32_t n = pc->read(pc->ctx, pos, b, (len < FLAC_PICTURE_HEAD) ? len : FLAC_PICTURE_HEAD);
+            uint32_t i = (n >= 8) ? 8 + rd_be32(b + 4) : n;
+            if (i + 4 <= n)
+            {
+                i += 4 + rd_be32(b + i) + 16;
+                if (i + 4 <= n && i + 4 <= len)
+                {
+                    uint32_t data_len = rd_be32(b + i);
+                    if (data_len <= len - i - 4) set_cover(t, pc, pos + i + 4, data_len, (uint8_t)rd_be32(b));
+                }
+            }
+        }
+        pos += len;
+    }
+
+    if (t->sample_rate == 0) return -1;
+    t->duration_ms = (uint32_t)(total * 1000 / t->sample_rate);
+    if (t->duration_ms > 0) t->bitrate = (uint32_t)((uint64_t)(t->size - pos) * 8000 / t->duration_ms);
+    return 0;
+}
+
+/* ---------------------------------------------------------------- APE --- */
+
+static void ape_parse_tag(Music_Index_Track *t, Probe_Context *pc)
+{
+    uint8_t *b = pc->buf;
+
+    if (t->size < 32 || pc->read(pc->ctx, t->size - 32, b, 32) < 32 || memcmp(b, "APETAGEX", 8) != 0) return;
+
+    uint32_t tag_size = rd_le32(b + 12);  // 包括 32 字节的尾部, 不包括头部
+    uint32_t count = rd_le32(b + 16);
+    if (tag_size < 32 || tag_size > t->size) return;
+
+    uint32_t n = tag_size - 32;
+    if (n > pc->buf_size) n = pc->buf_size;
+    n = pc->read(pc->ctx, t->size - tag_size, b, n);
+
+    for (uint32_t c = 0, i = 0; c < count && i + 8 < n; c++)
+    {
+        uint32_t len = rd_le32(b + i);
+        const uint8_t *key = b + i + 8;
+        const uint8_t *end = memchr(key, 0, n - i - 8);
+        if (!end) break;
+
+        uint32_t key_len = (uint32_t)(end - key);
+        uint32_t off = i + 8 + key_len + 1;
+        if (off > n) break;
+        uint32_t avail = (len > n - off) ? n - off : len;
+        if (((rd_le32(b + i + 4) >> 1) & 3) == 1)
+        {
+            // 二进制项: 封面为 "文件名\0" + 图片数据
+            const uint8_t *name_end = memchr(b + off, 0, avail);
+            if (name_end && key_equal(key, key_len, "Cover Art (Front)"))
+            {
+                uint32_t skip = (uint32_t)(name_end - (b + off)) + 1;
+                set_cover(t, pc, t->size - tag_size + off + skip, len - skip, PICTURE_TYPE_FRONT);
+            }
+        }
+        else
+        {
+            set_tag(t, key, key_len, b + off, avail);
+        }
+        if (len > n - off) break;  // 项超出缓冲区 (len 来自文件, 相加可能回绕)
+        i = off + len;
+    }
+}
+
+static int probe_ape(Music_Index_Track *t, Probe_Context *pc)
+{
+    uint8_t *b = pc->buf;
+    uint32_t blocks_per_frame, final_blocks, total_frames;
+
+    if (pc->read(pc->ctx, 0, b, 32) < 32 || memcmp(b, "MAC ", 4) != 0) return -1;
+    uint16_t version = rd_le16(b + 4);
+
+    if (version >= 3980)
+    {
+        // APE_DESCRIPTOR 之后为 APE_HEADER
+        uint32_t desc = rd_le32(b + 8);
+        if (pc->read(pc->ctx, desc, b, 24) < 24) return -1;
+        blocks_per_frame = rd_le32(b + 4);
+        final_blocks = rd_le32(b + 8);
+        total_frames = rd_le32(b + 12);
+        t->channels = (uint8_t)rd_le16(b + 18);
+        t->sample_rate = rd_le32(b + 20);
+    }
+    else
+    {
+        uint16_t compression = rd_le16(b + 6);
+        t->channels = (uint8_t)rd_le16(b + 10);
+        t->sample_rate = rd_le32(b + 12);
+        total_frames = rd_le32(b + 24);
+        final_blocks = rd_le32(b + 28);
+        if (version >= 3950)
+        {
+            blocks_per_frame = 73728 * 4;
+        }
+        else if (version >= 3900 || (version >= 3800 && compression == 4000))
+        {
+            blocks_per_frame = 73728;
+        }
+        else
+        {
+            blocks_per_frame = 9216;
+        }
+    }
+
+    if (t->sample_rate == 0) return -1;
+    if (total_frames > 0)
+    {
+        uint64_t total = (uint64_t)(total_frames - 1) * blocks_per_frame + final_blocks;
+        t->duration_ms = (uint32_t)(total * 1000 / t->sample_rate);
+    }
+    if (t->duration_ms > 0) t->bitrate = (uint32_t)((uint64_t)t->size * 8000 / t->duration_ms);
+
+    ape_parse_tag(t, pc);
+    return 0;
+}
+
+int Music_Index_Probe(Music_Index_Track *track, Music_Index_ReadFn read, void *ctx, uint8_t *buf, uint32_t buf_size)
+{
+    Probe_Context pc = {read, ctx, buf, buf_size, 0};
+
+    track->title[0] = track->artist[0] = track->album[0] = '\0';
+    track->cover_offset = 0;
+    track->cover_size = 0;
+    track->duration_ms = 0;
+    track->sample_rate = 0;
+    track->bitrate = 0;
+    track->channels = 0;
+
+    switch (track->format)
+    {
+        case MUSIC_INDEX_FMT_WAV:
+            return probe_wav(track, &pc);
+        case MUSIC_INDEX_FMT_MP3:
+            return probe_mp3(track, &pc);
+        case MUSIC_INDEX_FMT_FLAC:
+            return probe_flac(track, &pc);
+        case MUSIC_INDEX_FMT_APE:
+            return probe_ape(track, &pc);
+        default:
+            return -1;
+    }
+}
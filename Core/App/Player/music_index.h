@@ -0,0 +1,127 @@
+/*
+ * music_index.h
+ * 曲库索引文件格式与文件信息解析
+ *
+ * 索引文件 (0:/music/library.idx) 由固定大小的记录组成, 小端序:
+ *   Music_Index_Header (64 字节)
+ *   Music_Index_Track  x track_count  (256 字节, 按目录顺序排列, 同一目录的曲目连续)
+ *   Music_Index_Folder x folder_count (128 字节)
+ * 记录定长, 第 n 首的位置直接由 track_offset + n * track_size 得到, 不需要把曲目表读入 RAM。
+ * 每个目录保存一个签名 (目录中音频文件的名称、大小、修改时间的 FNV-1a), 启动时只读目录项比较签名,
+ * 签名不变的目录直接复制旧记录, 变化的目录才重新打开文件解析。
+ *
+ * 本模块不依赖 HAL / FatFs, 固件 (music_library.c) 和主机工具 (Tools/music_index) 共用。
+ */
+
+#ifndef APP_PLAYER_MUSIC_INDEX_H_
+#define APP_PLAYER_MUSIC_INDEX_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#define MUSIC_INDEX_MAGIC 0x58494C4DU  // "MLIX"
+#define MUSIC_INDEX_VERSION 2  // 2: 增加封面位置
+#define MUSIC_INDEX_FNV_BASIS 2166136261U
+
+/* 与 MusicSong_Format 取值相同 (本文件不依赖 music_player.h) */
+#define MUSIC_INDEX_FMT_WAV 0
+#define MUSIC_INDEX_FMT_MP3 1
+#define MUSIC_INDEX_FMT_FLAC 2
+#define MUSIC_INDEX_FMT_APE 3
+
+#define MUSIC_INDEX_NAME_LEN 128
+#define MUSIC_INDEX_PATH_LEN 112
+
+    /* 文件头 */
+    typedef struct
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t header_size;  // sizeof(Music_Index_Header)
+        uint16_t track_size;   // sizeof(Music_Index_Track)
+        uint16_t folder_size;  // sizeof(Music_Index_Folder)
+        uint32_t track_count;
+        uint32_t folder_count;
+        uint32_t track_offset;   // 曲目表在文件中的偏移
+        uint32_t folder_offset;  // 目录表偏移 (紧接曲目表)
+        uint32_t checksum;       // 目录表的 FNV-1a, 用于发现写了一半的文件
+        uint8_t reserved[32];
+    } Music_Index_Header;
+
+    /* 目录记录 */
+    typedef struct
+    {
+        char path[MUSIC_INDEX_PATH_LEN];  // 相对 0:/music 的路径, 根目录为 "", 以 0 结尾
+        uint32_t signature;               // Music_Index_FolderSignature()
+        uint32_t entries;                 // 目录中的音频文件数
+        uint32_t first_track;             // 第一首在曲目表中的序号
+        uint32_t track_count;             // 曲目表中的数量 (名称过长的文件不收录)
+    } Music_Index_Folder;
+
+    /* 曲目记录 (文本为 UTF-8) */
+    typedef struct
+    {
+        char name[MUSIC_INDEX_NAME_LEN];  // 文件名 (不含目录)
+        char title[40];
+        char artist[32];
+        char album[24];
+        uint32_t cover_offset;  // 内嵌封面图片数据 (JPEG / PNG 原始数据) 在文件中的偏移
+        uint32_t cover_size;    // 封面数据长度, 0 表示没有可直接读取的封面
+        uint32_t size;          // 文件大小
+        uint16_t fdate;         // FAT 修改日期
+        uint16_t ftime;         // FAT 修改时间
+        uint32_t duration_ms;   // 0 表示未知
+        uint32_t sample_rate;
+        uint32_t bitrate;       // 平均比特率 (bps)
+        uint16_t folder;        // 所在目录 (目录表序号)
+        uint8_t format;         // MusicSong_Format
+        uint8_t channels;
+    } Music_Index_Track;
+
+    _Static_assert(sizeof(Music_Index_Header) == 64, "index header layout");
+    _Static_assert(sizeof(Music_Index_Folder) == 128, "index folder layout");
+    _Static_assert(sizeof(Music_Index_Track) == 256, "index track layout");
+
+    /**
+     * @brief  读取文件中指定位置的数据 (由调用者实现: 固件用 stream_reader, 主机工具用 stdio)
+     * @retval 实际读取的字节数
+     */
+    typedef uint32_t (*Music_Index_ReadFn)(void *ctx, uint32_t offset, void *buf, uint32_t len);
+
+    /**
+     * @brief  FNV-1a 累加
+     */
+    uint32_t Music_Index_Hash(uint32_t hash, const void *data, uint32_t len);
+
+    /**
+     * @brief  把一个音频文件的目录项累加到目录签名
+     * @param  hash: 目录签名 (从 MUSIC_INDEX_FNV_BASIS 开始, 各目录项的 FNV-1a 相加, 与顺序无关)
+     */
+    uint32_t Music_Index_FolderSignature(uint32_t hash, const char *name, uint32_t size, uint16_t fdate,
+                                         uint16_t ftime);
+
+    /**
+     * @brief  解析文件头和标签, 填写采样率、时长、比特率、声道数、标题 / 艺术家 / 专辑和封面位置
+     * @note   调用前需填好 format 和 size; 无法识别的字段保持为 0 / 空字符串
+     *         封面取 ID3v2 APIC / PIC、FLAC PICTURE 块或 APEv2 "Cover Art (Front)", 有多张时优先封面 (front cover)
+     * @param  buf: 工作缓冲区 (决定读取标签的最大长度, 建议 >= 4KB)
+     * @retval 0: 成功, -1: 文件头无法识别
+     */
+    int Music_Index_Probe(Music_Index_Track *track, Music_Index_ReadFn read, void *ctx, uint8_t *buf,
+                          uint32_t buf_size);
+
+    /**
+     * @brief  校验文件头 (魔数、版本、记录大小、各表位置与文件大小一致)
+     * @retval 0: 有效
+     */
+    int Music_Index_CheckHeader(const Music_Index_Header *header, uint32_t file_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_MUSIC_INDEX_H_ */
@@ -0,0 +1,470 @@
+/*
+ * music_library.c
+ * 曲库索引的增量更新与读取
+ *
+ * 目录按广度优先编号 (0 为 0:/music 本身), 每次只打开一个 DIR, 不递归, 任务栈上只有一组 DIR / FILINFO。
+ * 索引文件 lib_file 在更新后保持打开, 读取曲目记录时持有 lib_mutex (GUI 任务和音频任务都会读)。
+ * 建立索引时同时打开的对象: lib_file、library.tmp、一个 DIR、stream_reader 的文件, 共 4 个 (_FS_LOCK)。
+ */
+
+#include "music_library.h"
+#include "audio_decoder.h"
+#include "cmsis_os.h"
+#include "codec_mem.h"
+#include "fatfs.h"
+#include "stream_reader.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define LIB_INDEX_PATH MUSIC_LIBRARY_ROOT "/library.idx"
+#define LIB_TEMP_PATH MUSIC_LIBRARY_ROOT "/library.tmp"
+#define LIB_PROBE_BUF_SIZE 4096  // 标签解析缓冲区 (CCM)
+#define LIB_NO_MATCH 0xFFFFU
+
+/* Private variables ---------------------------------------------------------*/
+static FIL lib_file;  // 当前索引 (只读), SRAM: SDIO DMA 直接读写 FIL 内部的扇区缓冲
+static uint8_t lib_opened = 0;
+static Music_Index_Header lib_header;
+static osMutexId_t lib_mutex = NULL;
+
+static const osMutexAttr_t lib_mutex_attributes = {
+    .name = "libraryMutex",
+    .attr_bits = osMutexPrioInherit,
+};
+
+// 路径拼接缓冲区: 0:/music/ + 目录 + / + 文件名
+static char lib_path[sizeof(MUSIC_LIBRARY_ROOT) + MUSIC_INDEX_PATH_LEN + MUSIC_INDEX_NAME_LEN + 2];
+
+/* Function implementations --------------------------------------------------*/
+
+/**
+ * @brief  Build "0:/music[/folder][/name]" into lib_path
+ */
+static const char *lib_make_path(const char *folder, const char *name)
+{
+    snprintf(lib_path, sizeof(lib_path), "%s%s%s%s%s", MUSIC_LIBRARY_ROOT, folder[0] ? "/" : "", folder,
+             name ? "/" : "", name ? name : "");
+    return lib_path;
+}
+
+/**
+ * @brief  Audio file that can be indexed (known extension, name fits the record)
+ */
+static const Audio_Decoder *lib_match_file(const FILINFO *fno)
+{
+    if (fno->fattrib & (AM_DIR | AM_HID | AM_SYS)) return NULL;
+    if (strlen(fno->fname) >= MUSIC_INDEX_NAME_LEN) return NULL;
+    return Audio_Decoder_FindByName(fno->fname);
+}
+
+/**
+ * @brief  Music_Index_ReadFn on top of stream_reader
+ */
+static uint32_t lib_stream_read(void *ctx, uint32_t offset, void *buf, uint32_t len)
+{
+    (void)ctx;
+    if (Stream_Seek(offset) != FR_OK) return 0;
+    return Stream_Read(buf, len);
+}
+
+/**
+ * @brief  Read the index header and folder table of the current index
+ * @param  folders: 输出目录表 (至少 MUSIC_LIBRARY_MAX_FOLDERS 项)
+ * @retval 目录数, 索引不存在或已损坏时返回 0
+ */
+static uint32_t lib_load_index(Music_Index_Folder *folders)
+{
+    UINT br;
+
+    lib_opened = 0;
+    if (f_open(&lib_file, LIB_INDEX_PATH, FA_READ) != FR_OK) return 0;
+    lib_opened = 1;
+
+    if (f_read(&lib_file, &lib_header, sizeof(lib_header), &br) != FR_OK || br != sizeof(lib_header) ||
+        Music_Index_CheckHeader(&lib_header, f_size(&lib_file)) != 0 ||
+        lib_header.folder_count > MUSIC_LIBRARY_MAX_FOLDERS)
+    {
+        return 0;
+    }
+
+    uint32_t len = lib_header.folder_count * sizeof(Music_Index_Folder);
+    if (f_lseek(&lib_file, lib_header.folder_offset) != FR_OK || f_read(&lib_file, folders, len, &br) != FR_OK ||
+        br != len || Music_Index_Hash(MUSIC_INDEX_FNV_BASIS, folders, len) != lib_header.checksum)
+    {
+        return 0;
+    }
+    return lib_header.folder_count;
+}
+
+/**
+ * @brief  Walk 0:/music breadth-first, filling path / signature / entries of each folder
+ * @retval 目录数
+ */
+static uint32_t lib_scan_folders(Music_Index_Folder *folders)
+{
+    DIR dir;
+    FILINFO fno;
+    uint32_t count = 1;
+
+    folders[0].path[0] = '\0';
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Music_Index_Folder *f = &folders[i];
+        uint32_t depth = 0;
+        for (const char *p = f->path; *p; p++) depth += (*p == '/');
+        if (f->path[0]) depth++;
+
+        f->signature = MUSIC_INDEX_FNV_BASIS;
+        f->entries = 0;
+        if (f_opendir(&dir, lib_make_path(f->path, NULL)) != FR_OK) continue;
+
+        while (f_readdir(&dir, &fno) == FR_OK && fno.fname[0] != 0)
+        {
+            if (fno.fattrib & AM_DIR)
+            {
+                if (fno.fattrib & (AM_HID | AM_SYS) || fno.fname[0] == '.') continue;
+                if (depth >= MUSIC_LIBRARY_MAX_DEPTH || count >= MUSIC_LIBRARY_MAX_FOLDERS) continue;
+
+                Music_Index_Folder *sub = &folders[count];
+                int n = snprintf(sub->path, sizeof(sub->path), "%s%s%s", f->path, f->path[0] ? "/" : "", fno.fname);
+                if (n > 0 && n < (int)sizeof(sub->path)) count++;
+            }
+            else if (lib_match_file(&fno))
+            {
+                f->signature =
+                    Music_Index_FolderSignature(f->signature, fno.fname, (uint32_t)fno.fsize, fno.fdate, fno.ftime);
+                f->entries++;
+            }
+        }
+        f_closedir(&dir);
+    }
+    return count;
+}
+
+/**
+ * @brief  Find the old record of a folder whose directory entries have not changed
+ */
+static uint16_t lib_find_unchanged(const Music_Index_Folder *f, const Music_Index_Folder *old, uint32_t old_count)
+{
+    for (uint32_t i = 0; i < old_count; i++)
+    {
+        if (old[i].signature == f->signature && old[i].entries == f->entries && strcmp(old[i].path, f->path) == 0)
+        {
+            return (uint16_t)i;
+        }
+    }
+    return LIB_NO_MATCH;
+}
+
+/**
+ * @brief  Copy the tracks of an unchanged folder from the old index
+ */
+static int lib_copy_tracks(FIL *out, const Music_Index_Folder *old, uint16_t folder, Music_Index_Track *track)
+{
+    UINT n;
+
+    if (f_lseek(&lib_file, lib_header.track_offset + old->first_track * sizeof(Music_Index_Track)) != FR_OK) return -1;
+    for (uint32_t i = 0; i < old->track_count; i++)
+    {
+        if (f_read(&lib_file, track, sizeof(*track), &n) != FR_OK || n != sizeof(*track)) return -1;
+        track->folder = folder;
+        if (f_write(out, track, sizeof(*track), &n) != FR_OK || n != sizeof(*track)) return -1;
+    }
+    return (int)old->track_count;
+}
+
+/**
+ * @brief  Probe every audio file of a changed folder
+ * @retval 写入的曲目数, -1: 写入失败
+ */
+static int lib_probe_tracks(FIL *out, const Music_Index_Folder *f, uint16_t folder, Music_Index_Track *track,
+                            uint8_t *buf)
+{
+    DIR dir;
+    FILINFO fno;
+    UINT n;
+    int count = 0;
+
+    if (f_opendir(&dir, lib_make_path(f->path, NULL)) != FR_OK) return 0;
+
+    while (f_readdir(&dir, &fno) == FR_OK && fno.fname[0] != 0)
+    {
+        const Audio_Decoder *dec = lib_match_file(&fno);
+        if (!dec) continue;
+
+        memset(track, 0, sizeof(*track));
+        strcpy(track->name, fno.fname);
+        track->size = (uint32_t)fno.fsize;
+        track->fdate = fno.fdate;
+        track->ftime = fno.ftime;
+        track->folder = folder;
+        track->format = (uint8_t)dec->format;
+
+        // 无法解析的文件也收录, 时长等字段为 0, 播放时由解码器判断
+        if (Stream_Open(lib_make_path(f->path, fno.fname)) == FR_OK)
+        {
+            Music_Index_Probe(track, lib_stream_read, NULL, buf, LIB_PROBE_BUF_SIZE);
+            Stream_Close();
+        }
+
+        if (f_write(out, track, sizeof(*track), &n) != FR_OK || n != sizeof(*track))
+        {
+            count = -1;
+            break;
+        }
+        count++;
+    }
+    f_closedir(&dir);
+    return count;
+}
+
+/**
+ * @brief  Write a new index into LIB_TEMP_PATH
+ * @retval 0: 成功
+ */
+static int lib_write_index(Music_Index_Folder *folders, uint32_t count, const Music_Index_Folder *old,
+                           uint32_t old_count, Music_Library_Stats *stats)
+{
+    FIL out;  // 任务栈 (SRAM)
+    UINT n;
+    Music_Index_Header header;
+    Music_Index_Track *track = Codec_Mem_Alloc(sizeof(Music_Index_Track));
+    uint8_t *buf = Codec_Mem_Alloc(LIB_PROBE_BUF_SIZE);
+    uint32_t tracks = 0;
+    int res = -1;
+
+    if (!track || !buf) return -1;
+    if (f_open(&out, LIB_TEMP_PATH, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) return -1;
+
+    memset(&header, 0, sizeof(header));
+    if (f_write(&out, &header, sizeof(header), &n) != FR_OK) goto done;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint16_t match = lib_find_unchanged(&folders[i], old, old_count);
+        int added;
+
+        if (match != LIB_NO_MATCH)
+        {
+            added = lib_copy_tracks(&out, &old[match], (uint16_t)i, track);
+        }
+        else
+        {
+            added = lib_probe_tracks(&out, &folders[i], (uint16_t)i, track, buf);
+            stats->rescanned_folders++;
+            if (added > 0) stats->probed_files += (uint32_t)added;
+        }
+        if (added < 0) goto done;
+
+        folders[i].first_track = tracks;
+        folders[i].track_count = (uint32_t)added;
+        tracks += (uint32_t)added;
+    }
+
+    uint32_t len = count * sizeof(Music_Index_Folder);
+    if (f_write(&out, folders, len, &n) != FR_OK || n != len) goto done;
+
+    // 最后写文件头: 之前断电的文件头全为 0, 不会被当作有效索引
+    header.magic = MUSIC_INDEX_MAGIC;
+    header.version = MUSIC_INDEX_VERSION;
+    header.header_size = sizeof(Music_Index_Header);
+    header.track_size = sizeof(Music_Index_Track);
+    header.folder_size = sizeof(Music_Index_Folder);
+    header.track_count = tracks;
+    header.folder_count = count;
+    header.track_offset = sizeof(Music_Index_Header);
+    header.folder_offset = sizeof(Music_Index_Header) + tracks * sizeof(Music_Index_Track);
+    header.checksum = Music_Index_Hash(MUSIC_INDEX_FNV_BASIS, folders, len);
+    if (f_lseek(&out, 0) != FR_OK || f_write(&out, &header, sizeof(header), &n) != FR_OK || n != sizeof(header))
+    {
+        goto done;
+    }
+    res = 0;
+
+done:
+    if (f_close(&out) != FR_OK) res = -1;
+    return res;
+}
+
+int Music_Library_Update(Music_Library_Stats *stats)
+{
+    Music_Library_Stats st;
+    uint32_t t0 = osKernelGetTickCount();
+    int res = 0;
+
+    memset(&st, 0, sizeof(st));
+    if (lib_mutex == NULL) lib_mutex = osMutexNew(&lib_mutex_attributes);
+    osMutexAcquire(lib_mutex, osWaitForever);
+
+    if (lib_opened)
+    {
+        f_close(&lib_file);
+        lib_opened = 0;
+    }
+    memset(&lib_header, 0, sizeof(lib_header));
+
+    // 新旧目录表放在 CCM (解码器此时还没有使用), 各 8KB
+    Codec_Mem_Reset();
+    Music_Index_Folder *folders = Codec_Mem_Alloc(MUSIC_LIBRARY_MAX_FOLDERS * sizeof(Music_Index_Folder));
+    Music_Index_Folder *old = Codec_Mem_Alloc(MUSIC_LIBRARY_MAX_FOLDERS * sizeof(Music_Index_Folder));
+
+    uint32_t old_count = lib_load_index(old);
+    uint32_t count = lib_scan_folders(folders);
+    uint8_t changed = (old_count != count);
+
+    for (uint32_t i = 0; i < count && !changed; i++)
+    {
+        changed = (lib_find_unchanged(&folders[i], old, old_count) == LIB_NO_MATCH);
+    }
+
+    if (changed)
+    {
+        st.rebuilt = 1;
+        if (lib_write_index(folders, count, old, old_count, &st) == 0)
+        {
+            if (lib_opened) f_close(&lib_file);
+            f_unlink(LIB_INDEX_PATH);
+            f_rename(LIB_TEMP_PATH, LIB_INDEX_PATH);
+            old_count = lib_load_index(old);
+        }
+        else
+        {
+            f_unlink(LIB_TEMP_PATH);
+        }
+        if (old_count != count) res = -1;
+    }
+
+    if (res != 0)
+    {
+        if (lib_opened) f_close(&lib_file);
+        lib_opened = 0;
+        memset(&lib_header, 0, sizeof(lib_header));
+    }
+    Codec_Mem_Reset();
+
+    st.folders = lib_header.folder_count;
+    st.tracks = lib_header.track_count;
+    st.time_ms = osKernelGetTickCount() - t0;
+    osMutexRelease(lib_mutex);
+
+    if (stats) *stats = st;
+    return res;
+}
+
+uint32_t Music_Library_GetCount(void)
+{
+    return lib_header.track_count;
+}
+
+/**
+ * @brief  Read one record at an absolute offset (caller holds lib_mutex)
+ */
+static int lib_read_at(uint32_t offset, void *dst, uint32_t len)
+{
+    UINT br;
+
+    if (!lib_opened) return -1;
+    if (f_lseek(&lib_file, offset) != FR_OK || f_read(&lib_file, dst, len, &br) != FR_OK || br != len) return -1;
+    return 0;
+}
+
+int Music_Library_ReadTrack(uint32_t index, Music_Index_Track *track)
+{
+    int res = -1;
+
+    if (lib_mutex == NULL || index >= lib_header.track_count) return -1;
+    osMutexAcquire(lib_mutex, osWaitForever);
+    res = lib_read_at(lib_header.track_offset + index * sizeof(Music_Index_Track), track, sizeof(*track));
+    osMutexRelease(lib_mutex);
+    return res;
+}
+
+int Music_Library_GetPath(uint32_t index, char *buf, uint32_t size)
+{
+    Music_Index_Track track;
+    Music_Index_Folder folder;
+    int res = -1;
+
+    if (lib_mutex == NULL || index >= lib_header.track_count) return -1;
+    osMutexAcquire(lib_mutex, osWaitForever);
+    if (lib_read_at(lib_header.track_offset + index * sizeof(Music_Index_Track), &track, sizeof(track)) == 0 &&
+        track.folder < lib_header.folder_count &&
+        lib_read_at(lib_header.folder_offset + track.folder * sizeof(Music_Index_Folder), &folder, sizeof(folder)) ==
+            0)
+    {
+        int n = snprintf(buf, size, "%s%s%s", folder.path, folder.path[0] ? "/" : "", track.name);
+        if (n > 0 && (uint32_t)n < size) res = 0;
+    }
+    osMutexRelease(lib_mutex);
+    return res;
+}
+
+uint32_t Music_Library_GetChecksum(void)
+{
+    return lib_header.checksum;
+}
+
+uint32_t Music_Library_GetFolderCount(void)
+{
+    return lib_header.folder_count;
+}
+
+int Music_Library_ReadFolder(uint32_t index, Music_Index_Folder *folder)
+{
+    int res;
+
+    if (lib_mutex == NULL || index >= lib_header.folder_count) return -1;
+    osMutexAcquire(lib_mutex, osWaitForever);
+    res = lib_read_at(lib_header.folder_offset + index * sizeof(Music_Index_Folder), folder, sizeof(*folder));
+    osMutexRelease(lib_mutex);
+    return res;
+}
+
+/**
+ * @brief  ASCII case-insensitive compare of at most len bytes (len < 0: whole strings)
+ */
+static int lib_name_equal(const char *a, const char *b, int len)
+{
+    for (int i = 0; len < 0 || i < len; i++)
+    {
+        char x = a[i], y = b[i];
+        if (x >= 'a' && x <= 'z') x -= 32;
+        if (y >= 'a' && y <= 'z') y -= 32;
+        if (x != y) return 0;
+        if (x == '\0') break;
+    }
+    return len < 0 || b[len] == '\0';
+}
+
+uint32_t Music_Library_FindPath(const char *path)
+{
+    Music_Index_Folder folder;
+    Music_Index_Track track;
+    const char *slash = strrchr(path, '/');
+    const char *name = slash ? slash + 1 : path;
+    int dir_len = slash ? (int)(slash - path) : 0;
+    uint32_t id = 0xFFFFFFFFU;
+
+    if (lib_mutex == NULL) return id;
+    osMutexAcquire(lib_mutex, osWaitForever);
+    for (uint32_t i = 0; i < lib_header.folder_count && id == 0xFFFFFFFFU; i++)
+    {
+        if (lib_read_at(lib_header.folder_offset + i * sizeof(folder), &folder, sizeof(folder)) != 0) break;
+        if (!lib_name_equal(path, folder.path, dir_len)) continue;
+
+        for (uint32_t t = 0; t < folder.track_count; t++)
+        {
+            uint32_t n = folder.first_track + t;
+            if (lib_read_at(lib_header.track_offset + n * sizeof(track), &track, sizeof(track)) != 0) break;
+            if (lib_name_equal(name, track.name, -1))
+            {
+                id = n;
+                break;
+            }
+        }
+    }
+    osMutexRelease(lib_mutex);
+    return id;
+}
@@ -0,0 +1,83 @@
+/*
+ * music_library.h
+ * 曲库: 维护 SD 卡上的索引文件 0:/music/library.idx (格式见 music_index.h)
+ *
+ * 启动时遍历 0:/music 及其子目录 (最多 MUSIC_LIBRARY_MAX_DEPTH 层), 只读取目录项计算每个目录的签名:
+ * 全部与索引一致时直接使用旧索引; 否则写入 library.tmp, 未变化目录的曲目从旧索引复制,
+ * 变化的目录逐个打开文件解析, 写完后替换 library.idx (中途断电时旧索引仍然完整)。
+ * 曲目记录按需从文件读取, 不占用 RAM。
+ */
+
+#ifndef APP_PLAYER_MUSIC_LIBRARY_H_
+#define APP_PLAYER_MUSIC_LIBRARY_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "music_index.h"
+
+#define MUSIC_LIBRARY_ROOT "0:/music"
+#define MUSIC_LIBRARY_MAX_DEPTH 4     // 子目录层数 (0:/music 为第 0 层)
+#define MUSIC_LIBRARY_MAX_FOLDERS 64  // 目录表 (建立索引时放在 CCM, 8KB)
+
+    /* 最近一次 Music_Library_Update() 的统计 */
+    typedef struct
+    {
+        uint32_t folders;            // 目录数
+        uint32_t tracks;             // 曲目数
+        uint32_t rescanned_folders;  // 签名变化、重新解析的目录数
+        uint32_t probed_files;       // 重新解析的文件数
+        uint32_t time_ms;            // 总耗时
+        uint8_t rebuilt;             // 1: 重写了索引文件, 0: 沿用旧索引
+    } Music_Library_Stats;
+
+    /**
+     * @brief  检查并增量更新索引 (f_mount 和 Stream_Init 之后, 播放开始前调用)
+     * @note   建立索引时借用解码器内存 (Codec_Mem), 返回前复位
+     * @param  stats: 输出统计, 可以为 NULL
+     * @retval 0: 成功, -1: 0:/music 不存在或索引无法写入
+     */
+    int Music_Library_Update(Music_Library_Stats *stats);
+
+    /**
+     * @brief  索引中的曲目数
+     */
+    uint32_t Music_Library_GetCount(void);
+
+    /**
+     * @brief  读取一条曲目记录
+     * @retval 0: 成功, -1: 序号越界或读取失败
+     */
+    int Music_Library_ReadTrack(uint32_t index, Music_Index_Track *track);
+
+    /**
+     * @brief  目录表的校验和, 曲目序号变化时随之变化 (播放列表文件用它判断是否过期)
+     */
+    uint32_t Music_Library_GetChecksum(void);
+
+    /**
+     * @brief  索引中的目录数 / 读取一条目录记录
+     */
+    uint32_t Music_Library_GetFolderCount(void);
+    int Music_Library_ReadFolder(uint32_t index, Music_Index_Folder *folder);
+
+    /**
+     * @brief  按相对 0:/music 的路径查找曲目 (不区分大小写, 与 FAT 相同)
+     * @retval 曲目序号, 不存在时返回 0xFFFFFFFF
+     */
+    uint32_t Music_Library_FindPath(const char *path);
+
+    /**
+     * @brief  曲目相对 0:/music 的路径 ("dir/sub/name.mp3", 根目录下为 "name.mp3")
+     * @retval 0: 成功, -1: 读取失败或 buf 太小
+     */
+    int Music_Library_GetPath(uint32_t index, char *buf, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_MUSIC_LIBRARY_H_ */
@@ -0,0 +1,382 @@
+/*
+ * music_lyric.c
+ * 歌词: .lrc 流式解析、时间表排序与二分查找
+ *
+ * 解析按字符进行, 不需要整行缓冲: 行首的 [...] 逐个识别 (时间标签暂存到本行的时间列表,
+ * [offset:] 记录偏移, 其他标签忽略), 之后的字符直接写入文字区; 行尾去掉末尾空白,
+ * 有时间标签的行为每个时间生成一条, 没有的行 (标题、作者等) 只计长度, 不写入。
+ * 两遍解析使用相同的上限, 第二遍写入的条数和长度与第一遍统计的完全一致;
+ * 第二遍的写入位置另外按分配的大小检查 (行尾被去掉的空白不计入第一遍的长度)。
+ */
+
+#include "music_lyric.h"
+#include "music_library.h"
+#include "fatfs.h"
+#include "../../Gui/lvgl/lvgl.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define LYRIC_CHUNK 256   // 每次读取的字节数 (放在调用者栈上)
+#define LYRIC_TAG_MAX 24  // 标签内容的最大长度, 更长的标签 (一般是 [ti:] 等) 不解析
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+    LYRIC_STATE_TAGS,  // 行首, 可以继续出现标签
+    LYRIC_STATE_TAG,   // 在 [...] 内
+    LYRIC_STATE_TEXT,  // 歌词文字
+} Lyric_State;
+
+typedef struct
+{
+    Music_Lyric_Line *line;  // NULL: 第一遍, 只统计
+    char *text;
+    uint32_t text_size;  // text 的大小 (第二遍按第一遍的 text_len 分配)
+    uint32_t count;     // 已生成的条数
+    uint32_t text_len;  // 文字区已使用的长度 (包括每行的 '\0')
+    int32_t offset_ms;
+
+    // 当前行
+    Lyric_State state;
+    uint32_t time[MUSIC_LYRIC_LINE_TIMES];
+    uint8_t times;
+    uint32_t len;   // 本行已写入的文字长度
+    uint32_t trim;  // 去掉末尾空白后的长度
+    char tag[LYRIC_TAG_MAX];
+    uint8_t tag_len;
+} Lyric_Parser;
+
+/* Private variables ---------------------------------------------------------*/
+static FIL lyric_file;
+static Lyric_Parser lyric_parser;
+static char lyric_path[sizeof(MUSIC_LIBRARY_ROOT) + MUSIC_INDEX_PATH_LEN + MUSIC_INDEX_NAME_LEN + 4];
+
+static Music_Lyric_Line *lyric_line = NULL;  // 时间表, 文字区紧跟在后面
+static const char *lyric_text = NULL;
+static uint32_t lyric_count = 0;
+
+/* Function implementations --------------------------------------------------*/
+
+/**
+ * @brief  Parse a run of decimal digits
+ * @retval Number of digits consumed
+ */
+static uint32_t lyric_digits(const char *s, uint32_t *value)
+{
+    uint32_t n = 0;
+
+    *value = 0;
+    while (s[n] >= '0' && s[n] <= '9' && n < 9)
+    {
+        *value = *value * 10 + (uint32_t)(s[n] - '0');
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief  Parse a time tag body: mm:ss, mm:ss.x, mm:ss.xx, mm:ss.xxx (小数点也可以是 ':')
+ * @retval 0: 成功, -1: 不是时间标签
+ */
+static int lyric_parse_time(const char *s, uint32_t *ms)
+{
+    uint32_t min, sec, frac = 0;
+    uint32_t n = lyric_digits(s, &min);
+
+    if (n == 0 || s[n] != ':') return -1;
+    s += n + 1;
+    n = lyric_digits(s, &sec);
+    if (n == 0 || n > 2 || sec >= 60) return -1;
+    s += n;
+
+    if (*s == '.' || *s == ':')
+    {
+        s++;
+        n = lyric_digits(s, &frac);
+        if (n == 0 || n > 3) return -1;
+        s += n;
+        if (n == 1) frac *= 100;
+        if (n == 2) frac *= 10;
+    }
+    if (*s != '\0') return -1;
+
+    *ms = (min * 60U + sec) * 1000U + frac;
+    return 0;
+}
+
+/**
+ * @brief  Handle one complete tag
+ */
+static void lyric_tag(Lyric_Parser *p)
+{
+    uint32_t ms;
+
+    p->tag[p->tag_len] = '\0';
+    if (lyric_parse_time(p->tag, &ms) == 0)
+    {
+        if (p->times < MUSIC_LYRIC_LINE_TIMES) p->time[p->times++] = ms;
+    }
+    else if (strncmp(p->tag, "offset:", 7) == 0)
+    {
+        const char *s = p->tag + 7;
+        int32_t sign = 1;
+        uint32_t value;
+
+        while (*s == ' ') s++;
+        if (*s == '+' || *s == '-') sign = (*s++ == '-') ? -1 : 1;
+        if (lyric_digits(s, &value) > 0) p->offset_ms = sign * (int32_t)value;
+    }
+}
+
+/**
+ * @brief  End of a line: emit one entry per time tag, or drop the line
+ */
+static void lyric_end_line(Lyric_Parser *p)
+{
+    if (p->state == LYRIC_STATE_TAG) p->times = 0;  // 没有闭合的标签, 整行无效
+
+    if (p->times > 0 && p->text_len + p->trim + 1 <= MUSIC_LYRIC_MAX_TEXT)
+    {
+        uint32_t start = p->text_len;
+        if (p->text) p->text[start + p->trim] = '\0';
+        p->text_len += p->trim + 1;
+
+        for (uint32_t i = 0; i < p->times && p->count < MUSIC_LYRIC_MAX_LINES; i++)
+        {
+            if (p->line)
+            {
+                p->line[p->count].time_ms = p->time[i];
+                p->line[p->count].text = start;
+            }
+            p->count++;
+        }
+    }
+
+    p->state = LYRIC_STATE_TAGS;
+    p->times = 0;
+    p->len = 0;
+    p->trim = 0;
+}
+
+/**
+ * @brief  Append one text character to the current line
+ */
+static void lyric_text_char(Lyric_Parser *p, char c)
+{
+    // 第一遍统计时同样按上限截断, 两遍的长度保持一致 ('\0' 占 1 字节)
+    if (p->text_len + p->len + 2 > MUSIC_LYRIC_MAX_TEXT) return;
+    // 只写入有时间标签的行, 时间标签都在文字之前
+    if (p->text && p->times > 0 && p->text_len + p->len < p->text_size) p->text[p->text_len + p->len] = c;
+    p->len++;
+    if (c != ' ' && c != '\t') p->trim = p->len;
+}
+
+/**
+ * @brief  Feed a chunk of the file to the parser
+ */
+static void lyric_feed(Lyric_Parser *p, const char *buf, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        char c = buf[i];
+
+        if (c == '\n')
+        {
+            lyric_end_line(p);
+            continue;
+        }
+        if (c == '\r') continue;
+
+        switch (p->state)
+        {
+            case LYRIC_STATE_TAGS:
+                if (c == '[')
+                {
+                    p->state = LYRIC_STATE_TAG;
+                    p->tag_len = 0;
+                    break;
+                }
+                if (c == ' ' || c == '\t') break;
+                p->state = LYRIC_STATE_TEXT;
+                lyric_text_char(p, c);
+                break;
+            case LYRIC_STATE_TEXT:
+                lyric_text_char(p, c);
+                break;
+            case LYRIC_STATE_TAG:
+                if (c == ']')
+                {
+                    if (p->tag_len < LYRIC_TAG_MAX) lyric_tag(p);
+                    p->state = LYRIC_STATE_TAGS;
+                }
+                else if (p->tag_len < LYRIC_TAG_MAX - 1)
+                {
+                    p->tag[p->tag_len++] = c;
+                }
+                else
+                {
+                    p->tag_len = LYRIC_TAG_MAX;  // 太长, 丢弃
+                }
+                break;
+        }
+    }
+}
+
+/**
+ * @brief  Run one parsing pass over the whole file
+ * @retval 0: 成功, -1: 读取失败
+ */
+static int lyric_pass(Lyric_Parser *p)
+{
+    char buf[LYRIC_CHUNK];
+    UINT br = 0;
+    uint8_t first = 1;
+
+    p->count = 0;
+    p->text_len = 0;
+    p->offset_ms = 0;
+    p->state = LYRIC_STATE_TAGS;
+    p->times = 0;
+    p->len = 0;
+    p->trim = 0;
+
+    if (f_lseek(&lyric_file, 0) != FR_OK) return -1;
+    do
+    {
+        if (f_read(&lyric_file, buf, sizeof(buf), &br) != FR_OK) return -1;
+
+        uint32_t skip = 0;
+        if (first && br >= 3 && memcmp(buf, "\xEF\xBB\xBF", 3) == 0) skip = 3;  // UTF-8 BOM
+        first = 0;
+        lyric_feed(p, buf + skip, br - skip);
+    } while (br == sizeof(buf));
+
+    lyric_end_line(p);  // 最后一行可能没有换行符
+    return 0;
+}
+
+/**
+ * @brief  Apply [offset:] and sort the time table (稳定排序, 同一时间保持文件中的顺序)
+ * @note   正的 offset 表示歌词提前显示。歌词文件基本按时间排列, 只有多时间标签的行乱序,
+ *         插入排序对这种输入接近线性
+ */
+static void lyric_sort(Music_Lyric_Line *line, uint32_t count, int32_t offset_ms)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        int64_t t = (int64_t)line[i].time_ms - offset_ms;
+        line[i].time_ms = (t < 0) ? 0 : (uint32_t)t;
+    }
+
+    for (uint32_t i = 1; i < count; i++)
+    {
+        Music_Lyric_Line key = line[i];
+        uint32_t j = i;
+        while (j > 0 && line[j - 1].time_ms > key.time_ms)
+        {
+            line[j] = line[j - 1];
+            j--;
+        }
+        line[j] = key;
+    }
+}
+
+/**
+ * @brief  Build 0:/music/<dir>/<name>.lrc from the track path
+ * @retval 0: 成功, -1: 曲目不存在
+ */
+static int lyric_make_path(uint32_t id)
+{
+    uint32_t root_len = sizeof(MUSIC_LIBRARY_ROOT);  // 包括 '/'
+
+    memcpy(lyric_path, MUSIC_LIBRARY_ROOT "/", root_len);
+    if (Music_Library_GetPath(id, lyric_path + root_len, sizeof(lyric_path) - root_len - 4) != 0) return -1;
+
+    char *name = strrchr(lyric_path, '/') + 1;
+    char *ext = strrchr(name, '.');
+    if (!ext) ext = name + strlen(name);
+    memcpy(ext, ".lrc", 5);
+    return 0;
+}
+
+int Music_Lyric_Load(uint32_t id)
+{
+    Lyric_Parser *p = &lyric_parser;
+    int result = -1;
+
+    Music_Lyric_Unload();
+    if (lyric_make_path(id) != 0) return -1;
+    if (f_open(&lyric_file, lyric_path, FA_READ) != FR_OK) return -1;
+
+    // 第一遍: 统计条数和文字长度
+    memset(p, 0, sizeof(*p));
+    if (lyric_pass(p) != 0 || p->count == 0) goto done;
+
+    // 第二遍: 写入按实际大小分配的内存
+    uint32_t count = p->count;
+    uint32_t text_len = p->text_len;
+    Music_Lyric_Line *line = lv_malloc(count * sizeof(Music_Lyric_Line) + text_len);
+    if (!line) goto done;
+
+    p->line = line;
+    p->text = (char *)(line + count);
+    p->text_size = text_len;
+    if (lyric_pass(p) != 0 || p->count != count || p->text_len != text_len)
+    {
+        lv_free(line);
+        goto done;
+    }
+
+    lyric_sort(line, count, p->offset_ms);
+    lyric_line = line;
+    lyric_text = p->text;
+    lyric_count = count;
+    result = 0;
+
+done:
+    p->line = NULL;
+    p->text = NULL;
+    p->text_size = 0;
+    f_close(&lyric_file);
+    return result;
+}
+
+void Music_Lyric_Unload(void)
+{
+    if (lyric_line) lv_free(lyric_line);
+    lyric_line = NULL;
+    lyric_text = NULL;
+    lyric_count = 0;
+}
+
+uint32_t Music_Lyric_GetCount(void)
+{
+    return lyric_count;
+}
+
+int32_t Music_Lyric_Find(uint32_t ms)
+{
+    // 第一条时间大于 ms 的位置, 它前面一条就是当前行
+    uint32_t lo = 0, hi = lyric_count;
+
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        if (lyric_line[mid].time_ms <= ms)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return (int32_t)lo - 1;
+}
+
+const char *Music_Lyric_GetText(int32_t index)
+{
+    if (index < 0 || (uint32_t)index >= lyric_count) return "";
+    return lyric_text + lyric_line[index].text;
+}
@@ -0,0 +1,67 @@
+/*
+ * music_lyric.h
+ * 歌词: 读取与曲目同名的 .lrc 文件 (0:/music/<目录>/<文件名>.lrc), 建立按时间排序的索引
+ *
+ * 文件分块流式读取, 解析两遍: 第一遍统计时间标签数和去掉标签后的文字长度, 第二遍写入一块按实际大小
+ * 分配的内存 (时间表 8 字节 / 条 + 文字)。一行有多个时间标签时 ([00:12.00][01:30.50]副歌),
+ * 各条时间指向同一段文字; [offset:+/-ms] 在排序前作用于所有时间。
+ * 当前行由播放位置在时间表中二分查找, GUI 只在行号变化时更新显示。
+ * 只在 GUI 任务中使用 (内存从 LVGL 堆分配)。
+ */
+
+#ifndef APP_PLAYER_MUSIC_LYRIC_H_
+#define APP_PLAYER_MUSIC_LYRIC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#define MUSIC_LYRIC_MAX_LINES 512   // 时间标签上限
+#define MUSIC_LYRIC_MAX_TEXT 8192   // 文字总长度上限, 放不下的行截断, 之后的行丢弃
+#define MUSIC_LYRIC_LINE_TIMES 16   // 一行最多的时间标签数
+#define MUSIC_LYRIC_NONE (-1)       // 第一行之前 / 没有歌词
+
+    /* 时间表中的一条 */
+    typedef struct
+    {
+        uint32_t time_ms;  // 已经加上 [offset:]
+        uint32_t text;     // 文字在文字区中的偏移 (以 0 结尾)
+    } Music_Lyric_Line;
+
+    /**
+     * @brief  加载一首曲目的歌词 (先释放已加载的)
+     * @param  id: 曲库序号
+     * @retval 0: 成功, -1: 没有歌词文件、没有时间标签或内存不够
+     */
+    int Music_Lyric_Load(uint32_t id);
+
+    /**
+     * @brief  释放已加载的歌词
+     */
+    void Music_Lyric_Unload(void);
+
+    /**
+     * @brief  时间表条数, 没有歌词时为 0
+     */
+    uint32_t Music_Lyric_GetCount(void);
+
+    /**
+     * @brief  查找播放位置所在的行 (时间不大于 ms 的最后一条)
+     * @retval 行号, 第一行之前或没有歌词时为 MUSIC_LYRIC_NONE
+     */
+    int32_t Music_Lyric_Find(uint32_t ms);
+
+    /**
+     * @brief  一行的文字
+     * @retval 行号越界时返回 ""
+     */
+    const char *Music_Lyric_GetText(int32_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_MUSIC_LYRIC_H_ */
@@ -1,6 +1,17 @@
 /* Includes ------------------------------------------------------------------*/
 #include "music_player.h"
-#include "mp3_decoder.h"
+#include "audio_decoder.h"
+#include "audio_eq.h"
+#include "audio_spectrum.h"
+#include "audio_src.h"
+#include "audio_src_selftest.h"
+#include "codec_mem.h"
+#include "dwt.h"
+#include "music_cover.h"
+#include "music_library.h"
+#include "music_playlist.h"
+#include "mp3_selftest.h"
+#include "stream_reader.h"
 #include "es8388.h"
 #include "fatfs.h"
 #include "i2c.h"
@@ -10,61 +21,121 @@
 #include <stdio.h>
 #include <string.h>
 
+/* Private define ------------------------------------------------------------*/
+// PCM 环形缓冲区: 每块 2304 个采样, 正好是 Helix MP3 解码器一帧的输出 (1152 stereo samples * 2)
+// 解码器直接写入空闲块, DMA 双缓冲模式 (DBM) 的 M0AR/M1AR 直接指向已解码的块, 全程无拷贝
+// DMA 同时占用 2 块, 其余块由解码任务提前填充
+#define PCM_RING_BLOCK_SAMPLES 2304
+#define PCM_RING_BLOCK_COUNT 4  // 18KB RAM, 取代原来的 audio_buffer (9KB) + mp3OutBuffer (4.5KB)
+#define PCM_START_BLOCKS 2      // 启动 DMA 前只需解码出 M0/M1 两块, 其余块在播放过程中补齐
+#define SRC_IN_SAMPLES 576      // 采样率转换的输入暂存 (CCM, 1.1KB): 解码器先写这里, 转换后再写入环形缓冲区
+#define FADE_MS 10                // 暂停、停止、切歌和定位时的渐弱 / 渐强长度
+#define FADE_TIMEOUT_TICKS 30     // 等待渐弱播完的上限 (每次最多等 10ms)
+#define VOLUME_STEP_TICKS 2       // 硬件音量每隔几次 music_player_update() 移动一级
+#define DSP_BUDGET_PERMILLE 850  // 解码 + SRC + EQ 超过 85% CPU 时关闭 EQ, 给 GUI 和文件读取留出余量
+#define CHAIN_PREPARE_MS 3000    // 距歌曲结束不到这么久时提前读出下一首的播放列表项、路径和时长
+#define CHAIN_SKIP_MAX 8         // 无缝衔接时最多连续跳过几首打不开的歌曲
+
 /* Private typedef -----------------------------------------------------------*/
+// 解析好的播放列表项: 打开文件之前需要读取播放列表和曲库索引的部分
 typedef struct
 {
-    char ChunkID[4];  // "RIFF"
-    uint32_t ChunkSize;
-    char Format[4];       // "WAVE"
-    char Subchunk1ID[4];  // "fmt "
-    uint32_t Subchunk1Size;
-    uint16_t AudioFormat;
-    uint16_t NumChannels;
-    uint32_t SampleRate;
-    uint32_t ByteRate;
-    uint16_t BlockAlign;
-    uint16_t BitsPerSample;
-    char Subchunk2ID[4];  // "data"
-    uint32_t Subchunk2Size;
-} WAV_Header_TypeDef;
+    uint32_t index;  // 播放列表序号
+    MusicSong_TypeDef song;
+    uint32_t index_duration_ms;  // 曲库索引中的时长, 解码器给不出总采样数时使用
+    char path[sizeof(MUSIC_LIBRARY_ROOT) + MUSIC_INDEX_PATH_LEN + MUSIC_INDEX_NAME_LEN + 1];
+} Player_Entry;
 
-/* Private define ------------------------------------------------------------*/
-// 音频缓冲区大小设置为 4608 (2304 stereo samples * 2 bytes = 9216 bytes)
-// 这样做是为了匹配 Helix MP3 解码器一帧的输出大小 (1152 stereo samples * 2 = 2304 samples)
-// 每次半传输中断(2304 samples)刚好对应一帧解码数据，避免数据断流和杂音
-#define AUDIO_BUFFER_SIZE 4608  // +9KB RAM usage (需要减小 FreeRTOS Heap)
-#define MAX_PLAYLIST_SIZE 100
-#define MP3_INBUF_SIZE 5120   // MP3 输入缓冲区大小 (5KB, 与正点原子 MP3_FILE_BUF_SZ 一致)
-#define MP3_OUTBUF_SIZE 2304  // MP3 输出缓冲区大小 (1152 samples * 2 channels)
+typedef enum
+{
+    NEXT_ENTRY_NONE,    // 还没有解析
+    NEXT_ENTRY_READY,   // next_entry 有效
+    NEXT_ENTRY_FAILED,  // 没有下一首或解析失败, 文件结束时再按原来的方式打开
+} Next_Entry_State;
 
 /* Private variables ---------------------------------------------------------*/
-// --- Audio Buffer (WAV 和 MP3 共用) ---
+// --- PCM Ring (解码输出 = DMA 发送缓冲, 所有格式共用) ---
 // 强制 4 字节对齐，优化 DMA 和解码访问
-static uint16_t audio_buffer[AUDIO_BUFFER_SIZE] __attribute__((aligned(4)));
+static int16_t pcm_pool[PCM_RING_BLOCK_SAMPLES * PCM_RING_BLOCK_COUNT] __attribute__((aligned(4)));
+static PCM_Ring_TypeDef pcm_ring;
+static int16_t *pcm_write_block = NULL;       // 当前正在填充的块 (尚未提交)
+static int pcm_write_offset = 0;              // 当前块内已写入的采样数
+static volatile uint8_t pcm_eof = 0;          // 文件已读完, 环形缓冲区排空后停止
+static volatile uint8_t pcm_drain_count = 0;  // 文件结束后 DMA 已切换到静音块的次数
+static uint8_t next_song_ready = 0;           // 下一首已打开, 但采样率不同, 排空后需要重新配置 I2S
+static uint8_t pcm_fading = 0;                // 正在渐弱: 增益降到 0 后不再解码, 当作文件结束排空
+
+// 欠载或排空时 DMA 发送的静音块 (const, 放在 Flash 中, DMA1 存储器端口可以访问)
+static const int16_t pcm_silence[PCM_RING_BLOCK_SAMPLES] __attribute__((aligned(4))) = {0};
+// DMA 的 M0/M1 当前是否指向环形缓冲块 (否则指向静音块)
+static volatile uint8_t dma_target_owned[2] = {0};
+
+// --- Sample Rate Converter (见 audio_src.h) ---
+#if defined(__GNUC__)
+__attribute__((section(".ccmram")))
+#endif
+static int16_t src_in_buf[SRC_IN_SAMPLES] __attribute__((aligned(4)));  // 只有 CPU 访问, 放在 CCM
+static const int16_t *src_in_ptr = NULL;  // 暂存区中尚未转换的采样
+static uint32_t src_in_left = 0;
+static uint64_t src_cycles = 0;      // Audio_SRC_Process() 累计周期数
+static uint32_t src_out_frames = 0;  // 累计输出的立体声采样对
+static uint32_t output_rate = 0;     // 当前歌曲送给 I2S 的采样率
+static uint32_t i2s_rate = 0;        // I2S 当前配置的采样率, 相同时切歌不重新初始化
+
+// --- EQ / Limiter (见 audio_eq.h), 在输出采样率上原地处理环形缓冲区中的数据 ---
+static uint64_t eq_cycles = 0;       // Audio_EQ_Process() 累计周期数
+static uint32_t eq_out_frames = 0;   // 累计处理的立体声采样对
+static uint64_t dsp_win_cycles = 0;  // 统计窗口起点的 SRC + EQ 累计周期数
+static uint32_t dsp_win_frames = 0;  // 统计窗口内输出的采样对 (满 1 秒检查一次预算)
+static uint16_t dsp_load = 0;        // 最近一个窗口 SRC + EQ 的 CPU 占用 (千分比)
+static uint8_t dsp_overload = 0;     // 超出预算, EQ 已被强制直通
+
+// --- Spectrum (见 audio_spectrum.h): 对 DMA 正在发送的块做 FFT, 发布给 GUI ---
+static uint32_t spectrum_tick = 0;
+
+// --- Play position: 按 I2S DMA 实际取走的采样计数, 不依赖文件偏移和码率 ---
+// 已发送完的块在 M0/M1 传输完成中断中累加, 正在发送的块由 NDTR 得到已发送的部分
+static volatile uint32_t play_frames = 0;  // DMA 已发送完的环形缓冲块中的采样对 (ISR 中累加)
+static uint32_t queued_frames = 0;         // 已提交到环形缓冲区的采样对
+static uint32_t song_start_frame = 0;      // 当前歌曲第一个采样对在上面两个计数中的位置 (无缝衔接时不为 0)
+static uint32_t song_base_ms = 0;          // 从 song_start_frame 开始播放时的歌曲位置 (定位后不为 0)
+static uint32_t song_duration_ms = 0;      // 解码器给出的总采样数 (MP3 为 Xing/VBRI 帧数), 未知时取曲库索引
+
+// --- Volume: 硬件音量逐级移动到目标值, 避免一次跳变多级 ---
+// 当前值只在本模块中记录, 不从 ES8388 读回 (音量 0 只写静音寄存器, 读回的音量寄存器仍然是 1)
+static uint8_t hp_volume = 0;          // 已写入 ES8388 的耳机音量 (0~33)
+static uint8_t spk_volume = 0;         // 已写入 ES8388 的喇叭音量 (0~33)
+static uint8_t hp_volume_target = 0;   // GUI 设置的目标值
+static uint8_t spk_volume_target = 0;
+static uint8_t volume_tick = 0;
 
 // --- File System Objects ---
-static FATFS fs;
-static FIL musicFile;
-static WAV_Header_TypeDef wavHeader;
-
-// --- MP3 Decoder ---
-static MP3_DecoderHandle mp3Decoder = NULL;
-static uint8_t mp3InBuffer[MP3_INBUF_SIZE] __attribute__((aligned(4)));
-static int16_t mp3OutBuffer[MP3_OUTBUF_SIZE] __attribute__((aligned(4)));
-static int mp3BytesLeft = 0;
-static uint8_t *mp3ReadPtr = NULL;
-static int pcm_offset = 0;     // Offset in mp3OutBuffer for next read (Moved from mp3_fill_buffer)
-static int pcm_available = 0;  // Number of samples available in mp3OutBuffer (Moved from mp3_fill_buffer)
-static MusicSong_Format currentFormat = MUSIC_FORMAT_WAV;
-
-// --- Playlist Data ---
-static MusicSong_TypeDef playlist[MAX_PLAYLIST_SIZE];
-static uint16_t music_count = 0;
+static FATFS fs;  // 文件读取由 stream_reader 预读任务完成
+
+// --- Decoder (WAV/MP3/FLAC/APE, 见 audio_decoder.h) ---
+static const Audio_Decoder *current_decoder = NULL;
+static Audio_Info current_info;
+static uint32_t seek_time_us = 0;     // 最近一次定位耗时 (解码器定位 + 环形缓冲区预填充)
+static uint32_t start_time_us = 0;    // 最近一次切歌到第一个采样送出的时间
+static uint32_t chain_time_us = 0;    // 最近一次无缝衔接打开下一首的耗时 (在 pcm_fill_ring() 中, 解码暂停)
+static uint32_t chain_margin_us = 0;  // 最近一次无缝衔接开始时环形缓冲区中尚未播放的 PCM 时长
+static Player_Entry next_entry;       // 提前解析的下一首, 文件结束时只需打开文件、解析文件头
+static Next_Entry_State next_entry_state = NEXT_ENTRY_NONE;
+
+#if MP3_SELFTEST
+// --- MP3 解码器自检 (见 mp3_selftest.h), 启动时运行一次, 用调试器查看结果 ---
+static MP3_Selftest_Result mp3_selftest_result;
+#endif
+#if AUDIO_SRC_SELFTEST
+// --- 采样率转换自检 (见 audio_src_selftest.h): THD+N 和每个输出采样对的 DWT 周期数 ---
+static Audio_SRC_Selftest_Result src_selftest_result;
+#endif
+
+// --- Playlist (分页读取, 见 music_playlist.h) ---
 static char current_song_name[64] = {0};
-static uint16_t current_song_index = 0;
+static uint32_t current_song_index = 0;
 // --- Control Flags & State ---
 uint8_t isPlaying = 0;
-volatile uint8_t audio_state = 0;
 
 // --- RTOS Objects ---
 static osSemaphoreId_t audio_semHandle = NULL;
@@ -74,12 +145,14 @@ osMessageQueueId_t music_eventQueueHandle = NULL;
 
 /* External variables --------------------------------------------------------*/
 extern I2S_HandleTypeDef hi2s2;
+extern DMA_HandleTypeDef hdma_spi2_tx;
 extern I2C_HandleTypeDef hi2c1;
 
 /* Private function prototypes -----------------------------------------------*/
 static void Bulid_MusicList(void);
-static void music_player_process_wav(void);
-static void music_player_process_mp3(void);
+static void music_player_close_song(void);
+static int music_player_chain_next(void);
+static uint32_t music_player_dma_frames(void);
 
 /* Function implementations --------------------------------------------------*/
 
@@ -96,6 +169,8 @@ void music_player_init(void)
     audio_semHandle = osSemaphoreNew(1, 0, NULL);
     audio_data_queueHandle = osMessageQueueNew(4, sizeof(uint8_t), NULL);
     music_eventQueueHandle = osMessageQueueNew(5, sizeof(Music_Event), NULL);
+    PCM_Ring_Init(&pcm_ring, pcm_pool, PCM_RING_BLOCK_SAMPLES, PCM_RING_BLOCK_COUNT);
+    Audio_Spectrum_Init();
 
     // 初始化ES8388
     if (ES8388_Init(&hi2c1) != 0)
@@ -107,6 +182,8 @@ void music_player_init(void)
     // 设置初始音量 (0-33 范围, 16 约 50%)
     ES8388_SetSpeakerEnable(1);
     ES8388_SetVolume(16);
+    hp_volume = hp_volume_target = ES8388_GetHeadphoneVolume();
+    spk_volume = spk_volume_target = ES8388_GetSpeakerVolume();
 
     // LED闪1次表示ES8388初始化成功
     HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_SET);
@@ -114,21 +191,6 @@ void music_player_init(void)
     HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_RESET);
     HAL_Delay(300);
 
-    // === 初始化 MP3 解码器 ===
-    mp3Decoder = MP3_Decoder_Init();
-    if (!mp3Decoder)
-    {
-        // MP3 解码器初始化失败（可能是 Helix 库未安装）
-        // LED 闪 2 次警告
-        for (int i = 0; i < 2; i++)
-        {
-            HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_SET);
-            HAL_Delay(150);
-            HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_RESET);
-            HAL_Delay(150);
-        }
-    }
-
     // 挂载SD卡
     res = f_mount(&fs, "0:/", 1);
     if (res != FR_OK)
@@ -150,11 +212,40 @@ void music_player_init(void)
         HAL_Delay(200);
     }
 
-    extern DMA_HandleTypeDef hdma_spi2_tx;
-    __HAL_DMA_ENABLE_IT(&hdma_spi2_tx, DMA_IT_TC);
-    __HAL_DMA_ENABLE_IT(&hdma_spi2_tx, DMA_IT_HT);
+#if MP3_SELFTEST
+    // 解码器自检 (没有打开任何歌曲, codec_mem 空闲); LED快闪5次表示校验和不符或解码出错
+    if (MP3_Selftest_Run(&mp3_selftest_result) != MP3_SELFTEST_OK)
+    {
+        for (int i = 0; i < 5; i++)
+        {
+            HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_SET);
+            HAL_Delay(80);
+            HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_RESET);
+            HAL_Delay(80);
+        }
+    }
+#endif
+
+#if AUDIO_SRC_SELFTEST
+    // 采样率转换自检 (还没有开始播放); LED快闪3次表示有用例失败
+    if (Audio_SRC_Selftest_Run(&src_selftest_result) != 0)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_SET);
+            HAL_Delay(80);
+            HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_RESET);
+            HAL_Delay(80);
+        }
+    }
+#endif
+
+    // DMA 中断源在 audio_start_dma() 中按双缓冲模式配置
     HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
 
+    // 文件预读任务 (需要在 f_mount 之后)
+    Stream_Init();
+
     Bulid_MusicList();
 }
 
@@ -166,138 +257,428 @@ void music_player_init(void)
 void music_player_play(const char *filename) {}
 
 /**
- * @brief  Actual audio processing logic (runs in task)
- * @param  filename: Name of the song file to process
+ * @brief  Reset PCM ring and producer state (DMA must be stopped)
+ * @retval None
+ */
+static void pcm_reset(void)
+{
+    PCM_Ring_Reset(&pcm_ring);
+    pcm_write_block = NULL;
+    pcm_write_offset = 0;
+    pcm_eof = 0;
+    pcm_drain_count = 0;
+    src_in_left = 0;
+    play_frames = 0;
+    queued_frames = 0;
+    song_start_frame = 0;
+    song_base_ms = 0;
+    Audio_SRC_Reset();
+    Audio_EQ_Reset();
+
+    // 新的位置从静音渐强开始
+    pcm_fading = 0;
+    Audio_EQ_SetGain(0, 0);
+    Audio_EQ_SetGain(AUDIO_EQ_GAIN_UNITY, output_rate * FADE_MS / 1000);
+}
+
+/**
+ * @brief  Get write pointer inside the block being filled
+ * @retval Write pointer, NULL if the ring is full
+ */
+static int16_t *pcm_get_write_ptr(void)
+{
+    if (!pcm_write_block)
+    {
+        pcm_write_block = PCM_Ring_GetWriteBlock(&pcm_ring);
+        pcm_write_offset = 0;
+        if (!pcm_write_block) return NULL;
+    }
+    return pcm_write_block + pcm_write_offset;
+}
+
+/**
+ * @brief  Account samples written to the current block, commit it when full
+ * @param  samples: Number of samples just written
+ * @param  flush: 1 = 不足一块时补零并立即提交 (文件结束)
  * @retval None
  */
+static void pcm_advance(int samples, uint8_t flush)
+{
+    if (!pcm_write_block) return;
+
+    pcm_write_offset += samples;
+    if (flush && pcm_write_offset > 0 && pcm_write_offset < PCM_RING_BLOCK_SAMPLES)
+    {
+        memset(pcm_write_block + pcm_write_offset, 0,
+               (PCM_RING_BLOCK_SAMPLES - pcm_write_offset) * sizeof(int16_t));
+        pcm_write_offset = PCM_RING_BLOCK_SAMPLES;
+    }
+
+    if (pcm_write_offset >= PCM_RING_BLOCK_SAMPLES)
+    {
+        PCM_Ring_CommitWrite(&pcm_ring);
+        queued_frames += PCM_RING_BLOCK_SAMPLES / 2;
+        pcm_write_block = NULL;
+        pcm_write_offset = 0;
+    }
+}
+
 /**
- * @brief  Fill audio buffer with MP3 decoded data
- * @param  dst: Destination buffer (pointer to int16_t)
- * @param  num_samples: Number of samples to fill
- * @retval Number of samples actually filled
+ * @brief  Produce PCM for the ring at the output rate
+ * @note   直通时解码器直接写入环形缓冲区; 需要转换时解码器写入暂存区, 再由 SRC 转换到环形缓冲区
+ * @param  dst: 当前块的写指针
+ * @param  space: 当前块剩余空间 (采样)
+ * @retval 与 decode_frame() 相同: >0 写入的采样数, 0 暂无输出, <0 AUDIO_DEC_EOF / AUDIO_DEC_NEED_BLOCK
  */
-static int mp3_fill_buffer(int16_t *dst, int num_samples)
+static int pcm_produce(int16_t *dst, uint32_t space)
+{
+    if (Audio_SRC_IsBypass()) return Audio_Decoder_Run(current_decoder, dst, space, current_info.sample_rate);
+
+    if (src_in_left == 0)
+    {
+        int ret = Audio_Decoder_Run(current_decoder, src_in_buf, SRC_IN_SAMPLES, current_info.sample_rate);
+        if (ret <= 0) return ret;
+
+        src_in_ptr = src_in_buf;
+        src_in_left = ret;
+    }
+
+    uint32_t used = src_in_left;
+    uint32_t t0 = DWT_GetCycles();
+    uint32_t out = Audio_SRC_Process(src_in_ptr, &used, dst, space);
+    src_cycles += DWT_GetCycles() - t0;
+    src_out_frames += out / 2;
+
+    src_in_ptr += used;
+    src_in_left -= used;
+    return (int)out;
+}
+
+/**
+ * @brief  Check SRC + EQ load against the decoder headroom once per second of output
+ * @note   解码占用按格式累计 (Audio_Decoder_GetStats), SRC + EQ 按最近一秒统计;
+ *         超出预算时 EQ 直通, 直到用户重新选择预设或低音增强 (不自动恢复, 避免反复开关)
+ * @retval None
+ */
+static void dsp_check_budget(void)
+{
+    Audio_Decoder_Stats stats;
+    uint64_t total = src_cycles + eq_cycles;
+    uint64_t play = (uint64_t)dsp_win_frames * SystemCoreClock / output_rate;
+
+    dsp_load = (uint16_t)((total - dsp_win_cycles) * 1000U / play);
+    dsp_win_cycles = total;
+    dsp_win_frames = 0;
+
+    Audio_Decoder_GetStats(current_decoder->format, &stats);
+    if (!Audio_EQ_IsBypassed() && Audio_EQ_GetActiveBands() > 0 &&
+        stats.load_permille + dsp_load > DSP_BUDGET_PERMILLE)
+    {
+        Audio_EQ_SetBypass(1);
+        dsp_overload = 1;
+    }
+}
+
+/**
+ * @brief  Run the EQ / limiter in place on samples just written to the ring
+ * @param  dst: pcm_produce() 写入的位置
+ * @param  samples: 写入的采样数 (左右声道合计)
+ * @retval None
+ */
+static void pcm_dsp(int16_t *dst, uint32_t samples)
+{
+    uint32_t t0 = DWT_GetCycles();
+    Audio_EQ_Process(dst, samples);
+    eq_cycles += DWT_GetCycles() - t0;
+    eq_out_frames += samples / 2;
+
+    dsp_win_frames += samples / 2;
+    if (output_rate > 0 && dsp_win_frames >= output_rate) dsp_check_budget();
+}
+
+/**
+ * @brief  Select the I2S rate for the opened song and set up the converter
+ * @retval 送给 I2S 的采样率 (SRC 不支持该采样率时为原采样率)
+ */
+static uint32_t music_player_config_output(uint32_t sample_rate)
+{
+#if AUDIO_SRC_ENABLE
+    if (Audio_SRC_Configure(sample_rate) == 0) return AUDIO_SRC_OUT_RATE;
+#endif
+    return sample_rate;
+}
+
+/**
+ * @brief  Decode ahead until the PCM ring is full or the file ends
+ * @param  max_frames: 本次最多输出的帧数 (避免长时间不响应控制事件)
+ * @retval None
+ */
+static void pcm_fill_ring(int max_frames)
 {
-    int samples_filled = 0;
     int loop_guard = 0;
 
-    while (samples_filled < num_samples)
+    if (!current_decoder) return;
+
+    while (!pcm_eof && max_frames > 0 && PCM_Ring_GetFree(&pcm_ring) > 0)
     {
         // Watchdog: Avoid infinite loop on corrupted files
-        if (++loop_guard > 500) return samples_filled;
+        if (++loop_guard > 500) break;
 
-        // 1. If we have decoded data available, copy it
-        if (pcm_available > 0)
+        // 渐弱已经写完: 后面的数据都是静音, 不再解码, 像文件结束一样让 DMA 排空
+        if (pcm_fading && !Audio_EQ_IsRamping())
         {
-            int to_copy =
-                (pcm_available < (num_samples - samples_filled)) ? pcm_available : (num_samples - samples_filled);
-            memcpy(dst + samples_filled, mp3OutBuffer + pcm_offset, to_copy * sizeof(int16_t));
+            pcm_advance(0, 1);
+            pcm_eof = 1;
+            break;
+        }
+
+        int16_t *dst = pcm_get_write_ptr();
+        if (!dst) break;
 
-            samples_filled += to_copy;
-            pcm_offset += to_copy;
-            pcm_available -= to_copy;
+        // 解码器 (或 SRC) 直接写入当前块的剩余空间
+        int ret = pcm_produce(dst, PCM_RING_BLOCK_SAMPLES - pcm_write_offset);
+        if (ret > 0)
+        {
+            pcm_dsp(dst, ret);
+            pcm_advance(ret, 0);
+            max_frames--;
         }
-        else
+        else if (ret == AUDIO_DEC_NEED_BLOCK)
         {
-            // 2. Decode next frame
-            // Refill input buffer if needed (参考正点原子: bytesleft < MAINBUF_SIZE * 2)
-            // MAINBUF_SIZE = 1940, so threshold ≈ 3880. We use 2000 for safety.
-            if (mp3BytesLeft < 2000)
-            {
-                // Move remaining data to beginning
-                memmove(mp3InBuffer, mp3ReadPtr, mp3BytesLeft);
-                mp3ReadPtr = mp3InBuffer;
+            pcm_advance(0, 1);  // 剩余空间放不下一帧: 补零提交, 下一帧写入新块
+        }
+        else if (ret < 0)
+        {
+            // 文件结束: 预先打开下一首, 采样率相同时在采样边界处无缝衔接
+            if (music_player_chain_next()) continue;
 
-                // Read more data
-                UINT br;
-                f_read(&musicFile, mp3InBuffer + mp3BytesLeft, MP3_INBUF_SIZE - mp3BytesLeft, &br);
-                mp3BytesLeft += br;
+            pcm_advance(0, 1);  // 提交最后一个不完整的块
+            pcm_eof = 1;
+        }
+    }
+}
 
-                if (br == 0 && mp3BytesLeft == 0) return samples_filled;  // End of file
-            }
+/**
+ * @brief  Pick the block DMA should send after the ones it already holds
+ * @param  target: 0 = M0AR, 1 = M1AR
+ * @note   Called from the DMA callbacks (ISR context) and before DMA start
+ * @retval Block address for the memory target
+ */
+static const int16_t *audio_dma_next_block(uint8_t target)
+{
+    // 另一个目标如果持有环形缓冲块, 它就是最早提交的那一块, 新的块排在它后面
+    uint16_t held = dma_target_owned[target ^ 1];
+    const int16_t *block = PCM_Ring_PeekReadBlock(&pcm_ring, held);
 
-            // Decode
-            MP3_FrameInfo frameInfo;
-            MP3_Error err = MP3_Decoder_DecodeFrame(mp3Decoder, &mp3ReadPtr, &mp3BytesLeft, mp3OutBuffer, &frameInfo);
+    if (block)
+    {
+        dma_target_owned[target] = 1;
+        return block;
+    }
 
-            if (err == MP3_OK)
-            {
-                pcm_offset = 0;
-                pcm_available = frameInfo.outputSamps;
-            }
-            else if (err == MP3_ERR_INDATA_UNDERFLOW || err == MP3_ERR_MAINDATA_UNDERFLOW)
-            {
-                // 数据不足，需要更多数据 - 强制触发 refill
-                // 不跳过数据，只是让下一次迭代读取更多
-                if (mp3BytesLeft > 0)
-                {
-                    memmove(mp3InBuffer, mp3ReadPtr, mp3BytesLeft);
-                    mp3ReadPtr = mp3InBuffer;
-
-                    UINT br;
-                    f_read(&musicFile, mp3InBuffer + mp3BytesLeft, MP3_INBUF_SIZE - mp3BytesLeft, &br);
-                    mp3BytesLeft += br;
-
-                    if (br == 0) return samples_filled;  // EOF
-                }
-                else
-                {
-                    return samples_filled;  // EOF
-                }
-            }
-            else
-            {
-                // 其他错误: 跳过损坏数据
-                if (mp3BytesLeft > 0)
-                {
-                    int offset = MP3_FindSyncWord(mp3ReadPtr + 1, mp3BytesLeft - 1);
-                    if (offset >= 0)
-                    {
-                        mp3ReadPtr += (offset + 1);
-                        mp3BytesLeft -= (offset + 1);
-                    }
-                    else
-                    {
-                        mp3BytesLeft = 0;
-                    }
-                }
-                else
-                {
-                    return samples_filled;  // EOF
-                }
-            }
-        }
+    // 没有数据: 发送静音. 文件未结束时记为欠载, 否则记录排空进度
+    dma_target_owned[target] = 0;
+    if (pcm_eof)
+    {
+        pcm_drain_count++;
     }
-    return samples_filled;
+    else
+    {
+        PCM_Ring_MarkUnderrun(&pcm_ring);
+    }
+    return pcm_silence;
 }
 
-static void music_player_process_wav(void)
+/**
+ * @brief  Memory target finished: release its block and queue the next one
+ * @param  target: 0 = M0AR, 1 = M1AR (DMA 已切换到另一个目标)
+ * @retval None
+ */
+static void audio_dma_target_done(uint8_t target)
 {
-    FRESULT res;
-    UINT bytesRead;
-    char music_full_name[128];
+    if (dma_target_owned[target])
+    {
+        PCM_Ring_ReleaseRead(&pcm_ring);
+        dma_target_owned[target] = 0;
+        play_frames += PCM_RING_BLOCK_SAMPLES / 2;
+    }
 
-    snprintf(music_full_name, sizeof(music_full_name), "0:/music/%s", playlist[current_song_index].name);
+    const int16_t *block = audio_dma_next_block(target);
+    if (target == 0)
+    {
+        hdma_spi2_tx.Instance->M0AR = (uint32_t)block;
+    }
+    else
+    {
+        hdma_spi2_tx.Instance->M1AR = (uint32_t)block;
+    }
 
-    res = f_open(&musicFile, music_full_name, FA_READ);
-    if (res != FR_OK) return;
+    osSemaphoreRelease(audio_semHandle);
+}
+
+static void audio_dma_m0_cplt(DMA_HandleTypeDef *hdma)
+{
+    audio_dma_target_done(0);
+}
 
-    res = f_read(&musicFile, &wavHeader, sizeof(wavHeader), &bytesRead);
-    if (res != FR_OK || strncmp(wavHeader.Format, "WAVE", 4) != 0)
+static void audio_dma_m1_cplt(DMA_HandleTypeDef *hdma)
+{
+    audio_dma_target_done(1);
+}
+
+static void audio_dma_error(DMA_HandleTypeDef *hdma)
+{
+    // FIFO 错误等非致命错误不处理, 下一个传输完成中断会继续推进
+}
+
+/**
+ * @brief  Decode the first blocks and start I2S with DMA double-buffer mode
+ * @note   HAL 的 I2S 驱动不支持双缓冲, 这里直接启动 DMA 并按 HAL_I2S_Transmit_DMA 的方式使能 I2S
+ * @retval HAL status
+ */
+static HAL_StatusTypeDef audio_start_dma(void)
+{
+    // 不等整个环形缓冲区填满: M0/M1 各有一块真实数据即可启动 (MP3 即解码两帧), 缩短首个采样的等待时间
+    for (int guard = 0; !pcm_eof && PCM_Ring_GetFill(&pcm_ring) < PCM_START_BLOCKS && guard < 64; guard++)
     {
-        f_close(&musicFile);
-        return;
+        pcm_fill_ring(1);
+    }
+
+    dma_target_owned[0] = 0;
+    dma_target_owned[1] = 0;
+    const int16_t *m0 = audio_dma_next_block(0);
+    const int16_t *m1 = audio_dma_next_block(1);
+
+    hdma_spi2_tx.XferCpltCallback = audio_dma_m0_cplt;
+    hdma_spi2_tx.XferM1CpltCallback = audio_dma_m1_cplt;
+    hdma_spi2_tx.XferErrorCallback = audio_dma_error;
+    hdma_spi2_tx.XferHalfCpltCallback = NULL;
+    hdma_spi2_tx.XferM1HalfCpltCallback = NULL;
+    __HAL_DMA_DISABLE_IT(&hdma_spi2_tx, DMA_IT_HT);  // 双缓冲模式只需要传输完成中断
+
+    if (HAL_DMAEx_MultiBufferStart_IT(&hdma_spi2_tx, (uint32_t)m0, (uint32_t)&hi2s2.Instance->DR, (uint32_t)m1,
+                                      PCM_RING_BLOCK_SAMPLES) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+
+    hi2s2.State = HAL_I2S_STATE_BUSY_TX;  // 让 HAL_I2S_DMAPause/Resume/Stop 正常工作
+    SET_BIT(hi2s2.Instance->CR2, SPI_CR2_TXDMAEN);
+    __HAL_I2S_ENABLE(&hi2s2);
+
+    return HAL_OK;
+}
+
+/**
+ * @brief  Take the duration of the opened song from the decoder, or from the library index
+ * @param  index_ms: 曲库索引中的时长 (0 表示未知)
+ * @retval None
+ */
+static void music_player_update_duration(uint32_t index_ms)
+{
+    if (current_info.total_samples > 0 && current_info.sample_rate > 0)
+    {
+        song_duration_ms = (uint32_t)((uint64_t)current_info.total_samples * 1000U / current_info.sample_rate);
+    }
+    else
+    {
+        song_duration_ms = index_ms;
     }
+}
 
-    hi2s2.Init.AudioFreq = wavHeader.SampleRate;
-    HAL_I2S_Init(&hi2s2);
+/**
+ * @brief  Read a playlist entry's path and index duration (不打开文件)
+ * @param  index: 播放列表序号
+ * @retval 0: 成功, -1: 播放列表或曲库索引读取失败
+ */
+static int music_player_resolve_song(uint32_t index, Player_Entry *e)
+{
+    uint32_t root_len = sizeof(MUSIC_LIBRARY_ROOT);  // 包括 '/'
+    Music_Index_Track track;
+
+    if (Music_Playlist_Get(index, &e->song) != 0) return -1;
+    memcpy(e->path, MUSIC_LIBRARY_ROOT "/", root_len);
+    if (Music_Library_GetPath(e->song.id, e->path + root_len, sizeof(e->path) - root_len) != 0) return -1;
+    e->index_duration_ms = (Music_Library_ReadTrack(e->song.id, &track) == 0) ? track.duration_ms : 0;
+    e->index = index;
+    return 0;
+}
 
-    // Initial fill (读取 AUDIO_BUFFER_SIZE * 2 字节 = 填满整个缓冲区)
-    f_read(&musicFile, audio_buffer, AUDIO_BUFFER_SIZE * 2, &bytesRead);
+/**
+ * @brief  Open a resolved entry and its decoder (I2S/DMA are not touched)
+ * @retval 0: 成功, -1: 打开失败 (文件已关闭)
+ */
+static int music_player_open_entry(const Player_Entry *e)
+{
+    uint8_t header[16];
+
+    Music_Cover_Request(e->song.id);  // 标签和封面由封面任务在后台读取
+    if (Stream_Open(e->path) != FR_OK) return -1;
+
+    // 优先按扩展名选择解码器, 文件头不符时再按文件头识别
+    current_decoder = Audio_Decoder_Get(e->song.format);
+    uint32_t len = Stream_Read(header, sizeof(header));
+    if (!current_decoder || !current_decoder->probe(header, len))
+    {
+        current_decoder = Audio_Decoder_Probe(header, len);
+    }
+    Stream_Seek(0);
 
-    if (HAL_I2S_Transmit_DMA(&hi2s2, audio_buffer, AUDIO_BUFFER_SIZE) != HAL_OK)
+    // 解码器内部缓冲区从 CCM 重新分配
+    Codec_Mem_Reset();
+    Audio_Decoder_ResetChecksum();
+    if (!current_decoder || current_decoder->open(&current_info) != 0)
     {
-        f_close(&musicFile);
+        music_player_close_song();
+        return -1;
+    }
+
+    output_rate = music_player_config_output(current_info.sample_rate);
+    music_player_update_duration(e->index_duration_ms);
+    dsp_win_frames = 0;
+    dsp_win_cycles = src_cycles + eq_cycles;
+    current_song_index = e->index;
+    memcpy(current_song_name, e->song.name, sizeof(current_song_name));
+    return 0;
+}
+
+/**
+ * @brief  Open a playlist entry and its decoder (I2S/DMA are not touched)
+ * @param  index: 播放列表序号
+ * @retval 0: 成功, -1: 打开失败 (文件已关闭)
+ */
+static int music_player_load_song(uint32_t index)
+{
+    Player_Entry e;
+
+    if (music_player_resolve_song(index, &e) != 0) return -1;
+    return music_player_open_entry(&e);
+}
+
+/**
+ * @brief  Configure I2S for the opened song, prefill the ring and start DMA
+ * @retval None
+ */
+static void music_player_start_output(void)
+{
+    // 采样率不变 (开启 SRC 时总是 48kHz) 时不重新初始化, 也就不会重新锁定 PLLI2S
+    // PLLI2S 只在 HAL_I2S_MspInit() 中按 AudioFreq 配置, 所以采样率变化时先 DeInit
+    if (output_rate != i2s_rate)
+    {
+        HAL_I2S_DeInit(&hi2s2);
+        hi2s2.Init.AudioFreq = output_rate;
+        HAL_I2S_Init(&hi2s2);
+        i2s_rate = output_rate;
+    }
+
+    Audio_EQ_SetSampleRate(output_rate);
+    pcm_reset();
+    if (audio_start_dma() != HAL_OK)
+    {
+        music_player_close_song();
+        taskENTER_CRITICAL();
+        isPlaying = 0;
+        taskEXIT_CRITICAL();
         return;
     }
 
@@ -309,133 +690,177 @@ static void music_player_process_wav(void)
     taskEXIT_CRITICAL();
 }
 
-static void music_player_process_mp3(void)
+/**
+ * @brief  Open the current song, pick its decoder and start I2S
+ * @retval None
+ */
+static void music_player_open_song(void)
 {
-    FRESULT res;
-    UINT br;
-    char music_full_name[128];
-
-    snprintf(music_full_name, sizeof(music_full_name), "0:/music/%s", playlist[current_song_index].name);
+    if (music_player_load_song(current_song_index) != 0) return;
+    music_player_start_output();
+}
 
-    res = f_open(&musicFile, music_full_name, FA_READ);
-    if (res != FR_OK) return;
+/**
+ * @brief  Resolve the next playlist entry shortly before the current song ends
+ * @note   在 music_player_update() 中、环形缓冲区刚填满之后调用: 播放列表和曲库索引的读取
+ *         不占用文件结束时的衔接时间。时长未知时在歌曲开始后立即解析。
+ *         文件结束时下一首的序号不同 (期间切换了随机或循环模式) 则不使用, 按原来的方式打开
+ * @retval None
+ */
+static void music_player_prepare_next(void)
+{
+    if (next_entry_state != NEXT_ENTRY_NONE || pcm_eof) return;
+    if (song_duration_ms > 0 && music_player_get_position_ms() + CHAIN_PREPARE_MS < song_duration_ms) return;
 
-    // 重置解码器以清除旧状态
-    if (mp3Decoder)
+    uint32_t next = Music_Playlist_Next(current_song_index, 0);
+    if (next != MUSIC_PLAYLIST_NONE && music_player_resolve_song(next, &next_entry) == 0)
     {
-        MP3_Decoder_Free(mp3Decoder);
+        next_entry_state = NEXT_ENTRY_READY;
     }
-    mp3Decoder = MP3_Decoder_Init();
-    if (!mp3Decoder)
+    else
     {
-        f_close(&musicFile);
-        return;
+        next_entry_state = NEXT_ENTRY_FAILED;
     }
+}
 
-    // Reset MP3 state variables
-    pcm_offset = 0;
-    pcm_available = 0;
-
-    // init mp3 state
-    mp3BytesLeft = 0;
-    mp3ReadPtr = mp3InBuffer;
-
-    // Skip ID3
-    MP3_SkipID3Tag(&musicFile);
-
-    // Fill input buffer
-    f_read(&musicFile, mp3InBuffer, MP3_INBUF_SIZE, &br);
-    mp3BytesLeft = br;
-    mp3ReadPtr = mp3InBuffer;
+/**
+ * @brief  Open the next playlist entry when the current decoder reaches the end of its file
+ * @note   在 pcm_fill_ring() 中调用, 此时只剩环形缓冲区里当前歌曲的最后几块在播放:
+ *         4 块共 4608 个采样对, 48kHz 时约 96ms, 减去 DMA 正在发送的部分, 一般有 50~90ms。
+ *         播放列表项已由 music_player_prepare_next() 提前读出, 这里只打开文件、解析文件头;
+ *         实际耗时和余量记录在 chain_time_us / chain_margin_us, 耗时超过余量时会有一段欠载静音。
+ *         打开失败时跳过该首继续尝试后面的歌曲 (最多 CHAIN_SKIP_MAX 首), 不停止播放。
+ *         输出采样率相同时下一首的 PCM 紧接着写入同一块, I2S 不停止 (开启 SRC 后不同采样率的歌曲也是如此);
+ *         输出采样率不同时等当前歌曲排空后再按新采样率重启 I2S (见 music_player_update)
+ * @retval 1: 已无缝衔接, 继续解码; 0: 没有衔接 (最后一首、全部打开失败或需要重新配置 I2S)
+ */
+static int music_player_chain_next(void)
+{
+    uint32_t t0 = DWT_GetCycles();
+    uint32_t pending = queued_frames + pcm_write_offset / 2 - music_player_dma_frames();
+    uint32_t margin_us = output_rate ? (uint32_t)((uint64_t)pending * 1000000U / output_rate) : 0;
+    int opened = 0;
 
-    // Find valid frame to get info
-    MP3_FrameInfo frameInfo;
-    int retries = 0;
-    const int MAX_RETRIES = 100;  // 防止无限循环
+    // 随机播放和循环模式由播放列表决定下一首, 单曲循环时重新打开同一首
+    uint32_t next = Music_Playlist_Next(current_song_index, 0);
+    if (next == MUSIC_PLAYLIST_NONE) return 0;
 
-    // Decode until we get a valid frame or run out
-    while (retries < MAX_RETRIES)
+    music_player_close_song();
+    for (int i = 0; i < CHAIN_SKIP_MAX && next != MUSIC_PLAYLIST_NONE; i++)
     {
-        int offset = MP3_FindSyncWord(mp3ReadPtr, mp3BytesLeft);
-        if (offset < 0)
+        if (next_entry_state == NEXT_ENTRY_READY && next_entry.index == next)
         {
-            // Refill
-            memmove(mp3InBuffer, mp3ReadPtr, mp3BytesLeft);
-            mp3ReadPtr = mp3InBuffer;
-            f_read(&musicFile, mp3InBuffer + mp3BytesLeft, MP3_INBUF_SIZE - mp3BytesLeft, &br);
-            if (br == 0)
-            {
-                f_close(&musicFile);
-                return;
-            }  // EOF
-            mp3BytesLeft += br;
-            retries++;
-            continue;
-        }
-        mp3ReadPtr += offset;
-        mp3BytesLeft -= offset;
-
-        MP3_Error err = MP3_Decoder_DecodeFrame(mp3Decoder, &mp3ReadPtr, &mp3BytesLeft, mp3OutBuffer, &frameInfo);
-        if (err == MP3_OK)
-        {
-            // Valid frame found
-            break;
+            opened = (music_player_open_entry(&next_entry) == 0);
         }
         else
         {
-            // 解码失败，跳过一个字节继续寻找
-            if (mp3BytesLeft > 0)
-            {
-                mp3ReadPtr++;
-                mp3BytesLeft--;
-            }
-            retries++;
+            opened = (music_player_load_song(next) == 0);
         }
+        next_entry_state = NEXT_ENTRY_NONE;
+        if (opened) break;
+
+        // 跳过打不开的歌曲; 单曲循环时下一首还是它自己, 不再重试
+        uint32_t after = Music_Playlist_Next(next, 0);
+        next = (after == next) ? MUSIC_PLAYLIST_NONE : after;
     }
+    if (!opened) return 0;
 
-    // 如果超过最大重试次数，放弃
-    if (retries >= MAX_RETRIES)
+    chain_time_us = DWT_CyclesToUs(DWT_GetCycles() - t0);
+    chain_margin_us = margin_us;
+    if (output_rate == i2s_rate)
     {
-        f_close(&musicFile);
-        return;
+        // 下一首从当前块已写入的部分之后开始
+        song_start_frame = queued_frames + pcm_write_offset / 2;
+        song_base_ms = 0;
+        return 1;
     }
 
-    // Init I2S
-    hi2s2.Init.AudioFreq = frameInfo.sampleRate;
-    HAL_I2S_Init(&hi2s2);
+    next_song_ready = 1;
+    return 0;
+}
 
-    // 重新定位文件到 ID3 标签之后，重新开始解码
-    f_lseek(&musicFile, 0);
-    MP3_SkipID3Tag(&musicFile);
+/**
+ * @brief  Fade the output to silence and wait until the fade has been played
+ * @note   增益在填充环形缓冲区时作用, 所以渐弱要等缓冲区中已有的数据播完才能听到 (最多约 4 块);
+ *         渐弱结束后停止解码, DMA 排空后返回, 此时 I2S 正在发送静音块, 可以直接暂停或停止。
+ *         渐弱所在的那一次解码输出中, 增益为 0 之后的部分会被丢弃 (恢复播放时最多跳过一帧)
+ * @retval None
+ */
+static void music_player_fade_out(void)
+{
+    if (!isPlaying || !current_decoder) return;
 
-    // 重新初始化解码器以清除 bit reservoir 状态
-    if (mp3Decoder)
+    Audio_EQ_SetGain(0, output_rate * FADE_MS / 1000);
+    pcm_fading = 1;
+    for (int i = 0; i < FADE_TIMEOUT_TICKS && !(pcm_eof && pcm_drain_count >= 2); i++)
     {
-        MP3_Decoder_Free(mp3Decoder);
+        pcm_fill_ring(1);
+        osSemaphoreAcquire(audio_semHandle, 10);
     }
-    mp3Decoder = MP3_Decoder_Init();
-    if (!mp3Decoder)
+    pcm_fading = 0;
+}
+
+/**
+ * @brief  Move each hardware volume one register step towards its target
+ * @note   ES8388 输出音量寄存器每级 1.5dB, 一次跳多级会有明显的台阶声;
+ *         这里每 VOLUME_STEP_TICKS 次 music_player_update() 只移动一级。
+ *         当前值与目标相同时不访问 I2C
+ * @retval None
+ */
+static void music_player_volume_step(void)
+{
+    uint8_t hp_target = hp_volume_target;  // GUI 任务可能同时修改, 各读一次
+    uint8_t spk_target = spk_volume_target;
+
+    if (hp_volume == hp_target && spk_volume == spk_target)
     {
-        f_close(&musicFile);
+        volume_tick = 0;
         return;
     }
+    if (++volume_tick < VOLUME_STEP_TICKS) return;
+    volume_tick = 0;
 
-    // 重置 MP3 缓冲区状态
-    mp3BytesLeft = 0;
-    mp3ReadPtr = mp3InBuffer;
-    pcm_offset = 0;
-    pcm_available = 0;
+    if (hp_volume != hp_target)
+    {
+        hp_volume = (hp_volume < hp_target) ? hp_volume + 1 : hp_volume - 1;
+        ES8388_SetVolume(hp_volume);
+    }
+    if (spk_volume != spk_target)
+    {
+        spk_volume = (spk_volume < spk_target) ? spk_volume + 1 : spk_volume - 1;
+        ES8388_SetSpeakerVol(spk_volume);
+    }
+}
 
-    // Pre-fill buffer
-    mp3_fill_buffer((int16_t *)audio_buffer, AUDIO_BUFFER_SIZE);
+/**
+ * @brief  Analyze the block being played and publish the spectrum (at most AUDIO_SPECTRUM_MAX_FPS per second)
+ * @note   最早提交的块就是 DMA 正在发送 (或下一个发送) 的块, 释放前生产者 (本任务) 不会改写它;
+ *         GUI 通过 Audio_Spectrum_Read() 读取双缓冲结果, 不与本任务同步
+ * @retval None
+ */
+static void music_player_spectrum_update(void)
+{
+    uint32_t now = osKernelGetTickCount();
+    if (now - spectrum_tick < 1000U / AUDIO_SPECTRUM_MAX_FPS) return;
+    spectrum_tick = now;
 
-    // Start DMA
-    HAL_I2S_Transmit_DMA(&hi2s2, audio_buffer, AUDIO_BUFFER_SIZE);
+    const int16_t *block = PCM_Ring_PeekReadBlock(&pcm_ring, 0);
+    if (block) Audio_Spectrum_Analyze(block, PCM_RING_BLOCK_SAMPLES / 2, output_rate);
+}
 
-    HAL_GPIO_WritePin(GPIOF, GPIO_PIN_9, GPIO_PIN_SET);
-    taskENTER_CRITICAL();
-    isPlaying = 1;
-    taskEXIT_CRITICAL();
+/**
+ * @brief  Release the decoder and the file
+ * @retval None
+ */
+static void music_player_close_song(void)
+{
+    next_song_ready = 0;
+    if (current_decoder)
+    {
+        current_decoder->close();
+        current_decoder = NULL;
+    }
+    Stream_Close();
 }
 
 /**
@@ -443,67 +868,289 @@ static void music_player_process_mp3(void)
  */
 void music_player_process_song()
 {
-    // Stop previous
-    if (isPlaying)
+    uint32_t t0 = DWT_GetCycles();
+
+    // 正在播放时先渐弱, 避免在波形中间截断产生爆音
+    music_player_fade_out();
+
+    // Stop previous (暂停状态下 DMA 仍然占用 I2S, 同样需要停止)
+    // HAL_I2S_DMAStop() 会等待最后一个半字移出, 不需要再额外延时
+    if (isPlaying || hi2s2.State != HAL_I2S_STATE_READY)
     {
         isPlaying = 0;
         HAL_I2S_DMAStop(&hi2s2);
-        f_close(&musicFile);
-        osDelay(10);
     }
+    music_player_close_song();
+    next_entry_state = NEXT_ENTRY_NONE;
 
-    // Determine format
     current_song_index = music_player_get_currentIndex();
-    if (playlist[current_song_index].format == MUSIC_FORMAT_WAV)
+    music_player_open_song();
+    if (isPlaying) start_time_us = DWT_CyclesToUs(DWT_GetCycles() - t0);
+}
+
+void music_player_update(void)
+{
+    music_player_volume_step();
+
+    if (isPlaying)
     {
-        currentFormat = MUSIC_FORMAT_WAV;
-        music_player_process_wav();
+        // 1. 尽可能提前解码, 直到环形缓冲区写满
+        pcm_fill_ring(PCM_RING_BLOCK_COUNT);
+        music_player_spectrum_update();
+        music_player_prepare_next();
+
+        // 2. 文件已结束, 且最后一块数据已经由 DMA 播放完毕
+        if (pcm_eof && pcm_drain_count >= 2)
+        {
+            if (next_song_ready)
+            {
+                // 下一首已经打开, 按新采样率重启 I2S
+                next_song_ready = 0;
+                HAL_I2S_DMAStop(&hi2s2);
+                music_player_start_output();
+                return;
+            }
+            music_player_stop();
+            return;
+        }
     }
-    else
+
+    // 3. 等待 DMA 取走一块 (超时后返回, 以便处理控制事件)
+    osSemaphoreAcquire(audio_semHandle, 10);
+}
+
+/**
+ * @brief  Seek to a sample position inside the current song (runs in AudioTask)
+ * @param  sample: 目标采样 (每声道计数)
+ * @retval None
+ */
+static void music_player_seek_sample(uint32_t sample)
+{
+    uint8_t wasPlaying = isPlaying;
+    music_player_fade_out();
+    taskENTER_CRITICAL();
+    isPlaying = 0;
+    taskEXIT_CRITICAL();
+    HAL_I2S_DMAStop(&hi2s2);
+
+    uint32_t t0 = DWT_GetCycles();
+    if (current_decoder->seek(sample) != 0)
     {
-        currentFormat = MUSIC_FORMAT_MP3;
-        music_player_process_mp3();
+        music_player_stop();
+        return;
     }
+
+    // 丢弃旧位置的 PCM, 从新位置重新解码
+    pcm_reset();
+    song_base_ms = (uint32_t)((uint64_t)sample * 1000U / current_info.sample_rate);
+    if (audio_start_dma() != HAL_OK)
+    {
+        music_player_stop();
+        return;
+    }
+    seek_time_us = DWT_CyclesToUs(DWT_GetCycles() - t0);
+    if (!wasPlaying) HAL_I2S_DMAPause(&hi2s2);
+
+    taskENTER_CRITICAL();
+    isPlaying = wasPlaying;
+    taskEXIT_CRITICAL();
 }
 
-void music_player_update(void)
+/**
+ * @brief  Seek inside the current song (runs in AudioTask)
+ * @param  percent: 目标位置 0~100
+ * @retval None
+ */
+void music_player_seek(uint8_t percent)
 {
-    UINT bytesRead;
+    if (!current_decoder || current_info.total_samples == 0) return;
+    if (percent > 100) percent = 100;
+
+    music_player_seek_sample((uint32_t)((uint64_t)current_info.total_samples * percent / 100U));
+}
 
-    if (osSemaphoreAcquire(audio_semHandle, 10) == osOK)
+/**
+ * @brief  Seek to a time position inside the current song (runs in AudioTask)
+ * @param  ms: 目标位置 (毫秒)
+ * @retval None
+ */
+void music_player_seek_ms(uint32_t ms)
+{
+    if (!current_decoder || current_info.sample_rate == 0) return;
+
+    uint32_t sample = (uint32_t)((uint64_t)ms * current_info.sample_rate / 1000U);
+    if (current_info.total_samples > 0 && sample > current_info.total_samples) sample = current_info.total_samples;
+    music_player_seek_sample(sample);
+}
+
+/**
+ * @brief  Output frames the I2S DMA has taken since the last reset
+ * @note   DMA 双缓冲模式下 M0/M1 的传输完成中断相当于半传输 / 全传输中断, 中断里累加整块;
+ *         当前目标 (CR.CT) 正在发送环形缓冲块时再加上 NDTR 已经走过的部分 (NDTR 以半字计, 即采样数)。
+ *         读取期间目标切换 (中断还没执行或刚刚执行) 时重读, 保证计数与 NDTR 属于同一块
+ * @retval Stereo frames
+ */
+static uint32_t music_player_dma_frames(void)
+{
+    DMA_Stream_TypeDef *stream = hdma_spi2_tx.Instance;
+    uint32_t frames, cr, left;
+
+    do
     {
-        int16_t *target_buffer = NULL;
+        frames = play_frames;
+        cr = stream->CR;
+        left = stream->NDTR;
+    } while (frames != play_frames || ((cr ^ stream->CR) & DMA_SxCR_CT));
 
-        if (audio_state == 1)
-        {
-            target_buffer = (int16_t *)audio_buffer;
-            audio_state = 0;
-        }
-        else if (audio_state == 2)
-        {
-            target_buffer = (int16_t *)&audio_buffer[AUDIO_BUFFER_SIZE / 2];
-            audio_state = 0;
-        }
+    uint8_t target = (cr & DMA_SxCR_CT) ? 1 : 0;
+    if ((cr & DMA_SxCR_EN) && dma_target_owned[target] && left <= PCM_RING_BLOCK_SAMPLES)
+    {
+        frames += (PCM_RING_BLOCK_SAMPLES - left) / 2;
+    }
+    return frames;
+}
 
-        if (target_buffer)
-        {
-            // 每次回调填充半个缓冲区 = AUDIO_BUFFER_SIZE / 2 个采样
-            int half_buffer_samples = AUDIO_BUFFER_SIZE / 2;
+/**
+ * @brief  Position of the current song, counted from the samples the I2S DMA has sent
+ * @note   按输出采样率换算 (开启 SRC 时与歌曲采样率不同), 定位后从目标位置继续计数;
+ *         暂停时 DMA 停止, 位置随之停止。无缝衔接时下一首在上一首排空之前就已打开, 这段时间返回下一首的起点
+ * @retval Milliseconds
+ */
+uint32_t music_player_get_position_ms(void)
+{
+    uint32_t played, start, base, rate, duration;
 
-            if (currentFormat == MUSIC_FORMAT_WAV)
-            {
-                // WAV: 读取 half_buffer_samples * 2 字节
-                f_read(&musicFile, target_buffer, half_buffer_samples * sizeof(int16_t), &bytesRead);
-                if (bytesRead < half_buffer_samples * sizeof(int16_t)) music_player_stop();
-            }
-            else
-            {
-                // MP3: 填充半个缓冲区的采样
-                int filled = mp3_fill_buffer(target_buffer, half_buffer_samples);
-                if (filled < half_buffer_samples) music_player_stop();
-            }
-        }
+    taskENTER_CRITICAL();
+    start = song_start_frame;
+    base = song_base_ms;
+    rate = output_rate;
+    duration = song_duration_ms;
+    taskEXIT_CRITICAL();
+
+    played = music_player_dma_frames() - start;
+    if ((int32_t)played < 0) played = 0;
+    if (rate == 0) return base;
+
+    uint32_t ms = base + (uint32_t)((uint64_t)played * 1000U / rate);
+    // 最后一块补零的部分不计入
+    if (duration > 0 && ms > duration) ms = duration;
+    return ms;
+}
+
+/**
+ * @brief  Duration of the current song
+ * @retval Milliseconds, 0 when unknown
+ */
+uint32_t music_player_get_duration_ms(void)
+{
+    return song_duration_ms;
+}
+
+/**
+ * @brief  Time spent by the last seek (decoder seek + ring prefill)
+ * @retval Microseconds
+ */
+uint32_t music_player_get_seek_time_us(void)
+{
+    return seek_time_us;
+}
+
+/**
+ * @brief  Time from a track change request to the first sample sent to I2S
+ * @note   包括停止上一首、打开文件、解析文件头和解码前两块, 不包括 GUI 消息队列的延迟
+ * @retval Microseconds
+ */
+uint32_t music_player_get_start_time_us(void)
+{
+    return start_time_us;
+}
+
+/**
+ * @brief  Time the last gapless chain spent opening the next song, and the PCM left to cover it
+ * @param  margin_us: 输出衔接开始时环形缓冲区中尚未播放的时长 (可为 NULL); 耗时大于它时出现欠载
+ * @retval Microseconds, 0 before the first chain
+ */
+uint32_t music_player_get_chain_time_us(uint32_t *margin_us)
+{
+    if (margin_us) *margin_us = chain_margin_us;
+    return chain_time_us;
+}
+
+/**
+ * @brief  Average cost of the sample rate converter
+ * @retval 每个输出采样对 (左右声道) 的 CPU 周期数, 直通或尚未转换时为 0
+ */
+uint32_t music_player_get_src_cycles(void)
+{
+    if (src_out_frames == 0) return 0;
+    return (uint32_t)(src_cycles / src_out_frames);
+}
+
+/**
+ * @brief  Select an EQ preset (runs in AudioTask)
+ * @note   重新选择时解除预算保护的直通, 按新设置重新统计
+ * @param  preset: Audio_EQ_Preset
+ * @retval None
+ */
+void music_player_set_eq_preset(uint8_t preset)
+{
+    Audio_EQ_SetPreset((Audio_EQ_Preset)preset);
+    Audio_EQ_SetBypass(0);
+    dsp_overload = 0;
+}
+
+/**
+ * @brief  Set bass boost (runs in AudioTask)
+ * @param  db: 0 ~ AUDIO_EQ_MAX_BASS_DB
+ * @retval None
+ */
+void music_player_set_bass_boost(uint8_t db)
+{
+    Audio_EQ_SetBassBoost(db);
+    Audio_EQ_SetBypass(0);
+    dsp_overload = 0;
+}
+
+uint8_t music_player_get_eq_preset(void)
+{
+    return (uint8_t)Audio_EQ_GetPreset();
+}
+
+uint8_t music_player_get_bass_boost(void)
+{
+    return Audio_EQ_GetBassBoost();
+}
+
+/**
+ * @brief  CPU load of the playback chain
+ * @param  stats: Output statistics
+ * @retval None
+ */
+void music_player_get_dsp_stats(Music_DSP_Stats *stats)
+{
+    Audio_Decoder_Stats dec;
+
+    memset(stats, 0, sizeof(Music_DSP_Stats));
+    if (current_decoder)
+    {
+        Audio_Decoder_GetStats(current_decoder->format, &dec);
+        stats->decoder_load = (uint16_t)dec.load_permille;
     }
+    stats->dsp_load = dsp_load;
+    stats->budget = DSP_BUDGET_PERMILLE;
+    if (eq_out_frames > 0) stats->eq_cycles = (uint32_t)(eq_cycles / eq_out_frames);
+    stats->eq_bands = Audio_EQ_GetActiveBands();
+    stats->overload = dsp_overload;
+}
+
+/**
+ * @brief  Get PCM ring fill level and underrun counters
+ * @param  stats: Output statistics
+ * @retval None
+ */
+void music_player_get_ring_stats(PCM_Ring_Stats *stats)
+{
+    PCM_Ring_GetStats(&pcm_ring, stats);
 }
 
 /**
@@ -522,7 +1169,7 @@ void music_player_set_headphone_volume(uint8_t volume)
     {
         volume = 33;
     }
-    ES8388_SetVolume(volume);
+    hp_volume_target = volume;  // 由 music_player_volume_step() 逐级写入
 }
 
 /**
@@ -533,9 +1180,7 @@ void music_player_set_headphone_volume(uint8_t volume)
 void music_player_set_speaker_volume(uint8_t volume)
 {
     if (volume > 33) volume = 33;
-
-    // 使用 ES8388_SetSpeakerVol 确保副本被更新
-    ES8388_SetSpeakerVol(volume);
+    spk_volume_target = volume;  // 由 music_player_volume_step() 逐级写入
 }
 /**
  * @brief  Get song count in playlist
@@ -547,18 +1192,19 @@ void music_player_set_speaker_volume(uint8_t volume)
  * @retval Number of songs
  */
 
-const uint16_t music_player_get_song_count(void)
+uint32_t music_player_get_song_count(void)
 {
-    return music_count;
+    return Music_Playlist_GetCount();
 }
-const uint16_t music_player_get_currentIndex(void)
+uint32_t music_player_get_currentIndex(void)
 {
     return current_song_index;
 }
 
-void music_player_set_currentIndex(uint16_t index)
+void music_player_set_currentIndex(uint32_t index)
 {
-    current_song_index = index % music_count;
+    uint32_t count = Music_Playlist_GetCount();
+    if (count > 0) current_song_index = index % count;
 }
 
 char *music_player_get_currentName()
@@ -566,86 +1212,61 @@ char *music_player_get_currentName()
     return current_song_name;
 }
 
-const MusicSong_TypeDef *music_player_get_playlist(void)
-{
-    return playlist;
-}
-
 /**
  * @brief  读取耳机音量 (百分比)
+ * @note   返回目标值 (不访问 I2C), 逐级调整的过程中也不会读到中间值
  * @retval 音量值 0~100
  */
 uint8_t music_player_get_headphone_volume(void)
 {
-    uint8_t hw_vol = ES8388_GetHeadphoneVolume();
     // 硬件值 0~33 转换为 0~100
-    return (uint8_t)(hw_vol * 100 / 33);
+    return (uint8_t)(hp_volume_target * 100 / 33);
 }
 
 /**
  * @brief  读取喇叭音量 (百分比)
+ * @note   返回目标值 (不访问 I2C)
  * @retval 音量值 0~100
  */
 uint8_t music_player_get_speaker_volume(void)
 {
-    uint8_t hw_vol = ES8388_GetSpeakerVolume();
     // 硬件值 0~33 转换为 0~100
-    return (uint8_t)(hw_vol * 100 / 33);
+    return (uint8_t)(spk_volume_target * 100 / 33);
 }
 /**
- * @brief  Build music list by scanning SD card
+ * @brief  Update the library index and restore the playlist (见 music_library.h / music_playlist.h)
  * @retval None
- * @note   To be implemented
  */
 static void Bulid_MusicList(void)
 {
-    DIR dir;
-    FILINFO fno;
-    FRESULT res;
+    Music_Library_Stats stats;
 
-    res = f_opendir(&dir, "0:/music");
-    if (res != FR_OK)
-    {
-        return;
-    }
+    MusicSong_TypeDef song;
 
-    while (1)
-    {
-        res = f_readdir(&dir, &fno);
-        if (res != FR_OK || fno.fname[0] == 0)
-        {
-            break;
-        }
-        if (fno.fattrib & AM_DIR)
-        {
-            continue;
-        }
-        if (strcmp(fno.fname + strlen(fno.fname) - 4, ".wav") == 0)
-        {
-            strncpy(playlist[music_count].name, fno.fname, sizeof(playlist[music_count].name) - 1);
-            playlist[music_count].name[sizeof(playlist[music_count].name) - 1] = '\0';  // 确保 null 结尾
-            playlist[music_count].format = MUSIC_FORMAT_WAV;
-            music_count++;
-        }
-        else if (strcmp(fno.fname + strlen(fno.fname) - 4, ".mp3") == 0)
-        {
-            strncpy(playlist[music_count].name, fno.fname, sizeof(playlist[music_count].name) - 1);
-            playlist[music_count].name[sizeof(playlist[music_count].name) - 1] = '\0';  // 确保 null 结尾
-            playlist[music_count].format = MUSIC_FORMAT_MP3;
-            music_count++;
-        }
-    }
-    f_closedir(&dir);
+    Music_Library_Update(&stats);
+    Music_Playlist_Init();
+    current_song_index = 0;
+
+    Music_Cover_Init();
+    if (Music_Playlist_Get(current_song_index, &song) == 0) Music_Cover_Request(song.id);
 }
 void music_player_pause(void)
 {
+    music_player_fade_out();
     HAL_I2S_DMAPause(&hi2s2);
+    Audio_Spectrum_Clear();
     taskENTER_CRITICAL();
     isPlaying = 0;
     taskEXIT_CRITICAL();
 }
 void music_player_resume(void)
 {
+    if (isPlaying) return;
+
+    // 暂停前的渐弱把解码标记为结束, 从暂停处继续解码并渐强
+    pcm_eof = 0;
+    pcm_drain_count = 0;
+    Audio_EQ_SetGain(AUDIO_EQ_GAIN_UNITY, output_rate * FADE_MS / 1000);
     HAL_I2S_DMAResume(&hi2s2);
     taskENTER_CRITICAL();
     isPlaying = 1;
@@ -653,29 +1274,14 @@ void music_player_resume(void)
 }
 void music_player_stop(void)
 {
+    music_player_fade_out();
     HAL_I2S_DMAStop(&hi2s2);
-    f_close(&musicFile);
+    Audio_Spectrum_Clear();
+    music_player_close_song();
     taskENTER_CRITICAL();
     isPlaying = 0;
     taskEXIT_CRITICAL();
+    pcm_reset();
     // 清空队列中的残留消息
     osMessageQueueReset(audio_data_queueHandle);
 }
-
-void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
-{
-    if (hi2s == &hi2s2)
-    {
-        audio_state = 1;
-        osSemaphoreRelease(audio_semHandle);
-    }
-}
-
-void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s)
-{
-    if (hi2s == &hi2s2)
-    {
-        audio_state = 2;
-        osSemaphoreRelease(audio_semHandle);
-    }
-}
@@ -8,15 +8,21 @@ extern "C"
 
 #include <stdint.h>
 #include "cmsis_os.h"
+#include "pcm_ring.h"
     typedef enum
     {
         MUSIC_FORMAT_WAV,
         MUSIC_FORMAT_MP3,
+        MUSIC_FORMAT_FLAC,
+        MUSIC_FORMAT_APE,
+        MUSIC_FORMAT_COUNT,
     } MusicSong_Format;
 
+    /* 播放列表中的一首 (见 music_playlist.h) */
     typedef struct
     {
-        char name[64];
+        char name[64];  // 显示名称: 标题标签, 没有时为文件名
+        uint32_t id;    // 曲库序号 (见 music_library.h)
         MusicSong_Format format;
     } MusicSong_TypeDef;
 
@@ -30,6 +36,11 @@ extern "C"
         MUSIC_SET_SPEAKER_VOL,
         MUSIC_NEXT,
         MUSIC_PREV,
+        MUSIC_SEEK,            // param: 目标位置 (0~100, 百分比)
+        MUSIC_SET_EQ_PRESET,   // param: Audio_EQ_Preset
+        MUSIC_SET_BASS_BOOST,  // param: 低音增强 (dB)
+        MUSIC_SET_SHUFFLE,     // param: 0 / 1
+        MUSIC_SET_REPEAT,      // param: Music_Playlist_Repeat
     } Music_EventType;
 
     typedef struct
@@ -38,6 +49,17 @@ extern "C"
         uint8_t param;  // 用于音量值等参数
     } Music_Event;
 
+    /* 播放链路 CPU 占用 (千分比, 相对于实时播放所需时间) */
+    typedef struct
+    {
+        uint16_t decoder_load;  // 当前格式的平均解码占用
+        uint16_t dsp_load;      // 最近一秒 SRC + EQ 的占用
+        uint16_t budget;        // decoder_load + dsp_load 的上限, 超出时 EQ 直通
+        uint32_t eq_cycles;     // EQ 每个输出采样对的平均周期数
+        uint8_t eq_bands;       // 参与运算的频段数, 0 表示直通
+        uint8_t overload;       // 1: 因超出预算而直通
+    } Music_DSP_Stats;
+
     extern uint8_t isPlaying;
     extern osMessageQueueId_t music_eventQueueHandle;
 
@@ -51,13 +73,39 @@ extern "C"
     void music_player_set_speaker_volume(uint8_t volume);
     void music_player_process_song();
     void music_player_update(void);
+    void music_player_seek(uint8_t percent);
+    void music_player_seek_ms(uint32_t ms);
+
+    // 当前歌曲的播放位置 (毫秒, 由 DMA 已发送的采样数计算)
+    uint32_t music_player_get_position_ms(void);
+    // 当前歌曲的时长 (毫秒, 0 表示未知)
+    uint32_t music_player_get_duration_ms(void);
 
-    void music_player_set_currentIndex(uint16_t index);
+    // 最近一次定位的耗时 (微秒, DWT 计时)
+    uint32_t music_player_get_seek_time_us(void);
+    // 最近一次切歌从请求到第一个采样送出的时间 (微秒, DWT 计时)
+    uint32_t music_player_get_start_time_us(void);
+    // 最近一次无缝衔接打开下一首的耗时和当时环形缓冲区中剩余的播放时长 (微秒, DWT 计时)
+    uint32_t music_player_get_chain_time_us(uint32_t *margin_us);
+    // SRC 每个输出采样对的平均周期数
+    uint32_t music_player_get_src_cycles(void);
 
-    const uint16_t music_player_get_currentIndex(void);
+    // 均衡器 (见 audio_eq.h)
+    void music_player_set_eq_preset(uint8_t preset);
+    void music_player_set_bass_boost(uint8_t db);
+    uint8_t music_player_get_eq_preset(void);
+    uint8_t music_player_get_bass_boost(void);
+    void music_player_get_dsp_stats(Music_DSP_Stats *stats);
+
+    // 播放列表位置 (列表内容按页读取, 见 music_playlist.h)
+    void music_player_set_currentIndex(uint32_t index);
+
+    uint32_t music_player_get_currentIndex(void);
     char *music_player_get_currentName();
-    const uint16_t music_player_get_song_count(void);
-    const MusicSong_TypeDef *music_player_get_playlist(void);
+    uint32_t music_player_get_song_count(void);
+
+    // 读取 PCM 环形缓冲区水位与欠载计数
+    void music_player_get_ring_stats(PCM_Ring_Stats *stats);
 
     // 读取音量 (百分比 0~100)
     uint8_t music_player_get_headphone_volume(void);
@@ -0,0 +1,673 @@
+/*
+ * music_playlist.c
+ * 分页播放列表 (列表文件 + LRU 页缓存 + 随机播放置换)
+ *
+ * 列表文件 0:/music/playlist.dat:
+ *   PL_File_Header (128 字节), 其中 library_checksum 为生成时的 Music_Library_GetChecksum()
+ *   uint32_t id x count
+ * 生成时先写 playlist.tmp, 完成后再替换, 与曲库索引相同。
+ */
+
+#include "music_playlist.h"
+#include "music_library.h"
+#include "dwt.h"
+#include "fatfs.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define PL_FILE_PATH MUSIC_LIBRARY_ROOT "/playlist.dat"
+#define PL_TEMP_PATH MUSIC_LIBRARY_ROOT "/playlist.tmp"
+#define PL_FILE_MAGIC 0x5453504DU  // "MPST"
+#define PL_FILE_VERSION 1
+#define PL_ID_CHUNK 64        // 读写 id 时每次处理的数量 (栈上 256 字节)
+#define PL_FEISTEL_ROUNDS 4
+#define PL_REL_PATH_LEN (MUSIC_INDEX_PATH_LEN + MUSIC_INDEX_NAME_LEN)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint8_t source;     // Music_Playlist_Source
+    uint8_t recursive;  // 目录列表是否包含子目录
+    uint32_t count;
+    uint32_t library_checksum;
+    char path[MUSIC_INDEX_PATH_LEN];  // 目录或 M3U 文件 (仅用于显示)
+} PL_File_Header;
+
+_Static_assert(sizeof(PL_File_Header) == 128, "playlist header layout");
+
+typedef struct
+{
+    uint32_t first;     // 第一首的位置 (MUSIC_PLAYLIST_PAGE_ENTRIES 对齐)
+    uint32_t last_use;  // 最近一次访问的时钟, 最小的先被替换
+    uint8_t valid;
+    MusicSong_TypeDef songs[MUSIC_PLAYLIST_PAGE_ENTRIES];
+} PL_Page;
+
+typedef struct
+{
+    FIL file;
+    uint32_t ids[PL_ID_CHUNK];
+    uint32_t fill;
+    uint32_t count;
+    uint8_t error;
+} PL_Writer;
+
+/* Private variables ---------------------------------------------------------*/
+static FIL pl_file;  // 列表文件 (只读, SRAM)
+static uint8_t pl_file_open = 0;
+static Music_Playlist_Source pl_source = MUSIC_PLAYLIST_ALL;
+static uint32_t pl_count = 0;
+
+static PL_Page pl_pages[MUSIC_PLAYLIST_PAGE_COUNT];
+static uint32_t pl_clock = 0;
+
+static uint8_t pl_shuffle = 0;
+static uint32_t pl_seed = 0;
+static uint32_t pl_half_bits = 1;  // 置换定义在 [0, 2^(2*pl_half_bits)) 上, 超出 pl_count 的结果继续置换
+static Music_Playlist_Repeat pl_repeat = MUSIC_REPEAT_OFF;
+
+// M3U 导入用的行缓冲 (持有 pl_mutex 时使用)
+static char pl_line[PL_REL_PATH_LEN + 16];
+static char pl_rel[PL_REL_PATH_LEN];
+
+static osMutexId_t pl_mutex = NULL;
+
+static const osMutexAttr_t pl_mutex_attributes = {
+    .name = "playlistMutex",
+    .attr_bits = osMutexPrioInherit,
+};
+
+/* Function implementations --------------------------------------------------*/
+
+static void pl_lock(void)
+{
+    if (pl_mutex == NULL) pl_mutex = osMutexNew(&pl_mutex_attributes);
+    osMutexAcquire(pl_mutex, osWaitForever);
+}
+
+static void pl_unlock(void)
+{
+    osMutexRelease(pl_mutex);
+}
+
+/**
+ * @brief  Drop all cached pages (列表内容变化后调用)
+ */
+static void pl_invalidate(void)
+{
+    for (uint32_t i = 0; i < MUSIC_PLAYLIST_PAGE_COUNT; i++) pl_pages[i].valid = 0;
+}
+
+/**
+ * @brief  Recompute the shuffle domain for pl_count
+ */
+static void pl_update_domain(void)
+{
+    uint32_t bits = 2;
+    while (bits < 32 && (1U << bits) < pl_count) bits++;
+    pl_half_bits = (bits + 1) / 2;
+}
+
+/**
+ * @brief  Switch to a new source; the caller has already opened pl_file when needed
+ */
+static void pl_set_source(Music_Playlist_Source source, uint32_t count)
+{
+    pl_source = source;
+    pl_count = count;
+    pl_invalidate();
+    pl_update_domain();
+}
+
+/**
+ * @brief  Open playlist.dat if it matches the current library
+ * @retval 曲目数, 文件不存在或已过期时返回 MUSIC_PLAYLIST_NONE
+ */
+static uint32_t pl_open_file(PL_File_Header *header)
+{
+    UINT br;
+
+    if (pl_file_open)
+    {
+        f_close(&pl_file);
+        pl_file_open = 0;
+    }
+    if (f_open(&pl_file, PL_FILE_PATH, FA_READ) != FR_OK) return MUSIC_PLAYLIST_NONE;
+    pl_file_open = 1;
+
+    if (f_read(&pl_file, header, sizeof(*header), &br) != FR_OK || br != sizeof(*header) ||
+        header->magic != PL_FILE_MAGIC || header->version != PL_FILE_VERSION ||
+        header->library_checksum != Music_Library_GetChecksum() ||
+        f_size(&pl_file) != sizeof(*header) + header->count * sizeof(uint32_t))
+    {
+        f_close(&pl_file);
+        pl_file_open = 0;
+        return MUSIC_PLAYLIST_NONE;
+    }
+    return header->count;
+}
+
+/**
+ * @brief  Use playlist.dat when it is valid, otherwise the whole library
+ */
+static void pl_reopen(void)
+{
+    PL_File_Header header;
+    uint32_t count = pl_open_file(&header);
+
+    if (count != MUSIC_PLAYLIST_NONE && header.source <= MUSIC_PLAYLIST_M3U)
+    {
+        pl_set_source((Music_Playlist_Source)header.source, count);
+    }
+    else
+    {
+        pl_set_source(MUSIC_PLAYLIST_ALL, Music_Library_GetCount());
+    }
+}
+
+/**
+ * @brief  Start writing PL_TEMP_PATH
+ * @note   写入期间关闭 pl_file: 导入 M3U 时同时打开 M3U、临时文件、曲库索引和正在播放的文件, 正好 _FS_LOCK 个
+ */
+static int pl_write_begin(PL_Writer *w)
+{
+    PL_File_Header header;
+    UINT bw;
+
+    if (pl_file_open)
+    {
+        f_close(&pl_file);
+        pl_file_open = 0;
+    }
+
+    memset(&header, 0, sizeof(header));
+    w->fill = 0;
+    w->count = 0;
+    w->error = 0;
+    if (f_open(&w->file, PL_TEMP_PATH, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK)
+    {
+        pl_reopen();
+        return -1;
+    }
+    if (f_write(&w->file, &header, sizeof(header), &bw) != FR_OK || bw != sizeof(header))
+    {
+        f_close(&w->file);
+        f_unlink(PL_TEMP_PATH);
+        pl_reopen();
+        return -1;
+    }
+    return 0;
+}
+
+static void pl_write_flush(PL_Writer *w)
+{
+    UINT bw;
+    uint32_t len = w->fill * sizeof(uint32_t);
+
+    if (len && (f_write(&w->file, w->ids, len, &bw) != FR_OK || bw != len)) w->error = 1;
+    w->fill = 0;
+}
+
+static void pl_write_id(PL_Writer *w, uint32_t id)
+{
+    w->ids[w->fill++] = id;
+    w->count++;
+    if (w->fill == PL_ID_CHUNK) pl_write_flush(w);
+}
+
+/**
+ * @brief  Finish the temp file, replace playlist.dat and switch to it
+ * @retval 曲目数, -1: 写入失败 (恢复原列表)
+ */
+static int pl_write_end(PL_Writer *w, Music_Playlist_Source source, uint8_t recursive, const char *path)
+{
+    PL_File_Header header;
+    UINT bw;
+
+    pl_write_flush(w);
+
+    memset(&header, 0, sizeof(header));
+    header.magic = PL_FILE_MAGIC;
+    header.version = PL_FILE_VERSION;
+    header.source = (uint8_t)source;
+    header.recursive = recursive;
+    header.count = w->count;
+    header.library_checksum = Music_Library_GetChecksum();
+    snprintf(header.path, sizeof(header.path), "%s", path);
+
+    if (!w->error && (f_lseek(&w->file, 0) != FR_OK || f_write(&w->file, &header, sizeof(header), &bw) != FR_OK ||
+                      bw != sizeof(header)))
+    {
+        w->error = 1;
+    }
+    if (f_close(&w->file) != FR_OK) w->error = 1;
+    if (w->error)
+    {
+        f_unlink(PL_TEMP_PATH);
+        pl_reopen();
+        return -1;
+    }
+
+    f_unlink(PL_FILE_PATH);
+    f_rename(PL_TEMP_PATH, PL_FILE_PATH);
+
+    uint32_t count = pl_open_file(&header);
+    if (count == MUSIC_PLAYLIST_NONE)
+    {
+        pl_set_source(MUSIC_PLAYLIST_ALL, Music_Library_GetCount());
+        return -1;
+    }
+    pl_set_source(source, count);
+    return (int)count;
+}
+
+void Music_Playlist_Init(void)
+{
+    pl_lock();
+    pl_reopen();
+    pl_unlock();
+}
+
+void Music_Playlist_LoadAll(void)
+{
+    pl_lock();
+    if (pl_file_open)
+    {
+        f_close(&pl_file);
+        pl_file_open = 0;
+    }
+    f_unlink(PL_FILE_PATH);  // 下次启动也使用全部曲目
+    pl_set_source(MUSIC_PLAYLIST_ALL, Music_Library_GetCount());
+    pl_unlock();
+}
+
+int Music_Playlist_LoadFolder(const char *folder, uint8_t recursive)
+{
+    PL_Writer w;  // 任务栈 (SRAM)
+    Music_Index_Folder f;
+    uint32_t len = (uint32_t)strlen(folder);
+    int res;
+
+    pl_lock();
+    if (pl_write_begin(&w) != 0)
+    {
+        pl_unlock();
+        return -1;
+    }
+
+    // 目录表按广度优先排列: 先是目录本身, 然后是各级子目录
+    for (uint32_t i = 0; i < Music_Library_GetFolderCount() && !w.error; i++)
+    {
+        if (Music_Library_ReadFolder(i, &f) != 0) break;
+
+        uint8_t match = (strcmp(f.path, folder) == 0);
+        if (!match && recursive)
+        {
+            match = (len == 0) || (strncmp(f.path, folder, len) == 0 && f.path[len] == '/');
+        }
+        if (!match) continue;
+
+        for (uint32_t t = 0; t < f.track_count; t++) pl_write_id(&w, f.first_track + t);
+    }
+
+    res = pl_write_end(&w, MUSIC_PLAYLIST_FOLDER, recursive, folder);
+    pl_unlock();
+    return res;
+}
+
+/**
+ * @brief  Path relative to 0:/music for "0:/music/..." and "/music/..." (不区分大小写)
+ * @retval 相对路径, 不在 0:/music 下时返回 NULL
+ */
+static const char *pl_music_relative(const char *path)
+{
+    static const char *const prefixes[] = {"0:/music/", "/music/"};
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        const char *p = path;
+        const char *q = prefixes[i];
+        while (*q && (*p == *q || (*p >= 'A' && *p <= 'Z' && *p + 32 == *q)))
+        {
+            p++;
+            q++;
+        }
+        if (*q == '\0') return p;
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Resolve one M3U line into pl_rel
+ * @param  base: M3U 所在目录 (相对 0:/music), 为 NULL 时只接受绝对路径
+ * @retval 0: 成功
+ */
+static int pl_m3u_resolve(char *line, const char *base)
+{
+    uint32_t n = (uint32_t)strlen(line);
+
+    while (n > 0 && (line[n - 1] == '\r' || line[n - 1] == '\n' || line[n - 1] == ' ')) line[--n] = '\0';
+    if ((uint8_t)line[0] == 0xEF && (uint8_t)line[1] == 0xBB && (uint8_t)line[2] == 0xBF) line += 3;  // UTF-8 BOM
+    if (line[0] == '\0' || line[0] == '#') return -1;
+
+    for (char *p = line; *p; p++)
+    {
+        if (*p == '\\') *p = '/';
+    }
+
+    if (line[0] == '/' || (line[0] && line[1] == ':'))
+    {
+        const char *rel = pl_music_relative(line);
+        if (!rel) return -1;
+        snprintf(pl_rel, sizeof(pl_rel), "%s", rel);
+        return 0;
+    }
+    if (!base) return -1;
+
+    // 相对路径: 处理开头的 "./" 和 "../"
+    uint32_t base_len = (uint32_t)strlen(base);
+    while (1)
+    {
+        if (strncmp(line, "./", 2) == 0)
+        {
+            line += 2;
+        }
+        else if (strncmp(line, "../", 3) == 0)
+        {
+            if (base_len == 0) return -1;
+            while (base_len > 0 && base[base_len - 1] != '/') base_len--;
+            if (base_len > 0) base_len--;
+            line += 3;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    int len = snprintf(pl_rel, sizeof(pl_rel), "%.*s%s%s", (int)base_len, base, base_len ? "/" : "", line);
+    return (len > 0 && len < (int)sizeof(pl_rel)) ? 0 : -1;
+}
+
+int Music_Playlist_LoadM3U(const char *path)
+{
+    FIL m3u;
+    PL_Writer w;
+    char base[MUSIC_INDEX_PATH_LEN];
+    const char *rel = pl_music_relative(path);
+    int res;
+
+    // M3U 所在目录
+    if (rel)
+    {
+        const char *slash = strrchr(rel, '/');
+        snprintf(base, sizeof(base), "%.*s", slash ? (int)(slash - rel) : 0, rel);
+    }
+
+    pl_lock();
+    if (f_open(&m3u, path, FA_READ) != FR_OK)
+    {
+        pl_unlock();
+        return -1;
+    }
+    if (pl_write_begin(&w) != 0)
+    {
+        f_close(&m3u);
+        pl_unlock();
+        return -1;
+    }
+
+    while (!w.error && f_gets(pl_line, sizeof(pl_line), &m3u))
+    {
+        if (pl_m3u_resolve(pl_line, rel ? base : NULL) != 0) continue;
+
+        uint32_t id = Music_Library_FindPath(pl_rel);
+        if (id != MUSIC_PLAYLIST_NONE) pl_write_id(&w, id);
+    }
+    f_close(&m3u);
+
+    res = pl_write_end(&w, MUSIC_PLAYLIST_M3U, 0, rel ? rel : path);
+    pl_unlock();
+    return res;
+}
+
+Music_Playlist_Source Music_Playlist_GetSource(void)
+{
+    return pl_source;
+}
+
+uint32_t Music_Playlist_GetCount(void)
+{
+    return pl_count;
+}
+
+/**
+ * @brief  Fill one page from the id list and the library index (caller holds pl_mutex)
+ */
+static void pl_fill_page(PL_Page *page, uint32_t first)
+{
+    uint32_t ids[MUSIC_PLAYLIST_PAGE_ENTRIES];
+    uint32_t n = pl_count - first;
+    Music_Index_Track track;
+    UINT br = 0;
+
+    if (n > MUSIC_PLAYLIST_PAGE_ENTRIES) n = MUSIC_PLAYLIST_PAGE_ENTRIES;
+
+    if (pl_source == MUSIC_PLAYLIST_ALL)
+    {
+        for (uint32_t i = 0; i < n; i++) ids[i] = first + i;
+    }
+    else if (!pl_file_open || f_lseek(&pl_file, sizeof(PL_File_Header) + first * sizeof(uint32_t)) != FR_OK ||
+             f_read(&pl_file, ids, n * sizeof(uint32_t), &br) != FR_OK || br != n * sizeof(uint32_t))
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        MusicSong_TypeDef *song = &page->songs[i];
+
+        song->id = ids[i];
+        if (Music_Library_ReadTrack(ids[i], &track) != 0)
+        {
+            snprintf(song->name, sizeof(song->name), "?");
+            song->format = MUSIC_FORMAT_COUNT;
+            continue;
+        }
+        // 有标题标签时显示标题, 否则显示文件名
+        snprintf(song->name, sizeof(song->name), "%s", track.title[0] ? track.title : track.name);
+        song->format = (MusicSong_Format)track.format;
+    }
+
+    page->first = first;
+    page->valid = 1;
+}
+
+/**
+ * @brief  Cached page containing pos, loading it into the least recently used slot on a miss
+ */
+static PL_Page *pl_get_page(uint32_t pos)
+{
+    uint32_t first = pos - pos % MUSIC_PLAYLIST_PAGE_ENTRIES;
+    PL_Page *victim = &pl_pages[0];
+
+    pl_clock++;
+    for (uint32_t i = 0; i < MUSIC_PLAYLIST_PAGE_COUNT; i++)
+    {
+        PL_Page *p = &pl_pages[i];
+        if (p->valid && p->first == first)
+        {
+            p->last_use = pl_clock;
+            return p;
+        }
+        if (!p->valid || (victim->valid && p->last_use < victim->last_use)) victim = p;
+    }
+
+    victim->valid = 0;
+    pl_fill_page(victim, first);
+    if (!victim->valid) return NULL;
+    victim->last_use = pl_clock;
+    return victim;
+}
+
+uint32_t Music_Playlist_GetRange(uint32_t start, uint32_t n, MusicSong_TypeDef *out)
+{
+    uint32_t done = 0;
+
+    pl_lock();
+    while (done < n && start + done < pl_count)
+    {
+        uint32_t pos = start + done;
+        PL_Page *page = pl_get_page(pos);
+        if (!page) break;
+
+        uint32_t off = pos - page->first;
+        uint32_t len = MUSIC_PLAYLIST_PAGE_ENTRIES - off;
+        if (len > n - done) len = n - done;
+        if (len > pl_count - pos) len = pl_count - pos;
+        memcpy(&out[done], &page->songs[off], len * sizeof(MusicSong_TypeDef));
+        done += len;
+    }
+    pl_unlock();
+    return done;
+}
+
+int Music_Playlist_Get(uint32_t pos, MusicSong_TypeDef *song)
+{
+    return (Music_Playlist_GetRange(pos, 1, song) == 1) ? 0 : -1;
+}
+
+uint32_t Music_Playlist_Find(uint32_t id)
+{
+    uint32_t ids[PL_ID_CHUNK];
+    uint32_t pos = MUSIC_PLAYLIST_NONE;
+    UINT br;
+
+    pl_lock();
+    if (pl_source == MUSIC_PLAYLIST_ALL)
+    {
+        if (id < pl_count) pos = id;
+    }
+    else if (pl_file_open && f_lseek(&pl_file, sizeof(PL_File_Header)) == FR_OK)
+    {
+        for (uint32_t base = 0; base < pl_count && pos == MUSIC_PLAYLIST_NONE; base += PL_ID_CHUNK)
+        {
+            if (f_read(&pl_file, ids, sizeof(ids), &br) != FR_OK || br == 0) break;
+            for (uint32_t i = 0; i < br / sizeof(uint32_t); i++)
+            {
+                if (ids[i] == id)
+                {
+                    pos = base + i;
+                    break;
+                }
+            }
+        }
+    }
+    pl_unlock();
+    return pos;
+}
+
+/**
+ * @brief  Feistel round function
+ */
+static uint32_t pl_round(uint32_t x, uint32_t round)
+{
+    x ^= pl_seed + round * 0x9E3779B9U;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    return x ^ (x >> 16);
+}
+
+/**
+ * @brief  Shuffle order: k-th song to play -> playlist position
+ * @note   在 2^(2h) 上做 Feistel 置换, 结果 >= pl_count 时继续置换 (cycle walking), 得到 [0, pl_count) 上的置换
+ */
+static uint32_t pl_permute(uint32_t k)
+{
+    uint32_t mask = (1U << pl_half_bits) - 1;
+
+    do
+    {
+        uint32_t l = k >> pl_half_bits, r = k & mask;
+        for (uint32_t i = 0; i < PL_FEISTEL_ROUNDS; i++)
+        {
+            uint32_t t = l ^ (pl_round(r, i) & mask);
+            l = r;
+            r = t;
+        }
+        k = (l << pl_half_bits) | r;
+    } while (k >= pl_count);
+    return k;
+}
+
+/**
+ * @brief  Inverse of pl_permute(): playlist position -> shuffle order
+ */
+static uint32_t pl_unpermute(uint32_t pos)
+{
+    uint32_t mask = (1U << pl_half_bits) - 1;
+
+    do
+    {
+        uint32_t l = pos >> pl_half_bits, r = pos & mask;
+        for (uint32_t i = PL_FEISTEL_ROUNDS; i-- > 0;)
+        {
+            uint32_t t = r ^ (pl_round(l, i) & mask);
+            r = l;
+            l = t;
+        }
+        pos = (l << pl_half_bits) | r;
+    } while (pos >= pl_count);
+    return pos;
+}
+
+void Music_Playlist_SetShuffle(uint8_t enable)
+{
+    if (enable) pl_seed = (pl_seed * 1664525U + 1013904223U) ^ DWT_GetCycles();
+    pl_shuffle = enable ? 1 : 0;
+}
+
+uint8_t Music_Playlist_GetShuffle(void)
+{
+    return pl_shuffle;
+}
+
+void Music_Playlist_SetRepeat(Music_Playlist_Repeat mode)
+{
+    if (mode < MUSIC_REPEAT_COUNT) pl_repeat = mode;
+}
+
+Music_Playlist_Repeat Music_Playlist_GetRepeat(void)
+{
+    return pl_repeat;
+}
+
+uint32_t Music_Playlist_Next(uint32_t pos, uint8_t manual)
+{
+    if (pl_count == 0) return MUSIC_PLAYLIST_NONE;
+    if (pos >= pl_count) return pl_shuffle ? pl_permute(0) : 0;
+    if (!manual && pl_repeat == MUSIC_REPEAT_ONE) return pos;
+
+    uint32_t k = (pl_shuffle ? pl_unpermute(pos) : pos) + 1;
+    if (k >= pl_count)
+    {
+        if (!manual && pl_repeat == MUSIC_REPEAT_OFF) return MUSIC_PLAYLIST_NONE;
+        k = 0;
+    }
+    return pl_shuffle ? pl_permute(k) : k;
+}
+
+uint32_t Music_Playlist_Prev(uint32_t pos)
+{
+    if (pl_count == 0) return MUSIC_PLAYLIST_NONE;
+    if (pos >= pl_count) pos = 0;
+
+    uint32_t k = pl_shuffle ? pl_unpermute(pos) : pos;
+    k = (k == 0) ? pl_count - 1 : k - 1;
+    return pl_shuffle ? pl_permute(k) : k;
+}
@@ -0,0 +1,128 @@
+/*
+ * music_playlist.h
+ * 播放列表: 曲库索引 (music_library.h) 之上的分页访问
+ *
+ * 列表只是一串曲库序号 (id):
+ *   全部曲目 : 位置 n 就是 id n, 不需要文件
+ *   目录 / M3U: id 按顺序写入 0:/music/playlist.dat (每首 4 字节), 重启后继续使用
+ * 显示和播放需要的 MusicSong_TypeDef 按页 (MUSIC_PLAYLIST_PAGE_ENTRIES 首) 从 SD 卡读取,
+ * RAM 中只保留 MUSIC_PLAYLIST_PAGE_COUNT 页 (LRU), 与曲目数无关。
+ * 随机播放使用带密钥的置换 (Feistel 网络), 播放顺序由种子计算得到, 也不占用 RAM。
+ *
+ * 所有函数可以在 GUI 任务和音频任务中调用 (内部加锁); 切换列表来源时应先停止播放。
+ */
+
+#ifndef APP_PLAYER_MUSIC_PLAYLIST_H_
+#define APP_PLAYER_MUSIC_PLAYLIST_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "music_player.h"
+
+#define MUSIC_PLAYLIST_PAGE_ENTRIES 16  // 每页曲目数 (1.1KB)
+#define MUSIC_PLAYLIST_PAGE_COUNT 4     // 缓存页数
+#define MUSIC_PLAYLIST_NONE 0xFFFFFFFFU
+
+    typedef enum
+    {
+        MUSIC_PLAYLIST_ALL,     // 曲库中的全部曲目
+        MUSIC_PLAYLIST_FOLDER,  // 一个目录 (可包含子目录)
+        MUSIC_PLAYLIST_M3U,     // M3U 文件中列出的曲目
+    } Music_Playlist_Source;
+
+    typedef enum
+    {
+        MUSIC_REPEAT_OFF,  // 播完最后一首停止
+        MUSIC_REPEAT_ALL,  // 列表循环
+        MUSIC_REPEAT_ONE,  // 单曲循环 (手动切歌仍然换曲)
+        MUSIC_REPEAT_COUNT,
+    } Music_Playlist_Repeat;
+
+    /**
+     * @brief  恢复上次的列表 (曲库更新后序号可能变化, 这时退回全部曲目)
+     * @note   在 Music_Library_Update() 之后调用
+     */
+    void Music_Playlist_Init(void);
+
+    /**
+     * @brief  使用曲库中的全部曲目
+     */
+    void Music_Playlist_LoadAll(void);
+
+    /**
+     * @brief  使用一个目录中的曲目
+     * @param  folder: 相对 0:/music 的目录, "" 为根目录
+     * @param  recursive: 1: 包含子目录
+     * @retval 曲目数, -1: 写入列表文件失败 (列表不变)
+     */
+    int Music_Playlist_LoadFolder(const char *folder, uint8_t recursive);
+
+    /**
+     * @brief  导入 M3U / M3U8 播放列表
+     * @param  path: M3U 文件完整路径; 其中的相对路径相对于 M3U 所在目录,
+     *         绝对路径需位于 0:/music 下 ("0:/music/..." 或 "/music/...")
+     * @retval 找到的曲目数 (曲库中不存在的条目跳过), -1: 文件无法打开或写入失败
+     */
+    int Music_Playlist_LoadM3U(const char *path);
+
+    /**
+     * @brief  当前列表来源
+     */
+    Music_Playlist_Source Music_Playlist_GetSource(void);
+
+    /**
+     * @brief  列表中的曲目数
+     */
+    uint32_t Music_Playlist_GetCount(void);
+
+    /**
+     * @brief  读取连续的一段列表
+     * @param  start: 起始位置
+     * @param  n: 最多读取的数量
+     * @retval 实际读取的数量
+     */
+    uint32_t Music_Playlist_GetRange(uint32_t start, uint32_t n, MusicSong_TypeDef *out);
+
+    /**
+     * @brief  读取一个位置
+     * @retval 0: 成功, -1: 越界或读取失败
+     */
+    int Music_Playlist_Get(uint32_t pos, MusicSong_TypeDef *song);
+
+    /**
+     * @brief  按曲库序号查找位置
+     * @retval 列表中的位置, 不在列表中时返回 MUSIC_PLAYLIST_NONE
+     */
+    uint32_t Music_Playlist_Find(uint32_t id);
+
+    /**
+     * @brief  随机播放开关 (打开时重新生成播放顺序)
+     */
+    void Music_Playlist_SetShuffle(uint8_t enable);
+    uint8_t Music_Playlist_GetShuffle(void);
+
+    void Music_Playlist_SetRepeat(Music_Playlist_Repeat mode);
+    Music_Playlist_Repeat Music_Playlist_GetRepeat(void);
+
+    /**
+     * @brief  下一首的位置 (考虑随机播放和循环模式)
+     * @param  pos: 当前位置
+     * @param  manual: 1: 用户切歌 (总是换曲, 到头后回到开头), 0: 当前歌曲播完
+     * @retval 下一首的位置, 不再播放时返回 MUSIC_PLAYLIST_NONE
+     */
+    uint32_t Music_Playlist_Next(uint32_t pos, uint8_t manual);
+
+    /**
+     * @brief  上一首的位置 (到开头后回到最后一首)
+     */
+    uint32_t Music_Playlist_Prev(uint32_t pos);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_MUSIC_PLAYLIST_H_ */
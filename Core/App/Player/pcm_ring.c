@@ -0,0 +1,98 @@
+/*
+ * pcm_ring.c
+ * PCM 环形缓冲区 (单生产者 / 单消费者, 无锁)
+ *
+ * head / tail 都是只增不减的 32 位计数, 差值即为已填充块数。
+ * 每个计数只有一方写入, 所以不需要关中断; 只需保证块内数据先于计数写入内存:
+ * 对方的计数用获取语义读取, 自己的计数用释放语义写入 (Cortex-M4 上即 DMB + 普通读写)。
+ */
+
+#include "pcm_ring.h"
+#include <stddef.h>
+
+#if defined(__GNUC__)
+#define PCM_RING_LOAD(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define PCM_RING_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define PCM_RING_LOAD(x) (x)
+#define PCM_RING_STORE(x, v) ((x) = (v))
+#endif
+
+void PCM_Ring_Init(PCM_Ring_TypeDef *ring, int16_t *pool, uint16_t block_samples, uint16_t block_count)
+{
+    ring->pool = pool;
+    ring->block_samples = block_samples;
+    ring->block_count = block_count;
+    PCM_Ring_Reset(ring);
+}
+
+void PCM_Ring_Reset(PCM_Ring_TypeDef *ring)
+{
+    ring->head = 0;
+    ring->tail = 0;
+    ring->min_fill = ring->block_count;
+    ring->underruns = 0;
+}
+
+int16_t *PCM_Ring_GetWriteBlock(PCM_Ring_TypeDef *ring)
+{
+    uint32_t head = ring->head;
+    if (head - PCM_RING_LOAD(ring->tail) >= ring->block_count) return NULL;  // 已满
+
+    return ring->pool + (head % ring->block_count) * ring->block_samples;
+}
+
+void PCM_Ring_CommitWrite(PCM_Ring_TypeDef *ring)
+{
+    // 确保块内 PCM 数据在 head 更新之前已经写入
+    PCM_RING_STORE(ring->head, ring->head + 1);
+}
+
+const int16_t *PCM_Ring_GetReadBlock(PCM_Ring_TypeDef *ring)
+{
+    return PCM_Ring_PeekReadBlock(ring, 0);
+}
+
+const int16_t *PCM_Ring_PeekReadBlock(PCM_Ring_TypeDef *ring, uint16_t index)
+{
+    uint32_t pos = ring->tail + index;
+    if (PCM_RING_LOAD(ring->head) - ring->tail <= index) return NULL;  // 尚未提交
+
+    return ring->pool + (pos % ring->block_count) * ring->block_samples;
+}
+
+void PCM_Ring_ReleaseRead(PCM_Ring_TypeDef *ring)
+{
+    // DMA 已经读完这一块, 之后生产者才能改写
+    PCM_RING_STORE(ring->tail, ring->tail + 1);
+
+    uint16_t fill = (uint16_t)(PCM_RING_LOAD(ring->head) - ring->tail);
+    if (fill < ring->min_fill) ring->min_fill = fill;
+}
+
+void PCM_Ring_MarkUnderrun(PCM_Ring_TypeDef *ring)
+{
+    ring->underruns = ring->underruns + 1;
+    ring->min_fill = 0;
+}
+
+uint16_t PCM_Ring_GetFill(const PCM_Ring_TypeDef *ring)
+{
+    return (uint16_t)(PCM_RING_LOAD(ring->head) - PCM_RING_LOAD(ring->tail));
+}
+
+uint16_t PCM_Ring_GetFree(const PCM_Ring_TypeDef *ring)
+{
+    return (uint16_t)(ring->block_count - (PCM_RING_LOAD(ring->head) - PCM_RING_LOAD(ring->tail)));
+}
+
+void PCM_Ring_GetStats(const PCM_Ring_TypeDef *ring, PCM_Ring_Stats *stats)
+{
+    if (!stats) return;
+
+    stats->fill = PCM_Ring_GetFill(ring);
+    stats->capacity = ring->block_count;
+    stats->min_fill = ring->min_fill;
+    stats->underruns = ring->underruns;
+    stats->blocks_played = ring->tail;
+}
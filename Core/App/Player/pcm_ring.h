@@ -0,0 +1,110 @@
+/*
+ * pcm_ring.h
+ * PCM 环形缓冲区 (单生产者 / 单消费者, 无锁)
+ *
+ * 生产者: 音频任务, 尽可能提前把解码结果写入空闲块
+ * 消费者: I2S DMA 半传输/传输完成中断, 每次取走一个完整块
+ *
+ * 本模块不依赖 HAL / RTOS, 可以直接在主机上编译, 用模拟的 DMA 时钟驱动。
+ */
+
+#ifndef APP_PLAYER_PCM_RING_H_
+#define APP_PLAYER_PCM_RING_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+    /* 环形缓冲区运行统计 */
+    typedef struct
+    {
+        uint16_t fill;           // 当前已解码、等待播放的块数
+        uint16_t capacity;       // 总块数
+        uint16_t min_fill;       // 自上次复位以来的最低水位 (块)
+        uint32_t underruns;      // DMA 需要数据但缓冲区为空的次数
+        uint32_t blocks_played;  // 已被 DMA 取走的块数
+    } PCM_Ring_Stats;
+
+    /* 环形缓冲区对象, 字段仅供本模块内部使用 */
+    typedef struct
+    {
+        int16_t *pool;           // block_count * block_samples 个采样
+        uint16_t block_samples;  // 每块采样数 (左右声道合计)
+        uint16_t block_count;
+        volatile uint32_t head;  // 已提交的块计数, 只由生产者修改
+        volatile uint32_t tail;  // 已释放的块计数, 只由消费者修改
+        volatile uint16_t min_fill;
+        volatile uint32_t underruns;
+    } PCM_Ring_TypeDef;
+
+    /**
+     * @brief  初始化环形缓冲区
+     * @param  ring: 缓冲区对象
+     * @param  pool: 块存储区, 至少 block_samples * block_count 个采样 (4 字节对齐, 需位于 DMA 可访问的 SRAM)
+     * @param  block_samples: 每块采样数
+     * @param  block_count: 块数
+     */
+    void PCM_Ring_Init(PCM_Ring_TypeDef *ring, int16_t *pool, uint16_t block_samples, uint16_t block_count);
+
+    /**
+     * @brief  清空缓冲区和统计计数 (调用时消费者必须已停止)
+     */
+    void PCM_Ring_Reset(PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  生产者: 获取下一个可写块
+     * @retval 块起始地址, 缓冲区已满时返回 NULL
+     */
+    int16_t *PCM_Ring_GetWriteBlock(PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  生产者: 提交 PCM_Ring_GetWriteBlock() 返回的块
+     */
+    void PCM_Ring_CommitWrite(PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  消费者: 获取最早提交的块
+     * @retval 块起始地址, 缓冲区为空时返回 NULL
+     */
+    const int16_t *PCM_Ring_GetReadBlock(PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  消费者: 查看尚未释放的第 index 个块 (0 = 最早提交的块)
+     * @note   用于 DMA 双缓冲模式: DMA 同时占用两个块, 按提交顺序依次释放
+     * @retval 块起始地址, 不存在时返回 NULL
+     */
+    const int16_t *PCM_Ring_PeekReadBlock(PCM_Ring_TypeDef *ring, uint16_t index);
+
+    /**
+     * @brief  消费者: 释放最早提交的块
+     */
+    void PCM_Ring_ReleaseRead(PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  消费者: 记录一次欠载 (需要数据时缓冲区为空)
+     */
+    void PCM_Ring_MarkUnderrun(PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  已提交未播放的块数
+     */
+    uint16_t PCM_Ring_GetFill(const PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  空闲块数
+     */
+    uint16_t PCM_Ring_GetFree(const PCM_Ring_TypeDef *ring);
+
+    /**
+     * @brief  读取运行统计
+     */
+    void PCM_Ring_GetStats(const PCM_Ring_TypeDef *ring, PCM_Ring_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_PCM_RING_H_ */
@@ -0,0 +1,330 @@
+/*
+ * stream_reader.c
+ * 音频文件预读模块 (所有格式共用)
+ *
+ * 块状态用只增不减的 head / tail 计数表示 (与 pcm_ring 相同):
+ *   head: 读取任务已填充的块数 (只在持有 stream_mutex 时由读取任务或 Seek/Open 修改)
+ *   tail: 解码器已用完的块数 (只由解码器一方修改)
+ * 文件对象只在持有 stream_mutex 时访问。
+ */
+
+#include "stream_reader.h"
+#include "cmsis_os.h"
+#include "dwt.h"
+
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define STREAM_FLAG_WAKE 0x0001U
+#define STREAM_WAIT_TIMEOUT 1000  // 解码器等待数据的最长时间 (ms), 超时按文件结束处理
+#define STREAM_CLMT_SIZE 64       // 快速定位簇链表 (256 字节), 碎片太多时退回普通定位
+
+#if defined(__GNUC__)
+#define STREAM_BARRIER() __sync_synchronize()
+#else
+#define STREAM_BARRIER()
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+// 4 字节对齐: FatFs 直接把整扇区读进这里, SDIO DMA 不需要走 scratch 缓冲区
+static uint8_t stream_buf[STREAM_CHUNK_COUNT][STREAM_CHUNK_SIZE] __attribute__((aligned(4)));
+static uint32_t chunk_pos[STREAM_CHUNK_COUNT];  // 块对应的文件偏移
+static uint32_t chunk_len[STREAM_CHUNK_COUNT];  // 块内有效字节数
+
+static volatile uint32_t stream_head = 0;
+static volatile uint32_t stream_tail = 0;
+static volatile uint8_t stream_eof = 0;      // 读取任务已读到文件末尾
+static volatile uint8_t stream_opened = 0;
+static uint32_t stream_read_pos = 0;         // 读取任务下一次读取的文件偏移 (块对齐)
+static uint32_t stream_consume_pos = 0;      // 解码器当前位置
+
+static FIL stream_file;
+static DWORD stream_clmt[STREAM_CLMT_SIZE];
+
+static volatile Stream_Stats stream_stats = {0};
+
+// --- RTOS Objects ---
+static osThreadId_t stream_taskHandle = NULL;
+static osMutexId_t stream_mutex = NULL;
+static osSemaphoreId_t stream_data_sem = NULL;
+
+static const osThreadAttr_t streamTask_attributes = {
+    .name = "streamTask",
+    .stack_size = 384 * 4,
+    .priority = (osPriority_t)osPriorityBelowNormal,
+};
+
+static const osMutexAttr_t stream_mutex_attributes = {
+    .name = "streamMutex",
+    .attr_bits = osMutexPrioInherit,
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void StartStreamTask(void *argument);
+
+/* Function implementations --------------------------------------------------*/
+
+void Stream_Init(void)
+{
+    DWT_Init();
+
+    stream_mutex = osMutexNew(&stream_mutex_attributes);
+    stream_data_sem = osSemaphoreNew(1, 0, NULL);
+    stream_taskHandle = osThreadNew(StartStreamTask, NULL, &streamTask_attributes);
+
+    stream_stats.chunk_size = STREAM_CHUNK_SIZE;
+    stream_stats.chunk_count = STREAM_CHUNK_COUNT;
+}
+
+/**
+ * @brief  Fill one free chunk (caller holds stream_mutex)
+ * @retval 1: 读取了一块, 0: 没有空闲块或已到文件末尾
+ */
+static int stream_fill_chunk(void)
+{
+    if (!stream_opened || stream_eof) return 0;
+    if (stream_head - stream_tail >= STREAM_CHUNK_COUNT) return 0;
+
+    uint32_t idx = stream_head % STREAM_CHUNK_COUNT;
+    UINT br = 0;
+
+    uint32_t t0 = DWT_GetCycles();
+    FRESULT res = f_read(&stream_file, stream_buf[idx], STREAM_CHUNK_SIZE, &br);
+    uint32_t us = DWT_CyclesToUs(DWT_GetCycles() - t0);
+
+    stream_stats.bytes_read += br;
+    stream_stats.read_count++;
+    stream_stats.busy_us += us;
+    if (us > stream_stats.worst_read_us) stream_stats.worst_read_us = us;
+    if (stream_stats.busy_us > 0)
+    {
+        stream_stats.kbytes_per_sec = (uint32_t)((uint64_t)stream_stats.bytes_read * 1000U / 1024U * 1000U /
+                                                 stream_stats.busy_us);
+    }
+
+    chunk_pos[idx] = stream_read_pos;
+    chunk_len[idx] = br;
+    stream_read_pos += br;
+
+    if (br > 0)
+    {
+        // 块数据先于 head 写入
+        STREAM_BARRIER();
+        stream_head = stream_head + 1;
+    }
+    if (res != FR_OK || br < STREAM_CHUNK_SIZE)
+    {
+        stream_eof = 1;
+    }
+    return br > 0;
+}
+
+/**
+ * @brief  Read-ahead task: 被唤醒后填满所有空闲块
+ */
+static void StartStreamTask(void *argument)
+{
+    for (;;)
+    {
+        osThreadFlagsWait(STREAM_FLAG_WAKE, osFlagsWaitAny, osWaitForever);
+
+        while (1)
+        {
+            osMutexAcquire(stream_mutex, osWaitForever);
+            int filled = stream_fill_chunk();
+            osMutexRelease(stream_mutex);
+
+            osSemaphoreRelease(stream_data_sem);
+            if (!filled) break;
+        }
+    }
+}
+
+static void stream_wake(void)
+{
+    if (stream_taskHandle) osThreadFlagsSet(stream_taskHandle, STREAM_FLAG_WAKE);
+}
+
+/**
+ * @brief  Buffer empty: 临时把读取任务提升到调用者的优先级, 等待下一块
+ * @retval 1: 有新数据, 0: 文件结束或超时
+ */
+static int stream_wait_data(void)
+{
+    if (stream_head != stream_tail) return 1;
+    if (!stream_opened || stream_eof) return 0;
+
+    stream_stats.starve_count++;
+
+    osPriority_t prio = osThreadGetPriority(osThreadGetId());
+    osThreadSetPriority(stream_taskHandle, prio);
+
+    uint32_t start = osKernelGetTickCount();
+    while (stream_head == stream_tail && !stream_eof)
+    {
+        uint32_t waited = osKernelGetTickCount() - start;
+        if (waited >= STREAM_WAIT_TIMEOUT) break;
+
+        stream_wake();
+        osSemaphoreAcquire(stream_data_sem, STREAM_WAIT_TIMEOUT - waited);
+    }
+
+    osThreadSetPriority(stream_taskHandle, osPriorityBelowNormal);
+    return stream_head != stream_tail;
+}
+
+FRESULT Stream_Open(const char *path)
+{
+    Stream_Close();
+
+    osMutexAcquire(stream_mutex, osWaitForever);
+
+    FRESULT res = f_open(&stream_file, path, FA_READ);
+    if (res == FR_OK)
+    {
+        // 建立簇链表, 之后的 f_lseek 不再需要遍历 FAT
+        stream_clmt[0] = STREAM_CLMT_SIZE;
+        stream_file.cltbl = stream_clmt;
+        if (f_lseek(&stream_file, CREATE_LINKMAP) != FR_OK)
+        {
+            stream_file.cltbl = NULL;
+        }
+
+        stream_head = 0;
+        stream_tail = 0;
+        stream_eof = 0;
+        stream_read_pos = 0;
+        stream_consume_pos = 0;
+        stream_opened = 1;
+    }
+
+    osMutexRelease(stream_mutex);
+
+    if (res == FR_OK) stream_wake();
+    return res;
+}
+
+void Stream_Close(void)
+{
+    osMutexAcquire(stream_mutex, osWaitForever);
+
+    if (stream_opened)
+    {
+        f_close(&stream_file);
+        stream_opened = 0;
+    }
+    stream_head = 0;
+    stream_tail = 0;
+    stream_eof = 0;
+
+    osMutexRelease(stream_mutex);
+}
+
+const uint8_t *Stream_GetSpan(uint32_t *len)
+{
+    *len = 0;
+
+    while (stream_head != stream_tail)
+    {
+        STREAM_BARRIER();
+        uint32_t idx = stream_tail % STREAM_CHUNK_COUNT;
+        uint32_t end = chunk_pos[idx] + chunk_len[idx];
+
+        if (stream_consume_pos >= chunk_pos[idx] && stream_consume_pos < end)
+        {
+            *len = end - stream_consume_pos;
+            return stream_buf[idx] + (stream_consume_pos - chunk_pos[idx]);
+        }
+
+        // 该块已用完 (或 Seek 之后位于目标之前): 释放给读取任务
+        stream_tail = stream_tail + 1;
+        stream_wake();
+    }
+    return NULL;
+}
+
+void Stream_Consume(uint32_t len)
+{
+    stream_consume_pos += len;
+
+    if (stream_head != stream_tail)
+    {
+        uint32_t idx = stream_tail % STREAM_CHUNK_COUNT;
+        if (stream_consume_pos >= chunk_pos[idx] + chunk_len[idx])
+        {
+            stream_tail = stream_tail + 1;
+            stream_wake();
+        }
+    }
+}
+
+uint32_t Stream_Read(void *dst, uint32_t len)
+{
+    uint8_t *out = (uint8_t *)dst;
+    uint32_t total = 0;
+
+    while (total < len)
+    {
+        uint32_t avail;
+        const uint8_t *src = Stream_GetSpan(&avail);
+        if (!src)
+        {
+            if (!stream_wait_data()) break;
+            continue;
+        }
+
+        uint32_t n = len - total;
+        if (n > avail) n = avail;
+        memcpy(out + total, src, n);
+        Stream_Consume(n);
+        total += n;
+    }
+    return total;
+}
+
+FRESULT Stream_Seek(uint32_t pos)
+{
+    if (!stream_opened) return FR_NOT_ENABLED;
+
+    // 目标已在缓冲区内: 只移动读指针, 之前的块由 Stream_GetSpan() 释放
+    for (uint32_t i = stream_tail; i != stream_head; i++)
+    {
+        uint32_t idx = i % STREAM_CHUNK_COUNT;
+        if (pos >= chunk_pos[idx] && pos < chunk_pos[idx] + chunk_len[idx])
+        {
+            stream_consume_pos = pos;
+            return FR_OK;
+        }
+    }
+
+    // 按块对齐重新读取, 保证后续 f_read 仍然是整扇区读取
+    uint32_t aligned = pos & ~(uint32_t)(STREAM_CHUNK_SIZE - 1);
+
+    osMutexAcquire(stream_mutex, osWaitForever);
+    FRESULT res = f_lseek(&stream_file, aligned);
+    stream_head = 0;
+    stream_tail = 0;
+    stream_eof = (res != FR_OK);
+    stream_read_pos = aligned;
+    stream_consume_pos = pos;
+    osMutexRelease(stream_mutex);
+
+    stream_wake();
+    return res;
+}
+
+uint32_t Stream_Tell(void)
+{
+    return stream_consume_pos;
+}
+
+uint32_t Stream_Size(void)
+{
+    return stream_opened ? (uint32_t)f_size(&stream_file) : 0;
+}
+
+void Stream_GetStats(Stream_Stats *stats)
+{
+    if (!stats) return;
+    memcpy(stats, (const void *)&stream_stats, sizeof(Stream_Stats));
+}
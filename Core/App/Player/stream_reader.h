@@ -0,0 +1,103 @@
+/*
+ * stream_reader.h
+ * 音频文件预读模块 (所有格式共用)
+ *
+ * 独立的低优先级读取任务按块 (STREAM_CHUNK_SIZE, 扇区/簇对齐) 把文件读入双缓冲,
+ * 解码器从缓冲区取字节段, 不再直接调用 f_read。
+ * 对齐的大块读取让 FatFs 把整段扇区直接交给 disk_read -> BSP_SD_ReadBlocks_DMA (多块读),
+ * 而不是拆成单扇区读到 FIL 内部缓冲区再拷贝。
+ */
+
+#ifndef APP_PLAYER_STREAM_READER_H_
+#define APP_PLAYER_STREAM_READER_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "fatfs.h"
+
+/* 每块大小: 必须是 512 的整数倍, 且最好能整除簇大小 (SD 卡 FAT32 通常为 32KB) */
+#define STREAM_CHUNK_SIZE 4096
+#define STREAM_CHUNK_COUNT 2  // 2 x 4KB = 8KB RAM
+
+    /* 读取性能统计 (用于确定缓冲区大小) */
+    typedef struct
+    {
+        uint32_t bytes_read;      // 累计读取字节数
+        uint32_t read_count;      // 累计 f_read 次数
+        uint32_t busy_us;         // 累计读取耗时 (us)
+        uint32_t worst_read_us;   // 单次读取最长耗时 (us)
+        uint32_t kbytes_per_sec;  // 持续读取速率 (KB/s) = bytes_read / busy_us
+        uint32_t starve_count;    // 解码器等待数据的次数
+        uint16_t chunk_size;
+        uint16_t chunk_count;
+    } Stream_Stats;
+
+    /**
+     * @brief  创建读取任务和同步对象 (在 f_mount 之后调用一次)
+     */
+    void Stream_Init(void);
+
+    /**
+     * @brief  打开文件并开始预读 (会先关闭当前文件)
+     * @param  path: 文件完整路径
+     * @retval FR_OK 表示成功
+     */
+    FRESULT Stream_Open(const char *path);
+
+    /**
+     * @brief  关闭当前文件, 丢弃已预读的数据
+     */
+    void Stream_Close(void);
+
+    /**
+     * @brief  读取数据 (缓冲区为空时阻塞等待读取任务)
+     * @param  dst: 目标缓冲区
+     * @param  len: 请求字节数
+     * @retval 实际读取的字节数, 小于 len 表示文件结束或读取超时
+     */
+    uint32_t Stream_Read(void *dst, uint32_t len);
+
+    /**
+     * @brief  获取当前可直接访问的连续数据 (不拷贝)
+     * @param  len: 输出可用字节数
+     * @retval 数据起始地址, 缓冲区暂时为空时返回 NULL
+     * @note   只返回当前块内剩余部分, 用完后调用 Stream_Consume()
+     */
+    const uint8_t *Stream_GetSpan(uint32_t *len);
+
+    /**
+     * @brief  标记已使用的字节数 (不超过 Stream_GetSpan() 返回的长度)
+     */
+    void Stream_Consume(uint32_t len);
+
+    /**
+     * @brief  定位到文件中的绝对位置
+     * @note   目标已在缓冲区内时只移动读指针, 否则按块对齐重新预读
+     * @retval FR_OK 表示成功
+     */
+    FRESULT Stream_Seek(uint32_t pos);
+
+    /**
+     * @brief  解码器当前读取位置 (文件内偏移)
+     */
+    uint32_t Stream_Tell(void);
+
+    /**
+     * @brief  当前文件大小, 未打开时返回 0
+     */
+    uint32_t Stream_Size(void);
+
+    /**
+     * @brief  读取性能统计
+     */
+    void Stream_GetStats(Stream_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_PLAYER_STREAM_READER_H_ */
@@ -9,7 +9,7 @@
 #if defined(LV_LVGL_H_INCLUDE_SIMPLE)
     #include "lvgl.h"
 #else
-#include "../../../Gui/lvgl/lvgl.h"
+    #include "../../../Gui/lvgl/lvgl.h"
 #endif
 
 
@@ -21,94 +21,178 @@
 #define LV_ATTRIBUTE_IMAGE_CAMERA_ICON
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_CAMERA_ICON uint8_t camera_icon_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xf6, 0xc9, 0xe4, 0x87, 0xe4, 0x67, 0xe4, 0xe8, 0xec, 0x69, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x2f, 0xfe, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xe4, 0xa8, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0x8b, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xab, 0xfd, 0x69, 0xfd, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xed, 0xa8, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0x6b, 0xf5, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x69, 0xfd, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x59, 0xce, 0x7a, 0xd6, 0x79, 0xd6, 0xbb, 0xd6, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x3d, 0xe7, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0x67, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x4a, 0xf5, 0xea, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0x0a, 0xed, 0x8b, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xab, 0xfd, 0x0f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xe7, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xf6, 0xa8, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0x2a, 0xf5, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xea, 0xec, 0xc9, 0xe4, 0xc9, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xa8, 0xe4, 0xc9, 0xe4, 0xa9, 0xe4, 0x8b, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x6a, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0x8c, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x6b, 0xf5, 0xc9, 0xe4, 0xc9, 0xe4, 0x6e, 0xe5, 0xf2, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf1, 0xe5, 0xf2, 0xe5, 0xf2, 0xe5, 0xc9, 0xe4, 0xc9, 0xe4, 0xe9, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0x8a, 0xfd, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x87, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xe9, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x2a, 0xf5, 0xc9, 0xe4, 0xc9, 0xe4, 0xdf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0xbf, 0xef, 0x76, 0xee, 0xa8, 0xe4, 0xc9, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0xab, 0xfd, 0xee, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf5, 0xa8, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0x4b, 0xf5, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x2a, 0xf5, 0xc9, 0xe4, 0xea, 0xe4, 0x9f, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x97, 0xee, 0xa8, 0xe4, 0xc9, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x69, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xe4, 0xc9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x2a, 0xf5, 0xc9, 0xe4, 0xea, 0xe4, 0xbf, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x97, 0xee, 0xa8, 0xe4, 0xc9, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x8b, 0xfd, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0x87, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xea, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x4a, 0xf5, 0xc9, 0xe4, 0xc8, 0xe4, 0xbf, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0x9f, 0xef, 0xbf, 0xef, 0x55, 0xe6, 0xa8, 0xe4, 0xc9, 0xe4, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xa9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x8b, 0xfd, 0xc9, 0xe4, 0xc9, 0xe4, 0xea, 0xe4, 0x4d, 0xe5, 0x4d, 0xe5, 0x4d, 0xe5, 0x4d, 0xe5, 0x4d, 0xe5, 0x4d, 0xe5, 0x4d, 0xe5, 0x4d, 0xe5, 0x4d, 0xe5, 0x4c, 0xe5, 0xa8, 0xe4, 0xc9, 0xe4, 0xea, 0xec, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x8a, 0xfd, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x9b, 0xd6, 0xbb, 0xd6, 0x9b, 0xd6, 0xdc, 0xde, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xe7, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xe5, 0xa8, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0x8b, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x2a, 0xed, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x6a, 0xfd, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0x39, 0xff, 0x77, 0xe6, 0xf5, 0xd5, 0x35, 0xde, 0x56, 0xe6, 0x77, 0xe6, 0xf8, 0xf6, 0xf8, 0xee, 0xf8, 0xee, 0xf8, 0xee, 0xf9, 0xf6, 0x39, 0xff, 0x31, 0xf6, 0xc8, 0xec, 0x09, 0xed, 0x2a, 0xed, 0x6b, 0xf5, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x6b, 0xfd, 0x2a, 0xed, 0x0a, 0xed, 0x2a, 0xed, 0x2a, 0xed, 0x2a, 0xed, 0x2a, 0xed, 0x2a, 0xed, 0x2a, 0xed, 0x2a, 0xed, 0x2a, 0xed, 0x0a, 0xed, 0x4a, 0xf5, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x8a, 0xfd, 0xed, 0xfd, 0xf7, 0xfe, 0x5a, 0xff, 0x7a, 0xff, 0x7a, 0xff, 0x7a, 0xff, 0x7a, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x74, 0xf6, 0x87, 0xe4, 0x87, 0xe4, 0x87, 0xe4, 0xe9, 0xec, 0xab, 0xfd, 0xab, 0xfd, 0xab, 0xfd, 0xab, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0xab, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xab, 0xfd, 0x8b, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0xf6, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xaf, 0xed, 0x87, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0x4b, 0xf5, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x8a, 0xfd, 0x72, 0xfe, 0xff, 0xff, 
-  0x19, 0xff, 0x87, 0xe4, 0xc9, 0xe4, 0xc9, 0xe4, 0xea, 0xec, 0xec, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x69, 0xfd, 0x7b, 0xff, 
-  0x8e, 0xed, 0xc9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0x6b, 0xf5, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xab, 0xfd, 0xab, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0xab, 0xfd, 0xac, 0xfd, 0xcd, 0xfd, 0xcd, 0xfd, 0xac, 0xfd, 0xab, 0xfd, 0x8a, 0xfd, 0x8a, 0xfd, 0xab, 0xfd, 0xab, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xab, 0xfd, 0x51, 0xfe, 
-  0xe9, 0xe4, 0xc9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0xab, 0xfd, 0x8a, 0xfd, 0xed, 0xfd, 0x73, 0xf6, 0xf9, 0xee, 0x5c, 0xef, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x7f, 0xe7, 0x5c, 0xef, 0xf9, 0xee, 0x73, 0xf6, 0xed, 0xfd, 0x8a, 0xfd, 0xab, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0xcd, 0xfd, 
-  0xc9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0xab, 0xfd, 0xab, 0xfd, 0x74, 0xf6, 0x3c, 0xef, 0x9f, 0xe7, 0x7e, 0xe7, 0x7e, 0xef, 0x5e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5e, 0xef, 0x7e, 0xef, 0x7e, 0xe7, 0x9f, 0xe7, 0x3c, 0xef, 0x74, 0xf6, 0xab, 0xfd, 0xab, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 
-  0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0xab, 0xfd, 0x8a, 0xfd, 0x95, 0xf6, 0x7f, 0xe7, 0x7f, 0xe7, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x7f, 0xe7, 0x7f, 0xe7, 0x95, 0xf6, 0x8a, 0xfd, 0xab, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 
-  0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x8a, 0xfd, 0x0f, 0xfe, 0x5d, 0xef, 0x7f, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7f, 0xe7, 0x5d, 0xef, 0x0f, 0xfe, 0x8a, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 
-  0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x8a, 0xfd, 0xb5, 0xf6, 0x9f, 0xe7, 0x5e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9e, 0xef, 0xbe, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0xbe, 0xf7, 0x9e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5e, 0xef, 0x9f, 0xe7, 0xb5, 0xf6, 0x8a, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 
-  0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x8a, 0xfd, 0x1a, 0xef, 0x7f, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xbf, 0xf7, 0xdf, 0xff, 0x59, 0xc6, 0xd3, 0x94, 0xaf, 0x6b, 0xec, 0x52, 0xab, 0x4a, 0xab, 0x4a, 0xec, 0x52, 0xaf, 0x6b, 0xd3, 0x94, 0x59, 0xc6, 0xdf, 0xff, 0xbf, 0xf7, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7f, 0xe7, 0x1a, 0xef, 0x8a, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 
-  0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x8a, 0xfd, 0x3b, 0xef, 0x7e, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0xdf, 0xf7, 0x3d, 0xe7, 0x52, 0x84, 0x29, 0x3a, 0x09, 0x32, 0x49, 0x3a, 0x4a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x4a, 0x3a, 0x49, 0x3a, 0x09, 0x32, 0x29, 0x3a, 0x52, 0x84, 0x3d, 0xe7, 0xdf, 0xf7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xe7, 0x3b, 0xef, 0x8a, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 
-  0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xac, 0xfd, 0x8a, 0xfd, 0x1a, 0xef, 0x7e, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9e, 0xef, 0xbf, 0xf7, 0x72, 0x84, 0xe8, 0x31, 0x49, 0x3a, 0x6a, 0x42, 0x8a, 0x42, 0x8a, 0x42, 0xab, 0x4a, 0xab, 0x4a, 0x0d, 0x5b, 0x2d, 0x5b, 0x0c, 0x53, 0xcb, 0x4a, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x49, 0x3a, 0xe8, 0x31, 0x72, 0x84, 0xbf, 0xf7, 0x9e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xe7, 0x1a, 0xef, 0x8a, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 
-  0xe9, 0xe4, 0xe9, 0xe4, 0xe9, 0xe4, 0xc9, 0xe4, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0x8a, 0xfd, 0x95, 0xf6, 0x7f, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0xdb, 0xd6, 0x4a, 0x42, 0x29, 0x3a, 0x8a, 0x42, 0x6a, 0x42, 0xab, 0x4a, 0x0d, 0x53, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xd0, 0x73, 0x10, 0x74, 0x10, 0x74, 0x10, 0x74, 0x10, 0x74, 0xaf, 0x6b, 0xec, 0x52, 0x6a, 0x42, 0x6a, 0x42, 0x29, 0x3a, 0x4a, 0x42, 0xdb, 0xd6, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7f, 0xe7, 0x95, 0xf6, 0x8a, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 
-  0xc7, 0xfc, 0xc7, 0xfc, 0xc7, 0xfc, 0xa7, 0xf4, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xa9, 0xfd, 0x0f, 0xfe, 0x9f, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xf7, 0xf8, 0xbd, 0xe8, 0x31, 0x6a, 0x42, 0x6a, 0x42, 0xab, 0x4a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x5b, 0xaf, 0x6b, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x10, 0x74, 0xf0, 0x73, 0xec, 0x52, 0x6a, 0x42, 0x6a, 0x42, 0xe8, 0x31, 0xf8, 0xbd, 0xdf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9f, 0xe7, 0x0f, 0xfe, 0xa9, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 0xaa, 0xfd, 
-  0x5a, 0x35, 0x5a, 0x35, 0x5a, 0x35, 0x3a, 0x35, 0xdd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xdd, 0x4d, 0x5e, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0x18, 0xbe, 0xe8, 0x29, 0x8a, 0x42, 0x6a, 0x42, 0xec, 0x52, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x5b, 0x6e, 0x63, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x11, 0x7c, 0x8e, 0x63, 0x6a, 0x42, 0x8a, 0x42, 0xe8, 0x29, 0x18, 0xbe, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5e, 0xe7, 0xdd, 0x4d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 0xfd, 0x5d, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x3a, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x9d, 0x9e, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9e, 0xef, 0xdb, 0xd6, 0xe8, 0x31, 0x8a, 0x42, 0x8a, 0x42, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xd0, 0x73, 0x6a, 0x42, 0x8a, 0x42, 0xe8, 0x31, 0xdb, 0xd6, 0x9e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x9d, 0x9e, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0xdf, 0xf7, 0x6a, 0x42, 0x6a, 0x42, 0x8a, 0x42, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x53, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xcf, 0x6b, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0xdf, 0xf7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x9d, 0x96, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xf7, 0x72, 0x84, 0x29, 0x3a, 0x6a, 0x42, 0xec, 0x52, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x5b, 0x6e, 0x63, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x10, 0x74, 0x8e, 0x63, 0x6a, 0x42, 0x29, 0x3a, 0x72, 0x8c, 0xdf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x9d, 0x96, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x3d, 0xdf, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x5d, 0xef, 0xe8, 0x31, 0x8a, 0x42, 0xab, 0x4a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x5b, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x11, 0x7c, 0xec, 0x52, 0x6a, 0x42, 0xe8, 0x31, 0x5d, 0xef, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x3d, 0xdf, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x1d, 0x5e, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0x92, 0x8c, 0x49, 0x3a, 0x6a, 0x42, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0c, 0x53, 0xec, 0x52, 0x6e, 0x63, 0x11, 0x7c, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x6a, 0x42, 0x49, 0x3a, 0x92, 0x8c, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0x1d, 0x5e, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x7d, 0x96, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xff, 0x4a, 0x3a, 0x6a, 0x42, 0xab, 0x4a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x53, 0xab, 0x4a, 0x6a, 0x42, 0x8a, 0x42, 0x8a, 0x42, 0x6a, 0x42, 0xab, 0x4a, 0xaf, 0x6b, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x10, 0x74, 0xec, 0x52, 0x6a, 0x42, 0x4a, 0x42, 0xdf, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x7d, 0x96, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0xfd, 0xbe, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x7a, 0xce, 0x09, 0x32, 0x8a, 0x42, 0x0c, 0x53, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xec, 0x52, 0x6a, 0x42, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x8a, 0x42, 0x4a, 0x42, 0x6e, 0x63, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x8f, 0x6b, 0x6a, 0x42, 0x09, 0x32, 0x7a, 0xce, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0xfd, 0xbe, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x3d, 0xdf, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbe, 0xf7, 0xf4, 0x94, 0x49, 0x3a, 0x8a, 0x42, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x5b, 0x6a, 0x42, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x4a, 0x42, 0xcf, 0x6b, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x6a, 0x42, 0x49, 0x3a, 0xf4, 0x94, 0xbe, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xdf, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0xf0, 0x73, 0x4a, 0x3a, 0xab, 0x4a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xab, 0x4a, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0xcb, 0x4a, 0x11, 0x7c, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x10, 0x74, 0xab, 0x4a, 0x4a, 0x3a, 0xf0, 0x73, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xff, 0x2d, 0x5b, 0x6a, 0x42, 0xab, 0x4a, 0x2d, 0x5b, 0x0d, 0x53, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x6a, 0x42, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x6a, 0x42, 0x6e, 0x63, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x10, 0x74, 0xec, 0x52, 0x6a, 0x42, 0x2d, 0x5b, 0xdf, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xff, 0xcc, 0x52, 0x6a, 0x42, 0x0c, 0x53, 0xf0, 0x73, 0xaf, 0x6b, 0x8e, 0x63, 0x4d, 0x5b, 0x0d, 0x53, 0x0d, 0x5b, 0x2d, 0x5b, 0x0d, 0x53, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x0c, 0x53, 0x0d, 0x5b, 0x6e, 0x63, 0xd0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x10, 0x74, 0x0d, 0x53, 0x6a, 0x42, 0xcc, 0x52, 0xdf, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xff, 0xec, 0x52, 0x6a, 0x42, 0x0d, 0x53, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x8e, 0x63, 0x2d, 0x5b, 0x0c, 0x53, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x0d, 0x53, 0x2d, 0x5b, 0x0d, 0x5b, 0x0d, 0x53, 0x2d, 0x5b, 0x6e, 0x63, 0x8f, 0x6b, 0xd0, 0x73, 0x0c, 0x53, 0x6a, 0x42, 0xec, 0x52, 0xdf, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xff, 0x2d, 0x5b, 0x6a, 0x42, 0xec, 0x52, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x6e, 0x63, 0x6a, 0x42, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x6a, 0x42, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x5b, 0x0d, 0x5b, 0x2d, 0x5b, 0xab, 0x4a, 0x6a, 0x42, 0x2d, 0x5b, 0xdf, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0x10, 0x7c, 0x4a, 0x3a, 0xab, 0x4a, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x11, 0x7c, 0xcc, 0x4a, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0xab, 0x4a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x8b, 0x4a, 0x4a, 0x3a, 0x10, 0x7c, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x3d, 0xdf, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbe, 0xf7, 0x14, 0x9d, 0x29, 0x3a, 0x6a, 0x42, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xd0, 0x73, 0x6a, 0x42, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x6a, 0x42, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x8a, 0x42, 0x29, 0x3a, 0x14, 0x9d, 0xbe, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x3d, 0xdf, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0xfd, 0xbe, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x9a, 0xce, 0x08, 0x32, 0x6a, 0x42, 0x8e, 0x63, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x8f, 0x6b, 0x6a, 0x42, 0x8a, 0x42, 0x8a, 0x42, 0x8b, 0x42, 0x8b, 0x42, 0x8a, 0x42, 0x8a, 0x42, 0x6a, 0x42, 0x0c, 0x53, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0c, 0x53, 0x8a, 0x42, 0x08, 0x32, 0xba, 0xd6, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0xfd, 0xbe, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x7d, 0x8e, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xff, 0x6a, 0x42, 0x6a, 0x42, 0xcc, 0x52, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xd0, 0x73, 0xec, 0x52, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0xab, 0x4a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xab, 0x4a, 0x6a, 0x42, 0x6a, 0x42, 0xdf, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x7d, 0x8e, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x5d, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0xb3, 0x94, 0x49, 0x3a, 0x6a, 0x42, 0xd0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x11, 0x7c, 0x8e, 0x63, 0x0d, 0x53, 0x0d, 0x53, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x6a, 0x42, 0x49, 0x3a, 0xb3, 0x94, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0xfd, 0x5d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x3d, 0xd7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x9e, 0xef, 0xe8, 0x31, 0x6a, 0x42, 0xcb, 0x4a, 0x11, 0x7c, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xab, 0x4a, 0x8a, 0x42, 0xe8, 0x31, 0x9e, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x3d, 0xd7, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x7d, 0x8e, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0xd3, 0x94, 0x29, 0x3a, 0x6a, 0x42, 0x6e, 0x63, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x8e, 0x63, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xec, 0x52, 0x6a, 0x42, 0x29, 0x3a, 0xd3, 0x94, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x7d, 0x8e, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdf, 0xff, 0xab, 0x4a, 0x6a, 0x42, 0x6a, 0x42, 0xaf, 0x6b, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x0d, 0x53, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x53, 0x6a, 0x42, 0x6a, 0x42, 0xab, 0x4a, 0xdf, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x9d, 0x96, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x1c, 0xe7, 0xe8, 0x31, 0x8a, 0x42, 0x6a, 0x42, 0xaf, 0x6b, 0x10, 0x74, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x4d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x53, 0x8a, 0x42, 0x8a, 0x42, 0xe8, 0x31, 0x1c, 0xe7, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x9d, 0x96, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x5d, 0xe7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbe, 0xf7, 0x7a, 0xce, 0xe8, 0x31, 0x8a, 0x42, 0x6a, 0x42, 0x6e, 0x63, 0x11, 0x7c, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0x6e, 0x63, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xec, 0x52, 0x6a, 0x42, 0x8a, 0x42, 0xe8, 0x31, 0x7a, 0xce, 0x9e, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x1e, 0x56, 0x1e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x1d, 0x6e, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0x7a, 0xce, 0x08, 0x32, 0x6a, 0x42, 0x6a, 0x42, 0xcb, 0x4a, 0xcf, 0x6b, 0x10, 0x7c, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xf0, 0x73, 0xaf, 0x6b, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0d, 0x5b, 0xab, 0x4a, 0x8a, 0x42, 0x6a, 0x42, 0x08, 0x32, 0x7a, 0xce, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0x1d, 0x6e, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x1e, 0x56, 0x3f, 0x56, 0x5a, 0x55, 0x39, 0x55, 0xfd, 0x55, 0x3f, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x9d, 0x9e, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9e, 0xf7, 0x3c, 0xe7, 0xab, 0x4a, 0x29, 0x3a, 0x6a, 0x42, 0x6a, 0x42, 0xcc, 0x4a, 0x6e, 0x63, 0xf0, 0x73, 0x11, 0x7c, 0x10, 0x74, 0x10, 0x74, 0xd0, 0x73, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xec, 0x52, 0xab, 0x4a, 0x6a, 0x42, 0x8a, 0x42, 0x29, 0x3a, 0xab, 0x4a, 0x3c, 0xe7, 0x9e, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0x9d, 0x9e, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x3f, 0x56, 0x18, 0x55, 0xec, 0x5a, 0xcb, 0x5a, 0xec, 0x5a, 0xab, 0x5a, 0xf1, 0x5b, 0x3e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0xfd, 0xbe, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0xff, 0xff, 0xf4, 0x94, 0x09, 0x32, 0x29, 0x3a, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0xab, 0x4a, 0xec, 0x52, 0x0c, 0x53, 0xec, 0x52, 0xab, 0x4a, 0x8b, 0x4a, 0x6a, 0x42, 0x8a, 0x42, 0x6a, 0x42, 0x29, 0x3a, 0x09, 0x32, 0xf4, 0x94, 0xff, 0xff, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0xfd, 0xbe, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x1e, 0x56, 0x39, 0x55, 0xab, 0x5a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xec, 0x5a, 0x8f, 0x5b, 0x5f, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x1d, 0xcf, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbf, 0xf7, 0x9e, 0xf7, 0xd4, 0x94, 0x8b, 0x42, 0x08, 0x32, 0x29, 0x3a, 0x4a, 0x3a, 0x4a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x6a, 0x42, 0x4a, 0x3a, 0x29, 0x3a, 0x08, 0x32, 0x8b, 0x42, 0xd4, 0x94, 0x9e, 0xf7, 0xbf, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x1d, 0xcf, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x3f, 0x56, 0x0d, 0x5b, 0x0d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xcb, 0x5a, 0x39, 0x55, 0x1e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0xfd, 0xbe, 0x9d, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0xbe, 0xf7, 0xff, 0xff, 0xdb, 0xd6, 0x35, 0xa5, 0x31, 0x7c, 0x6e, 0x63, 0x0d, 0x5b, 0x0d, 0x5b, 0x6e, 0x63, 0x31, 0x7c, 0x35, 0xa5, 0xdb, 0xd6, 0xff, 0xff, 0xbe, 0xf7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0xfd, 0xbe, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xbc, 0x55, 0xcb, 0x5a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0c, 0x5b, 0x33, 0x5c, 0x3e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x9d, 0x96, 0x9d, 0xff, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 0x9e, 0xf7, 0xbf, 0xf7, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbf, 0xf7, 0x9e, 0xf7, 0x7e, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x9d, 0xff, 0x9d, 0x96, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x9b, 0x55, 0xcb, 0x5a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0c, 0x5b, 0x33, 0x5c, 0x3e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x1d, 0x66, 0x5d, 0xe7, 0x7d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xf7, 0x5d, 0xe7, 0x1d, 0x66, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x3f, 0x56, 0xec, 0x5a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0xeb, 0x5a, 0xf7, 0x5c, 0x1e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x45, 0x7d, 0x8e, 0x5d, 0xef, 0x7d, 0xf7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x5d, 0xef, 0x7d, 0x8e, 0xdd, 0x45, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x5a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x1e, 0x56, 0x95, 0x5c, 0xcb, 0x5a, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x2d, 0x5b, 0x0c, 0x5b, 0x2d, 0x5b, 0x3f, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0xdd, 0x45, 0x7d, 0x8e, 0x1d, 0xcf, 0x9d, 0xff, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x7d, 0xf7, 0x9d, 0xff, 0x1d, 0xcf, 0x7d, 0x8e, 0xdd, 0x45, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x3a, 0x3d, 0x5a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x5f, 0x56, 0x53, 0x5c, 0xcb, 0x5a, 0xec, 0x5a, 0xec, 0x5a, 0xcb, 0x5a, 0x2d, 0x5b, 0xfd, 0x55, 0x1e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x55, 0xdd, 0x45, 0xfd, 0x55, 0x7d, 0x86, 0xdd, 0xb6, 0x3d, 0xd7, 0x7d, 0xef, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xef, 0x3d, 0xd7, 0xdd, 0xb6, 0x7d, 0x86, 0xfd, 0x55, 0xdd, 0x45, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 
-  0x59, 0x45, 0x3a, 0x3d, 0x5a, 0x3d, 0x39, 0x35, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x3f, 0x56, 0xbc, 0x55, 0xb6, 0x5c, 0x75, 0x5c, 0x39, 0x55, 0x3f, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x55, 0xdd, 0x4d, 0xdd, 0x4d, 0xdd, 0x45, 0xdd, 0x4d, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0xdd, 0x45, 0xdd, 0x4d, 0xdd, 0x4d, 0xdd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x65, 
-  0x1b, 0x76, 0x3a, 0x35, 0x5a, 0x3d, 0x3a, 0x3d, 0xbc, 0x4d, 0xfd, 0x5d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0x1e, 0x56, 0x1e, 0x56, 0x1e, 0x56, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x4d, 0x9d, 0x8e, 
-  0xbf, 0xef, 0xd9, 0x1c, 0x3a, 0x3d, 0x3a, 0x3d, 0x3a, 0x3d, 0x1e, 0x5e, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xbd, 0x3d, 0xdf, 0xf7, 
-  0xff, 0xff, 0xdd, 0xae, 0xd9, 0x1c, 0x3a, 0x35, 0x3a, 0x35, 0x7a, 0x3d, 0x1e, 0x5e, 0xfd, 0x5d, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xdd, 0x55, 0x9d, 0x3d, 0x3e, 0xc7, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x7e, 0xdf, 0xba, 0x5d, 0xf9, 0x24, 0xf9, 0x24, 0xf9, 0x24, 0x7b, 0x3d, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0xbd, 0x45, 0x5d, 0x7e, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+/* 80x80 RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): 12800 -> 5180 字节 */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_CAMERA_ICON uint16_t camera_icon_map[] = {
+  0x0050, 0x0052, 0x0054, 0x0056, 0x0058, 0x005a, 0x005c, 0x005e, 0x006e, 0x0080, 0x0099, 0x00be, 0x00e4, 0x010f, 0x0138, 0x0161,
+  0x018b, 0x01b5, 0x01de, 0x0203, 0x0232, 0x024b, 0x0259, 0x026a, 0x0286, 0x02a7, 0x02c9, 0x02e4, 0x02fb, 0x031e, 0x0346, 0x0371,
+  0x039f, 0x03cc, 0x03f7, 0x0420, 0x0447, 0x046e, 0x0497, 0x04bd, 0x04e3, 0x0511, 0x0540, 0x056b, 0x0596, 0x05c4, 0x05f3, 0x0621,
+  0x064f, 0x067a, 0x06a6, 0x06d4, 0x06ff, 0x0726, 0x074c, 0x0775, 0x079a, 0x07c4, 0x07ef, 0x081f, 0x0856, 0x088d, 0x08c1, 0x08f3,
+  0x091f, 0x093f, 0x0961, 0x098a, 0x09b2, 0x09d4, 0x09e4, 0x09f0, 0x0a00, 0x0a10, 0x0a12, 0x0a14, 0x0a16, 0x0a18, 0x0a1a, 0x0a1c,
+  0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8019, 0xffff,
+  0x0006, 0xf633, 0xe4c9, 0xe487, 0xe467, 0xece8, 0xfd69, 0x801d, 0xfd8a, 0x0002, 0xfe2f, 0xff9c, 0x8012, 0xffff, 0x8018, 0xffff,
+  0x0007, 0xe4c9, 0xe4a8, 0xe4c9, 0xe4c9, 0xfd8b, 0xfdcc, 0xfdcc, 0x801d, 0xfdac, 0x0003, 0xfdab, 0xfd69, 0xfef7, 0x8011, 0xffff,
+  0x8008, 0xffff, 0x0006, 0xf7be, 0xf7be, 0xffbf, 0xffff, 0xffdf, 0xffdf, 0x8009, 0xffff, 0x0005, 0xed4c, 0xe4a8, 0xe4e9, 0xe4c9,
+  0xf56b, 0x8021, 0xfdcc, 0x0003, 0xfdac, 0xfd69, 0xff9c, 0x8010, 0xffff, 0x8006, 0xffff, 0x000a, 0xffdf, 0xce59, 0xd67a, 0xd679,
+  0xd6bb, 0xef5d, 0xe75d, 0xe75d, 0xe73d, 0xf7bf, 0x8006, 0xffff, 0x0005, 0xff9c, 0xe467, 0xe4e9, 0xe4c9, 0xe4c9, 0x8013, 0xfdcc,
+  0x0002, 0xf54a, 0xe4ea, 0x800a, 0xe4e9, 0x0006, 0xed0a, 0xfd8b, 0xfdcc, 0xfdcc, 0xfdab, 0xfe0f, 0x8010, 0xffff, 0x8006, 0xffff,
+  0x0001, 0xe73c, 0x8003, 0xd69a, 0x0002, 0xdedb, 0xef7e, 0x8003, 0xef5d, 0x0001, 0xef7e, 0x8006, 0xffff, 0x0005, 0xf612, 0xe4a8,
+  0xe4e9, 0xe4c9, 0xf52a, 0x8012, 0xfdcc, 0x0003, 0xecea, 0xe4c9, 0xe4c9, 0x800a, 0xe4a8, 0x0006, 0xe4c9, 0xe4a9, 0xfd8b, 0xfdcc,
+  0xfdac, 0xfd6a, 0x8010, 0xffff, 0x8006, 0xffff, 0x0001, 0xef3d, 0x8003, 0xd69a, 0x0002, 0xdedb, 0xef7e, 0x8003, 0xef5d, 0x0001,
+  0xef7e, 0x8006, 0xffff, 0x0001, 0xe4a8, 0x8003, 0xe4c9, 0x0001, 0xfd8c, 0x8011, 0xfdcc, 0x0005, 0xf56b, 0xe4c9, 0xe4c9, 0xe56e,
+  0xe5f2, 0x8007, 0xe5f1, 0x0009, 0xe5f2, 0xe5f2, 0xe4c9, 0xe4c9, 0xe4e9, 0xfdcc, 0xfdcc, 0xfd8a, 0xff17, 0x800f, 0xffff, 0x8006,
+  0xffff, 0x0001, 0xef3d, 0x8003, 0xd69a, 0x0002, 0xdedb, 0xef7e, 0x8003, 0xef5d, 0x0001, 0xef7e, 0x8005, 0xffff, 0x0005, 0xff5b,
+  0xe487, 0xe4e9, 0xe4c9, 0xe4e9, 0x8012, 0xfdcc, 0x0004, 0xf52a, 0xe4c9, 0xe4c9, 0xefdf, 0x8009, 0xef9f, 0x0008, 0xefbf, 0xee76,
+  0xe4a8, 0xe4c9, 0xfdcc, 0xfdcc, 0xfdab, 0xfdee, 0x800f, 0xffff, 0x8006, 0xffff, 0x0001, 0xef3d, 0x8003, 0xd69a, 0x0002, 0xdedb,
+  0xef7e, 0x8003, 0xef5d, 0x0001, 0xef7e, 0x8005, 0xffff, 0x0005, 0xf5f1, 0xe4a8, 0xe4e9, 0xe4c9, 0xf54b, 0x8012, 0xfdcc, 0x0004,
+  0xf52a, 0xe4c9, 0xe4ea, 0xef9f, 0x8009, 0xef5d, 0x0008, 0xef7e, 0xee97, 0xe4a8, 0xe4c9, 0xfdcc, 0xfdcc, 0xfdac, 0xfd69, 0x800f,
+  0xffff, 0x8006, 0xffff, 0x0001, 0xef3d, 0x8003, 0xd69a, 0x0002, 0xdedb, 0xef7e, 0x8003, 0xef5d, 0x0001, 0xef7e, 0x8005, 0xffff,
+  0x0005, 0xe4a8, 0xe4c9, 0xe4e9, 0xe4c9, 0xfdac, 0x8012, 0xfdcc, 0x0004, 0xf52a, 0xe4c9, 0xe4ea, 0xefbf, 0x8009, 0xef5d, 0x0004,
+  0xef7e, 0xee97, 0xe4a8, 0xe4c9, 0x8003, 0xfdcc, 0x0002, 0xfd8b, 0xfef6, 0x800e, 0xffff, 0x8006, 0xffff, 0x0001, 0xef3d, 0x8003,
+  0xd69a, 0x0002, 0xdedb, 0xef7e, 0x8003, 0xef5d, 0x0001, 0xef7e, 0x8004, 0xffff, 0x0005, 0xff19, 0xe487, 0xe4e9, 0xe4c9, 0xe4ea,
+  0x8013, 0xfdcc, 0x0004, 0xf54a, 0xe4c9, 0xe4c8, 0xefbf, 0x8009, 0xef9f, 0x0004, 0xefbf, 0xe655, 0xe4a8, 0xe4c9, 0x8003, 0xfdcc,
+  0x0002, 0xfdac, 0xfdcc, 0x800e, 0xffff, 0x8006, 0xffff, 0x0001, 0xef3d, 0x8003, 0xd69a, 0x0002, 0xdedb, 0xef7e, 0x8003, 0xef5d,
+  0x0001, 0xef7e, 0x8004, 0xffff, 0x8003, 0xe4c9, 0x0002, 0xe4a9, 0xfdac, 0x8013, 0xfdcc, 0x0004, 0xfd8b, 0xe4c9, 0xe4c9, 0xe4ea,
+  0x8009, 0xe54d, 0x0004, 0xe54c, 0xe4a8, 0xe4c9, 0xecea, 0x8004, 0xfdcc, 0x0002, 0xfd8a, 0xff17, 0x800d, 0xffff, 0x8006, 0xffff,
+  0x0005, 0xef5d, 0xd69b, 0xd6bb, 0xd69b, 0xdedc, 0x8003, 0xef7e, 0x0002, 0xe77e, 0xef9e, 0x8003, 0xffff, 0x0005, 0xe50b, 0xe4a8,
+  0xe4c9, 0xe4c9, 0xfd8b, 0x8015, 0xfdcc, 0x0001, 0xed2a, 0x800e, 0xe4c9, 0x0001, 0xfdac, 0x8004, 0xfdcc, 0x0003, 0xfdac, 0xfd6a,
+  0xff18, 0x800c, 0xffff, 0x8004, 0xffff, 0x0008, 0xff5b, 0xff39, 0xe677, 0xd5f5, 0xde35, 0xe656, 0xe677, 0xf6f8, 0x8003, 0xeef8,
+  0x0007, 0xf6f9, 0xff39, 0xf631, 0xecc8, 0xed09, 0xed2a, 0xf56b, 0x8018, 0xfdcc, 0x0003, 0xfd6b, 0xed2a, 0xed0a, 0x8008, 0xed2a,
+  0x0003, 0xed0a, 0xf54a, 0xfdac, 0x8006, 0xfdcc, 0x0005, 0xfdac, 0xfd8a, 0xfded, 0xfef7, 0xff5a, 0x8004, 0xff7a, 0x0001, 0xff9c,
+  0x8004, 0xffff, 0x0003, 0xffff, 0xffff, 0xf674, 0x8003, 0xe487, 0x0001, 0xece9, 0x8004, 0xfdab, 0x8006, 0xfd8a, 0x0001, 0xfdab,
+  0x8032, 0xfdcc, 0x0002, 0xfdab, 0xfd8b, 0x8007, 0xfd8a, 0x0003, 0xfef6, 0xffff, 0xffff, 0x0006, 0xffff, 0xedaf, 0xe487, 0xe4c9,
+  0xe4c9, 0xf54b, 0x8046, 0xfdcc, 0x0004, 0xfdac, 0xfd8a, 0xfe72, 0xffff, 0x0006, 0xff19, 0xe487, 0xe4c9, 0xe4c9, 0xecea, 0xfdec,
+  0x801f, 0xfdcc, 0x8006, 0xfdac, 0x8022, 0xfdcc, 0x0003, 0xfdac, 0xfd69, 0xff7b, 0x0005, 0xed8e, 0xe4c9, 0xe4e9, 0xe4c9, 0xf56b,
+  0x801c, 0xfdcc, 0x000e, 0xfdab, 0xfdab, 0xfd8a, 0xfd8a, 0xfdab, 0xfdac, 0xfdcd, 0xfdcd, 0xfdac, 0xfdab, 0xfd8a, 0xfd8a, 0xfdab,
+  0xfdab, 0x801f, 0xfdcc, 0x0002, 0xfdab, 0xfe51, 0x0005, 0xe4e9, 0xe4c9, 0xe4e9, 0xe4c9, 0xfdac, 0x8019, 0xfdcc, 0x0008, 0xfdac,
+  0xfdab, 0xfd8a, 0xfded, 0xf673, 0xeef9, 0xef5c, 0xe77f, 0x8004, 0xe79f, 0x0008, 0xe77f, 0xef5c, 0xeef9, 0xf673, 0xfded, 0xfd8a,
+  0xfdab, 0xfdac, 0x801c, 0xfdcc, 0x0002, 0xfdac, 0xfdcd, 0x0005, 0xe4c9, 0xe4e9, 0xe4e9, 0xe4c9, 0xfdac, 0x8017, 0xfdcc, 0x0009,
+  0xfdac, 0xfdab, 0xfdab, 0xf674, 0xef3c, 0xe79f, 0xe77e, 0xef7e, 0xef5e, 0x8006, 0xef5d, 0x0009, 0xef5e, 0xef7e, 0xe77e, 0xe79f,
+  0xef3c, 0xf674, 0xfdab, 0xfdab, 0xfdac, 0x801b, 0xfdcc, 0x0001, 0xfdac, 0x8003, 0xe4e9, 0x0002, 0xe4c9, 0xfdac, 0x8015, 0xfdcc,
+  0x0007, 0xfdac, 0xfdab, 0xfd8a, 0xf695, 0xe77f, 0xe77f, 0xef7e, 0x800e, 0xef5d, 0x0007, 0xef7e, 0xe77f, 0xe77f, 0xf695, 0xfd8a,
+  0xfdab, 0xfdac, 0x801a, 0xfdcc, 0x8003, 0xe4e9, 0x0002, 0xe4c9, 0xfdac, 0x8014, 0xfdcc, 0x0005, 0xfdac, 0xfd8a, 0xfe0f, 0xef5d,
+  0xe77f, 0x8014, 0xef5d, 0x0005, 0xe77f, 0xef5d, 0xfe0f, 0xfd8a, 0xfdac, 0x8019, 0xfdcc, 0x8003, 0xe4e9, 0x0002, 0xe4c9, 0xfdac,
+  0x8013, 0xfdcc, 0x0005, 0xfdac, 0xfd8a, 0xf6b5, 0xe79f, 0xef5e, 0x8006, 0xef5d, 0x0003, 0xef9e, 0xf7be, 0xf7df, 0x8004, 0xffdf,
+  0x0003, 0xf7df, 0xf7be, 0xef9e, 0x8006, 0xef5d, 0x0005, 0xef5e, 0xe79f, 0xf6b5, 0xfd8a, 0xfdac, 0x8018, 0xfdcc, 0x8003, 0xe4e9,
+  0x0002, 0xe4c9, 0xfdac, 0x8012, 0xfdcc, 0x0004, 0xfdac, 0xfd8a, 0xef1a, 0xe77f, 0x8005, 0xef5d, 0x0010, 0xef7e, 0xf7bf, 0xffdf,
+  0xc659, 0x94d3, 0x6baf, 0x52ec, 0x4aab, 0x4aab, 0x52ec, 0x6baf, 0x94d3, 0xc659, 0xffdf, 0xf7bf, 0xef7e, 0x8005, 0xef5d, 0x0004,
+  0xe77f, 0xef1a, 0xfd8a, 0xfdac, 0x8017, 0xfdcc, 0x8003, 0xe4e9, 0x0002, 0xe4c9, 0xfdac, 0x8011, 0xfdcc, 0x0004, 0xfdac, 0xfd8a,
+  0xef3b, 0xe77e, 0x8004, 0xef5d, 0x0008, 0xef7d, 0xf7df, 0xe73d, 0x8452, 0x3a29, 0x3209, 0x3a49, 0x424a, 0x8004, 0x426a, 0x0008,
+  0x3a4a, 0x3a49, 0x3209, 0x3a29, 0x8452, 0xe73d, 0xf7df, 0xef7d, 0x8004, 0xef5d, 0x0004, 0xe77e, 0xef3b, 0xfd8a, 0xfdac, 0x8016,
+  0xfdcc, 0x8003, 0xe4e9, 0x0002, 0xe4c9, 0xfdac, 0x8010, 0xfdcc, 0x0004, 0xfdac, 0xfd8a, 0xef1a, 0xe77e, 0x8004, 0xef5d, 0x000e,
+  0xef9e, 0xf7bf, 0x8472, 0x31e8, 0x3a49, 0x426a, 0x428a, 0x428a, 0x4aab, 0x4aab, 0x5b0d, 0x5b2d, 0x530c, 0x4acb, 0x8003, 0x426a,
+  0x0005, 0x3a49, 0x31e8, 0x8472, 0xf7bf, 0xef9e, 0x8004, 0xef5d, 0x0004, 0xe77e, 0xef1a, 0xfd8a, 0xfdac, 0x8015, 0xfdcc, 0x8003,
+  0xe4e9, 0x0002, 0xe4c9, 0xfdac, 0x8010, 0xfdcc, 0x0003, 0xfd8a, 0xf695, 0xe77f, 0x8004, 0xef5d, 0x0008, 0xf7bf, 0xd6db, 0x424a,
+  0x3a29, 0x428a, 0x426a, 0x4aab, 0x530d, 0x8003, 0x5b2d, 0x0001, 0x73d0, 0x8004, 0x7410, 0x0008, 0x6baf, 0x52ec, 0x426a, 0x426a,
+  0x3a29, 0x424a, 0xd6db, 0xf7bf, 0x8004, 0xef5d, 0x0003, 0xe77f, 0xf695, 0xfd8a, 0x8015, 0xfdcc, 0x8003, 0xfcc7, 0x0001, 0xf4a7,
+  0x8010, 0xfdaa, 0x0003, 0xfda9, 0xfe0f, 0xe79f, 0x8004, 0xef5d, 0x0006, 0xf7df, 0xbdf8, 0x31e8, 0x426a, 0x426a, 0x4aab, 0x8005,
+  0x5b2d, 0x0002, 0x5b0d, 0x6baf, 0x8005, 0x73f0, 0x0008, 0x7410, 0x73f0, 0x52ec, 0x426a, 0x426a, 0x31e8, 0xbdf8, 0xf7df, 0x8004,
+  0xef5d, 0x0003, 0xe79f, 0xfe0f, 0xfda9, 0x8014, 0xfdaa, 0x8003, 0x355a, 0x0002, 0x353a, 0x5ddd, 0x800f, 0x5dfd, 0x0002, 0x4ddd,
+  0xe75e, 0x8004, 0xef5d, 0x0006, 0xf7bf, 0xbe18, 0x29e8, 0x428a, 0x426a, 0x52ec, 0x8006, 0x5b2d, 0x0002, 0x5b0d, 0x636e, 0x8007,
+  0x73f0, 0x0007, 0x7c11, 0x638e, 0x426a, 0x428a, 0x29e8, 0xbe18, 0xf7bf, 0x8004, 0xef5d, 0x0002, 0xe75e, 0x4ddd, 0x8014, 0x5dfd,
+  0x8003, 0x3d5a, 0x0002, 0x353a, 0x55dd, 0x800e, 0x55fd, 0x0003, 0x4ddd, 0x9e9d, 0xf77d, 0x8003, 0xef5d, 0x0006, 0xef9e, 0xd6db,
+  0x31e8, 0x428a, 0x428a, 0x5b0d, 0x8009, 0x5b2d, 0x8009, 0x73f0, 0x0006, 0x73d0, 0x426a, 0x428a, 0x31e8, 0xd6db, 0xef9e, 0x8003,
+  0xef5d, 0x0003, 0xf77d, 0x9e9d, 0x4ddd, 0x8013, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800e, 0x55fd, 0x0002, 0x4ddd,
+  0xf77d, 0x8003, 0xef5d, 0x0006, 0xef7d, 0xf7df, 0x426a, 0x426a, 0x428a, 0x5b0d, 0x8009, 0x5b2d, 0x0001, 0x530d, 0x800a, 0x73f0,
+  0x0001, 0x6bcf, 0x8003, 0x426a, 0x0002, 0xf7df, 0xef7d, 0x8003, 0xef5d, 0x0002, 0xf77d, 0x4ddd, 0x8013, 0x55fd, 0x8003, 0x3d5a,
+  0x0002, 0x3539, 0x55dd, 0x800d, 0x55fd, 0x0003, 0x4ddd, 0x969d, 0xf77d, 0x8003, 0xef5d, 0x0005, 0xf7df, 0x8472, 0x3a29, 0x426a,
+  0x52ec, 0x800a, 0x5b2d, 0x0002, 0x5b0d, 0x636e, 0x8009, 0x73f0, 0x0006, 0x7410, 0x638e, 0x426a, 0x3a29, 0x8c72, 0xf7df, 0x8003,
+  0xef5d, 0x0003, 0xf77d, 0x969d, 0x4ddd, 0x8012, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800d, 0x55fd, 0x000a, 0x45dd,
+  0xdf3d, 0xef7d, 0xef5d, 0xef5d, 0xef7e, 0xef5d, 0x31e8, 0x428a, 0x4aab, 0x800c, 0x5b2d, 0x0001, 0x5b0d, 0x800a, 0x73f0, 0x000b,
+  0x7c11, 0x52ec, 0x426a, 0x31e8, 0xef5d, 0xef7e, 0xef5d, 0xef5d, 0xef7d, 0xdf3d, 0x45dd, 0x8012, 0x55fd, 0x8003, 0x3d5a, 0x0002,
+  0x3539, 0x55dd, 0x800d, 0x55fd, 0x0002, 0x5e1d, 0xff9d, 0x8003, 0xef5d, 0x0004, 0xf7bf, 0x8c92, 0x3a49, 0x426a, 0x800c, 0x5b2d,
+  0x0004, 0x530c, 0x52ec, 0x636e, 0x7c11, 0x800a, 0x73f0, 0x0004, 0x426a, 0x3a49, 0x8c92, 0xf7bf, 0x8003, 0xef5d, 0x0002, 0xff9d,
+  0x5e1d, 0x8012, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x0003, 0x4ddd, 0x967d, 0xf77d, 0x8003, 0xef5d,
+  0x0004, 0xffdf, 0x3a4a, 0x426a, 0x4aab, 0x8009, 0x5b2d, 0x0009, 0x530d, 0x4aab, 0x426a, 0x428a, 0x428a, 0x426a, 0x4aab, 0x6baf,
+  0x7410, 0x8007, 0x73f0, 0x0005, 0x7410, 0x52ec, 0x426a, 0x424a, 0xffdf, 0x8003, 0xef5d, 0x0003, 0xf77d, 0x967d, 0x4ddd, 0x8011,
+  0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x000a, 0x4ddd, 0xbefd, 0xef7d, 0xef5d, 0xef5d, 0xef7e, 0xce7a,
+  0x3209, 0x428a, 0x530c, 0x8008, 0x5b2d, 0x0003, 0x52ec, 0x426a, 0x428a, 0x8003, 0x428b, 0x0005, 0x428a, 0x428a, 0x424a, 0x636e,
+  0x7410, 0x8007, 0x73f0, 0x000a, 0x6b8f, 0x426a, 0x3209, 0xce7a, 0xef7e, 0xef5d, 0xef5d, 0xef7d, 0xbefd, 0x4ddd, 0x8011, 0x55fd,
+  0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x0002, 0x45dd, 0xdf3d, 0x8003, 0xef5d, 0x0004, 0xf7be, 0x94f4, 0x3a49,
+  0x428a, 0x8008, 0x5b2d, 0x0003, 0x5b0d, 0x426a, 0x428a, 0x8006, 0x428b, 0x0003, 0x428a, 0x424a, 0x6bcf, 0x8008, 0x73f0, 0x0004,
+  0x426a, 0x3a49, 0x94f4, 0xf7be, 0x8003, 0xef5d, 0x0002, 0xdf3d, 0x45dd, 0x8011, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd,
+  0x800c, 0x55fd, 0x0002, 0x4ddd, 0xf77d, 0x8003, 0xef5d, 0x0004, 0xf7bf, 0x73f0, 0x3a4a, 0x4aab, 0x8008, 0x5b2d, 0x0002, 0x4aab,
+  0x428a, 0x8008, 0x428b, 0x0003, 0x428a, 0x4acb, 0x7c11, 0x8006, 0x73f0, 0x0005, 0x7410, 0x4aab, 0x3a4a, 0x73f0, 0xf7bf, 0x8003,
+  0xef5d, 0x0002, 0xf77d, 0x4ddd, 0x8011, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x0002, 0x4ddd, 0xff9d,
+  0x8003, 0xef5d, 0x0007, 0xffdf, 0x5b2d, 0x426a, 0x4aab, 0x5b2d, 0x530d, 0x5b0d, 0x8005, 0x5b2d, 0x0002, 0x426a, 0x428a, 0x8008,
+  0x428b, 0x0003, 0x428a, 0x426a, 0x636e, 0x8006, 0x73f0, 0x0005, 0x7410, 0x52ec, 0x426a, 0x5b2d, 0xffdf, 0x8003, 0xef5d, 0x0002,
+  0xff9d, 0x4ddd, 0x8011, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800d, 0x55fd, 0x0001, 0xff9d, 0x8003, 0xef5d, 0x000d,
+  0xffdf, 0x52cc, 0x426a, 0x530c, 0x73f0, 0x6baf, 0x638e, 0x5b4d, 0x530d, 0x5b0d, 0x5b2d, 0x530d, 0x428a, 0x800a, 0x428b, 0x0005,
+  0x428a, 0x530c, 0x5b0d, 0x636e, 0x73d0, 0x8003, 0x73f0, 0x0005, 0x7410, 0x530d, 0x426a, 0x52cc, 0xffdf, 0x8003, 0xef5d, 0x0001,
+  0xff9d, 0x8012, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800d, 0x55fd, 0x0001, 0xff9d, 0x8003, 0xef5d, 0x0005, 0xffdf,
+  0x52ec, 0x426a, 0x530d, 0x7410, 0x8004, 0x73f0, 0x0004, 0x638e, 0x5b2d, 0x530c, 0x428a, 0x800a, 0x428b, 0x000d, 0x428a, 0x530d,
+  0x5b2d, 0x5b0d, 0x530d, 0x5b2d, 0x636e, 0x6b8f, 0x73d0, 0x530c, 0x426a, 0x52ec, 0xffdf, 0x8003, 0xef5d, 0x0001, 0xff9d, 0x8012,
+  0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x0002, 0x4ddd, 0xff9d, 0x8003, 0xef5d, 0x0005, 0xffdf, 0x5b2d,
+  0x426a, 0x52ec, 0x7410, 0x8006, 0x73f0, 0x0003, 0x636e, 0x426a, 0x428a, 0x8008, 0x428b, 0x0002, 0x428a, 0x426a, 0x8005, 0x5b2d,
+  0x0007, 0x5b0d, 0x5b0d, 0x5b2d, 0x4aab, 0x426a, 0x5b2d, 0xffdf, 0x8003, 0xef5d, 0x0002, 0xff9d, 0x4ddd, 0x8011, 0x55fd, 0x8003,
+  0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x0002, 0x4ddd, 0xf77d, 0x8003, 0xef5d, 0x0005, 0xf7bf, 0x7c10, 0x3a4a, 0x4aab,
+  0x7410, 0x8006, 0x73f0, 0x0003, 0x7c11, 0x4acc, 0x428a, 0x8008, 0x428b, 0x0002, 0x428a, 0x4aab, 0x8008, 0x5b2d, 0x0004, 0x4a8b,
+  0x3a4a, 0x7c10, 0xf7bf, 0x8003, 0xef5d, 0x0002, 0xf77d, 0x4ddd, 0x8011, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c,
+  0x55fd, 0x000a, 0x45dd, 0xdf3d, 0xef7d, 0xef5d, 0xef5d, 0xf7be, 0x9d14, 0x3a29, 0x426a, 0x7410, 0x8007, 0x73f0, 0x0003, 0x73d0,
+  0x426a, 0x428a, 0x8006, 0x428b, 0x0003, 0x428a, 0x426a, 0x5b0d, 0x8008, 0x5b2d, 0x0009, 0x428a, 0x3a29, 0x9d14, 0xf7be, 0xef5d,
+  0xef5d, 0xef7d, 0xdf3d, 0x45dd, 0x8011, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x000a, 0x4ddd, 0xbefd,
+  0xef7d, 0xef5d, 0xef5d, 0xef7e, 0xce9a, 0x3208, 0x426a, 0x638e, 0x8008, 0x73f0, 0x000a, 0x6b8f, 0x426a, 0x428a, 0x428a, 0x428b,
+  0x428b, 0x428a, 0x428a, 0x426a, 0x530c, 0x8008, 0x5b2d, 0x000a, 0x530c, 0x428a, 0x3208, 0xd6ba, 0xef7e, 0xef5d, 0xef5d, 0xef7d,
+  0xbefd, 0x4ddd, 0x8011, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800c, 0x55fd, 0x0003, 0x4ddd, 0x8e7d, 0xf77d, 0x8003,
+  0xef5d, 0x0005, 0xffdf, 0x426a, 0x426a, 0x52cc, 0x7410, 0x8008, 0x73f0, 0x0002, 0x73d0, 0x52ec, 0x8004, 0x426a, 0x0001, 0x4aab,
+  0x800a, 0x5b2d, 0x0004, 0x4aab, 0x426a, 0x426a, 0xffdf, 0x8003, 0xef5d, 0x0003, 0xf77d, 0x8e7d, 0x4ddd, 0x8011, 0x55fd, 0x8003,
+  0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800d, 0x55fd, 0x0002, 0x5dfd, 0xff9d, 0x8003, 0xef5d, 0x0005, 0xf7bf, 0x94b3, 0x3a49, 0x426a,
+  0x73d0, 0x8009, 0x73f0, 0x0004, 0x7c11, 0x638e, 0x530d, 0x530d, 0x800c, 0x5b2d, 0x0004, 0x426a, 0x3a49, 0x94b3, 0xf7bf, 0x8003,
+  0xef5d, 0x0002, 0xff9d, 0x5dfd, 0x8012, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800d, 0x55fd, 0x000b, 0x45dd, 0xd73d,
+  0xef7d, 0xef5d, 0xef5d, 0xef7d, 0xef9e, 0x31e8, 0x426a, 0x4acb, 0x7c11, 0x800a, 0x73f0, 0x0001, 0x5b0d, 0x800c, 0x5b2d, 0x000a,
+  0x4aab, 0x428a, 0x31e8, 0xef9e, 0xef7d, 0xef5d, 0xef5d, 0xef7d, 0xd73d, 0x45dd, 0x8012, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539,
+  0x55dd, 0x800d, 0x55fd, 0x0003, 0x4ddd, 0x8e7d, 0xf77d, 0x8003, 0xef5d, 0x0006, 0xf7bf, 0x94d3, 0x3a29, 0x426a, 0x636e, 0x7410,
+  0x8009, 0x73f0, 0x0002, 0x638e, 0x5b0d, 0x800a, 0x5b2d, 0x0005, 0x52ec, 0x426a, 0x3a29, 0x94d3, 0xf7bf, 0x8003, 0xef5d, 0x0003,
+  0xf77d, 0x8e7d, 0x4ddd, 0x8012, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800e, 0x55fd, 0x0002, 0x45dd, 0xef7d, 0x8004,
+  0xef5d, 0x0005, 0xffdf, 0x4aab, 0x426a, 0x426a, 0x6baf, 0x800a, 0x73f0, 0x0001, 0x530d, 0x8009, 0x5b2d, 0x0005, 0x530d, 0x426a,
+  0x426a, 0x4aab, 0xffdf, 0x8004, 0xef5d, 0x0002, 0xef7d, 0x45dd, 0x8013, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800e,
+  0x55fd, 0x0003, 0x4ddd, 0x969d, 0xf77d, 0x8003, 0xef5d, 0x0007, 0xef7e, 0xe71c, 0x31e8, 0x428a, 0x426a, 0x6baf, 0x7410, 0x8008,
+  0x73f0, 0x0001, 0x5b4d, 0x8008, 0x5b2d, 0x0006, 0x530d, 0x428a, 0x428a, 0x31e8, 0xe71c, 0xef7e, 0x8003, 0xef5d, 0x0003, 0xf77d,
+  0x969d, 0x4ddd, 0x8013, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x800f, 0x55fd, 0x0003, 0x45dd, 0xe75d, 0xef7d, 0x8003,
+  0xef5d, 0x0007, 0xf7be, 0xce7a, 0x31e8, 0x428a, 0x426a, 0x636e, 0x7c11, 0x8007, 0x73f0, 0x0002, 0x636e, 0x5b0d, 0x8006, 0x5b2d,
+  0x0006, 0x52ec, 0x426a, 0x428a, 0x31e8, 0xce7a, 0xf79e, 0x8003, 0xef5d, 0x0003, 0xef7d, 0xe75d, 0x45dd, 0x8014, 0x55fd, 0x8003,
+  0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8009, 0x55fd, 0x0002, 0x561e, 0x561e, 0x8005, 0x55fd, 0x0002, 0x6e1d, 0xff9d, 0x8004, 0xef5d,
+  0x0008, 0xf7bf, 0xce7a, 0x3208, 0x426a, 0x426a, 0x4acb, 0x6bcf, 0x7c10, 0x8005, 0x73f0, 0x0002, 0x6baf, 0x5b0d, 0x8004, 0x5b2d,
+  0x0007, 0x5b0d, 0x4aab, 0x428a, 0x426a, 0x3208, 0xce7a, 0xf7bf, 0x8004, 0xef5d, 0x0002, 0xff9d, 0x6e1d, 0x8015, 0x55fd, 0x8003,
+  0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8007, 0x55fd, 0x0006, 0x561e, 0x563f, 0x555a, 0x5539, 0x55fd, 0x563f, 0x8003, 0x55fd, 0x0003,
+  0x4ddd, 0x9e9d, 0xff9d, 0x8004, 0xef5d, 0x000d, 0xf79e, 0xe73c, 0x4aab, 0x3a29, 0x426a, 0x426a, 0x4acc, 0x636e, 0x73f0, 0x7c11,
+  0x7410, 0x7410, 0x73d0, 0x8003, 0x5b2d, 0x0008, 0x52ec, 0x4aab, 0x426a, 0x428a, 0x3a29, 0x4aab, 0xe73c, 0xf79e, 0x8004, 0xef5d,
+  0x0003, 0xff9d, 0x9e9d, 0x4ddd, 0x8015, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8006, 0x55fd, 0x0008, 0x563f, 0x5518,
+  0x5aec, 0x5acb, 0x5aec, 0x5aab, 0x5bf1, 0x563e, 0x8003, 0x55fd, 0x0003, 0x45dd, 0xbefd, 0xf77d, 0x8004, 0xef5d, 0x0005, 0xef7e,
+  0xffff, 0x94f4, 0x3209, 0x3a29, 0x8003, 0x426a, 0x000e, 0x4aab, 0x52ec, 0x530c, 0x52ec, 0x4aab, 0x4a8b, 0x426a, 0x428a, 0x426a,
+  0x3a29, 0x3209, 0x94f4, 0xffff, 0xef7e, 0x8004, 0xef5d, 0x0003, 0xf77d, 0xbefd, 0x45dd, 0x8016, 0x55fd, 0x8003, 0x3d5a, 0x0002,
+  0x3539, 0x55dd, 0x8005, 0x55fd, 0x0003, 0x561e, 0x5539, 0x5aab, 0x8004, 0x5b2d, 0x0003, 0x5aec, 0x5b8f, 0x565f, 0x8003, 0x55fd,
+  0x0003, 0x45dd, 0xcf1d, 0xf77d, 0x8005, 0xef5d, 0x0008, 0xf7bf, 0xf79e, 0x94d4, 0x428b, 0x3208, 0x3a29, 0x3a4a, 0x424a, 0x8003,
+  0x426a, 0x0007, 0x3a4a, 0x3a29, 0x3208, 0x428b, 0x94d4, 0xf79e, 0xf7bf, 0x8005, 0xef5d, 0x0003, 0xf77d, 0xcf1d, 0x45dd, 0x8017,
+  0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8005, 0x55fd, 0x0003, 0x563f, 0x5b0d, 0x5b0d, 0x8005, 0x5b2d, 0x0003, 0x5acb,
+  0x5539, 0x561e, 0x8003, 0x55fd, 0x0003, 0x45dd, 0xbefd, 0xff9d, 0x8005, 0xef5d, 0x0010, 0xef7d, 0xf7be, 0xffff, 0xd6db, 0xa535,
+  0x7c31, 0x636e, 0x5b0d, 0x5b0d, 0x636e, 0x7c31, 0xa535, 0xd6db, 0xffff, 0xf7be, 0xef7d, 0x8005, 0xef5d, 0x0003, 0xff9d, 0xbefd,
+  0x45dd, 0x8018, 0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8005, 0x55fd, 0x0002, 0x55bc, 0x5acb, 0x8006, 0x5b2d, 0x0003,
+  0x5b0c, 0x5c33, 0x563e, 0x8004, 0x55fd, 0x0004, 0x45dd, 0x969d, 0xff9d, 0xef7d, 0x8006, 0xef5d, 0x0003, 0xef7e, 0xf79e, 0xf7bf,
+  0x8004, 0xffdf, 0x0003, 0xf7bf, 0xf79e, 0xef7e, 0x8006, 0xef5d, 0x0004, 0xef7d, 0xff9d, 0x969d, 0x45dd, 0x8019, 0x55fd, 0x8003,
+  0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8005, 0x55fd, 0x0002, 0x559b, 0x5acb, 0x8006, 0x5b2d, 0x0003, 0x5b0c, 0x5c33, 0x563e, 0x8005,
+  0x55fd, 0x0004, 0x4ddd, 0x661d, 0xe75d, 0xf77d, 0x8014, 0xef5d, 0x0004, 0xf77d, 0xe75d, 0x661d, 0x4ddd, 0x801a, 0x55fd, 0x8003,
+  0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8005, 0x55fd, 0x0002, 0x563f, 0x5aec, 0x8006, 0x5b2d, 0x0003, 0x5aeb, 0x5cf7, 0x561e, 0x8007,
+  0x55fd, 0x0005, 0x45dd, 0x8e7d, 0xef5d, 0xf77d, 0xef7d, 0x800e, 0xef5d, 0x0005, 0xef7d, 0xf77d, 0xef5d, 0x8e7d, 0x45dd, 0x801c,
+  0x55fd, 0x8003, 0x3d5a, 0x0002, 0x3539, 0x55dd, 0x8005, 0x55fd, 0x0003, 0x561e, 0x5c95, 0x5acb, 0x8004, 0x5b2d, 0x0003, 0x5b0c,
+  0x5b2d, 0x563f, 0x8009, 0x55fd, 0x0008, 0x4ddd, 0x45dd, 0x8e7d, 0xcf1d, 0xff9d, 0xf77d, 0xf77d, 0xef7d, 0x8006, 0xef5d, 0x0008,
+  0xef7d, 0xf77d, 0xf77d, 0xff9d, 0xcf1d, 0x8e7d, 0x45dd, 0x4ddd, 0x801d, 0x55fd, 0x0005, 0x3d3a, 0x3d5a, 0x3d5a, 0x3539, 0x55dd,
+  0x8006, 0x55fd, 0x0009, 0x565f, 0x5c53, 0x5acb, 0x5aec, 0x5aec, 0x5acb, 0x5b2d, 0x55fd, 0x561e, 0x800b, 0x55fd, 0x0007, 0x55dd,
+  0x45dd, 0x55fd, 0x867d, 0xb6dd, 0xd73d, 0xef7d, 0x8004, 0xf77d, 0x0007, 0xef7d, 0xd73d, 0xb6dd, 0x867d, 0x55fd, 0x45dd, 0x55dd,
+  0x801f, 0x55fd, 0x0005, 0x4559, 0x3d3a, 0x3d5a, 0x3539, 0x55dd, 0x8007, 0x55fd, 0x0006, 0x563f, 0x55bc, 0x5cb6, 0x5c75, 0x5539,
+  0x563f, 0x8010, 0x55fd, 0x000c, 0x55dd, 0x4ddd, 0x4ddd, 0x45dd, 0x4ddd, 0x55fd, 0x55fd, 0x4ddd, 0x45dd, 0x4ddd, 0x4ddd, 0x55dd,
+  0x8021, 0x55fd, 0x0001, 0x65fd, 0x0006, 0x761b, 0x353a, 0x3d5a, 0x3d3a, 0x4dbc, 0x5dfd, 0x8008, 0x55fd, 0x8003, 0x561e, 0x803d,
+  0x55fd, 0x0002, 0x4ddd, 0x8e9d, 0x0002, 0xefbf, 0x1cd9, 0x8003, 0x3d3a, 0x0001, 0x5e1e, 0x8048, 0x55fd, 0x0002, 0x3dbd, 0xf7df,
+  0x0008, 0xffff, 0xaedd, 0x1cd9, 0x353a, 0x353a, 0x3d7a, 0x5e1e, 0x5dfd, 0x8044, 0x55fd, 0x0004, 0x55dd, 0x3d9d, 0xc73e, 0xffff,
+  0x0004, 0xffff, 0xffff, 0xdf7e, 0x5dba, 0x8003, 0x24f9, 0x0001, 0x3d7b, 0x8044, 0x45bd, 0x0004, 0x7e5d, 0xefbf, 0xffff, 0xffff,
+  0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff, 0x8050, 0xffff,
 };
 
 const lv_image_dsc_t camera_icon = {
   .header.cf = LV_COLOR_FORMAT_RGB565,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_USER1,
   .header.w = 80,
   .header.h = 80,
-  .data_size = 6400 * 2,
-  .data = camera_icon_map,
+  .data_size = 2590 * 2,
+  .data = (const uint8_t *)camera_icon_map,
 };
@@ -21,64 +21,73 @@
 #define LV_ATTRIBUTE_IMAGE_BACK_BTN
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_BACK_BTN uint8_t back_btn_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x54, 0xfd, 0xef, 0xfb, 0x0a, 0xfb, 0x68, 0xfa, 0x06, 0xf2, 0x06, 0xf2, 0x68, 0xfa, 0x0a, 0xfb, 0xef, 0xfb, 0x54, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xee, 0xfb, 0xa5, 0xf1, 0x84, 0xf1, 0xc5, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xe6, 0xf1, 0xc5, 0xf1, 0x84, 0xf1, 0xa5, 0xf1, 0xee, 0xfb, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0x48, 0xfa, 0x84, 0xf1, 0xe6, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xe6, 0xf1, 0x84, 0xf1, 0x48, 0xfa, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x89, 0xfa, 0x84, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x84, 0xf1, 0x89, 0xfa, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfd, 0x43, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x43, 0xf1, 0x13, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x84, 0xf1, 0x4b, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xfa, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x88, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xfa, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc6, 0xf1, 0x88, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x4c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfd, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x13, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x43, 0xf1, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x43, 0xf1, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x89, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0xe6, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xa5, 0xf1, 0x0f, 0xfc, 0x4c, 0xfb, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x48, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x84, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfd, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xfb, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x43, 0xf1, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0xee, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x64, 0xf1, 0xd7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xf2, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x54, 0xfd, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x6c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x54, 0xfd, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x89, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0xa5, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x0a, 0xfb, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xe6, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xfc, 0x64, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0x84, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x0b, 0xfb, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x68, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xa5, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xa5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x68, 0xfa, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x06, 0xf2, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0xb2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x06, 0xf2, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x06, 0xf2, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0xb2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x06, 0xf2, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x68, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xa5, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xa5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x68, 0xfa, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x0a, 0xfb, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xe6, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xfc, 0x64, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0x84, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x0b, 0xfb, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x89, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0xa5, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x54, 0xfd, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x6c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x54, 0xfd, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xf2, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x64, 0xf1, 0xd7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xfb, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x43, 0xf1, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0xee, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x84, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfd, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xa5, 0xf1, 0x0f, 0xfc, 0x4c, 0xfb, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x48, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0xe6, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x89, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x43, 0xf1, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x43, 0xf1, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfd, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x13, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x4c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xfa, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x88, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xfa, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x88, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x84, 0xf1, 0x4c, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xfd, 0x43, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x43, 0xf1, 0x13, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa9, 0xfa, 0x84, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x84, 0xf1, 0x89, 0xfa, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0x68, 0xfa, 0x84, 0xf1, 0xe6, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xe6, 0xf1, 0x84, 0xf1, 0x48, 0xfa, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xee, 0xfb, 0xa5, 0xf1, 0x84, 0xf1, 0xc5, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xe6, 0xf1, 0xc5, 0xf1, 0x84, 0xf1, 0xa5, 0xf1, 0xee, 0xfb, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x54, 0xfd, 0x0f, 0xfc, 0x0b, 0xfb, 0x68, 0xfa, 0x06, 0xf2, 0x06, 0xf2, 0x68, 0xfa, 0x0b, 0xfb, 0x0f, 0xfc, 0x54, 0xfd, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+/* 50x50 RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): 5000 -> 1808 字节 */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_BACK_BTN uint16_t back_btn_map[] = {
+  0x0032, 0x0034, 0x0036, 0x0047, 0x005d, 0x006f, 0x007f, 0x008d, 0x009b, 0x00a7, 0x00b3, 0x00bf, 0x00cb, 0x00d9, 0x00e5, 0x00f7,
+  0x010b, 0x0121, 0x0137, 0x014d, 0x0163, 0x0179, 0x0193, 0x01af, 0x01c7, 0x01dd, 0x01f3, 0x020b, 0x0227, 0x0241, 0x0257, 0x026d,
+  0x0283, 0x0299, 0x02af, 0x02c3, 0x02d5, 0x02e1, 0x02ef, 0x02fb, 0x0307, 0x0313, 0x031f, 0x032d, 0x033b, 0x034b, 0x035d, 0x0373,
+  0x0384, 0x0386, 0x8032, 0xffff, 0x8032, 0xffff, 0x8013, 0xffff, 0x000c, 0xfefb, 0xfd54, 0xfbef, 0xfb0a, 0xfa68, 0xf206, 0xf206,
+  0xfa68, 0xfb0a, 0xfbef, 0xfd54, 0xfefb, 0x8013, 0xffff, 0x8010, 0xffff, 0x0007, 0xfedb, 0xfbee, 0xf1a5, 0xf184, 0xf1c5, 0xf1e6,
+  0xf1e6, 0x8004, 0xf206, 0x0007, 0xf1e6, 0xf1e6, 0xf1c5, 0xf184, 0xf1a5, 0xfbee, 0xfedb, 0x8010, 0xffff, 0x800e, 0xffff, 0x0005,
+  0xfe38, 0xfa48, 0xf184, 0xf1e6, 0xf207, 0x800c, 0xfa27, 0x0005, 0xf207, 0xf1e6, 0xf184, 0xfa48, 0xfe38, 0x800e, 0xffff, 0x800c,
+  0xffff, 0x0004, 0xff9e, 0xfa89, 0xf184, 0xf206, 0x8012, 0xfa27, 0x0004, 0xf206, 0xf184, 0xfa89, 0xff9e, 0x800c, 0xffff, 0x800b,
+  0xffff, 0x0003, 0xfd13, 0xf143, 0xf1e6, 0x8016, 0xfa27, 0x0003, 0xf1e6, 0xf143, 0xfd13, 0x800b, 0xffff, 0x800a, 0xffff, 0x0003,
+  0xfb4c, 0xf184, 0xf227, 0x8018, 0xfa27, 0x0003, 0xf227, 0xf184, 0xfb4b, 0x800a, 0xffff, 0x8009, 0xffff, 0x0002, 0xfa88, 0xf1c5,
+  0x801c, 0xfa27, 0x0002, 0xf1c5, 0xfa88, 0x8009, 0xffff, 0x8008, 0xffff, 0x0002, 0xfa88, 0xf1c5, 0x801e, 0xfa27, 0x0002, 0xf1c6,
+  0xfa88, 0x8008, 0xffff, 0x8007, 0xffff, 0x0002, 0xfb4c, 0xf1c5, 0x8020, 0xfa27, 0x0002, 0xf1c5, 0xfb4c, 0x8007, 0xffff, 0x8006,
+  0xffff, 0x0002, 0xfd13, 0xf184, 0x8022, 0xfa27, 0x0002, 0xf184, 0xfd13, 0x8006, 0xffff, 0x8005, 0xffff, 0x0003, 0xff9e, 0xf143,
+  0xf227, 0x8022, 0xfa27, 0x0003, 0xf227, 0xf143, 0xff9e, 0x8005, 0xffff, 0x8005, 0xffff, 0x0002, 0xfa89, 0xf1e6, 0x8024, 0xfa27,
+  0x0002, 0xf1e6, 0xfa89, 0x8005, 0xffff, 0x8004, 0xffff, 0x0002, 0xfe38, 0xf184, 0x800d, 0xfa27, 0x0003, 0xf227, 0xf1e6, 0xf1e6,
+  0x8016, 0xfa27, 0x0002, 0xf184, 0xfe38, 0x8004, 0xffff, 0x8004, 0xffff, 0x0002, 0xfa48, 0xf206, 0x800c, 0xfa27, 0x0005, 0xf206,
+  0xf1a5, 0xfc0f, 0xfb4c, 0xf1a5, 0x8015, 0xfa27, 0x0002, 0xf206, 0xfa48, 0x8004, 0xffff, 0x8003, 0xffff, 0x0002, 0xfedb, 0xf184,
+  0x800c, 0xfa27, 0x0007, 0xf207, 0xf184, 0xffbf, 0xffff, 0xffff, 0xfd13, 0xf1c5, 0x8015, 0xfa27, 0x0002, 0xf184, 0xfedb, 0x8003,
+  0xffff, 0x8003, 0xffff, 0x0002, 0xfbee, 0xf1e6, 0x800b, 0xfa27, 0x0003, 0xf227, 0xf143, 0xfefb, 0x8004, 0xffff, 0x0001, 0xf184,
+  0x8015, 0xfa27, 0x0002, 0xf1e6, 0xfbee, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002, 0xf1a5, 0xf207, 0x800b, 0xfa27, 0x0002, 0xf164,
+  0xfdd7, 0x8004, 0xffff, 0x0002, 0xff1c, 0xf184, 0x8015, 0xfa27, 0x0002, 0xf207, 0xf1a5, 0x8003, 0xffff, 0x0004, 0xffff, 0xffff,
+  0xfefb, 0xf184, 0x800b, 0xfa27, 0x0002, 0xf184, 0xfc91, 0x8005, 0xffff, 0x0002, 0xf207, 0xf206, 0x8016, 0xfa27, 0x0004, 0xf184,
+  0xfefb, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfd54, 0xf1c5, 0x800a, 0xfa27, 0x0002, 0xf1c5, 0xfb6c, 0x8005, 0xffff, 0x0002,
+  0xfaa9, 0xf1e6, 0x8017, 0xfa27, 0x0004, 0xf1c5, 0xfd54, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfbef, 0xf1e6, 0x8009, 0xfa27,
+  0x0002, 0xf1e6, 0xfa89, 0x8005, 0xffff, 0x0002, 0xfb8d, 0xf1a5, 0x800d, 0xf206, 0x0001, 0xf207, 0x800a, 0xfa27, 0x0004, 0xf1e6,
+  0xfc0f, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfb0a, 0xf1e6, 0x8008, 0xfa27, 0x0002, 0xf206, 0xf1e6, 0x8005, 0xffff, 0x0002,
+  0xfcb2, 0xf164, 0x800e, 0xf206, 0x0003, 0xf1e6, 0xf184, 0xf207, 0x8008, 0xfa27, 0x0004, 0xf1e6, 0xfb0b, 0xffff, 0xffff, 0x0004,
+  0xffff, 0xffff, 0xfa68, 0xf206, 0x8007, 0xfa27, 0x0003, 0xf207, 0xf1a5, 0xffdf, 0x8016, 0xffff, 0x0003, 0xff3c, 0xf1a5, 0xf207,
+  0x8007, 0xfa27, 0x0004, 0xf206, 0xfa68, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xf206, 0xf206, 0x8007, 0xfa27, 0x0002, 0xf1c5,
+  0xfcb2, 0x8018, 0xffff, 0x0002, 0xfcb2, 0xf1c5, 0x8007, 0xfa27, 0x0004, 0xf206, 0xf206, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff,
+  0xf206, 0xf206, 0x8007, 0xfa27, 0x0002, 0xf1c5, 0xfcb2, 0x8018, 0xffff, 0x0002, 0xfcb2, 0xf1c5, 0x8007, 0xfa27, 0x0004, 0xf206,
+  0xf206, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfa68, 0xf206, 0x8007, 0xfa27, 0x0003, 0xf207, 0xf1a5, 0xffdf, 0x8016, 0xffff,
+  0x0003, 0xff3c, 0xf1a5, 0xf207, 0x8007, 0xfa27, 0x0004, 0xf206, 0xfa68, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfb0a, 0xf1e6,
+  0x8008, 0xfa27, 0x0002, 0xf206, 0xf1e6, 0x8005, 0xffff, 0x0002, 0xfcb2, 0xf164, 0x800e, 0xf206, 0x0003, 0xf1e6, 0xf184, 0xf207,
+  0x8008, 0xfa27, 0x0004, 0xf1e6, 0xfb0b, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfbef, 0xf1e6, 0x8009, 0xfa27, 0x0002, 0xf1e6,
+  0xfa89, 0x8005, 0xffff, 0x0002, 0xfb8d, 0xf1a5, 0x800d, 0xf206, 0x0001, 0xf207, 0x800a, 0xfa27, 0x0004, 0xf1e6, 0xfc0f, 0xffff,
+  0xffff, 0x0004, 0xffff, 0xffff, 0xfd54, 0xf1c5, 0x800a, 0xfa27, 0x0002, 0xf1c5, 0xfb6c, 0x8005, 0xffff, 0x0002, 0xfaa9, 0xf1e6,
+  0x8017, 0xfa27, 0x0004, 0xf1c5, 0xfd54, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfefb, 0xf184, 0x800b, 0xfa27, 0x0002, 0xf184,
+  0xfc91, 0x8005, 0xffff, 0x0002, 0xf207, 0xf206, 0x8016, 0xfa27, 0x0004, 0xf184, 0xfefb, 0xffff, 0xffff, 0x8003, 0xffff, 0x0002,
+  0xf1a5, 0xf207, 0x800b, 0xfa27, 0x0002, 0xf164, 0xfdd7, 0x8004, 0xffff, 0x0002, 0xff3c, 0xf184, 0x8015, 0xfa27, 0x0002, 0xf207,
+  0xf1a5, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002, 0xfbee, 0xf1e6, 0x800b, 0xfa27, 0x0003, 0xf227, 0xf143, 0xfefb, 0x8004, 0xffff,
+  0x0001, 0xf184, 0x8015, 0xfa27, 0x0002, 0xf1e6, 0xfbee, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002, 0xfedb, 0xf184, 0x800c, 0xfa27,
+  0x0007, 0xf207, 0xf184, 0xffbf, 0xffff, 0xffff, 0xfd13, 0xf1c5, 0x8015, 0xfa27, 0x0002, 0xf184, 0xfedb, 0x8003, 0xffff, 0x8004,
+  0xffff, 0x0002, 0xfa68, 0xf206, 0x800c, 0xfa27, 0x0005, 0xf206, 0xf1a5, 0xfc0f, 0xfb4c, 0xf1a5, 0x8015, 0xfa27, 0x0002, 0xf206,
+  0xfa48, 0x8004, 0xffff, 0x8004, 0xffff, 0x0002, 0xfe38, 0xf184, 0x800d, 0xfa27, 0x0003, 0xf227, 0xf1e6, 0xf1e6, 0x8016, 0xfa27,
+  0x0002, 0xf184, 0xfe38, 0x8004, 0xffff, 0x8005, 0xffff, 0x0002, 0xfa89, 0xf1e6, 0x8024, 0xfa27, 0x0002, 0xf1e6, 0xfa89, 0x8005,
+  0xffff, 0x8005, 0xffff, 0x0003, 0xff9e, 0xf143, 0xf227, 0x8022, 0xfa27, 0x0003, 0xf227, 0xf143, 0xff9e, 0x8005, 0xffff, 0x8006,
+  0xffff, 0x0002, 0xfd13, 0xf184, 0x8022, 0xfa27, 0x0002, 0xf184, 0xfd13, 0x8006, 0xffff, 0x8007, 0xffff, 0x0002, 0xfb4c, 0xf1c5,
+  0x8020, 0xfa27, 0x0002, 0xf1c5, 0xfb4c, 0x8007, 0xffff, 0x8008, 0xffff, 0x0002, 0xfa88, 0xf1c5, 0x801e, 0xfa27, 0x0002, 0xf1c5,
+  0xfa88, 0x8008, 0xffff, 0x8009, 0xffff, 0x0002, 0xfa88, 0xf1c5, 0x801c, 0xfa27, 0x0002, 0xf1c5, 0xfa88, 0x8009, 0xffff, 0x800a,
+  0xffff, 0x0003, 0xfb4c, 0xf184, 0xf227, 0x8018, 0xfa27, 0x0003, 0xf227, 0xf184, 0xfb4c, 0x800a, 0xffff, 0x800b, 0xffff, 0x0003,
+  0xfd33, 0xf143, 0xf1e6, 0x8016, 0xfa27, 0x0003, 0xf1e6, 0xf143, 0xfd13, 0x800b, 0xffff, 0x800c, 0xffff, 0x0004, 0xff9e, 0xfaa9,
+  0xf184, 0xf206, 0x8012, 0xfa27, 0x0004, 0xf206, 0xf184, 0xfa89, 0xff9e, 0x800c, 0xffff, 0x800e, 0xffff, 0x0005, 0xfe38, 0xfa68,
+  0xf184, 0xf1e6, 0xf207, 0x800c, 0xfa27, 0x0005, 0xf207, 0xf1e6, 0xf184, 0xfa48, 0xfe38, 0x800e, 0xffff, 0x8010, 0xffff, 0x0007,
+  0xfedb, 0xfbee, 0xf1a5, 0xf184, 0xf1c5, 0xf1e6, 0xf1e6, 0x8004, 0xf206, 0x0007, 0xf1e6, 0xf1e6, 0xf1c5, 0xf184, 0xf1a5, 0xfbee,
+  0xfedb, 0x8010, 0xffff, 0x8013, 0xffff, 0x000c, 0xff1b, 0xfd54, 0xfc0f, 0xfb0b, 0xfa68, 0xf206, 0xf206, 0xfa68, 0xfb0b, 0xfc0f,
+  0xfd54, 0xfefb, 0x8013, 0xffff, 0x8032, 0xffff, 0x8032, 0xffff,
 };
 
 const lv_image_dsc_t back_btn = {
   .header.cf = LV_COLOR_FORMAT_RGB565,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_USER1,
   .header.w = 50,
   .header.h = 50,
-  .data_size = 2500 * 2,
-  .data = back_btn_map,
+  .data_size = 904 * 2,
+  .data = (const uint8_t *)back_btn_map,
 };
@@ -21,64 +21,81 @@
 #define LV_ATTRIBUTE_IMAGE_MUSIC_LIST
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MUSIC_LIST uint8_t music_list_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x3c, 0xff, 0xc5, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x43, 0xe9, 0xee, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xa9, 0xf2, 0x06, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x26, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x64, 0xf1, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x06, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0xa5, 0xf1, 0x34, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x13, 0xf5, 0x43, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x99, 0xfe, 0x96, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xfe, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xf3, 0x43, 0xf1, 0x43, 0xf1, 0xee, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x43, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x23, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0xe5, 0xf1, 0xd7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x6c, 0xf3, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xea, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xa9, 0xf2, 0xf3, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x68, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x2b, 0xf3, 0xc5, 0xf1, 0x26, 0xf2, 0x27, 0xf2, 0x26, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x26, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x26, 0xf2, 0x26, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xd6, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa4, 0xf1, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0xc5, 0xf1, 0x13, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xe6, 0xe9, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0xe6, 0xf1, 0x30, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa4, 0xf1, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x64, 0xf1, 0x18, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x0f, 0xf4, 0xa5, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0x06, 0xf2, 0xe5, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xe5, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x23, 0xf1, 0xda, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa4, 0xf1, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xf3, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x13, 0xf5, 0x50, 0xf4, 0x70, 0xf4, 0x70, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x70, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x70, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x70, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x70, 0xf4, 0x50, 0xf4, 0x50, 0xf4, 0x2f, 0xf4, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa4, 0xf1, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0xc5, 0xf1, 0xc9, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa4, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x26, 0xf2, 0x84, 0xe9, 0xd6, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0x8d, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xea, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xea, 0x47, 0xf2, 0xc5, 0xf1, 0xc9, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0xc5, 0xf1, 0xad, 0xeb, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x84, 0xe9, 0x38, 0xf6, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xf2, 0x2b, 0xf3, 0xc5, 0xe9, 0xc5, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x26, 0xf2, 0xe6, 0xe9, 0xff, 0xff, 
-  0xff, 0xff, 0x13, 0xf5, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x4f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x0f, 0xf4, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa4, 0xf1, 0x27, 0xf2, 0x47, 0xf2, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x95, 0xf5, 0xe6, 0xf1, 0xe6, 0xf1, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0xa5, 0xe9, 0x59, 0xf6, 
-  0x0f, 0xf4, 0xa4, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x43, 0xf1, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa4, 0xf1, 0x47, 0xf2, 0x27, 0xf2, 0xa4, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xf3, 0xc5, 0xf1, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xea, 0x2f, 0xf4, 
-  0x06, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0xe6, 0xf1, 0x0f, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xf3, 0xe5, 0xf1, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xea, 0xca, 0xea, 
-  0x4b, 0xf3, 0xe5, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x27, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x27, 0xf2, 0x26, 0xf2, 0x26, 0xf2, 0x06, 0xf2, 0x26, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x26, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x26, 0xf2, 0x26, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x26, 0xf2, 0x27, 0xf2, 0x07, 0xf2, 0x43, 0xf1, 0xf7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x47, 0xf2, 0x47, 0xf2, 0xa4, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0xea, 0x26, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xea, 0x47, 0xea, 
-  0xff, 0xff, 0x8d, 0xf3, 0xca, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xe9, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xea, 0xea, 0xea, 0xe9, 0xea, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xea, 0xf2, 0xc9, 0xf2, 0x54, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x47, 0xf2, 0x47, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xa4, 0xf1, 0x47, 0xea, 0x47, 0xea, 0x27, 0xea, 0x67, 0xea, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x47, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0xea, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xea, 0x0b, 0xeb, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x47, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xf4, 0xe6, 0xf1, 0x47, 0xf2, 0x06, 0xea, 0x50, 0xf4, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x47, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0xc5, 0xf1, 0x47, 0xea, 0xa5, 0xe9, 0x9a, 0xfe, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xf5, 0x64, 0xf1, 0xe6, 0xf1, 0xe6, 0xe9, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xe9, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xf4, 0x8d, 0xf3, 0x7d, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xe9, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xba, 0xfe, 0x96, 0xf5, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xf5, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xf5, 0xb6, 0xf5, 0xb6, 0xfd, 0xb6, 0xfd, 0xb6, 0xf5, 0x96, 0xfd, 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0xb6, 0xfd, 0xb6, 0xfd, 0xba, 0xfe, 0xbe, 0xff, 0x84, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x34, 0xf5, 0x43, 0xf1, 0xc6, 0xf1, 0xa6, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xf1, 0xc5, 0xe9, 0xc5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0x64, 0xf1, 0x8d, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xfe, 0xc9, 0xf2, 0x44, 0xe9, 0xa5, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0xa5, 0xf1, 0x84, 0xe9, 0x27, 0xf2, 0x26, 0xf2, 0x07, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xea, 0x27, 0xf2, 0x44, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf3, 0x63, 0xf1, 0x07, 0xf2, 0x48, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xa9, 0xf2, 0x06, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xf2, 0x85, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xf4, 0xa5, 0xf1, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x48, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x5d, 0xff, 0xe6, 0xe9, 0x63, 0xf1, 0x84, 0xf1, 0x63, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x64, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x64, 0xe9, 0xc6, 0xe9, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0xa5, 0xf1, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x84, 0xf1, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0xa5, 0xf1, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xf1, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x06, 0xf2, 0xea, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0x63, 0xe9, 0x26, 0xea, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xf2, 0x84, 0xe9, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0xc5, 0xe9, 0xc5, 0xf1, 0x06, 0xf2, 0x27, 0xf2, 0x47, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xf2, 0xa5, 0xf1, 0x47, 0xf2, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xf5, 0x0b, 0xf3, 0xc5, 0xe9, 0x84, 0xf1, 0x84, 0xf1, 0xe6, 0xf1, 0x6c, 0xf3, 0xf7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+/* 50x50 RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): 5000 -> 2054 字节 */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MUSIC_LIST uint16_t music_list_map[] = {
+  0x0032, 0x0034, 0x0036, 0x0038, 0x005b, 0x0069, 0x0072, 0x008e, 0x0096, 0x0098, 0x009a, 0x00a1, 0x00aa, 0x00b4, 0x00bf, 0x00d5,
+  0x00f4, 0x010c, 0x0139, 0x0160, 0x0171, 0x017f, 0x0192, 0x01a0, 0x01b1, 0x01c5, 0x01e5, 0x0207, 0x0239, 0x026a, 0x0291, 0x02a2,
+  0x02b3, 0x02c4, 0x02d5, 0x02e5, 0x02f0, 0x0310, 0x0337, 0x034b, 0x036d, 0x0394, 0x03a6, 0x03ba, 0x03cc, 0x03df, 0x03f0, 0x03fd,
+  0x03ff, 0x0401, 0x8032, 0xffff, 0x8032, 0xffff, 0x8032, 0xffff, 0x0002, 0xff3c, 0xf1c5, 0x8003, 0xf164, 0x8006, 0xf184, 0x8004,
+  0xf164, 0x0009, 0xf184, 0xf184, 0xf164, 0xf184, 0xf184, 0xf164, 0xf184, 0xf184, 0xf164, 0x8003, 0xf184, 0x0001, 0xf164, 0x8006,
+  0xf184, 0x8003, 0xf164, 0x0005, 0xf184, 0xf164, 0xf184, 0xe943, 0xf3ee, 0x8008, 0xffff, 0x0002, 0xf2a9, 0xf206, 0x8020, 0xf227,
+  0x0001, 0xf226, 0x8006, 0xf227, 0x0002, 0xf164, 0xfdf7, 0x8007, 0xffff, 0x0001, 0xf206, 0x8028, 0xf227, 0x0002, 0xf1a5, 0xfd34,
+  0x8007, 0xffff, 0x0007, 0xf513, 0xf143, 0xf1a5, 0xf1c5, 0xf1a5, 0xf1c5, 0xf1a5, 0x800d, 0xf1c5, 0x0005, 0xf1a5, 0xf1a5, 0xf1c5,
+  0xf1c5, 0xf1a5, 0x8007, 0xf1c5, 0x0001, 0xf1a5, 0x8006, 0xf1c5, 0x0003, 0xf1a5, 0xf1a5, 0xf1c5, 0x8008, 0xffff, 0x0003, 0xffff,
+  0xfe99, 0xfd96, 0x8026, 0xfdb6, 0x8009, 0xffff, 0x8032, 0xffff, 0x8032, 0xffff, 0x8023, 0xffff, 0x0002, 0xfeda, 0xfe9a, 0x800d,
+  0xffff, 0x8022, 0xffff, 0x0004, 0xf3ad, 0xf143, 0xf143, 0xf3ee, 0x800c, 0xffff, 0x8021, 0xffff, 0x0005, 0xffdf, 0xf143, 0xf227,
+  0xf227, 0xe923, 0x800c, 0xffff, 0x8021, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf227, 0xf227, 0xf1e5, 0xf5d7, 0x800b, 0xffff, 0x0002,
+  0xffff, 0xf36c, 0x8014, 0xf2a9, 0x0001, 0xeaa9, 0x8005, 0xf2a9, 0x0001, 0xf4f3, 0x8004, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf247,
+  0xf247, 0xf227, 0xea68, 0x800b, 0xffff, 0x0005, 0xf32b, 0xf1c5, 0xf226, 0xf227, 0xf226, 0x8004, 0xf227, 0x0005, 0xf226, 0xf227,
+  0xf227, 0xf226, 0xf226, 0x800e, 0xf227, 0x0002, 0xf184, 0xf5d6, 0x8003, 0xffff, 0x0007, 0xff9e, 0xf1a4, 0xf247, 0xf227, 0xf247,
+  0xf1c5, 0xf513, 0x800a, 0xffff, 0x0001, 0xe9e6, 0x8003, 0xf247, 0x0001, 0xf227, 0x8017, 0xf247, 0x0002, 0xf1e6, 0xf430, 0x8003,
+  0xffff, 0x0008, 0xff9e, 0xf1a4, 0xf247, 0xf227, 0xf247, 0xf247, 0xf164, 0xf618, 0x8009, 0xffff, 0x0007, 0xf40f, 0xf1a5, 0xf1e6,
+  0xf1e6, 0xf206, 0xf1e6, 0xf1e6, 0x8003, 0xf206, 0x0014, 0xf1e6, 0xf206, 0xf206, 0xf1e6, 0xf1e6, 0xf206, 0xf206, 0xf1e6, 0xf206,
+  0xf1e5, 0xf1e6, 0xf1e6, 0xf206, 0xf206, 0xf1e6, 0xf1e5, 0xf206, 0xf206, 0xf123, 0xfeda, 0x8003, 0xffff, 0x0009, 0xff9e, 0xf1a4,
+  0xf227, 0xf247, 0xf247, 0xf227, 0xf227, 0xf184, 0xf4f3, 0x8008, 0xffff, 0x0008, 0xffff, 0xf513, 0xf450, 0xf470, 0xf470, 0xf450,
+  0xf450, 0xf470, 0x8006, 0xf450, 0x0001, 0xf470, 0x8006, 0xf450, 0x0008, 0xf470, 0xf450, 0xf450, 0xf470, 0xf450, 0xf450, 0xf42f,
+  0xfefb, 0x8004, 0xffff, 0x000a, 0xff9e, 0xf1a4, 0xf247, 0xf247, 0xf227, 0xf227, 0xf247, 0xf247, 0xf1c5, 0xf2c9, 0x8007, 0xffff,
+  0x8021, 0xffff, 0x0002, 0xff9e, 0xf1a4, 0x8003, 0xf227, 0x0007, 0xf247, 0xf227, 0xf227, 0xf247, 0xf226, 0xe984, 0xf5d6, 0x8005,
+  0xffff, 0x8021, 0xffff, 0x0002, 0xff9e, 0xf184, 0x8007, 0xf227, 0x0004, 0xf247, 0xf227, 0xf184, 0xf38d, 0x8004, 0xffff, 0x8021,
+  0xffff, 0x0002, 0xff9e, 0xf184, 0x8003, 0xf227, 0x0001, 0xea27, 0x8003, 0xf227, 0x0005, 0xf247, 0xea47, 0xf247, 0xf1c5, 0xeac9,
+  0x8003, 0xffff, 0x8021, 0xffff, 0x0002, 0xff9e, 0xf184, 0x8007, 0xf227, 0x8004, 0xf247, 0x0004, 0xf1c5, 0xebad, 0xffff, 0xffff,
+  0x8021, 0xffff, 0x0002, 0xff9e, 0xf184, 0x8003, 0xf227, 0x0001, 0xf206, 0x8006, 0xf227, 0x0005, 0xf247, 0xf227, 0xe984, 0xf638,
+  0xffff, 0x8021, 0xffff, 0x0008, 0xff9e, 0xf184, 0xf227, 0xf227, 0xf206, 0xf32b, 0xe9c5, 0xf1c5, 0x8003, 0xf227, 0x0006, 0xf247,
+  0xf227, 0xf227, 0xf226, 0xe9e6, 0xffff, 0x0002, 0xffff, 0xf513, 0x8005, 0xf42f, 0x0001, 0xf44f, 0x8013, 0xf42f, 0x0002, 0xf40f,
+  0xfeba, 0x8004, 0xffff, 0x000a, 0xff9e, 0xf1a4, 0xf227, 0xf247, 0xf184, 0xffff, 0xffff, 0xf595, 0xf1e6, 0xf1e6, 0x8003, 0xf247,
+  0x0004, 0xf227, 0xf227, 0xe9a5, 0xf659, 0x0002, 0xf40f, 0xf1a4, 0x8003, 0xf1e6, 0x0002, 0xf206, 0xf206, 0x8014, 0xf1e6, 0x0003,
+  0xf206, 0xf143, 0xfeba, 0x8003, 0xffff, 0x0006, 0xff9e, 0xf1a4, 0xf247, 0xf227, 0xf1a4, 0xffdf, 0x8003, 0xffff, 0x0008, 0xf36c,
+  0xf1c5, 0xf247, 0xf247, 0xf227, 0xf227, 0xea06, 0xf42f, 0x0006, 0xf206, 0xf247, 0xf247, 0xf227, 0xf227, 0xf247, 0x8003, 0xf227,
+  0x0001, 0xf247, 0x8003, 0xf227, 0x0004, 0xf247, 0xf227, 0xf247, 0xf247, 0x8003, 0xf227, 0x000a, 0xf247, 0xf227, 0xf247, 0xf247,
+  0xf227, 0xf227, 0xf247, 0xf227, 0xf1e6, 0xf40f, 0x8003, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf227, 0xf227, 0xf184, 0xffdf, 0x8004,
+  0xffff, 0x0007, 0xf3ce, 0xf1e5, 0xf247, 0xf227, 0xf227, 0xea27, 0xeaca, 0x001e, 0xf34b, 0xf1e5, 0xf206, 0xf207, 0xf227, 0xf207,
+  0xf207, 0xf227, 0xf226, 0xf226, 0xf206, 0xf226, 0xf207, 0xf207, 0xf227, 0xf227, 0xf207, 0xf207, 0xf226, 0xf207, 0xf206, 0xf226,
+  0xf226, 0xf206, 0xf207, 0xf226, 0xf227, 0xf207, 0xf143, 0xf5f7, 0x8003, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf247, 0xf247, 0xf1a4,
+  0xffdf, 0x8005, 0xffff, 0x0006, 0xea68, 0xf226, 0xf247, 0xf247, 0xea27, 0xea47, 0x0003, 0xffff, 0xf38d, 0xf2ca, 0x8006, 0xf2ea,
+  0x0003, 0xf2e9, 0xeaea, 0xeaea, 0x8007, 0xf2ea, 0x0003, 0xeaea, 0xeaea, 0xeae9, 0x8005, 0xf2ea, 0x0002, 0xf2c9, 0xf554, 0x8004,
+  0xffff, 0x0006, 0xff9e, 0xf184, 0xf247, 0xf247, 0xf184, 0xffdf, 0x8005, 0xffff, 0x0006, 0xfefb, 0xf1a4, 0xea47, 0xea47, 0xea27,
+  0xea67, 0x8021, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf247, 0xf227, 0xf184, 0xffdf, 0x8006, 0xffff, 0x0005, 0xea47, 0xf227, 0xf247,
+  0xea27, 0xeb0b, 0x8021, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf227, 0xf247, 0xf184, 0xffdf, 0x8006, 0xffff, 0x0005, 0xf471, 0xf1e6,
+  0xf247, 0xea06, 0xf450, 0x8021, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf227, 0xf247, 0xf184, 0xffdf, 0x8006, 0xffff, 0x0005, 0xf534,
+  0xf1c5, 0xea47, 0xe9a5, 0xfe9a, 0x8021, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf227, 0xf227, 0xf184, 0xffdf, 0x8006, 0xffff, 0x0005,
+  0xf5d6, 0xf164, 0xf1e6, 0xe9e6, 0xffff, 0x8021, 0xffff, 0x0006, 0xff9e, 0xf184, 0xf227, 0xf227, 0xe984, 0xffdf, 0x8007, 0xffff,
+  0x0004, 0xf4d2, 0xf38d, 0xff7d, 0xffff, 0x8021, 0xffff, 0x0006, 0xffbe, 0xf184, 0xf227, 0xf227, 0xe984, 0xffdf, 0x800b, 0xffff,
+  0x0006, 0xffff, 0xfeba, 0xf596, 0xfdb6, 0xfdb6, 0xf5b6, 0x8006, 0xfdb6, 0x0007, 0xf5b6, 0xf5b6, 0xfdb6, 0xfdb6, 0xf5b6, 0xfd96,
+  0xfe58, 0x800a, 0xffff, 0x000a, 0xfe79, 0xfdb6, 0xfdb6, 0xfeba, 0xffbe, 0xf184, 0xf227, 0xf227, 0xf184, 0xffdf, 0x800b, 0xffff,
+  0x0009, 0xf534, 0xf143, 0xf1c6, 0xf1a6, 0xf1a5, 0xf1c5, 0xf1c5, 0xf1a5, 0xf1a5, 0x8003, 0xf1c5, 0x0008, 0xe9c5, 0xf1c5, 0xf1c5,
+  0xf1a5, 0xf1c5, 0xf1a5, 0xf164, 0xf38d, 0x8006, 0xffff, 0x000d, 0xfe59, 0xf2c9, 0xe944, 0xf1a5, 0xf1c5, 0xf1a5, 0xf1a5, 0xe984,
+  0xf227, 0xf226, 0xf207, 0xf184, 0xffdf, 0x800b, 0xffff, 0x8011, 0xf227, 0x0003, 0xea27, 0xf227, 0xe944, 0x8005, 0xffff, 0x0004,
+  0xf3ee, 0xf163, 0xf207, 0xf248, 0x8008, 0xf227, 0x0002, 0xf184, 0xffdf, 0x800b, 0xffff, 0x0008, 0xf2a9, 0xf206, 0xf227, 0xf227,
+  0xf247, 0xf227, 0xf227, 0xf247, 0x800a, 0xf227, 0x0002, 0xf206, 0xe985, 0x8004, 0xffff, 0x0006, 0xf450, 0xf1a5, 0xf247, 0xf227,
+  0xf247, 0xf247, 0x8003, 0xf227, 0x0001, 0xf248, 0x8003, 0xf227, 0x0002, 0xf184, 0xffbf, 0x800b, 0xffff, 0x0009, 0xff5d, 0xe9e6,
+  0xf163, 0xf184, 0xf163, 0xf184, 0xf184, 0xf164, 0xf164, 0x8003, 0xf184, 0x0008, 0xf164, 0xf184, 0xf164, 0xf184, 0xf184, 0xe964,
+  0xe9c6, 0xfe38, 0x8004, 0xffff, 0x0003, 0xf163, 0xf227, 0xf227, 0x8003, 0xf247, 0x0002, 0xf227, 0xf247, 0x8005, 0xf227, 0x0002,
+  0xf184, 0xffdf, 0x800b, 0xffff, 0x8017, 0xffff, 0x0008, 0xfe38, 0xf1a5, 0xf227, 0xf227, 0xf247, 0xf227, 0xf227, 0xf247, 0x8006,
+  0xf227, 0x0002, 0xf184, 0xffbe, 0x800b, 0xffff, 0x8017, 0xffff, 0x000f, 0xfe99, 0xf1a5, 0xf247, 0xf247, 0xf227, 0xf227, 0xf247,
+  0xf247, 0xf227, 0xf227, 0xf247, 0xf227, 0xf227, 0xf247, 0xf184, 0x800c, 0xffff, 0x8018, 0xffff, 0x0002, 0xf1a4, 0xf227, 0x8003,
+  0xf247, 0x0001, 0xf227, 0x8004, 0xf247, 0x0004, 0xf227, 0xf247, 0xf206, 0xf2ea, 0x800c, 0xffff, 0x8018, 0xffff, 0x0004, 0xfeba,
+  0xe963, 0xea26, 0xf247, 0x8003, 0xf227, 0x0001, 0xf247, 0x8003, 0xf227, 0x0003, 0xf206, 0xe984, 0xffbe, 0x800c, 0xffff, 0x8019,
+  0xffff, 0x000c, 0xfe99, 0xe9c5, 0xf1c5, 0xf206, 0xf227, 0xf247, 0xf227, 0xf227, 0xf206, 0xf1a5, 0xf247, 0xff9d, 0x800d, 0xffff,
+  0x801b, 0xffff, 0x0008, 0xf554, 0xf30b, 0xe9c5, 0xf184, 0xf184, 0xf1e6, 0xf36c, 0xf5f7, 0x800f, 0xffff, 0x8032, 0xffff, 0x8032,
+  0xffff, 0x8032, 0xffff,
 };
 
 const lv_image_dsc_t music_list = {
   .header.cf = LV_COLOR_FORMAT_RGB565,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_USER1,
   .header.w = 50,
   .header.h = 50,
-  .data_size = 2500 * 2,
-  .data = music_list_map,
+  .data_size = 1027 * 2,
+  .data = (const uint8_t *)music_list_map,
 };
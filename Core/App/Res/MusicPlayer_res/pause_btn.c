@@ -21,78 +21,111 @@
 #define LV_ATTRIBUTE_IMAGE_PAUSE_BTN
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PAUSE_BTN uint8_t pause_btn_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0x54, 0xfd, 0x30, 0xfc, 0x6c, 0xfb, 0xc9, 0xfa, 0x68, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x68, 0xfa, 0xc9, 0xfa, 0x6c, 0xfb, 0x30, 0xfc, 0x34, 0xfd, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0x91, 0xfc, 0x48, 0xfa, 0x64, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0x64, 0xf1, 0x48, 0xfa, 0x91, 0xfc, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd, 0x27, 0xfa, 0x64, 0xf1, 0xc5, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xc5, 0xf1, 0x64, 0xf1, 0x27, 0xfa, 0x54, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc, 0x84, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xa5, 0xf1, 0x84, 0xf1, 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfd, 0xa5, 0xf1, 0xc5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xc5, 0xf1, 0xa5, 0xf1, 0xd6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xfa, 0x84, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x84, 0xf1, 0xc9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe, 0x64, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x64, 0xf1, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xfc, 0x43, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x63, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x8d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0xfb, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x2b, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x8d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xfc, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xfe, 0x63, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x63, 0xf1, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x64, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xa5, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0xa9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfd, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xce, 0xfb, 0x3c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x79, 0xfe, 0x48, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x48, 0xfa, 0x79, 0xfe, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xae, 0xfb, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xd6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x71, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x48, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x54, 0xfd, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x27, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x1c, 0xff, 0x64, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x64, 0xf1, 0x1c, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x91, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x91, 0xfc, 0xff, 0xff, 
-  0xff, 0xff, 0x48, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x68, 0xfa, 0xff, 0xff, 
-  0xff, 0xff, 0x64, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x64, 0xf1, 0xff, 0xff, 
-  0x99, 0xfe, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x99, 0xfe, 
-  0x54, 0xfd, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x54, 0xfd, 
-  0x30, 0xfc, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x30, 0xfc, 
-  0x6c, 0xfb, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x6c, 0xfb, 
-  0xc9, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xc9, 0xfa, 
-  0x48, 0xfa, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x68, 0xfa, 
-  0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 
-  0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 
-  0x48, 0xfa, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0x68, 0xfa, 
-  0xc9, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xca, 0xfa, 
-  0x6c, 0xfb, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x6c, 0xfb, 
-  0x30, 0xfc, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x30, 0xfc, 
-  0x54, 0xfd, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x54, 0xfd, 
-  0x99, 0xfe, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x99, 0xfe, 
-  0xff, 0xff, 0x64, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x64, 0xf1, 0xff, 0xff, 
-  0xff, 0xff, 0x48, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x68, 0xfa, 0xff, 0xff, 
-  0xff, 0xff, 0x91, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x91, 0xfc, 0xff, 0xff, 
-  0xff, 0xff, 0x1c, 0xff, 0x64, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x64, 0xf1, 0x3c, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x27, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x54, 0xfd, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x84, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x27, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xc5, 0xf1, 0x71, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xfa, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0x47, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfc, 0xc5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfd, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xad, 0xfb, 0x3c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x79, 0xfe, 0x47, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x47, 0xfa, 0x79, 0xfe, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xad, 0xfb, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0xd6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xfa, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xa5, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0x84, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0xc9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x64, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe, 0x43, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x43, 0xf1, 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xfc, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x8d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xfb, 0xa5, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xa5, 0xf1, 0x2b, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0x84, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x84, 0xf1, 0x8d, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xfc, 0x43, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x43, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0xfe, 0x64, 0xf1, 0xe6, 0xf1, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0xe6, 0xf1, 0x64, 0xf1, 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xfa, 0x84, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0x84, 0xf1, 0xc9, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfd, 0xa5, 0xf1, 0xc5, 0xf1, 0x07, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x07, 0xf2, 0xc5, 0xf1, 0xa5, 0xf1, 0xd6, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc, 0x84, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xa5, 0xf1, 0x84, 0xf1, 0xd2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xfd, 0x47, 0xfa, 0x64, 0xf1, 0xc5, 0xf1, 0x06, 0xf2, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x06, 0xf2, 0xc5, 0xf1, 0x64, 0xf1, 0x27, 0xfa, 0x54, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x91, 0xfc, 0x68, 0xfa, 0x64, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xa5, 0xf1, 0x64, 0xf1, 0x68, 0xfa, 0x91, 0xfc, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0x54, 0xfd, 0x30, 0xfc, 0x6c, 0xfb, 0xc9, 0xfa, 0x68, 0xfa, 0x27, 0xfa, 0x27, 0xfa, 0x68, 0xfa, 0xc9, 0xfa, 0x6c, 0xfb, 0x30, 0xfc, 0x34, 0xfd, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+/* 64x64 RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): 8192 -> 3012 字节 */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PAUSE_BTN uint16_t pause_btn_map[] = {
+  0x0040, 0x0053, 0x006d, 0x007f, 0x008f, 0x009f, 0x00ad, 0x00bb, 0x00c9, 0x00d5, 0x00e1, 0x00ed, 0x00f9, 0x0105, 0x0111, 0x012f,
+  0x0155, 0x0175, 0x0195, 0x01b3, 0x01d1, 0x01ef, 0x020b, 0x0227, 0x0243, 0x025d, 0x0277, 0x0291, 0x02ab, 0x02c5, 0x02df, 0x02f9,
+  0x0311, 0x0329, 0x0343, 0x035d, 0x0377, 0x0391, 0x03ab, 0x03c5, 0x03df, 0x03fb, 0x0417, 0x0433, 0x0451, 0x046f, 0x048d, 0x04ad,
+  0x04cd, 0x04f3, 0x0511, 0x051d, 0x0529, 0x0535, 0x0541, 0x054d, 0x0559, 0x0567, 0x0575, 0x0583, 0x0593, 0x05a3, 0x05b5, 0x05cf,
+  0x8019, 0xffff, 0x000e, 0xfe99, 0xfd54, 0xfc30, 0xfb6c, 0xfac9, 0xfa68, 0xfa27, 0xfa27, 0xfa68, 0xfac9, 0xfb6c, 0xfc30, 0xfd34,
+  0xfe99, 0x8019, 0xffff, 0x8015, 0xffff, 0x0009, 0xff1c, 0xfc91, 0xfa48, 0xf164, 0xf1a5, 0xf1c5, 0xf1e6, 0xf206, 0xf206, 0x8004,
+  0xf227, 0x0009, 0xf206, 0xf206, 0xf1e6, 0xf1c5, 0xf1a5, 0xf164, 0xfa48, 0xfc91, 0xff1c, 0x8015, 0xffff, 0x8013, 0xffff, 0x0005,
+  0xfd75, 0xfa27, 0xf164, 0xf1c5, 0xf206, 0x8010, 0xfa27, 0x0005, 0xf206, 0xf1c5, 0xf164, 0xfa27, 0xfd54, 0x8013, 0xffff, 0x8011,
+  0xffff, 0x0004, 0xfcd2, 0xf184, 0xf1a5, 0xf206, 0x8016, 0xfa27, 0x0004, 0xf206, 0xf1a5, 0xf184, 0xfcd2, 0x8011, 0xffff, 0x800f,
+  0xffff, 0x0004, 0xfdd6, 0xf1a5, 0xf1c5, 0xf207, 0x801a, 0xfa27, 0x0004, 0xf207, 0xf1c5, 0xf1a5, 0xfdd6, 0x800f, 0xffff, 0x800e,
+  0xffff, 0x0003, 0xfac9, 0xf184, 0xf207, 0x801e, 0xfa27, 0x0003, 0xf207, 0xf184, 0xfac9, 0x800e, 0xffff, 0x800c, 0xffff, 0x0003,
+  0xfe58, 0xf164, 0xf1e6, 0x8022, 0xfa27, 0x0003, 0xf1e6, 0xf164, 0xfe38, 0x800c, 0xffff, 0x800b, 0xffff, 0x0003, 0xfc91, 0xf143,
+  0xf207, 0x8024, 0xfa27, 0x0003, 0xf207, 0xf163, 0xfc91, 0x800b, 0xffff, 0x800a, 0xffff, 0x0002, 0xfb8d, 0xf184, 0x8028, 0xfa27,
+  0x0002, 0xf184, 0xfb8d, 0x800a, 0xffff, 0x8009, 0xffff, 0x0002, 0xfb2b, 0xf1a5, 0x802a, 0xfa27, 0x0002, 0xf1a5, 0xfb2b, 0x8009,
+  0xffff, 0x8008, 0xffff, 0x0002, 0xfb8d, 0xf1a5, 0x802c, 0xfa27, 0x0002, 0xf1a5, 0xfb8d, 0x8008, 0xffff, 0x8007, 0xffff, 0x0002,
+  0xfc91, 0xf184, 0x802e, 0xfa27, 0x0002, 0xf184, 0xfc91, 0x8007, 0xffff, 0x8006, 0xffff, 0x0002, 0xfe38, 0xf163, 0x8030, 0xfa27,
+  0x0002, 0xf163, 0xfe38, 0x8006, 0xffff, 0x8006, 0xffff, 0x0002, 0xf164, 0xf207, 0x8030, 0xfa27, 0x0002, 0xf207, 0xf164, 0x8006,
+  0xffff, 0x8005, 0xffff, 0x0002, 0xfac9, 0xf1e6, 0x800d, 0xfa27, 0x0001, 0xf1e6, 0x8005, 0xf184, 0x0002, 0xf1a5, 0xf206, 0x8008,
+  0xfa27, 0x0002, 0xf206, 0xf1a5, 0x8005, 0xf184, 0x0001, 0xf1e6, 0x800d, 0xfa27, 0x0002, 0xf1e6, 0xfaa9, 0x8005, 0xffff, 0x8004,
+  0xffff, 0x0002, 0xfdd6, 0xf184, 0x800d, 0xfa27, 0x0004, 0xf184, 0xfbce, 0xff3c, 0xffff, 0x8003, 0xffdf, 0x0003, 0xfe79, 0xfa48,
+  0xf1e6, 0x8006, 0xfa27, 0x0003, 0xf1e6, 0xfa48, 0xfe79, 0x8003, 0xffdf, 0x0004, 0xffff, 0xff3c, 0xfbae, 0xf184, 0x800d, 0xfa27,
+  0x0002, 0xf184, 0xfdd6, 0x8004, 0xffff, 0x8004, 0xffff, 0x0002, 0xf1a5, 0xf207, 0x800c, 0xfa27, 0x0002, 0xf1c5, 0xfc71, 0x8008,
+  0xffff, 0x0002, 0xfa48, 0xf206, 0x8004, 0xfa27, 0x0002, 0xf206, 0xfa48, 0x8008, 0xffff, 0x0002, 0xfc71, 0xf1c5, 0x800c, 0xfa27,
+  0x0002, 0xf207, 0xf1a5, 0x8004, 0xffff, 0x8003, 0xffff, 0x0002, 0xfcd2, 0xf1c5, 0x800c, 0xfa27, 0x0002, 0xf227, 0xf1a5, 0x8009,
+  0xffff, 0x0002, 0xfe79, 0xf1a5, 0x8004, 0xfa27, 0x0002, 0xf1a5, 0xfe79, 0x8009, 0xffff, 0x0002, 0xf1a5, 0xf227, 0x800c, 0xfa27,
+  0x0002, 0xf1c5, 0xfcd2, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002, 0xf184, 0xf207, 0x800c, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a,
+  0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800c, 0xfa27, 0x0002, 0xf207,
+  0xf184, 0x8003, 0xffff, 0x0004, 0xffff, 0xffff, 0xfd54, 0xf1a5, 0x800d, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001,
+  0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800d, 0xfa27, 0x0004, 0xf1a5, 0xfd75, 0xffff,
+  0xffff, 0x0004, 0xffff, 0xffff, 0xfa27, 0xf206, 0x800d, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004,
+  0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800d, 0xfa27, 0x0004, 0xf206, 0xfa27, 0xffff, 0xffff, 0x0003,
+  0xffff, 0xff1c, 0xf164, 0x800e, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184,
+  0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800e, 0xfa27, 0x0003, 0xf164, 0xff1c, 0xffff, 0x0003, 0xffff, 0xfc91, 0xf1c5, 0x800e,
+  0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea,
+  0xf206, 0x800e, 0xfa27, 0x0003, 0xf1c5, 0xfc91, 0xffff, 0x0003, 0xffff, 0xfa48, 0xf206, 0x800e, 0xfa27, 0x0002, 0xf206, 0xfaea,
+  0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800e, 0xfa27, 0x0003,
+  0xf206, 0xfa68, 0xffff, 0x0002, 0xffff, 0xf164, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004,
+  0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf164, 0xffff, 0x0002, 0xfe99, 0xf1a5,
+  0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002,
+  0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf1a5, 0xfe99, 0x0002, 0xfd54, 0xf1c5, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a,
+  0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf1c5,
+  0xfd54, 0x0002, 0xfc30, 0xf1e6, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001,
+  0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf1e6, 0xfc30, 0x0002, 0xfb6c, 0xf206, 0x800f, 0xfa27,
+  0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206,
+  0x800f, 0xfa27, 0x0002, 0xf206, 0xfb6c, 0x0002, 0xfac9, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001,
+  0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfac9, 0x0002,
+  0xfa48, 0xf227, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a,
+  0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf227, 0xfa68, 0x0001, 0xf227, 0x8010, 0xfa27, 0x0002, 0xf206, 0xfaea,
+  0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x8010, 0xfa27, 0x0001,
+  0xf227, 0x0001, 0xf227, 0x8010, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184,
+  0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x8010, 0xfa27, 0x0001, 0xf227, 0x0002, 0xfa48, 0xf227, 0x800f, 0xfa27, 0x0002, 0xf206,
+  0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27,
+  0x0002, 0xf227, 0xfa68, 0x0002, 0xfac9, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004,
+  0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaca, 0x0002, 0xfb6c, 0xf206,
+  0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002,
+  0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfb6c, 0x0002, 0xfc30, 0xf1e6, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a,
+  0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf1e6,
+  0xfc30, 0x0002, 0xfd54, 0xf1c5, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001,
+  0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf1c5, 0xfd54, 0x0002, 0xfe99, 0xf1a5, 0x800f, 0xfa27,
+  0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206,
+  0x800f, 0xfa27, 0x0002, 0xf1a5, 0xfe99, 0x0002, 0xffff, 0xf164, 0x800f, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001,
+  0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800f, 0xfa27, 0x0002, 0xf164, 0xffff, 0x0003,
+  0xffff, 0xfa48, 0xf206, 0x800e, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184,
+  0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800e, 0xfa27, 0x0003, 0xf206, 0xfa68, 0xffff, 0x0003, 0xffff, 0xfc91, 0xf1c5, 0x800e,
+  0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea,
+  0xf206, 0x800e, 0xfa27, 0x0003, 0xf1c5, 0xfc91, 0xffff, 0x0003, 0xffff, 0xff1c, 0xf164, 0x800e, 0xfa27, 0x0002, 0xf206, 0xfaea,
+  0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800e, 0xfa27, 0x0003,
+  0xf164, 0xff3c, 0xffff, 0x0004, 0xffff, 0xffff, 0xfa27, 0xf206, 0x800d, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001,
+  0xf184, 0x8004, 0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800d, 0xfa27, 0x0004, 0xf206, 0xfa27, 0xffff,
+  0xffff, 0x0004, 0xffff, 0xffff, 0xfd54, 0xf1a5, 0x800d, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004,
+  0xfa27, 0x0001, 0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800d, 0xfa27, 0x0004, 0xf1a5, 0xfd75, 0xffff, 0xffff, 0x8003,
+  0xffff, 0x0002, 0xf184, 0xf207, 0x800c, 0xfa27, 0x0002, 0xf206, 0xfaea, 0x800a, 0xffff, 0x0001, 0xf184, 0x8004, 0xfa27, 0x0001,
+  0xf184, 0x800a, 0xffff, 0x0002, 0xfaea, 0xf206, 0x800c, 0xfa27, 0x0002, 0xf207, 0xf184, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002,
+  0xfcd2, 0xf1c5, 0x800c, 0xfa27, 0x0002, 0xf227, 0xf1a5, 0x8009, 0xffff, 0x0002, 0xfe79, 0xf1a5, 0x8004, 0xfa27, 0x0002, 0xf1a5,
+  0xfe79, 0x8009, 0xffff, 0x0002, 0xf1a5, 0xf227, 0x800c, 0xfa27, 0x0002, 0xf1c5, 0xfcd2, 0x8003, 0xffff, 0x8004, 0xffff, 0x0002,
+  0xf1a5, 0xf207, 0x800c, 0xfa27, 0x0002, 0xf1c5, 0xfc71, 0x8008, 0xffff, 0x0002, 0xfa48, 0xf206, 0x8004, 0xfa27, 0x0002, 0xf206,
+  0xfa47, 0x8008, 0xffff, 0x0002, 0xfc71, 0xf1c5, 0x800c, 0xfa27, 0x0002, 0xf207, 0xf1a5, 0x8004, 0xffff, 0x8004, 0xffff, 0x0002,
+  0xfdd6, 0xf184, 0x800d, 0xfa27, 0x0004, 0xf184, 0xfbad, 0xff3c, 0xffff, 0x8003, 0xffdf, 0x0003, 0xfe79, 0xfa47, 0xf1e6, 0x8006,
+  0xfa27, 0x0003, 0xf1e6, 0xfa47, 0xfe79, 0x8003, 0xffdf, 0x0004, 0xffff, 0xff3c, 0xfbad, 0xf184, 0x800d, 0xfa27, 0x0002, 0xf184,
+  0xfdd6, 0x8004, 0xffff, 0x8005, 0xffff, 0x0002, 0xfac9, 0xf1e6, 0x800d, 0xfa27, 0x0001, 0xf1e6, 0x8005, 0xf184, 0x0002, 0xf1a5,
+  0xf206, 0x8008, 0xfa27, 0x0002, 0xf206, 0xf1a5, 0x8005, 0xf184, 0x0001, 0xf1e6, 0x800d, 0xfa27, 0x0002, 0xf1e6, 0xfac9, 0x8005,
+  0xffff, 0x8006, 0xffff, 0x0002, 0xf164, 0xf207, 0x8030, 0xfa27, 0x0002, 0xf207, 0xf164, 0x8006, 0xffff, 0x8006, 0xffff, 0x0002,
+  0xfe58, 0xf143, 0x8030, 0xfa27, 0x0002, 0xf143, 0xfe58, 0x8006, 0xffff, 0x8007, 0xffff, 0x0002, 0xfc91, 0xf184, 0x802e, 0xfa27,
+  0x0002, 0xf184, 0xfc91, 0x8007, 0xffff, 0x8008, 0xffff, 0x0002, 0xfb8d, 0xf1a5, 0x802c, 0xfa27, 0x0002, 0xf1a5, 0xfb8d, 0x8008,
+  0xffff, 0x8009, 0xffff, 0x0002, 0xfb4b, 0xf1a5, 0x802a, 0xfa27, 0x0002, 0xf1a5, 0xfb2b, 0x8009, 0xffff, 0x800a, 0xffff, 0x0002,
+  0xfb8d, 0xf184, 0x8028, 0xfa27, 0x0002, 0xf184, 0xfb8d, 0x800a, 0xffff, 0x800b, 0xffff, 0x0003, 0xfc91, 0xf143, 0xf207, 0x8024,
+  0xfa27, 0x0003, 0xf207, 0xf143, 0xfc91, 0x800b, 0xffff, 0x800c, 0xffff, 0x0003, 0xfe58, 0xf164, 0xf1e6, 0x8022, 0xfa27, 0x0003,
+  0xf1e6, 0xf164, 0xfe58, 0x800c, 0xffff, 0x800e, 0xffff, 0x0003, 0xfac9, 0xf184, 0xf207, 0x801e, 0xfa27, 0x0003, 0xf207, 0xf184,
+  0xfac9, 0x800e, 0xffff, 0x800f, 0xffff, 0x0004, 0xfdd6, 0xf1a5, 0xf1c5, 0xf207, 0x801a, 0xfa27, 0x0004, 0xf207, 0xf1c5, 0xf1a5,
+  0xfdd6, 0x800f, 0xffff, 0x8011, 0xffff, 0x0004, 0xfcd2, 0xf184, 0xf1a5, 0xf206, 0x8016, 0xfa27, 0x0004, 0xf206, 0xf1a5, 0xf184,
+  0xfcd2, 0x8011, 0xffff, 0x8013, 0xffff, 0x0005, 0xfd75, 0xfa47, 0xf164, 0xf1c5, 0xf206, 0x8010, 0xfa27, 0x0005, 0xf206, 0xf1c5,
+  0xf164, 0xfa27, 0xfd54, 0x8013, 0xffff, 0x8015, 0xffff, 0x0009, 0xff3c, 0xfc91, 0xfa68, 0xf164, 0xf1a5, 0xf1c5, 0xf1e6, 0xf206,
+  0xf206, 0x8004, 0xf227, 0x0009, 0xf206, 0xf206, 0xf1e6, 0xf1c5, 0xf1a5, 0xf164, 0xfa68, 0xfc91, 0xff1c, 0x8015, 0xffff, 0x8019,
+  0xffff, 0x000e, 0xfe99, 0xfd54, 0xfc30, 0xfb6c, 0xfac9, 0xfa68, 0xfa27, 0xfa27, 0xfa68, 0xfac9, 0xfb6c, 0xfc30, 0xfd34, 0xfe99,
+  0x8019, 0xffff,
 };
 
 const lv_image_dsc_t pause_btn = {
   .header.cf = LV_COLOR_FORMAT_RGB565,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_USER1,
   .header.w = 64,
   .header.h = 64,
-  .data_size = 4096 * 2,
-  .data = pause_btn_map,
+  .data_size = 1506 * 2,
+  .data = (const uint8_t *)pause_btn_map,
 };
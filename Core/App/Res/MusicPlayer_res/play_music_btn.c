@@ -21,74 +21,82 @@
 #define LV_ATTRIBUTE_IMAGE_PLAY_MUSIC_BTN
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PLAY_MUSIC_BTN uint8_t play_music_btn_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0x97, 0xf5, 0x32, 0xec, 0x4f, 0xeb, 0x8c, 0xe2, 0x0a, 0xe2, 0xca, 0xe1, 0xca, 0xe1, 0x0a, 0xe2, 0x8c, 0xe2, 0x4f, 0xeb, 0x32, 0xec, 0x97, 0xf5, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xf5, 0xcd, 0xe2, 0xc6, 0xd8, 0xa6, 0xd8, 0xe7, 0xd8, 0x07, 0xd9, 0x28, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x28, 0xd9, 0x07, 0xd9, 0xe7, 0xd8, 0xa6, 0xd8, 0xc6, 0xd8, 0xcd, 0xe2, 0x77, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0x2f, 0xeb, 0x85, 0xd8, 0xe6, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0xe6, 0xd8, 0x85, 0xd8, 0x2f, 0xeb, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x6c, 0xe2, 0x85, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0x85, 0xd8, 0x6c, 0xe2, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xeb, 0x85, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0x85, 0xd8, 0x4f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0xc6, 0xd8, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xc6, 0xd8, 0x7a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xec, 0x85, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0x85, 0xd8, 0x12, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xe2, 0xc6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xc6, 0xd8, 0x6c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xe1, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xca, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xe1, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xca, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xe2, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0x6c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xeb, 0xc6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xc6, 0xd8, 0xf1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xfe, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0x39, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0xc6, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xeb, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0x2e, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0xe2, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0x2b, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xdc, 0xfe, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0x6f, 0xeb, 0x70, 0xeb, 0x85, 0xd8, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0xdc, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xee, 0xe2, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xd1, 0xeb, 0xff, 0xff, 0x3d, 0xff, 0x6c, 0xe2, 0x85, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0xee, 0xe2, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0xca, 0xe1, 0xa6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x15, 0xf5, 0xe7, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xfe, 0x68, 0xd9, 0xc6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xe7, 0xd8, 0x15, 0xf5, 0xff, 0xff, 
-  0xff, 0xff, 0x6c, 0xe2, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xf5, 0x07, 0xd9, 0xe6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0x6c, 0xe2, 0xff, 0xff, 
-  0xff, 0xff, 0xa6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xf4, 0xc6, 0xd8, 0xe7, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xa6, 0xd8, 0xff, 0xff, 
-  0xbb, 0xfe, 0xc6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0xec, 0x85, 0xd8, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xc6, 0xd8, 0xbb, 0xfe, 
-  0x36, 0xf5, 0xe7, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xeb, 0x85, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xe7, 0xd8, 0x36, 0xf5, 
-  0xf1, 0xeb, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xee, 0xe2, 0x85, 0xd8, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xf1, 0xeb, 
-  0xee, 0xe2, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x4c, 0xe2, 0xa6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0xee, 0xe2, 
-  0x2b, 0xe2, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xfe, 0xca, 0xe1, 0xa6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0x2b, 0xe2, 
-  0xa9, 0xe1, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf5, 0x68, 0xd9, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0xa9, 0xe1, 
-  0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xe2, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 
-  0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xf5, 0xe7, 0xd8, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 
-  0xa9, 0xe1, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xf5, 0x48, 0xd9, 0xc6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0xa9, 0xe1, 
-  0x2b, 0xe2, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0xa9, 0xe1, 0xc6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0x2b, 0xe2, 
-  0xee, 0xe2, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0x2b, 0xe2, 0xa6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0xee, 0xe2, 
-  0xf1, 0xeb, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xcd, 0xe2, 0x85, 0xd8, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xf1, 0xeb, 
-  0x36, 0xf5, 0xe7, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xeb, 0x85, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xe7, 0xd8, 0x36, 0xf5, 
-  0xbb, 0xfe, 0xc6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xec, 0x85, 0xd8, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xc6, 0xd8, 0xbb, 0xfe, 
-  0xff, 0xff, 0xa6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xf4, 0xa6, 0xd8, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xa6, 0xd8, 0xff, 0xff, 
-  0xff, 0xff, 0x6c, 0xe2, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xf5, 0xe7, 0xd8, 0xe7, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0x6c, 0xe2, 0xff, 0xff, 
-  0xff, 0xff, 0x15, 0xf5, 0xe7, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xb1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf5, 0x48, 0xd9, 0xc6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xe7, 0xd8, 0x15, 0xf5, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xd1, 0xeb, 0xff, 0xff, 0x9a, 0xfe, 0xa9, 0xe1, 0xa6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xee, 0xe2, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0x2e, 0xeb, 0xad, 0xe2, 0xa6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0xee, 0xe2, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xdc, 0xfe, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0xdc, 0xfe, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2b, 0xe2, 0x28, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x28, 0xd9, 0x2b, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xeb, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0x2e, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0xc6, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xfe, 0x85, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x85, 0xd8, 0x39, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xeb, 0xc6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xc6, 0xd8, 0xf1, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xe2, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0x6c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xe1, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xca, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xe1, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xca, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xe2, 0xc6, 0xd8, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0xc6, 0xd8, 0x6c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xec, 0x85, 0xd8, 0x48, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x48, 0xd9, 0x85, 0xd8, 0x12, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0xc6, 0xd8, 0x07, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x07, 0xd9, 0xc6, 0xd8, 0x7a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xeb, 0x85, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0x85, 0xd8, 0x4f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x6c, 0xe2, 0x85, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0x85, 0xd8, 0x6c, 0xe2, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0x2f, 0xeb, 0x85, 0xd8, 0xe6, 0xd8, 0x27, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x68, 0xd9, 0x27, 0xd9, 0xe6, 0xd8, 0x85, 0xd8, 0x2f, 0xeb, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xf5, 0xcd, 0xe2, 0xc6, 0xd8, 0xa6, 0xd8, 0xe7, 0xd8, 0x07, 0xd9, 0x28, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x48, 0xd9, 0x28, 0xd9, 0x07, 0xd9, 0xe7, 0xd8, 0xa6, 0xd8, 0xc6, 0xd8, 0xcd, 0xe2, 0x77, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0x97, 0xf5, 0x32, 0xec, 0x4f, 0xeb, 0x8c, 0xe2, 0x0a, 0xe2, 0xca, 0xe1, 0xca, 0xe1, 0x0a, 0xe2, 0x8c, 0xe2, 0x4f, 0xeb, 0x32, 0xec, 0x97, 0xf5, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+/* 60x60 RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): 7200 -> 2092 字节 */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PLAY_MUSIC_BTN uint16_t play_music_btn_map[] = {
+  0x003c, 0x004f, 0x0065, 0x0077, 0x0087, 0x0095, 0x00a3, 0x00b1, 0x00bd, 0x00c9, 0x00d5, 0x00e1, 0x00ed, 0x00f9, 0x0105, 0x0111,
+  0x011d, 0x012e, 0x0142, 0x0158, 0x016e, 0x0184, 0x019a, 0x01ad, 0x01c0, 0x01d3, 0x01e7, 0x01fb, 0x020f, 0x0222, 0x022e, 0x023b,
+  0x024f, 0x0263, 0x0277, 0x028b, 0x029e, 0x02b1, 0x02c4, 0x02da, 0x02f0, 0x0304, 0x0318, 0x0329, 0x0335, 0x0341, 0x034d, 0x0359,
+  0x0365, 0x0371, 0x037d, 0x0389, 0x0395, 0x03a1, 0x03af, 0x03bd, 0x03cb, 0x03db, 0x03ed, 0x0403, 0x8017, 0xffff, 0x000e, 0xff1c,
+  0xf597, 0xec32, 0xeb4f, 0xe28c, 0xe20a, 0xe1ca, 0xe1ca, 0xe20a, 0xe28c, 0xeb4f, 0xec32, 0xf597, 0xff1c, 0x8017, 0xffff, 0x8014,
+  0xffff, 0x0007, 0xf577, 0xe2cd, 0xd8c6, 0xd8a6, 0xd8e7, 0xd907, 0xd928, 0x8006, 0xd948, 0x0007, 0xd928, 0xd907, 0xd8e7, 0xd8a6,
+  0xd8c6, 0xe2cd, 0xf577, 0x8014, 0xffff, 0x8011, 0xffff, 0x0005, 0xff1d, 0xeb2f, 0xd885, 0xd8e6, 0xd927, 0x8010, 0xd968, 0x0005,
+  0xd927, 0xd8e6, 0xd885, 0xeb2f, 0xff1d, 0x8011, 0xffff, 0x800f, 0xffff, 0x0004, 0xff3d, 0xe26c, 0xd885, 0xd927, 0x8016, 0xd968,
+  0x0004, 0xd927, 0xd885, 0xe26c, 0xff3d, 0x800f, 0xffff, 0x800e, 0xffff, 0x0003, 0xeb4f, 0xd885, 0xd927, 0x801a, 0xd968, 0x0003,
+  0xd927, 0xd885, 0xeb4f, 0x800e, 0xffff, 0x800c, 0xffff, 0x0003, 0xfe7a, 0xd8c6, 0xd907, 0x801e, 0xd968, 0x0003, 0xd907, 0xd8c6,
+  0xfe7a, 0x800c, 0xffff, 0x800b, 0xffff, 0x0003, 0xec12, 0xd885, 0xd948, 0x8020, 0xd968, 0x0003, 0xd948, 0xd885, 0xec12, 0x800b,
+  0xffff, 0x800a, 0xffff, 0x0002, 0xe26c, 0xd8c6, 0x8024, 0xd968, 0x0002, 0xd8c6, 0xe26c, 0x800a, 0xffff, 0x8009, 0xffff, 0x0002,
+  0xe1ca, 0xd907, 0x8026, 0xd968, 0x0002, 0xd907, 0xe1ca, 0x8009, 0xffff, 0x8008, 0xffff, 0x0002, 0xe1ca, 0xd907, 0x8028, 0xd968,
+  0x0002, 0xd907, 0xe1ca, 0x8008, 0xffff, 0x8007, 0xffff, 0x0002, 0xe26c, 0xd907, 0x802a, 0xd968, 0x0002, 0xd907, 0xe26c, 0x8007,
+  0xffff, 0x8006, 0xffff, 0x0002, 0xebf1, 0xd8c6, 0x802c, 0xd968, 0x0002, 0xd8c6, 0xebf1, 0x8006, 0xffff, 0x8005, 0xffff, 0x0002,
+  0xfe39, 0xd885, 0x802e, 0xd968, 0x0002, 0xd885, 0xfe39, 0x8005, 0xffff, 0x8005, 0xffff, 0x0002, 0xd8c6, 0xd948, 0x802e, 0xd968,
+  0x0002, 0xd948, 0xd8c6, 0x8005, 0xffff, 0x8004, 0xffff, 0x0002, 0xeb2e, 0xd907, 0x8030, 0xd968, 0x0002, 0xd907, 0xeb2e, 0x8004,
+  0xffff, 0x8003, 0xffff, 0x0002, 0xfefc, 0xd885, 0x8032, 0xd968, 0x0002, 0xd885, 0xfefc, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002,
+  0xe22b, 0xd928, 0x8010, 0xd968, 0x0002, 0xd927, 0xd927, 0x8020, 0xd968, 0x0002, 0xd928, 0xe22b, 0x8003, 0xffff, 0x0004, 0xffff,
+  0xffff, 0xfedc, 0xd885, 0x8010, 0xd968, 0x0005, 0xd927, 0xeb6f, 0xeb70, 0xd885, 0xd928, 0x801f, 0xd968, 0x0004, 0xd885, 0xfedc,
+  0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xe2ee, 0xd927, 0x8010, 0xd968, 0x0007, 0xd907, 0xebd1, 0xffff, 0xff3d, 0xe26c, 0xd885,
+  0xd948, 0x801d, 0xd968, 0x0004, 0xd927, 0xe2ee, 0xffff, 0xffff, 0x0003, 0xffff, 0xffff, 0xd885, 0x8011, 0xd968, 0x0002, 0xd907,
+  0xebb1, 0x8003, 0xffff, 0x0004, 0xfebb, 0xe1ca, 0xd8a6, 0xd948, 0x801c, 0xd968, 0x0003, 0xd885, 0xffff, 0xffff, 0x0003, 0xffff,
+  0xf515, 0xd8e7, 0x8011, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8005, 0xffff, 0x0004, 0xfe19, 0xd968, 0xd8c6, 0xd948, 0x801a, 0xd968,
+  0x0003, 0xd8e7, 0xf515, 0xffff, 0x0003, 0xffff, 0xe26c, 0xd928, 0x8011, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8007, 0xffff, 0x0004,
+  0xf577, 0xd907, 0xd8e6, 0xd948, 0x8018, 0xd968, 0x0003, 0xd928, 0xe26c, 0xffff, 0x0002, 0xffff, 0xd8a6, 0x8012, 0xd968, 0x0002,
+  0xd907, 0xebb1, 0x8009, 0xffff, 0x0003, 0xf4d4, 0xd8c6, 0xd8e7, 0x8018, 0xd968, 0x0002, 0xd8a6, 0xffff, 0x0002, 0xfebb, 0xd8c6,
+  0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x800b, 0xffff, 0x0003, 0xec32, 0xd885, 0xd907, 0x8016, 0xd968, 0x0002, 0xd8c6, 0xfebb,
+  0x0002, 0xf536, 0xd8e7, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x800d, 0xffff, 0x0003, 0xeb90, 0xd885, 0xd927, 0x8014, 0xd968,
+  0x0002, 0xd8e7, 0xf536, 0x0002, 0xebf1, 0xd907, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x800e, 0xffff, 0x0004, 0xffbf, 0xe2ee,
+  0xd885, 0xd928, 0x8012, 0xd968, 0x0002, 0xd907, 0xebf1, 0x0002, 0xe2ee, 0xd928, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8010,
+  0xffff, 0x0004, 0xff3d, 0xe24c, 0xd8a6, 0xd948, 0x8010, 0xd968, 0x0002, 0xd928, 0xe2ee, 0x0002, 0xe22b, 0xd948, 0x8012, 0xd968,
+  0x0002, 0xd907, 0xebb1, 0x8012, 0xffff, 0x0004, 0xfe9b, 0xe1ca, 0xd8a6, 0xd948, 0x800e, 0xd968, 0x0002, 0xd948, 0xe22b, 0x0002,
+  0xe1a9, 0xd948, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8014, 0xffff, 0x0003, 0xf5f8, 0xd968, 0xd927, 0x800d, 0xd968, 0x0002,
+  0xd948, 0xe1a9, 0x8014, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8016, 0xffff, 0x0002, 0xe24b, 0xd948, 0x800e, 0xd968, 0x8014, 0xd968,
+  0x0002, 0xd907, 0xebb1, 0x8014, 0xffff, 0x0003, 0xf536, 0xd8e7, 0xd928, 0x800f, 0xd968, 0x0002, 0xe1a9, 0xd948, 0x8012, 0xd968,
+  0x0002, 0xd907, 0xebb1, 0x8012, 0xffff, 0x0004, 0xf5d8, 0xd948, 0xd8c6, 0xd948, 0x800e, 0xd968, 0x0002, 0xd948, 0xe1a9, 0x0002,
+  0xe22b, 0xd948, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8010, 0xffff, 0x0004, 0xfe7a, 0xe1a9, 0xd8c6, 0xd948, 0x8010, 0xd968,
+  0x0002, 0xd948, 0xe22b, 0x0002, 0xe2ee, 0xd928, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x800e, 0xffff, 0x0004, 0xff1c, 0xe22b,
+  0xd8a6, 0xd948, 0x8012, 0xd968, 0x0002, 0xd928, 0xe2ee, 0x0002, 0xebf1, 0xd907, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x800c,
+  0xffff, 0x0004, 0xff9e, 0xe2cd, 0xd885, 0xd928, 0x8014, 0xd968, 0x0002, 0xd907, 0xebf1, 0x0002, 0xf536, 0xd8e7, 0x8012, 0xd968,
+  0x0002, 0xd907, 0xebb1, 0x800b, 0xffff, 0x0003, 0xeb6f, 0xd885, 0xd927, 0x8016, 0xd968, 0x0002, 0xd8e7, 0xf536, 0x0002, 0xfebb,
+  0xd8c6, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8009, 0xffff, 0x0003, 0xec12, 0xd885, 0xd907, 0x8018, 0xd968, 0x0002, 0xd8c6,
+  0xfebb, 0x0002, 0xffff, 0xd8a6, 0x8012, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8007, 0xffff, 0x0003, 0xf4b4, 0xd8a6, 0xd907, 0x801a,
+  0xd968, 0x0002, 0xd8a6, 0xffff, 0x0003, 0xffff, 0xe26c, 0xd928, 0x8011, 0xd968, 0x0002, 0xd907, 0xebb1, 0x8005, 0xffff, 0x0004,
+  0xf556, 0xd8e7, 0xd8e7, 0xd948, 0x801a, 0xd968, 0x0003, 0xd928, 0xe26c, 0xffff, 0x0003, 0xffff, 0xf515, 0xd8e7, 0x8011, 0xd968,
+  0x0002, 0xd907, 0xebb1, 0x8003, 0xffff, 0x0004, 0xf5f8, 0xd948, 0xd8c6, 0xd948, 0x801c, 0xd968, 0x0003, 0xd8e7, 0xf515, 0xffff,
+  0x0003, 0xffff, 0xffff, 0xd885, 0x8011, 0xd968, 0x0007, 0xd907, 0xebd1, 0xffff, 0xfe9a, 0xe1a9, 0xd8a6, 0xd948, 0x801e, 0xd968,
+  0x0003, 0xd885, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xe2ee, 0xd927, 0x8010, 0xd968, 0x0005, 0xd928, 0xeb2e, 0xe2ad, 0xd8a6,
+  0xd948, 0x801f, 0xd968, 0x0004, 0xd927, 0xe2ee, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfedc, 0xd885, 0x8011, 0xd968, 0x0002,
+  0xd928, 0xd928, 0x8021, 0xd968, 0x0004, 0xd885, 0xfedc, 0xffff, 0xffff, 0x8003, 0xffff, 0x0002, 0xe22b, 0xd928, 0x8032, 0xd968,
+  0x0002, 0xd928, 0xe22b, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002, 0xfefc, 0xd885, 0x8032, 0xd968, 0x0002, 0xd885, 0xfefc, 0x8003,
+  0xffff, 0x8004, 0xffff, 0x0002, 0xeb2e, 0xd907, 0x8030, 0xd968, 0x0002, 0xd907, 0xeb2e, 0x8004, 0xffff, 0x8005, 0xffff, 0x0002,
+  0xd8c6, 0xd948, 0x802e, 0xd968, 0x0002, 0xd948, 0xd8c6, 0x8005, 0xffff, 0x8005, 0xffff, 0x0002, 0xfe39, 0xd885, 0x802e, 0xd968,
+  0x0002, 0xd885, 0xfe39, 0x8005, 0xffff, 0x8006, 0xffff, 0x0002, 0xebf1, 0xd8c6, 0x802c, 0xd968, 0x0002, 0xd8c6, 0xebf1, 0x8006,
+  0xffff, 0x8007, 0xffff, 0x0002, 0xe26c, 0xd907, 0x802a, 0xd968, 0x0002, 0xd907, 0xe26c, 0x8007, 0xffff, 0x8008, 0xffff, 0x0002,
+  0xe1ca, 0xd907, 0x8028, 0xd968, 0x0002, 0xd907, 0xe1ca, 0x8008, 0xffff, 0x8009, 0xffff, 0x0002, 0xe1ca, 0xd907, 0x8026, 0xd968,
+  0x0002, 0xd907, 0xe1ca, 0x8009, 0xffff, 0x800a, 0xffff, 0x0002, 0xe26c, 0xd8c6, 0x8024, 0xd968, 0x0002, 0xd8c6, 0xe26c, 0x800a,
+  0xffff, 0x800b, 0xffff, 0x0003, 0xec12, 0xd885, 0xd948, 0x8020, 0xd968, 0x0003, 0xd948, 0xd885, 0xec12, 0x800b, 0xffff, 0x800c,
+  0xffff, 0x0003, 0xfe7a, 0xd8c6, 0xd907, 0x801e, 0xd968, 0x0003, 0xd907, 0xd8c6, 0xfe7a, 0x800c, 0xffff, 0x800e, 0xffff, 0x0003,
+  0xeb4f, 0xd885, 0xd927, 0x801a, 0xd968, 0x0003, 0xd927, 0xd885, 0xeb4f, 0x800e, 0xffff, 0x800f, 0xffff, 0x0004, 0xff3d, 0xe26c,
+  0xd885, 0xd927, 0x8016, 0xd968, 0x0004, 0xd927, 0xd885, 0xe26c, 0xff3d, 0x800f, 0xffff, 0x8011, 0xffff, 0x0005, 0xff1d, 0xeb2f,
+  0xd885, 0xd8e6, 0xd927, 0x8010, 0xd968, 0x0005, 0xd927, 0xd8e6, 0xd885, 0xeb2f, 0xff1d, 0x8011, 0xffff, 0x8014, 0xffff, 0x0007,
+  0xf577, 0xe2cd, 0xd8c6, 0xd8a6, 0xd8e7, 0xd907, 0xd928, 0x8006, 0xd948, 0x0007, 0xd928, 0xd907, 0xd8e7, 0xd8a6, 0xd8c6, 0xe2cd,
+  0xf577, 0x8014, 0xffff, 0x8017, 0xffff, 0x000e, 0xff1c, 0xf597, 0xec32, 0xeb4f, 0xe28c, 0xe20a, 0xe1ca, 0xe1ca, 0xe20a, 0xe28c,
+  0xeb4f, 0xec32, 0xf597, 0xff1c, 0x8017, 0xffff,
 };
 
 const lv_image_dsc_t play_music_btn = {
   .header.cf = LV_COLOR_FORMAT_RGB565,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_USER1,
   .header.w = 60,
   .header.h = 60,
-  .data_size = 3600 * 2,
-  .data = play_music_btn_map,
+  .data_size = 1046 * 2,
+  .data = (const uint8_t *)play_music_btn_map,
 };
@@ -21,54 +21,62 @@
 #define LV_ATTRIBUTE_IMAGE_PREVIOUS_BTN
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PREVIOUS_BTN uint8_t previous_btn_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x95, 0xfd, 0x2f, 0xfc, 0x2b, 0xfb, 0x68, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x68, 0xf2, 0x0b, 0xfb, 0x0f, 0xfc, 0x75, 0xfd, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc, 0xe6, 0xf1, 0x64, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xc6, 0xf1, 0xa5, 0xf1, 0x64, 0xf1, 0xc5, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xfc, 0x43, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xc5, 0xf1, 0x43, 0xf1, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0xa5, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xc5, 0xf1, 0x64, 0xf1, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xfc, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x43, 0xf1, 0xce, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0x84, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0xca, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0xca, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfc, 0x84, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0xce, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xfe, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x63, 0xf1, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x64, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x91, 0xfc, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xa5, 0xf1, 0x27, 0xf2, 0xc5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xc5, 0xf1, 0xee, 0xfb, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x63, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xfb, 0xe6, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x43, 0xf1, 0xdf, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x13, 0xfd, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xfc, 0xc5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xc5, 0xf1, 0x70, 0xfc, 0xff, 0xff, 
-  0xff, 0xff, 0x07, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x64, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 
-  0x9e, 0xff, 0x64, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x64, 0xf1, 0x1b, 0xff, 
-  0xd6, 0xfd, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0x34, 0xfd, 
-  0x70, 0xfc, 0xc5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xee, 0xfb, 
-  0x6c, 0xfb, 0xe6, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xea, 0xf2, 
-  0xa9, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x27, 0xf2, 
-  0x68, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 
-  0x68, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x84, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 
-  0xa9, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x27, 0xf2, 
-  0x6c, 0xfb, 0xe6, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xea, 0xf2, 
-  0x70, 0xfc, 0xc5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xee, 0xfb, 
-  0xd6, 0xfd, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0x34, 0xfd, 
-  0x9e, 0xff, 0x64, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x64, 0xf1, 0x1b, 0xff, 
-  0xff, 0xff, 0x07, 0xf2, 0xe6, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xfd, 0x64, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xa5, 0xf1, 0xff, 0xff, 
-  0xff, 0xff, 0x13, 0xfd, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xfc, 0xc5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xc5, 0xf1, 0x70, 0xfc, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x63, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xc5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xce, 0xfb, 0xc6, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x43, 0xf1, 0xdf, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x91, 0xfc, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xe6, 0xf1, 0xa5, 0xf1, 0x68, 0xf2, 0xc5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xc5, 0xf1, 0xee, 0xfb, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x64, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xfe, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x63, 0xf1, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfc, 0x84, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0xce, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0xa5, 0xf1, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0xca, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0x84, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0xa5, 0xf1, 0xca, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xfc, 0x43, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0x43, 0xf1, 0xce, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xfe, 0xa5, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xc5, 0xf1, 0x64, 0xf1, 0x17, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xfc, 0x43, 0xf1, 0xa5, 0xf1, 0x06, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x06, 0xf2, 0xc5, 0xf1, 0x43, 0xf1, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfc, 0xe6, 0xf1, 0x64, 0xf1, 0xa5, 0xf1, 0xc5, 0xf1, 0xe6, 0xf1, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0x06, 0xf2, 0xe6, 0xf1, 0xc6, 0xf1, 0xa5, 0xf1, 0x64, 0xf1, 0xc5, 0xf1, 0x91, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x95, 0xfd, 0x30, 0xfc, 0x2b, 0xfb, 0x68, 0xf2, 0x27, 0xf2, 0x27, 0xf2, 0x68, 0xf2, 0x0b, 0xfb, 0x0f, 0xfc, 0x75, 0xfd, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+/* 40x40 RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): 3200 -> 1452 字节 */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PREVIOUS_BTN uint16_t previous_btn_map[] = {
+  0x0028, 0x0039, 0x004d, 0x005d, 0x006d, 0x007b, 0x0088, 0x0094, 0x00a0, 0x00ad, 0x00be, 0x00d1, 0x00e6, 0x00fa, 0x010f, 0x0122,
+  0x0135, 0x0148, 0x015b, 0x016e, 0x017f, 0x0190, 0x01a3, 0x01b6, 0x01c9, 0x01dc, 0x01ef, 0x0204, 0x0218, 0x022d, 0x0240, 0x0251,
+  0x025e, 0x026a, 0x0276, 0x0283, 0x0291, 0x02a1, 0x02b1, 0x02c5, 0x800e, 0xffff, 0x000c, 0xff5d, 0xfd95, 0xfc2f, 0xfb2b, 0xf268,
+  0xf227, 0xf227, 0xf268, 0xfb0b, 0xfc0f, 0xfd75, 0xff3c, 0x800e, 0xffff, 0x800c, 0xffff, 0x0006, 0xfcd2, 0xf1e6, 0xf164, 0xf1a5,
+  0xf1c5, 0xf1e6, 0x8004, 0xf206, 0x0006, 0xf1e6, 0xf1c6, 0xf1a5, 0xf164, 0xf1c5, 0xfc91, 0x800c, 0xffff, 0x800a, 0xffff, 0x0004,
+  0xfc70, 0xf143, 0xf1a5, 0xf206, 0x800c, 0xf207, 0x0004, 0xf206, 0xf1c5, 0xf143, 0xfc0f, 0x800a, 0xffff, 0x8008, 0xffff, 0x0004,
+  0xfe79, 0xf1a5, 0xf1a5, 0xf206, 0x8010, 0xf207, 0x0004, 0xf206, 0xf1c5, 0xf164, 0xfdf7, 0x8008, 0xffff, 0x8007, 0xffff, 0x0003,
+  0xfc70, 0xf143, 0xf206, 0x8014, 0xf207, 0x0003, 0xf206, 0xf143, 0xfbce, 0x8007, 0xffff, 0x8006, 0xffff, 0x0003, 0xfb4c, 0xf184,
+  0xf206, 0x8017, 0xf207, 0x0002, 0xf1a5, 0xf2ca, 0x8006, 0xffff, 0x8005, 0xffff, 0x0002, 0xfb4c, 0xf1a5, 0x801a, 0xf207, 0x0002,
+  0xf1a5, 0xf2ca, 0x8005, 0xffff, 0x8004, 0xffff, 0x0002, 0xfc71, 0xf184, 0x801c, 0xf207, 0x0002, 0xf1a5, 0xfbce, 0x8004, 0xffff,
+  0x8003, 0xffff, 0x0003, 0xfe9a, 0xf143, 0xf206, 0x801d, 0xf207, 0x0002, 0xf163, 0xfdf7, 0x8003, 0xffff, 0x8003, 0xffff, 0x0002,
+  0xf1a5, 0xf206, 0x8011, 0xf207, 0x0002, 0xf206, 0xf206, 0x800b, 0xf207, 0x0002, 0xf206, 0xf164, 0x8003, 0xffff, 0x0004, 0xffff,
+  0xffff, 0xfc91, 0xf1a5, 0x8011, 0xf207, 0x0004, 0xf1e6, 0xf1a5, 0xf227, 0xf1c5, 0x800b, 0xf207, 0x0004, 0xf1c5, 0xfbee, 0xffff,
+  0xffff, 0x0004, 0xffff, 0xffff, 0xf163, 0xf206, 0x8010, 0xf207, 0x0006, 0xf1e6, 0xf1c5, 0xffff, 0xffff, 0xfb6c, 0xf1e6, 0x800a,
+  0xf207, 0x0004, 0xf206, 0xf143, 0xffdf, 0xffff, 0x0003, 0xffff, 0xfd13, 0xf1a5, 0x8010, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003,
+  0xffff, 0x0002, 0xfc2f, 0xf1c5, 0x800b, 0xf207, 0x0003, 0xf1c5, 0xfc70, 0xffff, 0x0003, 0xffff, 0xf207, 0xf206, 0x800f, 0xf207,
+  0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf164, 0xf206, 0x800b, 0xf207, 0x0003, 0xf206, 0xf1a5, 0xffff, 0x0002,
+  0xff9e, 0xf164, 0x800f, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143, 0xf206, 0x800d, 0xf207, 0x0002,
+  0xf164, 0xff1b, 0x0002, 0xfdd6, 0xf1a5, 0x800e, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143, 0xf206,
+  0x800e, 0xf207, 0x0002, 0xf1a5, 0xfd34, 0x0002, 0xfc70, 0xf1c5, 0x800d, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0003,
+  0xfdb6, 0xf143, 0xf206, 0x800f, 0xf207, 0x0002, 0xf1e6, 0xfbee, 0x0002, 0xfb6c, 0xf1e6, 0x800c, 0xf207, 0x0002, 0xf1e6, 0xf1c5,
+  0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143, 0xf206, 0x8010, 0xf207, 0x0002, 0xf206, 0xf2ea, 0x0002, 0xf2a9, 0xf206, 0x800b, 0xf207,
+  0x0002, 0xf206, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143, 0xf206, 0x8011, 0xf207, 0x0002, 0xf206, 0xf227, 0x0002, 0xf268,
+  0xf206, 0x800b, 0xf207, 0x0007, 0xf184, 0xffdf, 0xffff, 0xffff, 0xfd34, 0xf143, 0xf206, 0x8013, 0xf207, 0x0001, 0xf206, 0x0002,
+  0xf268, 0xf206, 0x800b, 0xf207, 0x0007, 0xf184, 0xffdf, 0xffff, 0xffff, 0xfd34, 0xf143, 0xf206, 0x8013, 0xf207, 0x0001, 0xf206,
+  0x0002, 0xf2a9, 0xf206, 0x800b, 0xf207, 0x0002, 0xf206, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143, 0xf206, 0x8011, 0xf207,
+  0x0002, 0xf206, 0xf227, 0x0002, 0xfb6c, 0xf1e6, 0x800c, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143,
+  0xf206, 0x8010, 0xf207, 0x0002, 0xf206, 0xf2ea, 0x0002, 0xfc70, 0xf1c5, 0x800d, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff,
+  0x0003, 0xfdb6, 0xf143, 0xf206, 0x800f, 0xf207, 0x0002, 0xf1e6, 0xfbee, 0x0002, 0xfdd6, 0xf1a5, 0x800e, 0xf207, 0x0002, 0xf1e6,
+  0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143, 0xf206, 0x800e, 0xf207, 0x0002, 0xf1a5, 0xfd34, 0x0002, 0xff9e, 0xf164, 0x800f,
+  0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf143, 0xf206, 0x800d, 0xf207, 0x0002, 0xf164, 0xff1b, 0x0003,
+  0xffff, 0xf207, 0xf1e6, 0x800f, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0003, 0xfdb6, 0xf164, 0xf206, 0x800b, 0xf207,
+  0x0003, 0xf206, 0xf1a5, 0xffff, 0x0003, 0xffff, 0xfd13, 0xf1a5, 0x8010, 0xf207, 0x0002, 0xf1e6, 0xf1c5, 0x8003, 0xffff, 0x0002,
+  0xfc50, 0xf1c5, 0x800b, 0xf207, 0x0003, 0xf1c5, 0xfc70, 0xffff, 0x0004, 0xffff, 0xffff, 0xf163, 0xf206, 0x8010, 0xf207, 0x0006,
+  0xf1e6, 0xf1c5, 0xffff, 0xffff, 0xfbce, 0xf1c6, 0x800a, 0xf207, 0x0004, 0xf206, 0xf143, 0xffdf, 0xffff, 0x0004, 0xffff, 0xffff,
+  0xfc91, 0xf1a5, 0x8011, 0xf207, 0x0004, 0xf1e6, 0xf1a5, 0xf268, 0xf1c5, 0x800b, 0xf207, 0x0004, 0xf1c5, 0xfbee, 0xffff, 0xffff,
+  0x8003, 0xffff, 0x0002, 0xf1a5, 0xf206, 0x8011, 0xf207, 0x0002, 0xf206, 0xf206, 0x800b, 0xf207, 0x0002, 0xf206, 0xf164, 0x8003,
+  0xffff, 0x8003, 0xffff, 0x0003, 0xfe9a, 0xf143, 0xf206, 0x801d, 0xf207, 0x0002, 0xf163, 0xfdf7, 0x8003, 0xffff, 0x8004, 0xffff,
+  0x0002, 0xfc71, 0xf184, 0x801c, 0xf207, 0x0002, 0xf1a5, 0xfbce, 0x8004, 0xffff, 0x8005, 0xffff, 0x0002, 0xfb4c, 0xf1a5, 0x801a,
+  0xf207, 0x0002, 0xf1a5, 0xf2ca, 0x8005, 0xffff, 0x8006, 0xffff, 0x0003, 0xfb4c, 0xf184, 0xf206, 0x8017, 0xf207, 0x0002, 0xf1a5,
+  0xf2ca, 0x8006, 0xffff, 0x8007, 0xffff, 0x0003, 0xfc70, 0xf143, 0xf206, 0x8014, 0xf207, 0x0003, 0xf206, 0xf143, 0xfbce, 0x8007,
+  0xffff, 0x8008, 0xffff, 0x0004, 0xfe79, 0xf1a5, 0xf1a5, 0xf206, 0x8010, 0xf207, 0x0004, 0xf206, 0xf1c5, 0xf164, 0xfe17, 0x8008,
+  0xffff, 0x800a, 0xffff, 0x0004, 0xfc70, 0xf143, 0xf1a5, 0xf206, 0x800c, 0xf207, 0x0004, 0xf206, 0xf1c5, 0xf143, 0xfc0f, 0x800a,
+  0xffff, 0x800c, 0xffff, 0x0006, 0xfcd2, 0xf1e6, 0xf164, 0xf1a5, 0xf1c5, 0xf1e6, 0x8004, 0xf206, 0x0006, 0xf1e6, 0xf1c6, 0xf1a5,
+  0xf164, 0xf1c5, 0xfc91, 0x800c, 0xffff, 0x800e, 0xffff, 0x000c, 0xff5d, 0xfd95, 0xfc30, 0xfb2b, 0xf268, 0xf227, 0xf227, 0xf268,
+  0xfb0b, 0xfc0f, 0xfd75, 0xff3c, 0x800e, 0xffff,
 };
 
 const lv_image_dsc_t previous_btn = {
   .header.cf = LV_COLOR_FORMAT_RGB565,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_USER1,
   .header.w = 40,
   .header.h = 40,
-  .data_size = 1600 * 2,
-  .data = previous_btn_map,
+  .data_size = 726 * 2,
+  .data = (const uint8_t *)previous_btn_map,
 };
@@ -21,64 +21,83 @@
 #define LV_ATTRIBUTE_IMAGE_SETTING_BTN
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_SETTING_BTN uint8_t setting_btn_map[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xd9, 0xfd, 0x53, 0xfc, 0xef, 0xfa, 0x0c, 0xfa, 0x6a, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x6a, 0xf9, 0x0c, 0xfa, 0xef, 0xfa, 0x33, 0xfc, 0xd9, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfc, 0x4a, 0xf9, 0x26, 0xf8, 0x87, 0xf8, 0xa8, 0xf8, 0xe8, 0xf8, 0xe9, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe9, 0xf8, 0xe8, 0xf8, 0xa8, 0xf8, 0x87, 0xf8, 0x26, 0xf8, 0x4a, 0xf9, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xae, 0xfa, 0x26, 0xf8, 0xa7, 0xf8, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xa7, 0xf8, 0x26, 0xf8, 0xae, 0xfa, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfb, 0x26, 0xf8, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x26, 0xf8, 0x0f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0x67, 0xf8, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x67, 0xf8, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfb, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0x71, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xfa, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x0c, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xf9, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0xab, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xfa, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x0c, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfb, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x71, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x87, 0xf8, 0x87, 0xf8, 0x87, 0xf8, 0x87, 0xf8, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0xae, 0xfa, 0x3a, 0xfe, 0x19, 0xfe, 0x19, 0xfe, 0x3a, 0xfe, 0xae, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x67, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfb, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x0f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x67, 0xf8, 0xec, 0xf9, 0x87, 0xf8, 0xe8, 0xf8, 0xc8, 0xf8, 0xec, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf9, 0xc8, 0xf8, 0xe8, 0xf8, 0x87, 0xf8, 0xec, 0xf9, 0x67, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xae, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe9, 0xf8, 0x46, 0xf8, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf9, 0x67, 0xf8, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfc, 0x67, 0xf8, 0x09, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x46, 0xf8, 0xe9, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0xce, 0xfa, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x46, 0xf8, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x46, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x74, 0xfc, 0xa7, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x67, 0xf8, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x67, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa7, 0xf8, 0x74, 0xfc, 0xff, 0xff, 
-  0xff, 0xff, 0x4a, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xec, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x4a, 0xf9, 0xff, 0xff, 
-  0xdf, 0xff, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0xdf, 0xff, 
-  0xd9, 0xfd, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0xd9, 0xfd, 
-  0x33, 0xfc, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x67, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0xef, 0xfa, 0xef, 0xfa, 0xf6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xf8, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x33, 0xfc, 
-  0xef, 0xfa, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x09, 0xf9, 0xcb, 0xf9, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa7, 0xf8, 0x87, 0xf8, 0xc8, 0xf8, 0xc8, 0xf8, 0x87, 0xf8, 0xa7, 0xf8, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfc, 0xcb, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xef, 0xfa, 
-  0x0c, 0xfa, 0xe9, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0xae, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xf8, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xa7, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe9, 0xf8, 0x0c, 0xfa, 
-  0x6a, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x3a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0xf6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xfe, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x6a, 0xf9, 
-  0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x0f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xfe, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x29, 0xf9, 
-  0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x19, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x0f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xfe, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x29, 0xf9, 
-  0x6a, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x3a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0xf6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xfe, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x6a, 0xf9, 
-  0x0c, 0xfa, 0xe9, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0xae, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xf8, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xa7, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe9, 0xf8, 0x0c, 0xfa, 
-  0xef, 0xfa, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x09, 0xf9, 0xcb, 0xf9, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xa7, 0xf8, 0x87, 0xf8, 0xc8, 0xf8, 0xc8, 0xf8, 0x87, 0xf8, 0xa7, 0xf8, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfc, 0xcb, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xef, 0xfa, 
-  0x33, 0xfc, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x67, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0xef, 0xfa, 0x0f, 0xfb, 0xf6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xf8, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x33, 0xfc, 
-  0xd9, 0xfd, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0xd9, 0xfd, 
-  0xdf, 0xff, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0xdf, 0xff, 
-  0xff, 0xff, 0x4a, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xec, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x6a, 0xf9, 0xff, 0xff, 
-  0xff, 0xff, 0x74, 0xfc, 0xa7, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x67, 0xf8, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x67, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa7, 0xf8, 0x74, 0xfc, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x46, 0xf8, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x46, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xae, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe9, 0xf8, 0x46, 0xf8, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf9, 0x67, 0xf8, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfc, 0x67, 0xf8, 0x09, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x46, 0xf8, 0xe9, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0xce, 0xfa, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x67, 0xf8, 0xec, 0xf9, 0x87, 0xf8, 0xe8, 0xf8, 0xc8, 0xf8, 0xec, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf9, 0xc8, 0xf8, 0xe8, 0xf8, 0x87, 0xf8, 0xec, 0xf9, 0x67, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xfb, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x10, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0xae, 0xfa, 0x3a, 0xfe, 0x19, 0xfe, 0x19, 0xfe, 0x3a, 0xfe, 0xae, 0xfa, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x67, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x87, 0xf8, 0x87, 0xf8, 0x87, 0xf8, 0x87, 0xf8, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfb, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x71, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xfa, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x0c, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xf9, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0xab, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xfa, 0x87, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x87, 0xf8, 0x0c, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xfb, 0x26, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x26, 0xf8, 0x71, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfd, 0x67, 0xf8, 0xa8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xa8, 0xf8, 0x67, 0xf8, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfb, 0x26, 0xf8, 0xc8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xc8, 0xf8, 0x26, 0xf8, 0x10, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xcf, 0xfa, 0x26, 0xf8, 0xa7, 0xf8, 0xe8, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe8, 0xf8, 0xa7, 0xf8, 0x26, 0xf8, 0xae, 0xfa, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xfc, 0x6a, 0xf9, 0x26, 0xf8, 0x87, 0xf8, 0xa8, 0xf8, 0xe8, 0xf8, 0xe9, 0xf8, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0x09, 0xf9, 0xe9, 0xf8, 0xe8, 0xf8, 0xa8, 0xf8, 0x87, 0xf8, 0x26, 0xf8, 0x4a, 0xf9, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xd9, 0xfd, 0x53, 0xfc, 0xef, 0xfa, 0x0c, 0xfa, 0x6a, 0xf9, 0x29, 0xf9, 0x29, 0xf9, 0x6a, 0xf9, 0x0c, 0xfa, 0xef, 0xfa, 0x33, 0xfc, 0xd9, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+/* 50x50 RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): 5000 -> 2124 字节 */
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_SETTING_BTN uint16_t setting_btn_map[] = {
+  0x0032, 0x0045, 0x005b, 0x006d, 0x007b, 0x0089, 0x0095, 0x00a1, 0x00ad, 0x00b9, 0x00c5, 0x00d9, 0x00ee, 0x0106, 0x0124, 0x0146,
+  0x015a, 0x016e, 0x0182, 0x0192, 0x01a4, 0x01bd, 0x01de, 0x01fa, 0x0214, 0x022c, 0x0244, 0x025e, 0x027a, 0x029b, 0x02b4, 0x02c6,
+  0x02d6, 0x02ea, 0x02fe, 0x0312, 0x0334, 0x0352, 0x036a, 0x037f, 0x0393, 0x039f, 0x03ab, 0x03b7, 0x03c3, 0x03cf, 0x03dd, 0x03eb,
+  0x03fd, 0x0413, 0x8012, 0xffff, 0x000e, 0xffdf, 0xfdd9, 0xfc53, 0xfaef, 0xfa0c, 0xf96a, 0xf909, 0xf909, 0xf96a, 0xfa0c, 0xfaef,
+  0xfc33, 0xfdd9, 0xffdf, 0x8012, 0xffff, 0x8010, 0xffff, 0x0007, 0xfc74, 0xf94a, 0xf826, 0xf887, 0xf8a8, 0xf8e8, 0xf8e9, 0x8004,
+  0xf909, 0x0007, 0xf8e9, 0xf8e8, 0xf8a8, 0xf887, 0xf826, 0xf94a, 0xfc74, 0x8010, 0xffff, 0x800d, 0xffff, 0x0005, 0xff5e, 0xfaae,
+  0xf826, 0xf8a7, 0xf8e8, 0x800e, 0xf909, 0x0005, 0xf8e8, 0xf8a7, 0xf826, 0xfaae, 0xff5e, 0x800d, 0xffff, 0x800c, 0xffff, 0x0003,
+  0xfb0f, 0xf826, 0xf8c8, 0x8014, 0xf909, 0x0003, 0xf8c8, 0xf826, 0xfb0f, 0x800c, 0xffff, 0x800a, 0xffff, 0x0003, 0xfdf9, 0xf867,
+  0xf8a8, 0x8018, 0xf909, 0x0003, 0xf8a8, 0xf867, 0xfdf9, 0x800a, 0xffff, 0x8009, 0xffff, 0x0002, 0xfb71, 0xf826, 0x801c, 0xf909,
+  0x0002, 0xf826, 0xfb71, 0x8009, 0xffff, 0x8008, 0xffff, 0x0002, 0xfa0c, 0xf887, 0x801e, 0xf909, 0x0002, 0xf887, 0xfa0c, 0x8008,
+  0xffff, 0x8007, 0xffff, 0x0002, 0xf9ab, 0xf8a8, 0x8020, 0xf909, 0x0002, 0xf8a8, 0xf9ab, 0x8007, 0xffff, 0x8006, 0xffff, 0x0002,
+  0xfa0c, 0xf8a8, 0x8022, 0xf909, 0x0002, 0xf8a8, 0xfa0c, 0x8006, 0xffff, 0x8005, 0xffff, 0x0002, 0xfb71, 0xf887, 0x8024, 0xf909,
+  0x0002, 0xf887, 0xfb71, 0x8005, 0xffff, 0x8004, 0xffff, 0x0002, 0xfdf9, 0xf826, 0x8010, 0xf909, 0x0001, 0xf8c8, 0x8004, 0xf887,
+  0x0001, 0xf8c8, 0x8010, 0xf909, 0x0002, 0xf826, 0xfdf9, 0x8004, 0xffff, 0x8004, 0xffff, 0x0001, 0xf867, 0x8010, 0xf909, 0x0008,
+  0xf8c8, 0xfaae, 0xfe3a, 0xfe19, 0xfe19, 0xfe3a, 0xfaae, 0xf8c8, 0x8010, 0xf909, 0x0001, 0xf867, 0x8004, 0xffff, 0x8003, 0xffff,
+  0x0002, 0xfb0f, 0xf8a8, 0x800c, 0xf909, 0x0001, 0xf8e8, 0x8004, 0xf909, 0x8006, 0xffff, 0x8004, 0xf909, 0x0001, 0xf8e8, 0x800c,
+  0xf909, 0x0002, 0xf8a8, 0xfb0f, 0x8003, 0xffff, 0x0004, 0xffff, 0xffff, 0xff5e, 0xf826, 0x800c, 0xf909, 0x0006, 0xf867, 0xf9ec,
+  0xf887, 0xf8e8, 0xf8c8, 0xf9ec, 0x8006, 0xffff, 0x0006, 0xf9ec, 0xf8c8, 0xf8e8, 0xf887, 0xf9ec, 0xf867, 0x800c, 0xf909, 0x0004,
+  0xf826, 0xff5e, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfaae, 0xf8c8, 0x800a, 0xf909, 0x0008, 0xf8e9, 0xf846, 0xff5d, 0xffff,
+  0xffff, 0xf909, 0xf867, 0xfc74, 0x8006, 0xffff, 0x0008, 0xfc74, 0xf867, 0xf909, 0xffff, 0xffff, 0xff3d, 0xf846, 0xf8e9, 0x800a,
+  0xf909, 0x0004, 0xf8c8, 0xface, 0xffff, 0xffff, 0x0003, 0xffff, 0xffff, 0xf826, 0x800b, 0xf909, 0x0002, 0xf846, 0xff5e, 0x8012,
+  0xffff, 0x0002, 0xff5e, 0xf846, 0x800b, 0xf909, 0x0003, 0xf826, 0xffff, 0xffff, 0x0003, 0xffff, 0xfc74, 0xf8a7, 0x800a, 0xf909,
+  0x0002, 0xf867, 0xff3d, 0x8014, 0xffff, 0x0002, 0xff3d, 0xf867, 0x800a, 0xf909, 0x0003, 0xf8a7, 0xfc74, 0xffff, 0x0003, 0xffff,
+  0xf94a, 0xf8e8, 0x8009, 0xf909, 0x0002, 0xf8e8, 0xf9ec, 0x8016, 0xffff, 0x0002, 0xf9ec, 0xf8e8, 0x8009, 0xf909, 0x0003, 0xf8e8,
+  0xf94a, 0xffff, 0x0002, 0xffdf, 0xf826, 0x800b, 0xf909, 0x0001, 0xf887, 0x8016, 0xffff, 0x0001, 0xf887, 0x800b, 0xf909, 0x0002,
+  0xf826, 0xffdf, 0x0002, 0xfdd9, 0xf887, 0x800b, 0xf909, 0x0002, 0xf8e8, 0xf909, 0x8014, 0xffff, 0x0002, 0xf909, 0xf8e8, 0x800b,
+  0xf909, 0x0002, 0xf887, 0xfdd9, 0x0002, 0xfc33, 0xf8a8, 0x800b, 0xf909, 0x0002, 0xf8c8, 0xf867, 0x8008, 0xffff, 0x0004, 0xfcf6,
+  0xfaef, 0xfaef, 0xfcf6, 0x8008, 0xffff, 0x0002, 0xf867, 0xf8c8, 0x800b, 0xf909, 0x0002, 0xf8a8, 0xfc33, 0x0002, 0xfaef, 0xf8e8,
+  0x8009, 0xf909, 0x0004, 0xf8c8, 0xf909, 0xf9cb, 0xfc74, 0x8006, 0xffff, 0x0008, 0xff9e, 0xf8a7, 0xf887, 0xf8c8, 0xf8c8, 0xf887,
+  0xf8a7, 0xff9e, 0x8006, 0xffff, 0x0004, 0xfc74, 0xf9cb, 0xf909, 0xf8c8, 0x8009, 0xf909, 0x0002, 0xf8e8, 0xfaef, 0x0002, 0xfa0c,
+  0xf8e9, 0x8008, 0xf909, 0x0002, 0xf8c8, 0xfaae, 0x8009, 0xffff, 0x0002, 0xf8a7, 0xf8e8, 0x8004, 0xf909, 0x0002, 0xf8e8, 0xf8a7,
+  0x8009, 0xffff, 0x0002, 0xfaae, 0xf8c8, 0x8008, 0xf909, 0x0002, 0xf8e9, 0xfa0c, 0x0001, 0xf96a, 0x8009, 0xf909, 0x0002, 0xf887,
+  0xfe3a, 0x8008, 0xffff, 0x0002, 0xfcf6, 0xf887, 0x8006, 0xf909, 0x0002, 0xf887, 0xfcf6, 0x8008, 0xffff, 0x0002, 0xfe3a, 0xf887,
+  0x8009, 0xf909, 0x0001, 0xf96a, 0x800a, 0xf909, 0x0002, 0xf887, 0xfe19, 0x8008, 0xffff, 0x0002, 0xfaef, 0xf8c8, 0x8006, 0xf909,
+  0x0002, 0xf8c8, 0xfb0f, 0x8008, 0xffff, 0x0002, 0xfe19, 0xf887, 0x8009, 0xf909, 0x0001, 0xf929, 0x800a, 0xf909, 0x0002, 0xf887,
+  0xfe19, 0x8008, 0xffff, 0x0002, 0xfaef, 0xf8c8, 0x8006, 0xf909, 0x0002, 0xf8c8, 0xfb0f, 0x8008, 0xffff, 0x0002, 0xfe19, 0xf887,
+  0x8009, 0xf909, 0x0001, 0xf929, 0x0001, 0xf96a, 0x8009, 0xf909, 0x0002, 0xf887, 0xfe3a, 0x8008, 0xffff, 0x0002, 0xfcf6, 0xf887,
+  0x8006, 0xf909, 0x0002, 0xf887, 0xfcf6, 0x8008, 0xffff, 0x0002, 0xfe3a, 0xf887, 0x8009, 0xf909, 0x0001, 0xf96a, 0x0002, 0xfa0c,
+  0xf8e9, 0x8008, 0xf909, 0x0002, 0xf8c8, 0xfaae, 0x8009, 0xffff, 0x0002, 0xf8a7, 0xf8e8, 0x8004, 0xf909, 0x0002, 0xf8e8, 0xf8a7,
+  0x8009, 0xffff, 0x0002, 0xfaae, 0xf8c8, 0x8008, 0xf909, 0x0002, 0xf8e9, 0xfa0c, 0x0002, 0xfaef, 0xf8e8, 0x8009, 0xf909, 0x0004,
+  0xf8c8, 0xf909, 0xf9cb, 0xfc74, 0x8006, 0xffff, 0x0008, 0xff9e, 0xf8a7, 0xf887, 0xf8c8, 0xf8c8, 0xf887, 0xf8a7, 0xff9e, 0x8006,
+  0xffff, 0x0004, 0xfc74, 0xf9cb, 0xf909, 0xf8c8, 0x8009, 0xf909, 0x0002, 0xf8e8, 0xfaef, 0x0002, 0xfc33, 0xf8a8, 0x800b, 0xf909,
+  0x0002, 0xf8c8, 0xf867, 0x8008, 0xffff, 0x0004, 0xfcf6, 0xfaef, 0xfb0f, 0xfcf6, 0x8008, 0xffff, 0x0002, 0xf867, 0xf8c8, 0x800b,
+  0xf909, 0x0002, 0xf8a8, 0xfc33, 0x0002, 0xfdd9, 0xf887, 0x800b, 0xf909, 0x0002, 0xf8e8, 0xf909, 0x8014, 0xffff, 0x0002, 0xf909,
+  0xf8e8, 0x800b, 0xf909, 0x0002, 0xf887, 0xfdd9, 0x0002, 0xffdf, 0xf826, 0x800b, 0xf909, 0x0001, 0xf887, 0x8016, 0xffff, 0x0001,
+  0xf887, 0x800b, 0xf909, 0x0002, 0xf826, 0xffdf, 0x0003, 0xffff, 0xf94a, 0xf8e8, 0x8009, 0xf909, 0x0002, 0xf8e8, 0xf9ec, 0x8016,
+  0xffff, 0x0002, 0xf9ec, 0xf8e8, 0x8009, 0xf909, 0x0003, 0xf8e8, 0xf96a, 0xffff, 0x0003, 0xffff, 0xfc74, 0xf8a7, 0x800a, 0xf909,
+  0x0002, 0xf867, 0xff3d, 0x8014, 0xffff, 0x0002, 0xff5d, 0xf867, 0x800a, 0xf909, 0x0003, 0xf8a7, 0xfc74, 0xffff, 0x0003, 0xffff,
+  0xffff, 0xf826, 0x800b, 0xf909, 0x0002, 0xf846, 0xff5e, 0x8012, 0xffff, 0x0002, 0xff5e, 0xf846, 0x800b, 0xf909, 0x0003, 0xf826,
+  0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xfaae, 0xf8c8, 0x800a, 0xf909, 0x0008, 0xf8e9, 0xf846, 0xff3d, 0xffff, 0xffff, 0xf909,
+  0xf867, 0xfc74, 0x8006, 0xffff, 0x0008, 0xfc74, 0xf867, 0xf909, 0xffff, 0xffff, 0xff3d, 0xf846, 0xf8e9, 0x800a, 0xf909, 0x0004,
+  0xf8c8, 0xface, 0xffff, 0xffff, 0x0004, 0xffff, 0xffff, 0xff5e, 0xf826, 0x800c, 0xf909, 0x0006, 0xf867, 0xf9ec, 0xf887, 0xf8e8,
+  0xf8c8, 0xf9ec, 0x8006, 0xffff, 0x0006, 0xf9ec, 0xf8c8, 0xf8e8, 0xf887, 0xf9ec, 0xf867, 0x800c, 0xf909, 0x0004, 0xf826, 0xff5e,
+  0xffff, 0xffff, 0x8003, 0xffff, 0x0002, 0xfb10, 0xf8a8, 0x800c, 0xf909, 0x0001, 0xf8e8, 0x8004, 0xf909, 0x8006, 0xffff, 0x8004,
+  0xf909, 0x0001, 0xf8e8, 0x800c, 0xf909, 0x0002, 0xf8a8, 0xfb10, 0x8003, 0xffff, 0x8004, 0xffff, 0x0001, 0xf867, 0x8010, 0xf909,
+  0x0008, 0xf8c8, 0xfaae, 0xfe3a, 0xfe19, 0xfe19, 0xfe3a, 0xfaae, 0xf8c8, 0x8010, 0xf909, 0x0001, 0xf867, 0x8004, 0xffff, 0x8004,
+  0xffff, 0x0002, 0xfdf9, 0xf826, 0x8010, 0xf909, 0x0001, 0xf8c8, 0x8004, 0xf887, 0x0001, 0xf8c8, 0x8010, 0xf909, 0x0002, 0xf826,
+  0xfdf9, 0x8004, 0xffff, 0x8005, 0xffff, 0x0002, 0xfb71, 0xf887, 0x8024, 0xf909, 0x0002, 0xf887, 0xfb71, 0x8005, 0xffff, 0x8006,
+  0xffff, 0x0002, 0xfa0c, 0xf8a8, 0x8022, 0xf909, 0x0002, 0xf8a8, 0xfa0c, 0x8006, 0xffff, 0x8007, 0xffff, 0x0002, 0xf9ab, 0xf8a8,
+  0x8020, 0xf909, 0x0002, 0xf8a8, 0xf9ab, 0x8007, 0xffff, 0x8008, 0xffff, 0x0002, 0xfa0c, 0xf887, 0x801e, 0xf909, 0x0002, 0xf887,
+  0xfa0c, 0x8008, 0xffff, 0x8009, 0xffff, 0x0002, 0xfb91, 0xf826, 0x801c, 0xf909, 0x0002, 0xf826, 0xfb71, 0x8009, 0xffff, 0x800a,
+  0xffff, 0x0003, 0xfdf9, 0xf867, 0xf8a8, 0x8018, 0xf909, 0x0003, 0xf8a8, 0xf867, 0xfdf9, 0x800a, 0xffff, 0x800c, 0xffff, 0x0003,
+  0xfb0f, 0xf826, 0xf8c8, 0x8014, 0xf909, 0x0003, 0xf8c8, 0xf826, 0xfb10, 0x800c, 0xffff, 0x800d, 0xffff, 0x0005, 0xff5e, 0xfacf,
+  0xf826, 0xf8a7, 0xf8e8, 0x800e, 0xf909, 0x0005, 0xf8e8, 0xf8a7, 0xf826, 0xfaae, 0xff5e, 0x800d, 0xffff, 0x8010, 0xffff, 0x0007,
+  0xfc74, 0xf96a, 0xf826, 0xf887, 0xf8a8, 0xf8e8, 0xf8e9, 0x8004, 0xf909, 0x0007, 0xf8e9, 0xf8e8, 0xf8a8, 0xf887, 0xf826, 0xf94a,
+  0xfc74, 0x8010, 0xffff, 0x8012, 0xffff, 0x000e, 0xffdf, 0xfdd9, 0xfc53, 0xfaef, 0xfa0c, 0xf96a, 0xf929, 0xf929, 0xf96a, 0xfa0c,
+  0xfaef, 0xfc33, 0xfdd9, 0xffdf, 0x8012, 0xffff,
 };
 
 const lv_image_dsc_t setting_btn = {
   .header.cf = LV_COLOR_FORMAT_RGB565,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = LV_IMAGE_FLAGS_USER1,
   .header.w = 50,
   .header.h = 50,
-  .data_size = 2500 * 2,
-  .data = setting_btn_map,
+  .data_size = 1062 * 2,
+  .data = (const uint8_t *)setting_btn_map,
 };
@@ -13,6 +13,11 @@
 #include "lv_port_disp.h"
 #include <stdbool.h>
 
+#include "cmsis_os.h"
+#include "dma.h"
+#include "dwt.h"
+#include "lcd.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -31,6 +36,21 @@
 #define BYTE_PER_PIXEL                                                         \
   (LV_COLOR_FORMAT_GET_SIZE(LV_COLOR_FORMAT_RGB565)) /*will be 2 for RGB565 */
 
+/* 两块 5 行的渲染缓冲 (共 9.6KB, 与原来单块 10 行相同): DMA2 把一块送往 LCD 时
+ * LVGL 渲染另一块 */
+#define DISP_BUF_ROWS 5
+/* 区域太小时 CPU 直接写, 省去 DMA 配置和中断的开销 */
+#define DISP_DMA_MIN_PIXELS 64
+
+/* TE 同步 (见 disp_te_wait), 0: 不使用 TE, 渲染好就送出 */
+#define DISP_TE_SYNC 1
+/* 启动时等待 TE 脉冲的时间, 没有收到脉冲时退回到不同步 */
+#define DISP_TE_PROBE_MS 100
+/* FSMC 写一个像素的 HCLK 周期数 (ADDSET 9 + DATAST 8 + 1), 用于估计传输时间 */
+#define DISP_TE_CYCLES_PER_PIXEL 18
+/* 扫描线估计的余量 (行): TE 之后的消隐期、帧周期的抖动 */
+#define DISP_TE_MARGIN_ROWS 16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -42,10 +62,31 @@ static void disp_init(void);
 
 static void disp_flush(lv_display_t *disp, const lv_area_t *area,
                        uint8_t *px_map);
+static void disp_flush_wait(lv_display_t *disp);
+static void disp_dma_cplt(DMA_HandleTypeDef *hdma);
+static void disp_te_init(void);
+static void disp_te_wait(int32_t y1, int32_t y2, uint32_t len);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static lv_display_t *disp_dma_display;
+static osSemaphoreId_t disp_dma_sem;
+static volatile bool disp_dma_busy;
+static uint32_t disp_dma_start; /* 本次传输开始时的 DWT 周期数 */
+
+/* 统计 (见 disp_get_flush_stats) */
+static volatile uint32_t stat_flushes;
+static volatile uint32_t stat_pixels;
+static volatile uint64_t stat_bus_cycles; /* 像素送往 LCD 的总时间 */
+static volatile uint64_t stat_cpu_cycles; /* 其中 CPU 被占用的时间 */
+static uint64_t stat_te_cycles;           /* 等待扫描线让开的时间 */
+
+/* TE (EXTI 中断中更新) */
+static volatile uint32_t te_last;   /* 最近一次 TE 上升沿的 DWT 周期数 */
+static volatile uint32_t te_period; /* 帧周期 (周期数, 平滑后), 0: 还没有测到 */
+static volatile uint32_t te_edges;
+static bool te_sync; /* TE 可用, flush 按扫描线调度 */
 
 /**********************
  *      MACROS
@@ -66,26 +107,21 @@ void lv_port_disp_init(void) {
    * -----------------------------------*/
   lv_display_t *disp = lv_display_create(MY_DISP_HOR_RES, MY_DISP_VER_RES);
   lv_display_set_flush_cb(disp, disp_flush);
-
-  /* Example 1
-   * One buffer for partial rendering*/
-  LV_ATTRIBUTE_MEM_ALIGN
-  static uint8_t
-      buf_1_1[MY_DISP_HOR_RES * 10 * BYTE_PER_PIXEL]; /*A buffer for 10 rows*/
-  lv_display_set_buffers(disp, buf_1_1, NULL, sizeof(buf_1_1),
-                         LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_flush_wait_cb(disp, disp_flush_wait);
+  disp_dma_display = disp;
 
   /* Example 2
    * Two buffers for partial rendering
    * In flush_cb DMA or similar hardware should be used to update the display in
    * the background.*/
-  // LV_ATTRIBUTE_MEM_ALIGN
-  // static uint8_t buf_2_1[MY_DISP_HOR_RES * 10 * BYTE_PER_PIXEL];
+  /* 缓冲区必须在 SRAM 中 (DMA 不能访问 CCM) */
+  LV_ATTRIBUTE_MEM_ALIGN
+  static uint8_t buf_2_1[MY_DISP_HOR_RES * DISP_BUF_ROWS * BYTE_PER_PIXEL];
 
-  // LV_ATTRIBUTE_MEM_ALIGN
-  // static uint8_t buf_2_2[MY_DISP_HOR_RES * 10 * BYTE_PER_PIXEL];
-  // lv_display_set_buffers(disp, buf_2_1, buf_2_2, sizeof(buf_2_1),
-  //                        LV_DISPLAY_RENDER_MODE_PARTIAL);
+  LV_ATTRIBUTE_MEM_ALIGN
+  static uint8_t buf_2_2[MY_DISP_HOR_RES * DISP_BUF_ROWS * BYTE_PER_PIXEL];
+  lv_display_set_buffers(disp, buf_2_1, buf_2_2, sizeof(buf_2_1),
+                         LV_DISPLAY_RENDER_MODE_PARTIAL);
 
   /* Example 3
    * Two buffers screen sized buffer for double buffering.
@@ -105,7 +141,86 @@ void lv_port_disp_init(void) {
  **********************/
 
 /*Initialize your display and the required peripherals.*/
-static void disp_init(void) { /*You code here*/ }
+static void disp_init(void) {
+  /* LCD 已由 lcd_init() 初始化; DMA2_Stream7 (存储器到存储器) 由 MX_DMA_Init()
+   * 配置: 源地址 (PAR) 递增, 目的地址 (M0AR) 固定为 LCD->LCD_RAM, 半字传输 */
+  disp_dma_sem = osSemaphoreNew(1, 0, NULL);
+  disp_dma_busy = false;
+  hdma_memtomem_dma2_stream7.XferCpltCallback = disp_dma_cplt;
+  hdma_memtomem_dma2_stream7.XferErrorCallback = disp_dma_cplt;
+
+  disp_te_init();
+}
+
+/* 打开控制器的 TE 输出并确认 PC0 (LCD_TE) 上有脉冲; 控制器不支持 TE、横屏
+ * 或者 TE 引脚没有连接时关闭 EXTI, flush 不同步 */
+static void disp_te_init(void) {
+  te_sync = false;
+#if DISP_TE_SYNC
+  DWT_Init();
+  if (lcd_te_enable()) {
+    te_edges = 0;
+    te_period = 0;
+    osDelay(DISP_TE_PROBE_MS);
+    te_sync = (te_edges >= 3 && te_period != 0);
+  }
+#endif
+  if (!te_sync)
+    HAL_NVIC_DisableIRQ(LCD_TE_EXTI_IRQn);
+}
+
+/* TE 上升沿 (垂直消隐开始): 记录时间, 平滑帧周期 */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+  if (GPIO_Pin != LCD_TE_Pin)
+    return;
+
+  uint32_t now = DWT_GetCycles();
+  uint32_t period = now - te_last;
+
+  /* 只接受 20~120Hz 的间隔, 干扰脉冲不影响帧周期 */
+  if (te_edges > 0 && period > SystemCoreClock / 120 &&
+      period < SystemCoreClock / 20)
+    te_period = te_period ? (te_period * 7 + period) / 8 : period;
+  te_last = now;
+  te_edges++;
+}
+
+/* 面板在一帧内从第 0 行扫到最后一行, 扫描线位置由上次 TE 之后的时间推算。
+ * 写入 [y1, y2] 时扫描线不能经过这些行, 否则同一帧上半是旧图、下半是新图 (撕裂)。
+ * 可以立即开始的两种情况:
+ *  - 扫描线还没到 y1, 且传输完成前也到不了;
+ *  - 扫描线已经越过 y2, 且下一帧重新扫到 y1 之前传输能完成。
+ * 否则等扫描线经过这块区域 (5 行的缓冲最多约 1ms)。等待时用 osDelay(1) 阻塞,
+ * 每个节拍重新判断, 不占用 CPU (音频解码等低优先级任务可以运行), 一般 1~2 个节拍。
+ * TE 丢失时不等待 */
+static void disp_te_wait(int32_t y1, int32_t y2, uint32_t len) {
+  uint32_t period = te_period;
+  const uint32_t h = MY_DISP_VER_RES;
+
+  if (!te_sync || period == 0)
+    return;
+
+  /* 传输期间扫描线前进的行数, 加上余量 */
+  uint32_t ahead = (uint32_t)((uint64_t)len * DISP_TE_CYCLES_PER_PIXEL * h /
+                              period) +
+                   DISP_TE_MARGIN_ROWS;
+  uint32_t t0 = DWT_GetCycles();
+
+  for (;;) {
+    uint32_t now = DWT_GetCycles();
+    uint32_t since = now - te_last;
+    if (since >= period * 2 || now - t0 >= period)
+      break; /* TE 丢失, 或者已经等了一帧 */
+
+    uint32_t line = (uint32_t)((uint64_t)since * h / period);
+    if (line + ahead < (uint32_t)y1)
+      break;
+    if (line > (uint32_t)y2 + DISP_TE_MARGIN_ROWS && line + ahead < h + y1)
+      break;
+    osDelay(1);
+  }
+  stat_te_cycles += DWT_GetCycles() - t0;
+}
 
 volatile bool disp_flush_enabled = true;
 
@@ -119,7 +234,21 @@ void disp_enable_update(void) { disp_flush_enabled = true; }
  */
 void disp_disable_update(void) { disp_flush_enabled = false; }
 
-#include "lcd.h"
+/* DMA 传输完成 (或出错) 中断: 通知 LVGL 这块缓冲区可以重新使用 */
+static void disp_dma_cplt(DMA_HandleTypeDef *hdma) {
+  stat_bus_cycles += DWT_GetCycles() - disp_dma_start;
+  disp_dma_busy = false;
+  lv_display_flush_ready(disp_dma_display);
+  osSemaphoreRelease(disp_dma_sem);
+}
+
+/* LVGL 需要重新使用正在传输的缓冲区时调用: 阻塞 GUI 任务直到 DMA 完成,
+ * 而不是空转 (信号量中可能残留上一次传输的计数, 所以循环检查) */
+static void disp_flush_wait(lv_display_t *disp) {
+  while (disp_dma_busy) {
+    osSemaphoreAcquire(disp_dma_sem, osWaitForever);
+  }
+}
 
 /*Flush the content of the internal buffer the specific area on the display.
  *`px_map` contains the rendered image as raw pixel map and it should be copied
@@ -128,33 +257,73 @@ void disp_disable_update(void) { disp_flush_enabled = false; }
  * called when it's finished.*/
 static void disp_flush(lv_display_t *disp_drv, const lv_area_t *area,
                        uint8_t *px_map) {
-  if (disp_flush_enabled) {
-    uint16_t width = area->x2 - area->x1 + 1;
-    uint16_t height = area->y2 - area->y1 + 1;
-
-    /* Set the drawing window */
-    lcd_set_window(area->x1, area->y1, width, height);
-
-    /* Prepare to write to RAM */
-    lcd_write_ram_prepare();
-
-    /* Write pixel data */
-    /* px_map is a byte array, but for RGB565 it contains 16-bit pixels */
-    uint16_t *color_p = (uint16_t *)px_map;
-    uint32_t len = width * height;
-
-    /* Burst write to LCD RAM */
-	while (len--)
-	{
-		LCD->LCD_RAM = *color_p++;
-	}
+  if (!disp_flush_enabled) {
+    lv_display_flush_ready(disp_drv);
+    return;
+  }
+
+  uint16_t width = area->x2 - area->x1 + 1;
+  uint16_t height = area->y2 - area->y1 + 1;
+  uint32_t len = (uint32_t)width * height;
+
+  /* 等扫描线让开再写 (没有 TE 时直接返回) */
+  disp_te_wait(area->y1, area->y2, len);
+
+  uint32_t t0 = DWT_GetCycles();
+
+  /* Set the drawing window */
+  lcd_set_window(area->x1, area->y1, width, height);
+
+  /* Prepare to write to RAM */
+  lcd_write_ram_prepare();
+
+  stat_flushes++;
+  stat_pixels += len;
+
+  /* px_map is a byte array, but for RGB565 it contains 16-bit pixels */
+  if (len >= DISP_DMA_MIN_PIXELS && len <= 0xFFFF) {
+    /* 后台传输: 完成中断中调用 lv_display_flush_ready(), LVGL 同时渲染另一块缓冲 */
+    disp_dma_busy = true;
+    disp_dma_start = DWT_GetCycles();
+    if (HAL_DMA_Start_IT(&hdma_memtomem_dma2_stream7, (uint32_t)px_map,
+                         (uint32_t)&LCD->LCD_RAM, len) == HAL_OK) {
+      stat_cpu_cycles += disp_dma_start - t0;
+      return;
+    }
+    disp_dma_busy = false;
+  }
+
+  /* 小区域 (或 DMA 启动失败) 由 CPU 写入 */
+  uint16_t *color_p = (uint16_t *)px_map;
+  while (len--) {
+    LCD->LCD_RAM = *color_p++;
   }
+  uint32_t cycles = DWT_GetCycles() - t0;
+  stat_cpu_cycles += cycles;
+  stat_bus_cycles += cycles;
 
   /*IMPORTANT!!!
    *Inform the graphics library that you are ready with the flushing*/
   lv_display_flush_ready(disp_drv);
 }
 
+void disp_get_flush_stats(disp_flush_stats_t *stats) {
+  uint64_t bus = stat_bus_cycles;
+  uint64_t cpu = stat_cpu_cycles;
+
+  stats->flushes = stat_flushes;
+  stats->pixels = stat_pixels;
+  stats->kpixel_per_s =
+      bus ? (uint32_t)((uint64_t)stats->pixels * (SystemCoreClock / 1000) / bus)
+          : 0;
+  stats->cpu_permille = bus ? (uint16_t)(cpu * 1000 / bus) : 0;
+  stats->te_sync = te_sync;
+  stats->te_hz10 =
+      te_period ? (uint16_t)((uint64_t)SystemCoreClock * 10 / te_period) : 0;
+  stats->te_wait_us =
+      (uint32_t)(stat_te_cycles / (SystemCoreClock / 1000000U));
+}
+
 #else /*Enable this file at the top*/
 
 /*This dummy typedef exists purely to silence -Wpedantic.*/
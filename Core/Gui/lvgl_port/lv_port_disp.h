@@ -30,6 +30,16 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+/* 刷新统计 (启动以来累计) */
+typedef struct {
+  uint32_t flushes;      /* flush_cb 调用次数 */
+  uint32_t pixels;       /* 送往 LCD 的像素数 */
+  uint32_t kpixel_per_s; /* 传输速率: 像素数 / 传输时间 (千像素每秒) */
+  uint16_t cpu_permille; /* 传输期间 CPU 被占用的比例 (千分比), 其余时间可以渲染 */
+  uint8_t te_sync;       /* 1: flush 与面板 TE 同步 */
+  uint16_t te_hz10;      /* 测得的面板刷新率 (0.1Hz) */
+  uint32_t te_wait_us;   /* 为避开扫描线累计等待的时间 */
+} disp_flush_stats_t;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -47,6 +57,9 @@ void disp_enable_update(void);
  */
 void disp_disable_update(void);
 
+/* Read the flush throughput and CPU share */
+void disp_get_flush_stats(disp_flush_stats_t *stats);
+
 /**********************
  *      MACROS
  **********************/
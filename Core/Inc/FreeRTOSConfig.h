@@ -171,6 +171,14 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* 任务运行时间统计 (gui_perf.c 读取), 时钟来自 DWT 周期计数 (dwt.c) */
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+extern void DWT_Init(void);
+extern uint32_t DWT_GetRunTime(void);
+#endif
+#define configGENERATE_RUN_TIME_STATS 1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() DWT_Init()
+#define portGET_RUN_TIME_COUNTER_VALUE() DWT_GetRunTime()
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
@@ -42,10 +42,18 @@
  *
  * MULSHIFT32(x, y)    signed multiply of two 32-bit integers (x and y), returns top 32 bits of 64-bit result
  * FASTABS(x)          branchless absolute value of signed integer x
- * CLZ(x)              count leading zeros in x
+ * CLZ(x)              count leading zeros in x (32 for x == 0, like the ARM instruction)
  * MADD64(sum, x, y)   sum [64-bit] += x [32-bit] * y [32-bit]
  * SHL64(sum, x, y)    64-bit left shift using __int64
  * SAR64(sum, x, y)    64-bit right shift using __int64
+ * MULSHIFT32_ADD(sum, x, y)  sum + MULSHIFT32(x, y) (single SMMLA on Cortex-M4/M7)
+ *
+ * Cortex-M4/M7 (ARMv7E-M with DSP extension) get their own section: SMMUL/SMMLA return the
+ *   high word of the product in a single destination register, and the asm is not volatile so
+ *   the compiler can interleave it with the coefficient loads. HELIX_ARM_DSP is defined there
+ *   and also selects the packed PCM stores in polyphase.c. All results are bit-exact with the
+ *   generic C versions. Define HELIX_NO_ARM_DSP to build the plain ARMv7 section instead; the
+ *   decoder self-test (mp3_selftest.c) must give the same checksum in both builds.
  */
 
 #ifndef _ASSEMBLY_H
@@ -53,7 +61,87 @@
 
 #define ALWAYS_INLINE inline __attribute__((always_inline))
 
-#if defined(__GNUC__) && defined(__arm__) && (__ARM_ARCH >= 7)
+#if defined(__GNUC__) && defined(__arm__) && defined(__ARM_FEATURE_DSP) && !defined(HELIX_NO_ARM_DSP)
+
+#pragma message("Using optimizations for ARM Cortex-M4/M7 (DSP)")
+
+#define HELIX_ARM_DSP 1
+
+typedef long long Word64;
+
+static ALWAYS_INLINE int MULSHIFT32(int x, int y)
+{
+	int z;
+
+	/* smmul = high 32 bits of the signed 64-bit product, truncated (same as smull + discard RdLo) */
+	__asm__("smmul %0,%1,%2" : "=r" (z) : "r" (x), "r" (y));
+
+	return z;
+}
+
+static ALWAYS_INLINE int MULSHIFT32_ADD(int sum, int x, int y)
+{
+	int z;
+
+	/* smmla = sum + high 32 bits of x*y (exact: ((sum << 32) + x*y) >> 32) */
+	__asm__("smmla %0,%1,%2,%3" : "=r" (z) : "r" (x), "r" (y), "r" (sum));
+
+	return z;
+}
+
+static ALWAYS_INLINE int FASTABS(int x)
+{
+	int sign;
+
+	sign = x >> 31;
+	x ^= sign;
+	x -= sign;
+
+	return x;
+}
+
+static ALWAYS_INLINE int CLZ(int x)
+{
+	return x ? __builtin_clz(x) : 32;
+}
+
+typedef union 
+{
+	Word64 w64;
+	struct {
+		unsigned lo32;
+		signed hi32;
+	} r;
+} U64;
+
+static ALWAYS_INLINE Word64 MADD64(Word64 sum64, int x, int y)
+{
+	U64 u;
+	u.w64 = sum64;
+
+	__asm__("smlal %0,%1,%2,%3" : "+r" (u.r.lo32), "+r" (u.r.hi32) : "r" (x), "r" (y));
+
+	return u.w64;
+}
+
+static ALWAYS_INLINE Word64 SHL64(Word64 x, int n)
+{
+	return x << n;
+}
+
+static ALWAYS_INLINE Word64 SAR64(Word64 x, int n)
+{
+	return x >> n;
+}
+
+/* (x >> n) saturated to 16 bits in one instruction, n must be a constant 1..31 */
+#define SSAT16_ASR(x, n) ({ \
+	int _z; \
+	__asm__("ssat %0, #16, %1, asr %2" : "=r" (_z) : "r" (x), "I" (n)); \
+	_z; \
+})
+
+#elif defined(__GNUC__) && defined(__arm__) && (__ARM_ARCH >= 7)
 
 #pragma message("Using optimizations for ARM")
 
@@ -159,7 +247,7 @@ static ALWAYS_INLINE int FASTABS(int x)
 static ALWAYS_INLINE int CLZ(int x)
 {
 #if defined(__GNUC__)
-	return __builtin_clz(x);
+	return x ? __builtin_clz(x) : 32;
 #else
 	int count;
 
@@ -228,7 +316,7 @@ static ALWAYS_INLINE int FASTABS(int x)
 static ALWAYS_INLINE int CLZ(int x)
 {
 #if defined(__GNUC__)
-	return __builtin_clz(x);
+	return x ? __builtin_clz(x) : 32;
 #else
 	int count;
 
@@ -283,7 +371,7 @@ static ALWAYS_INLINE int FASTABS(int x)
 static ALWAYS_INLINE int CLZ(int x)
 {
 #if defined(__GNUC__)
-	return __builtin_clz(x);
+	return x ? __builtin_clz(x) : 32;
 #else
 	int count;
 
@@ -319,4 +407,11 @@ static ALWAYS_INLINE Word64 SAR64(Word64 x, int n)
 
 #endif
 
+#if !defined(HELIX_ARM_DSP)
+static ALWAYS_INLINE int MULSHIFT32_ADD(int sum, int x, int y)
+{
+	return sum + MULSHIFT32(x, y);
+}
+#endif
+
 #endif
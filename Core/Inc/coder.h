@@ -193,6 +193,18 @@ typedef struct _HuffmanInfo {
 	int gb[MAX_NCHAN];							/* minimum number of guard bits in huffDecBuf[ch] */
 } HuffmanInfo;
 
+/* handoff between the two decode stages (see MP3DecodeEntropy/MP3DecodeSynthesis)
+ *  - written by the entropy stage: dequantized, stereo-processed coefficients for every granule
+ *  - read by the synthesis stage, which never touches FrameHeader/SideInfo/ScaleFactorInfo, so the
+ *      entropy stage may already be unpacking the next frame into the decoder while this one is synthesized
+ */
+typedef struct _MP3FrameData {
+	MP3FrameParams params;						/* must be first, read by mp3dec.c */
+	HuffmanInfo gran[MAX_NGRAN];				/* coefficients + nonZeroBound + gb, one set per granule */
+	SideInfoSub sis[MAX_NGRAN][MAX_NCHAN];		/* block type / window switching, used by IMDCT */
+	int blockCutoff;							/* first short block of a mixed block (from sfBand table) */
+} MP3FrameData;
+
 typedef enum _HuffTabType {
 	noBits,
 	oneShot,
@@ -0,0 +1,25 @@
+/*
+ * dwt.h
+ * Cortex-M4 DWT 周期计数器 (CYCCNT), 用于性能统计
+ */
+
+#ifndef INC_DWT_H_
+#define INC_DWT_H_
+
+#include "main.h"
+#include <stdint.h>
+
+/* 函数声明 */
+void DWT_Init(void);
+uint32_t DWT_CyclesToUs(uint32_t cycles);
+uint32_t DWT_GetRunTime(void);
+
+/**
+ * @brief  读取当前周期计数 (168MHz 下约 25.5 秒回绕一次, 差值用无符号减法即可)
+ */
+static inline uint32_t DWT_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+#endif /* INC_DWT_H_ */
@@ -90,6 +90,7 @@ void lcd_display_on(void);
 void lcd_display_off(void);
 void lcd_scan_dir(uint8_t dir);
 void lcd_display_dir(uint8_t dir);
+uint8_t lcd_te_enable(void);
 void lcd_ssd_backlight_set(uint8_t pwm);
 void lcd_write_ram_prepare(void);
 void lcd_set_cursor(uint16_t x, uint16_t y);
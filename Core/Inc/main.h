@@ -59,6 +59,9 @@ void Error_Handler(void);
 /* Private defines -----------------------------------------------------------*/
 #define LCD_BACKLED_Pin GPIO_PIN_15
 #define LCD_BACKLED_GPIO_Port GPIOB
+#define LCD_TE_Pin GPIO_PIN_0
+#define LCD_TE_GPIO_Port GPIOC
+#define LCD_TE_EXTI_IRQn EXTI0_IRQn
 
 /* USER CODE BEGIN Private defines */
 
@@ -66,10 +66,11 @@ typedef struct _MP3DecInfo {
 	void *FrameHeaderPS;
 	void *SideInfoPS;
 	void *ScaleFactorInfoPS;
-	void *HuffmanInfoPS;
+	void *HuffmanInfoPS;		/* granule being entropy-decoded, points into a MP3FrameData */
 	void *DequantInfoPS;
 	void *IMDCTInfoPS;
 	void *SubbandInfoPS;
+	void *FrameDataPS;			/* handoff used by MP3Decode() itself */
 
 	/* buffer which must be large enough to hold largest possible main_data section */
 	unsigned char mainBuf[MAINBUF_SIZE];
@@ -95,6 +96,15 @@ typedef struct _MP3DecInfo {
 
 } MP3DecInfo;
 
+/* frame layout carried from the entropy stage to the synthesis stage
+ * (first member of the platform-specific MP3FrameData handoff)
+ */
+typedef struct _MP3FrameParams {
+	int nGrans;
+	int nChans;
+	int nGranSamps;
+} MP3FrameParams;
+
 typedef struct _SFBandTable {
 	short l[23];
 	short s[14];
@@ -103,14 +113,17 @@ typedef struct _SFBandTable {
 /* decoder functions which must be implemented for each platform */
 MP3DecInfo *AllocateBuffers(void);
 void FreeBuffers(MP3DecInfo *mp3DecInfo);
+void *AllocateFrameData(void);
+void FreeFrameData(void *frameData);
 int CheckPadBit(MP3DecInfo *mp3DecInfo);
 int UnpackFrameHeader(MP3DecInfo *mp3DecInfo, unsigned char *buf);
 int UnpackSideInfo(MP3DecInfo *mp3DecInfo, unsigned char *buf);
 int DecodeHuffman(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, int huffBlockBits, int gr, int ch);
 int Dequantize(MP3DecInfo *mp3DecInfo, int gr);
-int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch);
+int SelectGranule(MP3DecInfo *mp3DecInfo, void *frameData, int gr);
+int IMDCT(MP3DecInfo *mp3DecInfo, void *frameData, int gr, int ch);
 int UnpackScaleFactors(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, int bitsAvail, int gr, int ch);
-int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf);
+int Subband(MP3DecInfo *mp3DecInfo, int nChans, short *pcmBuf);
 
 /* mp3tabs.c - global ROM tables */
 extern const int samplerateTab[3][3];
@@ -0,0 +1,52 @@
+/*
+ * dwt.c
+ * Cortex-M4 DWT 周期计数器 (CYCCNT), 用于性能统计
+ */
+
+#include "dwt.h"
+
+/* FreeRTOS 运行时间统计的时钟: 周期数 / 64 (168MHz 下 2.625MHz) */
+#define DWT_RUNTIME_SHIFT 6
+
+static uint32_t dwt_last = 0;  // 上次读取的 CYCCNT
+static uint32_t dwt_high = 0;  // 软件扩展的高 32 位
+
+/**
+ * @brief  使能 DWT 周期计数器 (可重复调用)
+ */
+void DWT_Init(void)
+{
+    if (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) return;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief  周期数转换为微秒
+ */
+uint32_t DWT_CyclesToUs(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000U);
+}
+
+/**
+ * @brief  FreeRTOS 运行时间统计的计数 (portGET_RUN_TIME_COUNTER_VALUE)
+ * @note   CYCCNT 只有 32 位, 约 25.5 秒回绕, 直接移位后的差值在回绕时出错;
+ *         这里在软件中扩展到 64 位再移位, 结果按 32 位完整回绕 (约 27 分钟)。
+ *         每次任务切换都会调用, 两次调用间隔远小于 25.5 秒
+ */
+uint32_t DWT_GetRunTime(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now = DWT->CYCCNT;
+    if (now < dwt_last) dwt_high++;
+    dwt_last = now;
+    uint32_t value = (dwt_high << (32 - DWT_RUNTIME_SHIFT)) | (now >> DWT_RUNTIME_SHIFT);
+
+    __set_PRIMASK(primask);
+    return value;
+}
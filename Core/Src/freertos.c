@@ -26,7 +26,10 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "../APP/Player/music_player.h"
+#include "../APP/Player/music_playlist.h"
 #include "../App/GUI/gui_app.h"
+#include "../App/GUI/gui_image_rle.h"
+#include "../App/GUI/gui_perf.h"
 #include "../Gui/lvgl/lvgl.h"
 #include "../Gui/lvgl_port/lv_port_disp.h"
 #include "../Gui/lvgl_port/lv_port_indev.h"
@@ -138,6 +141,7 @@ void StartDefaultTask(void *argument)
     HAL_Delay(100);  // Wait for power stability
     lcd_init();
     lv_init();
+    gui_image_rle_init();  // Core/App/Res 中按行 RLE 压缩的图标
     lv_port_disp_init();
 
     // Initialize touch screen hardware
@@ -146,6 +150,9 @@ void StartDefaultTask(void *argument)
     // Initialize LVGL input device
     lv_port_indev_init();
 
+    // 刷新耗时与任务占用统计 (GUI_PERF_OVERLAY 为 1 时显示在屏幕上)
+    gui_perf_init(lv_display_get_default());
+
     HAL_TIM_Base_Start_IT(&htim6);
     music_player_init();
     gui_app_init();
@@ -192,13 +199,28 @@ void StartAudioTask(void *argument)
                     music_player_set_speaker_volume(event.param);
                     break;
                 case MUSIC_NEXT:
-                    music_player_set_currentIndex(music_player_get_currentIndex() + 1);
+                    music_player_set_currentIndex(Music_Playlist_Next(music_player_get_currentIndex(), 1));
                     music_player_process_song();
                     break;
                 case MUSIC_PREV:
-                    music_player_set_currentIndex(music_player_get_currentIndex() - 1);
+                    music_player_set_currentIndex(Music_Playlist_Prev(music_player_get_currentIndex()));
                     music_player_process_song();
                     break;
+                case MUSIC_SEEK:
+                    music_player_seek(event.param);
+                    break;
+                case MUSIC_SET_EQ_PRESET:
+                    music_player_set_eq_preset(event.param);
+                    break;
+                case MUSIC_SET_BASS_BOOST:
+                    music_player_set_bass_boost(event.param);
+                    break;
+                case MUSIC_SET_SHUFFLE:
+                    Music_Playlist_SetShuffle(event.param);
+                    break;
+                case MUSIC_SET_REPEAT:
+                    Music_Playlist_SetRepeat((Music_Playlist_Repeat)event.param);
+                    break;
                 default:
                     break;
             }
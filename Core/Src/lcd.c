@@ -326,6 +326,33 @@ void lcd_display_dir(uint8_t dir) {
   lcd_scan_dir(DFT_SCAN_DIR);
 }
 
+/**
+ * @brief 打开撕裂效应输出 (TE 引脚在垂直消隐期间为高电平)
+ * @note  只在竖屏时使用: 这些控制器的面板按 GRAM 的行从上到下扫描, 扫描线可以由 TE 之后的时间推算。
+ *        SSD1963 的面板原生为横屏, 竖屏时按列扫描, 不支持
+ * @retval 1: 已打开, 0: 不支持
+ */
+uint8_t lcd_te_enable(void) {
+  if (lcddev.dir != 0)
+    return 0;
+
+  switch (lcddev.id) {
+  case 0x5510:
+    lcd_write_reg(0x3500, 0x00); /* TEON, 只输出 V-Blank */
+    return 1;
+  case 0x9341:
+  case 0x7789:
+  case 0x5310:
+  case 0x7796:
+  case 0x9806:
+    lcd_wr_regno(0x35); /* TEON, 只输出 V-Blank */
+    lcd_wr_data(0x00);
+    return 1;
+  default:
+    return 0;
+  }
+}
+
 void lcd_set_window(uint16_t sx, uint16_t sy, uint16_t width, uint16_t height) {
   uint16_t twidth, theight;
   twidth = sx + width - 1;
@@ -0,0 +1,101 @@
+/*
+ * audio_src_test.c
+ * 在电脑上测试 audio_src.c: 22.05 / 32 / 44.1kHz 正弦转换到 48kHz 后的 THD+N, 以及分段调用的一致性
+ *
+ * 1. THD+N: 运行 audio_src_selftest.c 的全部用例 (板上打开 AUDIO_SRC_SELFTEST 运行的是同一段代码),
+ *    超过上限、增益偏差超过 0.5dB 或左右声道不同时失败。time 列电脑上为每个输出采样对的纳秒数,
+ *    板上 src_selftest_result 中同一字段为 DWT 周期数。
+ * 2. 分段: 同一段输入一次送完和按随机长度分段送入 (输出空间也随机), 输出必须逐位相同,
+ *    检查相位和历史窗口在调用之间正确保存。
+ * 任何检查失败时返回 1。
+ *
+ * 编译:
+ *   gcc -O2 -I../../Core/App/Player audio_src_test.c ../../Core/App/Player/audio_src_selftest.c \
+ *       ../../Core/App/Player/audio_src.c -lm -o audio_src_test
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio_src.h"
+#include "audio_src_selftest.h"
+
+#define CHUNK_IN_FRAMES 20000
+#define CHUNK_OUT_FRAMES (CHUNK_IN_FRAMES * 48000 / 22050 + 64)
+
+static uint32_t rng_state = 1;
+
+static uint32_t rnd(uint32_t n)
+{
+    rng_state = rng_state * 1664525U + 1013904223U;
+    return (uint32_t)(((uint64_t)(rng_state >> 8) * n) >> 24);
+}
+
+/**
+ * @brief  Convert the whole input, in_max / out_max 个采样对为一次调用的上限 (0 = 随机)
+ * @retval 输出的采样数 (左右声道合计)
+ */
+static uint32_t convert(const int16_t *in, uint32_t in_samples, int16_t *out, uint32_t in_max, uint32_t out_max)
+{
+    uint32_t produced = 0;
+
+    Audio_SRC_Reset();
+    while (in_samples > 0)
+    {
+        uint32_t used = 2 * (in_max ? in_max : 1 + rnd(700));
+        uint32_t space = 2 * (out_max ? out_max : 1 + rnd(1500));
+        if (used > in_samples) used = in_samples;
+        if (space > 2 * CHUNK_OUT_FRAMES - produced) space = 2 * CHUNK_OUT_FRAMES - produced;
+
+        produced += Audio_SRC_Process(in, &used, out + produced, space);
+        in += used;
+        in_samples -= used;
+    }
+    return produced;
+}
+
+static int test_chunking(uint32_t in_rate)
+{
+    static int16_t in[CHUNK_IN_FRAMES * 2];
+    static int16_t ref[CHUNK_OUT_FRAMES * 2];
+    static int16_t out[CHUNK_OUT_FRAMES * 2];
+
+    // 白噪声 (左右声道不同), 覆盖全部相位和溢出削波
+    for (uint32_t i = 0; i < CHUNK_IN_FRAMES * 2; i++) in[i] = (int16_t)(rnd(65536) - 32768);
+
+    Audio_SRC_Configure(in_rate);
+    uint32_t n_ref = convert(in, CHUNK_IN_FRAMES * 2, ref, CHUNK_IN_FRAMES, CHUNK_OUT_FRAMES);
+    uint32_t n_out = convert(in, CHUNK_IN_FRAMES * 2, out, 0, 0);
+
+    int ok = n_ref == n_out && memcmp(ref, out, n_ref * sizeof(int16_t)) == 0;
+    printf("chunking %5u Hz: %u -> %u pairs  %s\n", in_rate, CHUNK_IN_FRAMES, n_ref / 2, ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+int main(void)
+{
+    Audio_SRC_Selftest_Result r;
+    Audio_SRC_Info info;
+    int failed = 0;
+
+    Audio_SRC_Selftest_Run(&r);
+    printf("%7s %6s %4s %4s %5s %8s %8s %8s %8s\n", "in Hz", "tone", "L", "M", "taps", "THD+N", "limit", "gain",
+           "ns/pair");
+    for (int i = 0; i < AUDIO_SRC_SELFTEST_CASES; i++)
+    {
+        const Audio_SRC_Selftest_Case *c = &r.cases[i];
+        Audio_SRC_Configure(c->in_rate);
+        Audio_SRC_GetInfo(&info);
+        printf("%7u %6u %4u %4u %5u %8.1f %8.1f %8.3f %8u\n", c->in_rate, c->freq, info.phases, info.step, info.taps,
+               c->thdn_db, c->limit_db, c->gain_db, c->time);
+    }
+    printf("THD+N: %d failed\n", (int)r.failed);
+    failed |= r.failed != 0;
+
+    failed |= test_chunking(22050);
+    failed |= test_chunking(32000);
+    failed |= test_chunking(44100);
+    return failed;
+}
@@ -0,0 +1,126 @@
+/*
+ * codec_bench.c
+ * 在电脑上用播放器的解码器接口解码 WAV / MP3 / FLAC / APE 文件, 输出解码速度和 PCM 校验和
+ *
+ * 与 Tools/helix_bench 相同, 文件通过 host_stream.c (stream_reader 接口的 stdio 实现) 读取,
+ * 解码器内存从 codec_mem 分配, 输出与板上 decode_frame() 写入环形缓冲区的数据相同。
+ * 校验和与 audio_decoder.c 的 AUDIO_DEC_PCM_CHECKSUM 相同 (FNV-1a, 每个左右声道对 32 位),
+ * 可以直接和板上打开该开关后 Audio_Decoder_GetChecksum() 的结果比较。
+ * 用时是电脑上的, 只用于相对比较。
+ *
+ * 这些解码器在板上之外没有别的编译入口: 移植代码缺少函数 (例如 APE 预测器只有汇编版本) 时
+ * 固件要到链接时才报错, make 在电脑上链接全部解码器源文件, 可以提前发现。
+ *
+ * 编译: make (见 Makefile)
+ * 用法:
+ *   ./codec_bench <.wav|.mp3|.flac|.ape 文件>...    有文件解码出错时返回 1
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "audio_decoder.h"
+#include "codec_mem.h"
+#include "host_stream.h"
+
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+#define BLOCK_SAMPLES 2304  // 与 music_player.c 的 PCM_RING_BLOCK_SAMPLES 相同
+
+static const Audio_Decoder *const decoders[] = {&Audio_Decoder_WAV, &Audio_Decoder_MP3, &Audio_Decoder_FLAC,
+                                                &Audio_Decoder_APE};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  Decoder for a file name, by extension (不区分大小写)
+ */
+static const Audio_Decoder *find_decoder(const char *path)
+{
+    const char *dot = strrchr(path, '.');
+    if (!dot) return NULL;
+
+    for (size_t i = 0; i < sizeof(decoders) / sizeof(decoders[0]); i++)
+    {
+        const char *a = dot, *b = decoders[i]->ext;
+        while (*a && *b && tolower((unsigned char)*a) == *b)
+        {
+            a++;
+            b++;
+        }
+        if (*a == '\0' && *b == '\0') return decoders[i];
+    }
+    return NULL;
+}
+
+/**
+ * @retval 0: 解码到文件结束, 1: 打开失败
+ */
+static int decode_file(const char *path)
+{
+    static int16_t block[BLOCK_SAMPLES] __attribute__((aligned(4)));
+    const Audio_Decoder *dec = find_decoder(path);
+    Audio_Info info;
+    uint32_t used = 0;
+    uint64_t samples = 0;
+    uint32_t h = FNV_OFFSET_BASIS;
+
+    if (!dec)
+    {
+        printf("%s: unsupported extension\n", path);
+        return 1;
+    }
+    Codec_Mem_Reset();
+    if (Stream_Open(path) != FR_OK || dec->open(&info) != 0)
+    {
+        printf("%s: %s open failed\n", path, dec->name);
+        Stream_Close();
+        return 1;
+    }
+
+    uint64_t t0 = now_ns();
+    for (;;)
+    {
+        int n = dec->decode_frame(block + used, BLOCK_SAMPLES - used);
+        if (n == AUDIO_DEC_EOF) break;
+        if (n == AUDIO_DEC_NEED_BLOCK) used = BLOCK_SAMPLES;  // 与环形缓冲区相同, 剩余空间补零后换块
+        else if (n > 0)
+        {
+            const uint32_t *p = (const uint32_t *)(block + used);
+            for (int i = 0; i < n / 2; i++) h = (h ^ p[i]) * FNV_PRIME;
+            samples += n / 2;
+            used += n;
+        }
+        if (used >= BLOCK_SAMPLES) used = 0;
+    }
+    uint64_t ns = now_ns() - t0;
+    dec->close();
+    Stream_Close();
+
+    double seconds = info.sample_rate ? (double)samples / info.sample_rate : 0;
+    printf("%-40s %-4s %6u Hz %u ch %2u bit %10llu samples %8.2f s  %7.1fx  crc %08x\n", path, dec->name,
+           info.sample_rate, info.channels, info.bits_per_sample, (unsigned long long)samples, seconds,
+           ns ? seconds * 1e9 / ns : 0, h);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int failed = 0;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <.wav|.mp3|.flac|.ape>...\n", argv[0]);
+        return 1;
+    }
+    Stream_Init();
+    for (int i = 1; i < argc; i++) failed |= decode_file(argv[i]);
+    return failed;
+}
@@ -0,0 +1,451 @@
+/*
+ * gui_cover_check.c
+ * 在电脑上检查封面缩略图的生成与复用 (music_index.c 记录封面位置 + music_cover.c 解码写文件)
+ *
+ * 在临时目录中生成内嵌同一张基线 JPEG 的 MP3 (ID3v2.3 APIC)、FLAC (PICTURE 块) 和 APE (APEv2
+ * "Cover Art (Front)") 文件, 用 Music_Index_Probe() 找到封面位置, 再按顺序生成缩略图:
+ *   - 三个文件得到同一个缩略图文件, 大小为 LVGL 图片头 + MUSIC_COVER_SIZE^2 个 RGB565 像素
+ *   - 缩略图与参考结果逐像素一致: 参考结果由 TJpgDec 把整张图解码到内存后按同样的位置取样,
+ *     不经过 music_cover.c 的行缓存和多遍解码
+ *   - 第一个文件生成缩略图之后把文件内容改成标记, 后两个文件打开时标记不变 (直接复用, 没有重新解码)
+ *   - 给出渐进式 JPEG 时 (第二个参数), 不生成缩略图, 也不留下临时文件
+ * 并打印生成和复用的用时 (电脑上, 只用于相对比较) 与解码期间 LVGL 堆的峰值占用。
+ *
+ * 编译: make (见 Makefile)
+ * 用法:
+ *   ./build/gui_cover_check baseline.jpg [progressive.jpg]
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "gui_host.h"
+#include "fatfs.h"
+
+/* 被测代码: 直接包含, 以便单独调用 cover_make() */
+#include "../../Core/App/Player/music_cover.c"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#define MP3_FRAMES 40
+#define MP3_FRAME_LEN 417  // MPEG-1 Layer III, 128 kbps, 44.1 kHz
+#define AUDIO_BYTES 4096   // FLAC / APE 的 "音频数据" (内容不解析)
+#define PROBE_BUF 4096
+#define MARK 0xA5
+
+typedef struct
+{
+    const char *name;
+    uint8_t format;
+} Track_File;
+
+static const Track_File files[] = {
+    {"cover.mp3", MUSIC_INDEX_FMT_MP3},
+    {"cover.flac", MUSIC_INDEX_FMT_FLAC},
+    {"cover.ape", MUSIC_INDEX_FMT_APE},
+    {"progressive.mp3", MUSIC_INDEX_FMT_MP3},
+};
+#define FILE_COUNT (sizeof(files) / sizeof(files[0]))
+
+static Music_Index_Track tracks[FILE_COUNT];
+static uint8_t *jpeg;
+static uint32_t jpeg_size;
+
+/* music_library.c 的替身: 曲库中只有上面几个文件 ----------------------------*/
+
+int Music_Library_ReadTrack(uint32_t index, Music_Index_Track *track)
+{
+    if (index >= FILE_COUNT) return -1;
+    *track = tracks[index];
+    return 0;
+}
+
+int Music_Library_GetPath(uint32_t index, char *buf, uint32_t size)
+{
+    if (index >= FILE_COUNT) return -1;
+    snprintf(buf, size, "%s", tracks[index].name);
+    return 0;
+}
+
+/* 测试文件 -------------------------------------------------------------------*/
+
+static uint8_t *load(const char *path, uint32_t *size)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return NULL;
+
+    fseek(fp, 0, SEEK_END);
+    long n = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t *data = malloc((size_t)n);
+    if (data && fread(data, 1, (size_t)n, fp) != (size_t)n)
+    {
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    *size = (uint32_t)n;
+    return data;
+}
+
+static void put_be32(FILE *fp, uint32_t v)
+{
+    uint8_t b[4] = {(uint8_t)(v >> 24), (uint8_t)(v >> 16), (uint8_t)(v >> 8), (uint8_t)v};
+    fwrite(b, 1, 4, fp);
+}
+
+static void put_le32(FILE *fp, uint32_t v)
+{
+    uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+    fwrite(b, 1, 4, fp);
+}
+
+static void put_le16(FILE *fp, uint16_t v)
+{
+    uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+    fwrite(b, 1, 2, fp);
+}
+
+static void put_zero(FILE *fp, uint32_t n)
+{
+    while (n--) fputc(0, fp);
+}
+
+/**
+ * @brief  ID3v2.3 tag (APIC, front cover) followed by silent CBR frames
+ */
+static void write_mp3(FILE *fp, const uint8_t *pic, uint32_t pic_size)
+{
+    static const char mime[] = "image/jpeg";
+    uint32_t apic = 1 + sizeof(mime) + 1 + 1 + pic_size;  // 编码, MIME\0, 图片类型, 描述\0, 数据
+    uint32_t tag = 10 + apic;
+
+    fwrite("ID3\x03\x00\x00", 1, 6, fp);
+    uint8_t ss[4] = {(uint8_t)(tag >> 21 & 0x7F), (uint8_t)(tag >> 14 & 0x7F), (uint8_t)(tag >> 7 & 0x7F),
+                     (uint8_t)(tag & 0x7F)};
+    fwrite(ss, 1, 4, fp);
+    fwrite("APIC", 1, 4, fp);
+    put_be32(fp, apic);
+    put_zero(fp, 2);
+    fputc(0, fp);
+    fwrite(mime, 1, sizeof(mime), fp);
+    fputc(3, fp);
+    fputc(0, fp);
+    fwrite(pic, 1, pic_size, fp);
+
+    for (int i = 0; i < MP3_FRAMES; i++)
+    {
+        fwrite("\xFF\xFB\x90\x00", 1, 4, fp);
+        put_zero(fp, MP3_FRAME_LEN - 4);
+    }
+}
+
+/**
+ * @brief  STREAMINFO + PICTURE (front cover, last block) + placeholder frames
+ */
+static void write_flac(FILE *fp, const uint8_t *pic, uint32_t pic_size)
+{
+    static const char mime[] = "image/jpeg";
+    uint32_t sample_rate = 44100;
+    uint64_t samples = 441000;
+    uint32_t len = 4 + 4 + (sizeof(mime) - 1) + 4 + 16 + 4 + pic_size;
+
+    fwrite("fLaC", 1, 4, fp);
+    put_be32(fp, (0u << 24) | 34);  // STREAMINFO
+    put_be32(fp, (4096u << 16) | 4096u);
+    put_zero(fp, 6);
+    uint8_t si[8];
+    si[0] = (uint8_t)(sample_rate >> 12);
+    si[1] = (uint8_t)(sample_rate >> 4);
+    si[2] = (uint8_t)((sample_rate << 4) | (1 << 1) | 0);     // 2 声道
+    si[3] = (uint8_t)((15 << 4) | (uint8_t)(samples >> 32));  // 16 位
+    si[4] = (uint8_t)(samples >> 24);
+    si[5] = (uint8_t)(samples >> 16);
+    si[6] = (uint8_t)(samples >> 8);
+    si[7] = (uint8_t)samples;
+    fwrite(si, 1, 8, fp);
+    put_zero(fp, 16);  // MD5
+
+    put_be32(fp, (0x80u | 6) << 24 | len);  // PICTURE, 最后一个块
+    put_be32(fp, 3);
+    put_be32(fp, sizeof(mime) - 1);
+    fwrite(mime, 1, sizeof(mime) - 1, fp);
+    put_be32(fp, 0);
+    put_zero(fp, 16);  // 宽, 高, 色深, 颜色数 (不使用)
+    put_be32(fp, pic_size);
+    fwrite(pic, 1, pic_size, fp);
+
+    put_zero(fp, AUDIO_BYTES);
+}
+
+/**
+ * @brief  APE 3.99 descriptor + header, placeholder frames, APEv2 tag with a binary cover item
+ */
+static void write_ape(FILE *fp, const uint8_t *pic, uint32_t pic_size)
+{
+    static const char key[] = "Cover Art (Front)";
+    static const char file[] = "cover.jpg";
+    uint32_t item = 8 + sizeof(key) + sizeof(file) + pic_size;
+
+    fwrite("MAC ", 1, 4, fp);
+    put_le16(fp, 3990);
+    put_zero(fp, 2);
+    put_le32(fp, 52);  // 描述符长度
+    put_zero(fp, 52 - 12);
+    put_le16(fp, 2000);       // 压缩级别
+    put_le16(fp, 0);          // 标志
+    put_le32(fp, 73728 * 4);  // 每帧块数
+    put_le32(fp, 4410);       // 最后一帧块数
+    put_le32(fp, 2);          // 帧数
+    put_le16(fp, 16);
+    put_le16(fp, 2);
+    put_le32(fp, 44100);
+    put_zero(fp, AUDIO_BYTES);
+
+    put_le32(fp, sizeof(file) + pic_size);
+    put_le32(fp, 1 << 1);  // 二进制项
+    fwrite(key, 1, sizeof(key), fp);
+    fwrite(file, 1, sizeof(file), fp);
+    fwrite(pic, 1, pic_size, fp);
+
+    fwrite("APETAGEX", 1, 8, fp);
+    put_le32(fp, 2000);
+    put_le32(fp, item + 32);  // 包括尾部
+    put_le32(fp, 1);
+    put_le32(fp, 0);
+    put_zero(fp, 8);
+}
+
+static uint32_t probe_read(void *ctx, uint32_t offset, void *buf, uint32_t len)
+{
+    FILE *fp = (FILE *)ctx;
+    if (fseek(fp, offset, SEEK_SET) != 0) return 0;
+    return (uint32_t)fread(buf, 1, len, fp);
+}
+
+/**
+ * @brief  Write <root>/music/<name> with the picture embedded and probe it like the library index does
+ */
+static int make_track(uint32_t index, const uint8_t *pic, uint32_t pic_size)
+{
+    static uint8_t buf[PROBE_BUF];
+    char path[256];
+    Music_Index_Track *t = &tracks[index];
+
+    snprintf(path, sizeof(path), "%s/music/%s", gui_host_sd_root, files[index].name);
+    FILE *fp = fopen(path, "w+b");
+    if (!fp) return -1;
+    if (files[index].format == MUSIC_INDEX_FMT_FLAC) write_flac(fp, pic, pic_size);
+    else if (files[index].format == MUSIC_INDEX_FMT_APE) write_ape(fp, pic, pic_size);
+    else write_mp3(fp, pic, pic_size);
+    fflush(fp);
+
+    memset(t, 0, sizeof(*t));
+    snprintf(t->name, sizeof(t->name), "%s", files[index].name);
+    t->format = files[index].format;
+    t->size = (uint32_t)ftell(fp);
+    int res = Music_Index_Probe(t, probe_read, fp, buf, sizeof(buf));
+    fclose(fp);
+    return res;
+}
+
+/* 参考缩略图 ------------------------------------------------------------------*/
+
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size, pos;
+    uint32_t width;
+    uint16_t *pixels;  // 整张图, RGB565
+} Ref_Source;
+
+static size_t ref_input(JDEC *jd, uint8_t *buf, size_t n)
+{
+    Ref_Source *src = (Ref_Source *)jd->device;
+    if (n > src->size - src->pos) n = src->size - src->pos;
+    if (buf) memcpy(buf, src->data + src->pos, n);
+    src->pos += (uint32_t)n;
+    return n;
+}
+
+static int ref_output(JDEC *jd, void *bitmap, JRECT *rect)
+{
+    Ref_Source *src = (Ref_Source *)jd->device;
+    const uint8_t *p = (const uint8_t *)bitmap;
+
+    for (uint32_t y = rect->top; y <= rect->bottom; y++)
+    {
+        for (uint32_t x = rect->left; x <= rect->right; x++, p += 3)
+        {
+            src->pixels[y * src->width + x] = (uint16_t)(((p[2] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[0] >> 3));
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief  Decode the whole picture, crop the centre square and sample it at the thumbnail positions
+ * @retval 0: 成功
+ */
+static int ref_thumbnail(uint16_t *out)
+{
+    static uint8_t pool[COVER_POOL_SIZE] __attribute__((aligned(4)));
+    Ref_Source src = {jpeg, jpeg_size, 0, 0, NULL};
+    JDEC jd;
+
+    if (jd_prepare(&jd, ref_input, pool, sizeof(pool), &src) != JDR_OK) return -1;
+    src.width = jd.width;
+    src.pixels = malloc(jd.width * jd.height * sizeof(uint16_t));
+    if (!src.pixels || jd_decomp(&jd, ref_output, 0) != JDR_OK) return -1;
+
+    uint32_t crop = (jd.width < jd.height) ? jd.width : jd.height;
+    uint32_t x0 = (jd.width - crop) / 2, y0 = (jd.height - crop) / 2;
+    for (uint32_t y = 0; y < MUSIC_COVER_SIZE; y++)
+    {
+        uint32_t sy = y0 + (2 * y + 1) * crop / (2 * MUSIC_COVER_SIZE);
+        for (uint32_t x = 0; x < MUSIC_COVER_SIZE; x++)
+        {
+            uint32_t sx = x0 + (2 * x + 1) * crop / (2 * MUSIC_COVER_SIZE);
+            out[y * MUSIC_COVER_SIZE + x] = src.pixels[sy * jd.width + sx];
+        }
+    }
+    printf("picture: %ux%u baseline JPEG, %u bytes\n", jd.width, jd.height, jpeg_size);
+    free(src.pixels);
+    return 0;
+}
+
+/* 检查 -----------------------------------------------------------------------*/
+
+/**
+ * @brief  cover_make() for one track, timed, with the LVGL heap peak above the level before the call
+ */
+static int make_cover(uint32_t id, Music_Cover_Info *info, double *ms, uint32_t *heap_peak)
+{
+    lv_mem_monitor_t mon;
+
+    lv_mem_monitor(&mon);
+    uint32_t used0 = mon.total_size - mon.free_size;
+    uint32_t peak0 = mon.max_used;
+
+    memset(info, 0, sizeof(*info));
+    cover_request = id;
+    uint64_t t0 = gui_host_now_ns();
+    int res = cover_make(info, &tracks[id], id);
+    *ms = (gui_host_now_ns() - t0) / 1e6;
+
+    lv_mem_monitor(&mon);
+    *heap_peak = (mon.max_used > peak0) ? mon.max_used - used0 : 0;
+    return res;
+}
+
+static int file_exists(const char *lv_path)
+{
+    FILINFO fno;
+    char path[64];
+    snprintf(path, sizeof(path), "0:%s", lv_path);
+    return f_stat(path, &fno) == FR_OK;
+}
+
+int main(int argc, char **argv)
+{
+    static uint16_t ref[MUSIC_COVER_SIZE * MUSIC_COVER_SIZE];
+    static uint8_t thumb[COVER_FILE_SIZE];
+    int failed = 0;
+
+    if (argc < 2)
+    {
+        printf("usage: %s baseline.jpg [progressive.jpg]\n", argv[0]);
+        return 1;
+    }
+    jpeg = load(argv[1], &jpeg_size);
+    if (!jpeg)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    if (!gui_host_sd_create("gui_cover_check")) return 1;
+
+    gui_host_init(0);
+    if (ref_thumbnail(ref) != 0)
+    {
+        printf("%s: not a baseline JPEG\n", argv[1]);
+        return 1;
+    }
+
+    int probed = 1;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        probed &= (make_track(i, jpeg, jpeg_size) == 0 && tracks[i].cover_size == jpeg_size);
+    }
+    failed |= gui_host_check("MP3 / FLAC / APE: cover found by Music_Index_Probe()", probed);
+
+    // 第一个文件生成缩略图, 与参考结果比较
+    Music_Cover_Info info[FILE_COUNT];
+    double ms[FILE_COUNT];
+    uint32_t heap[FILE_COUNT];
+    int made = (make_cover(0, &info[0], &ms[0], &heap[0]) == 0);
+    char cover_path[sizeof(cover_file_path)];
+    snprintf(cover_path, sizeof(cover_path), "%s", cover_file_path);
+
+    size_t got = 0;
+    FILE *fp = made ? fopen(host_path(cover_path), "rb") : NULL;
+    if (fp)
+    {
+        got = fread(thumb, 1, sizeof(thumb), fp);
+        if (fgetc(fp) != EOF) got++;
+        fclose(fp);
+    }
+    const lv_image_header_t *header = (const lv_image_header_t *)thumb;
+    uint32_t differ = 0;
+    for (uint32_t i = 0; i < MUSIC_COVER_SIZE * MUSIC_COVER_SIZE; i++)
+    {
+        uint16_t px;
+        memcpy(&px, thumb + sizeof(lv_image_header_t) + i * 2, 2);
+        differ += (px != ref[i]);
+    }
+    printf("build: %s, %.2f ms (host), LVGL heap peak +%u B\n", info[0].path, ms[0], heap[0]);
+    failed |= gui_host_check("thumbnail file written with an LVGL image header", made && got == COVER_FILE_SIZE &&
+                             header->magic == LV_IMAGE_HEADER_MAGIC && header->cf == LV_COLOR_FORMAT_RGB565 &&
+                             header->w == MUSIC_COVER_SIZE && header->h == MUSIC_COVER_SIZE);
+    failed |= gui_host_check("thumbnail matches the whole-picture reference", made && differ == 0);
+
+    // 把像素改成标记, 后两个文件应直接使用这个文件
+    memset(thumb + sizeof(lv_image_header_t), MARK, COVER_FILE_SIZE - sizeof(lv_image_header_t));
+    fp = fopen(host_path(cover_path), "wb");
+    if (fp)
+    {
+        fwrite(thumb, 1, COVER_FILE_SIZE, fp);
+        fclose(fp);
+    }
+    int shared = made;
+    for (uint32_t i = 1; i < 3; i++)
+    {
+        shared &= (make_cover(i, &info[i], &ms[i], &heap[i]) == 0 && strcmp(info[i].path, info[0].path) == 0);
+        printf("reuse (%s): %.3f ms (host)\n", files[i].name, ms[i]);
+    }
+    fp = fopen(host_path(cover_path), "rb");
+    got = fp ? fread(thumb, 1, sizeof(thumb), fp) : 0;
+    if (fp) fclose(fp);
+    uint32_t kept = 0;
+    for (uint32_t i = sizeof(lv_image_header_t); i < got; i++) kept += (thumb[i] == MARK);
+    failed |= gui_host_check("FLAC and APE use the same file", shared);
+    failed |= gui_host_check("existing file reused without decoding",
+                             kept == COVER_FILE_SIZE - sizeof(lv_image_header_t));
+
+    // 渐进式 JPEG: 没有缩略图, 不留临时文件
+    if (argc > 2)
+    {
+        uint32_t size;
+        uint8_t *prog = load(argv[2], &size);
+        int none = prog && make_track(3, prog, size) == 0 && tracks[3].cover_size == size &&
+                   make_cover(3, &info[3], &ms[3], &heap[3]) != 0;
+        failed |= gui_host_check("progressive JPEG: no thumbnail, no temporary file",
+                                 none && !file_exists(info[3].path + 2) &&
+                                     access(host_path(COVER_TMP_PATH), F_OK) != 0);
+        free(prog);
+    }
+
+    gui_host_sd_remove();
+    free(jpeg);
+    return failed;
+}
@@ -0,0 +1,211 @@
+/*
+ * gui_host.c
+ * 无界面 LVGL 显示、测试程序推进的节拍与 CMSIS-RTOS2 替身 (见 gui_host.h)
+ */
+
+#define _XOPEN_SOURCE 700  // mkdtemp, nftw
+
+#include "gui_host.h"
+#include "cmsis_os.h"
+#include "../../Core/App/GUI/gui_image_rle.h"
+#include "../../Core/Gui/lvgl/src/misc/lv_area_private.h"
+
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+/* Private variables ---------------------------------------------------------*/
+uint16_t gui_host_fb[GUI_HOST_HOR_RES * GUI_HOST_VER_RES];
+uint32_t gui_host_messages = 0;
+const char *gui_host_sd_root = ".";
+
+static uint8_t host_buf[GUI_HOST_HOR_RES * GUI_HOST_VER_RES * 2];
+static uint32_t host_tick = 0;
+static Gui_Host_Flush_Stats host_flush;
+static lv_area_t host_flush_log[GUI_HOST_FLUSH_LOG];
+static char host_sd_dir[64] = "";  // gui_host_sd_create() 创建的目录
+
+/* Function implementations --------------------------------------------------*/
+
+static uint32_t host_tick_cb(void)
+{
+    return host_tick;
+}
+
+static void host_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    int32_t w = lv_area_get_width(area);
+
+    for (int32_t y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(&gui_host_fb[y * GUI_HOST_HOR_RES + area->x1], px_map + (y - area->y1) * w * 2, w * 2);
+    }
+
+    if (host_flush.flushes < GUI_HOST_FLUSH_LOG) host_flush_log[host_flush.flushes] = *area;
+    if (host_flush.flushes == 0) host_flush.bounds = *area;
+    else lv_area_join(&host_flush.bounds, &host_flush.bounds, area);
+    host_flush.flushes++;
+    host_flush.pixels += lv_area_get_size(area);
+    lv_display_flush_ready(disp);
+}
+
+lv_display_t *gui_host_init(uint32_t buf_rows)
+{
+    if (buf_rows == 0) buf_rows = GUI_HOST_BUF_ROWS;
+    if (buf_rows > GUI_HOST_VER_RES) buf_rows = GUI_HOST_VER_RES;
+
+    lv_init();
+    lv_tick_set_cb(host_tick_cb);
+    gui_image_rle_init();
+
+    lv_display_t *disp = lv_display_create(GUI_HOST_HOR_RES, GUI_HOST_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, host_flush_cb);
+    lv_display_set_buffers(disp, host_buf, NULL, GUI_HOST_HOR_RES * buf_rows * 2, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    return disp;
+}
+
+void gui_host_advance(uint32_t ms, uint32_t step)
+{
+    if (step == 0) step = 1;
+    for (uint32_t t = 0; t < ms; t += step)
+    {
+        host_tick += step;
+        lv_timer_handler();
+    }
+}
+
+uint32_t gui_host_tick(void)
+{
+    return host_tick;
+}
+
+void gui_host_flush_reset(void)
+{
+    memset(&host_flush, 0, sizeof(host_flush));
+}
+
+void gui_host_flush_get(Gui_Host_Flush_Stats *stats)
+{
+    *stats = host_flush;
+}
+
+uint64_t gui_host_flush_outside(const lv_area_t *allowed, uint32_t count)
+{
+    uint32_t n = (host_flush.flushes < GUI_HOST_FLUSH_LOG) ? host_flush.flushes : GUI_HOST_FLUSH_LOG;
+    uint64_t outside = 0;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        const lv_area_t *a = &host_flush_log[i];
+
+        // 逐行统计: 每一行减去与各允许区域的交集 (允许区域互不重叠)
+        for (int32_t y = a->y1; y <= a->y2; y++)
+        {
+            int32_t left = lv_area_get_width(a);
+            for (uint32_t k = 0; k < count; k++)
+            {
+                const lv_area_t *b = &allowed[k];
+                if (y < b->y1 || y > b->y2) continue;
+                int32_t x1 = LV_MAX(a->x1, b->x1), x2 = LV_MIN(a->x2, b->x2);
+                if (x2 >= x1) left -= x2 - x1 + 1;
+            }
+            outside += (uint64_t)left;
+        }
+    }
+    if (host_flush.flushes > GUI_HOST_FLUSH_LOG) outside = UINT64_MAX;  // 记录不全, 无法判断
+    return outside;
+}
+
+uint32_t gui_host_heap_used(void)
+{
+    lv_mem_monitor_t mon;
+
+    lv_mem_monitor(&mon);
+    return (uint32_t)(mon.total_size - mon.free_size);
+}
+
+uint64_t gui_host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+int gui_host_check(const char *what, int ok)
+{
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+const char *gui_host_sd_create(const char *name)
+{
+    char music[sizeof(host_sd_dir) + 8];
+
+    snprintf(host_sd_dir, sizeof(host_sd_dir), "/tmp/%s.XXXXXX", name);
+    if (!mkdtemp(host_sd_dir))
+    {
+        perror(host_sd_dir);
+        host_sd_dir[0] = '\0';
+        return NULL;
+    }
+    snprintf(music, sizeof(music), "%s/music", host_sd_dir);
+    mkdir(music, 0777);
+    gui_host_sd_root = host_sd_dir;
+    return host_sd_dir;
+}
+
+static int sd_remove_cb(const char *path, const struct stat *st, int type, struct FTW *ftw)
+{
+    return remove(path);
+}
+
+void gui_host_sd_remove(void)
+{
+    if (host_sd_dir[0] == '\0') return;
+    nftw(host_sd_dir, sd_remove_cb, 8, FTW_DEPTH | FTW_PHYS);  // 先删目录中的文件, 再删目录
+    host_sd_dir[0] = '\0';
+    gui_host_sd_root = ".";
+}
+
+/* CMSIS-RTOS2 替身 ------------------------------------------------------------*/
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+    (void)mq_id;
+    (void)msg_ptr;
+    (void)msg_prio;
+    (void)timeout;
+    gui_host_messages++;
+    return osOK;
+}
+
+uint32_t osKernelGetTickCount(void)
+{
+    return host_tick;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+    // 电脑上不创建任务: 测试程序直接调用任务里的函数
+    (void)func;
+    (void)argument;
+    (void)attr;
+    return NULL;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+    (void)thread_id;
+    return flags;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    (void)options;
+    (void)timeout;
+    return flags;
+}
@@ -0,0 +1,81 @@
+/*
+ * gui_host.h
+ * 电脑上运行固件 GUI 代码的公共部分: 无界面的 LVGL 显示 (480x800 RGB565, 与板上相同的分块渲染)、
+ * 由测试程序推进的系统节拍, 以及刷新区域记录
+ *
+ * 刷新回调把每次 flush 的像素写入 gui_host_fb (整屏), 并记录区域, 测试程序据此检查
+ * "哪些区域被重绘、重绘了多少像素"。时间不随真实时钟走, 只由 gui_host_advance() 推进,
+ * 所以定时器、动画和刷新的顺序每次运行都相同。
+ */
+
+#ifndef GUI_HOST_H_
+#define GUI_HOST_H_
+
+#include <stdint.h>
+
+#include "../../Core/Gui/lvgl/lvgl.h"
+
+#define GUI_HOST_HOR_RES 480
+#define GUI_HOST_VER_RES 800
+#define GUI_HOST_BUF_ROWS 80     // 默认渲染缓冲行数 (与 disp_driver 的一块缓冲相同)
+#define GUI_HOST_FLUSH_LOG 1024  // 最多记录的刷新区域数, 更多时只计数
+
+typedef struct
+{
+    uint32_t flushes;  // flush 次数
+    uint64_t pixels;   // 写入的像素数
+    lv_area_t bounds;  // 所有区域的外接矩形 (flushes 为 0 时无效)
+} Gui_Host_Flush_Stats;
+
+extern uint16_t gui_host_fb[GUI_HOST_HOR_RES * GUI_HOST_VER_RES];
+extern uint32_t gui_host_messages;  // osMessageQueuePut() 调用次数
+
+/**
+ * @brief  lv_init(), 注册 RLE 图片解码器, 创建显示
+ * @param  buf_rows: 渲染缓冲的行数 (分块渲染), 0 表示 GUI_HOST_BUF_ROWS
+ */
+lv_display_t *gui_host_init(uint32_t buf_rows);
+
+/**
+ * @brief  推进系统节拍, 每 step 毫秒运行一次 lv_timer_handler() (与 GUI 任务的循环相同)
+ */
+void gui_host_advance(uint32_t ms, uint32_t step);
+
+uint32_t gui_host_tick(void);
+
+void gui_host_flush_reset(void);
+void gui_host_flush_get(Gui_Host_Flush_Stats *stats);
+
+/**
+ * @brief  上次 gui_host_flush_reset() 之后不在 allowed 中任何一个区域内的像素数
+ */
+uint64_t gui_host_flush_outside(const lv_area_t *allowed, uint32_t count);
+
+/**
+ * @brief  LVGL 堆当前占用 (字节)
+ */
+uint32_t gui_host_heap_used(void);
+
+/**
+ * @brief  单调时钟 (纳秒), 只用于电脑上的相对比较
+ */
+uint64_t gui_host_now_ns(void);
+
+/**
+ * @brief  打印一项检查的结果
+ * @retval 0: 通过, 1: 失败 (各项按位或作为程序的返回值)
+ */
+int gui_host_check(const char *what, int ok);
+
+/**
+ * @brief  创建临时目录 /tmp/<name>.XXXXXX 作为 SD 卡根目录 (gui_host_sd_root), 其中建好 music 目录
+ * @retval 目录路径, 失败时为 NULL (已打印原因)
+ */
+const char *gui_host_sd_create(const char *name);
+
+/**
+ * @brief  删除 gui_host_sd_create() 创建的目录和其中的全部文件
+ */
+void gui_host_sd_remove(void);
+
+#endif /* GUI_HOST_H_ */
@@ -0,0 +1,124 @@
+/*
+ * gui_host_player.c
+ * 播放器、曲库、播放列表、EQ 与频谱接口的替身 (见 gui_host_player.h)
+ */
+
+#include "gui_host_player.h"
+#include "../../Core/App/GUI/gui_app.h"
+#include "../../Core/App/Player/audio_eq.h"
+#include "../../Core/App/Player/audio_spectrum.h"
+#include "../../Core/App/Player/music_library.h"
+#include "../../Core/App/Player/music_playlist.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+Gui_Host_Player gui_host_player = {
+    .song_count = 0,
+    .cover = {.id = MUSIC_COVER_NO_TRACK, .state = MUSIC_COVER_NONE},
+};
+
+osMessageQueueId_t music_eventQueueHandle = NULL;
+
+/* Function implementations --------------------------------------------------*/
+
+int Music_Playlist_Get(uint32_t pos, MusicSong_TypeDef *song)
+{
+    gui_host_player.playlist_reads++;
+    if (pos >= gui_host_player.song_count) return -1;
+    snprintf(song->name, sizeof(song->name), "Track %05lu - Artist %lu", (unsigned long)pos,
+             (unsigned long)(pos % 97));
+    song->id = pos;
+    song->format = MUSIC_FORMAT_MP3;
+    return 0;
+}
+
+int Music_Library_GetPath(uint32_t index, char *buf, uint32_t size)
+{
+    if (index != 0 || !gui_host_player.track_path) return -1;
+    if (strlen(gui_host_player.track_path) >= size) return -1;
+    strcpy(buf, gui_host_player.track_path);
+    return 0;
+}
+
+uint8_t Music_Cover_Read(Music_Cover_Info *info, uint32_t *seq)
+{
+    if (*seq == gui_host_player.cover_seq) return 0;
+    *info = gui_host_player.cover;
+    *seq = gui_host_player.cover_seq;
+    return 1;
+}
+
+uint32_t music_player_get_position_ms(void)
+{
+    return gui_host_player.position_ms;
+}
+
+uint32_t music_player_get_duration_ms(void)
+{
+    return gui_host_player.duration_ms;
+}
+
+uint32_t music_player_get_currentIndex(void)
+{
+    return gui_host_player.current;
+}
+
+void music_player_set_currentIndex(uint32_t index)
+{
+    gui_host_player.current = index;
+}
+
+char *music_player_get_currentName(void)
+{
+    return (char *)gui_host_player.current_name;
+}
+
+uint32_t music_player_get_song_count(void)
+{
+    return gui_host_player.song_count;
+}
+
+uint8_t music_player_get_eq_preset(void)
+{
+    return 0;
+}
+
+uint8_t music_player_get_bass_boost(void)
+{
+    return 0;
+}
+
+void music_player_get_dsp_stats(Music_DSP_Stats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+uint8_t music_player_get_headphone_volume(void)
+{
+    return 90;
+}
+
+uint8_t music_player_get_speaker_volume(void)
+{
+    return 90;
+}
+
+const char *Audio_EQ_GetPresetName(Audio_EQ_Preset preset)
+{
+    (void)preset;
+    return "Preset";
+}
+
+uint8_t Audio_Spectrum_Read(uint8_t *bars, uint32_t *seq)
+{
+    // 没有音频: 频谱保持不变, 不引起重绘
+    (void)bars;
+    (void)seq;
+    return 0;
+}
+
+void gui_app_return_home(void)
+{
+}
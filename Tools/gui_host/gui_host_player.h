@@ -0,0 +1,32 @@
+/*
+ * gui_host_player.h
+ * 播放界面 (gui_music_player.c) 在电脑上运行时的播放器替身
+ *
+ * 音频任务、曲库和播放列表不运行, 界面读取的状态都来自 gui_host_player, 由测试程序直接设置:
+ * 列表名称按位置生成, 播放位置由测试程序推进, 歌词文件从 gui_host_sd_root 下的 track_path 读取
+ * (music_lyric.c 使用真实代码)。
+ */
+
+#ifndef GUI_HOST_PLAYER_H_
+#define GUI_HOST_PLAYER_H_
+
+#include <stdint.h>
+
+#include "../../Core/App/Player/music_cover.h"
+
+typedef struct
+{
+    uint32_t song_count;       // 列表中的曲目数
+    uint32_t current;          // 当前歌曲的列表位置
+    const char *current_name;  // music_player_get_currentName(), NULL 表示没有歌曲
+    uint32_t position_ms;      // music_player_get_position_ms()
+    uint32_t duration_ms;      // music_player_get_duration_ms(), 0 表示未知
+    const char *track_path;    // 曲库序号 0 相对 0:/music 的路径 (歌词从同名 .lrc 读取), NULL 表示没有
+    Music_Cover_Info cover;    // Music_Cover_Read() 的结果, 修改后递增 cover_seq
+    uint32_t cover_seq;
+    uint32_t playlist_reads;   // Music_Playlist_Get() 调用次数
+} Gui_Host_Player;
+
+extern Gui_Host_Player gui_host_player;
+
+#endif /* GUI_HOST_PLAYER_H_ */
@@ -0,0 +1,185 @@
+/*
+ * gui_list_bench.c
+ * 在电脑上测量播放列表弹窗 (gui_music_player.c 的虚拟列表) 的打开、首帧和滚动开销
+ *
+ * 在空白屏幕上按曲目数依次打开列表弹窗 (播放界面的图标在 RLE 解码缓存中按需解压, 会混入堆占用), 统计:
+ *   build  list_event_cb() 创建弹窗的用时        frame  随后第一次整屏渲染的用时
+ *   reads  打开时的 Music_Playlist_Get() 次数    heap   弹窗占用的 LVGL 堆
+ * 然后上下各滚动 SCROLL_FRAMES 帧 (每帧 SCROLL_STEP 像素, 每帧渲染一次), 统计每帧用时 (平均 / 最大)
+ * 与每帧重新绑定的行数。用时是电脑上的, 只用于相对比较。
+ *
+ * 以下情况返回 1:
+ *   - 打开时读取的条目多于 SONG_LIST_POOL, 或弹窗的堆占用随曲目数增长 (超过 HEAP_SLACK)
+ *   - 滚动后堆占用增长超过 HEAP_SLACK (重新绑定行只改写标签文字)
+ *   - 某个可见行显示的不是它所在位置的曲目
+ *
+ * 编译: make (见 Makefile)
+ * 用法:
+ *   ./build/gui_list_bench [曲目数]...    默认 12 100 10000
+ */
+
+#include "gui_host.h"
+#include "gui_host_player.h"
+
+/* 被测代码: 直接包含, 以便调用 list_event_cb() 并检查列表的内部状态 */
+#include "../../Core/App/GUI/gui_music_player.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCROLL_FRAMES 120
+#define SCROLL_STEP 60
+#define HEAP_SLACK 1024  // 行文字长度不同, 标签占用的堆不完全相同
+
+typedef struct
+{
+    uint32_t count;
+    double build_ms;
+    double frame_ms;
+    uint32_t reads;
+    uint32_t heap;
+    double scroll_avg_ms;
+    double scroll_max_ms;
+    double rebinds;
+    int32_t heap_drift;
+    uint32_t wrong_rows;
+} List_Result;
+
+static double elapsed_ms(uint64_t t0)
+{
+    return (gui_host_now_ns() - t0) / 1e6;
+}
+
+/**
+ * @brief  Visible rows whose text does not match their list position
+ */
+static uint32_t check_rows(void)
+{
+    uint32_t wrong = 0;
+    char expect[80];
+
+    for (uint32_t i = 0; i < SONG_LIST_POOL; i++)
+    {
+        lv_obj_t *row = list_rows[i];
+        if (lv_obj_has_flag(row, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        uint32_t index = (uint32_t)(uintptr_t)lv_obj_get_user_data(row);
+        MusicSong_TypeDef song;
+        uint32_t reads = gui_host_player.playlist_reads;
+        Music_Playlist_Get(index, &song);
+        gui_host_player.playlist_reads = reads;
+        snprintf(expect, sizeof(expect), LV_SYMBOL_AUDIO " %s", song.name);
+
+        if (index % SONG_LIST_POOL != i || lv_obj_get_y(row) != (int32_t)(index * SONG_ROW_PITCH) ||
+            strcmp(lv_label_get_text(lv_obj_get_child(row, 0)), expect) != 0)
+        {
+            wrong++;
+        }
+    }
+    return wrong;
+}
+
+static void run_list(uint32_t count, List_Result *r)
+{
+    memset(r, 0, sizeof(*r));
+    r->count = count;
+    gui_host_player.song_count = count;
+    gui_host_player.current = count / 2;
+    gui_host_player.playlist_reads = 0;
+
+    // 打开: 与点击列表按钮相同
+    lv_obj_t *trigger = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(trigger, list_event_cb, LV_EVENT_CLICKED, NULL);
+    uint32_t heap0 = gui_host_heap_used();
+
+    uint64_t t0 = gui_host_now_ns();
+    lv_obj_send_event(trigger, LV_EVENT_CLICKED, NULL);
+    r->build_ms = elapsed_ms(t0);
+    r->reads = gui_host_player.playlist_reads;
+
+    t0 = gui_host_now_ns();
+    lv_refr_now(NULL);
+    r->frame_ms = elapsed_ms(t0);
+    r->heap = gui_host_heap_used() - heap0;
+    r->wrong_rows = check_rows();
+
+    // 滚动: 先向下再向上
+    uint32_t reads0 = gui_host_player.playlist_reads;
+    uint32_t heap1 = gui_host_heap_used();
+    double total = 0;
+    for (int i = 0; i < 2 * SCROLL_FRAMES; i++)
+    {
+        t0 = gui_host_now_ns();
+        lv_obj_scroll_by(list_cont, 0, (i < SCROLL_FRAMES) ? -SCROLL_STEP : SCROLL_STEP, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+        double ms = elapsed_ms(t0);
+
+        total += ms;
+        if (ms > r->scroll_max_ms) r->scroll_max_ms = ms;
+        r->wrong_rows += check_rows();
+    }
+    r->scroll_avg_ms = total / (2 * SCROLL_FRAMES);
+    r->rebinds = (double)(gui_host_player.playlist_reads - reads0) / (2 * SCROLL_FRAMES);
+    r->heap_drift = (int32_t)(gui_host_heap_used() - heap1);
+
+    lv_obj_delete(list_mask);
+    lv_obj_delete(trigger);
+    lv_refr_now(NULL);
+}
+
+int main(int argc, char **argv)
+{
+    static const uint32_t default_counts[] = {12, 100, 10000};
+    uint32_t counts[16];
+    uint32_t n = 0;
+    int failed = 0;
+
+    for (int i = 1; i < argc && n < 16; i++) counts[n++] = (uint32_t)strtoul(argv[i], NULL, 0);
+    if (n == 0)
+    {
+        memcpy(counts, default_counts, sizeof(default_counts));
+        n = sizeof(default_counts) / sizeof(default_counts[0]);
+    }
+
+    gui_host_init(0);
+    lv_refr_now(NULL);
+
+    printf("%7s %8s %8s %5s %7s %10s %10s %8s\n", "songs", "build ms", "frame ms", "reads", "heap B", "scroll avg",
+           "scroll max", "rebinds");
+    uint32_t heap_ref = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        List_Result r;
+        run_list(counts[i], &r);
+        printf("%7u %8.2f %8.2f %5u %7u %10.3f %10.3f %8.2f", r.count, r.build_ms, r.frame_ms, r.reads, r.heap,
+               r.scroll_avg_ms, r.scroll_max_ms, r.rebinds);
+
+        // 曲目数不少于一屏 + 余量时, 弹窗的堆占用不能随曲目数增长
+        int full = (r.count >= SONG_LIST_POOL);
+        if (full && heap_ref == 0) heap_ref = r.heap;
+        int ok = 1;
+        if (r.reads > SONG_LIST_POOL)
+        {
+            printf("  TOO MANY READS");
+            ok = 0;
+        }
+        if (full && r.heap > heap_ref + HEAP_SLACK)
+        {
+            printf("  HEAP DEPENDS ON COUNT");
+            ok = 0;
+        }
+        if (r.heap_drift > HEAP_SLACK)
+        {
+            printf("  HEAP DRIFT %d", r.heap_drift);
+            ok = 0;
+        }
+        if (r.wrong_rows)
+        {
+            printf("  %u WRONG ROWS", r.wrong_rows);
+            ok = 0;
+        }
+        printf("\n");
+        if (!ok) failed = 1;
+    }
+    return failed;
+}
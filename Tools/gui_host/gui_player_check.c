@@ -0,0 +1,239 @@
+/*
+ * gui_player_check.c
+ * 在电脑上检查播放界面的歌词和进度条只重绘必要的区域 (gui_music_player.c + music_lyric.c)
+ *
+ * 在临时目录中生成 LRC_LINES 行的歌词 (含一行多个时间标签、[offset:] 和结尾一行很长的无时间标签文字,
+ * 加载后检查 LVGL 堆完整, 无时间标签的文字不能写入歌词区), 打开播放界面, 以 STEP_MS 为步长
+ * 模拟播放一首 SONG_MS 的歌 (播放位置与系统节拍同步前进), 每一步之后检查刷新的区域:
+ *   - 所有刷新都必须落在歌词框、进度条或当前时间标签之内, 其他任何像素被刷新即失败
+ *   - 歌词框只在换行后的 LYRIC_SCROLL_MS + 两个刷新周期内刷新, 两次换行之间没有刷新
+ *   - 进度条每个像素变化重绘一次 (共 PROGRESS_W 次), 时间标签每秒一次, 总时长标签不变
+ * 然后向后定位 (不滚动, 直接切换), 检查歌词框最多刷新 SEEK_MAX_FRAMES 帧。
+ * 最后测量 Music_Lyric_Find() 的平均用时 (电脑上, 只用于相对比较)。
+ *
+ * 编译: make (见 Makefile)
+ * 用法:
+ *   ./build/gui_player_check [-v]    -v 打印每次换行的刷新统计
+ */
+
+#include "gui_host.h"
+#include "gui_host_player.h"
+#include "fatfs.h"
+#include "../../Core/Gui/lvgl/src/core/lv_obj_draw_private.h"
+
+/* 被测代码: 直接包含, 以便取得歌词框、进度条和时间标签的位置 */
+#include "../../Core/App/GUI/gui_music_player.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SONG_MS 200000U
+#define STEP_MS 10U  // 与 GUI 任务的循环周期相同
+#define LRC_LINES 198
+#define LRC_REPEAT_EVERY 20  // 每隔多少行有一行带两个时间标签 (副歌)
+#define LRC_OFFSET_MS 120
+#define LRC_TAIL_LEN 600  // 结尾无时间标签行的长度
+#define SEEK_TO_MS 50000U
+#define SEEK_MAX_FRAMES 2
+#define SETTLE_MS 1000U  // 打开界面后等待首帧、封面标签和歌词加载
+#define FIND_LOOKUPS 2000000U
+
+typedef struct
+{
+    uint32_t changes;       // 换行次数
+    uint32_t lyric_frames;  // 歌词框有刷新的步数
+    uint64_t lyric_pixels;
+    uint32_t lyric_stray;   // 换行窗口之外的歌词框刷新
+    uint32_t bar_frames;
+    uint64_t bar_pixels;
+    uint32_t time_frames;
+    uint64_t other_pixels;  // 允许区域之外的刷新像素
+} Play_Result;
+
+static int verbose = 0;
+
+/**
+ * @brief  Write <root>/music/song.lrc: LRC_LINES lines, 0.6~1.4 s apart
+ * @retval 时间标签数 (歌词索引应有的条数)
+ */
+static uint32_t write_lrc(void)
+{
+    char path[256];
+    uint32_t tags = 0;
+
+    snprintf(path, sizeof(path), "%s/music/song.lrc", gui_host_sd_root);
+    FILE *fp = fopen(path, "wb");
+    if (!fp) return 0;
+
+    uint32_t times[LRC_LINES];
+    uint32_t t = 1000;
+    for (uint32_t i = 0; i < LRC_LINES; i++)
+    {
+        times[i] = t;
+        t += 600 + (i * 37) % 800;
+    }
+
+    fprintf(fp, "\xEF\xBB\xBF[ti:Host Check]\n[ar:gui_host]\n[offset:%d]\n", LRC_OFFSET_MS);
+    for (uint32_t i = 0; i < LRC_LINES; i++)
+    {
+        fprintf(fp, "[%02u:%02u.%02u]", times[i] / 60000, times[i] / 1000 % 60, times[i] / 10 % 100);
+        tags++;
+        if (i % LRC_REPEAT_EVERY == LRC_REPEAT_EVERY - 1 && i + 2 < LRC_LINES)
+        {
+            // 同一行再出现一次: 放在后面两行之间, 排序后插在中间 (与相邻行至少相隔 300 ms, 大于查询周期)
+            uint32_t t2 = (times[i + 1] + times[i + 2]) / 2;
+            fprintf(fp, "[%02u:%02u.%02u]", t2 / 60000, t2 / 1000 % 60, t2 / 10 % 100);
+            tags++;
+        }
+        fprintf(fp, "line %03u %s\r\n", i, (i % 3) ? "lorem ipsum" : "dolor sit amet consectetur");
+    }
+    for (uint32_t i = 0; i < LRC_TAIL_LEN; i++) fputc('a' + i % 26, fp);
+    fputc('\n', fp);
+    fclose(fp);
+    return tags;
+}
+
+/**
+ * @brief  Area LVGL invalidates for obj: its coordinates plus the extra draw size (阴影、文字外沿等)
+ */
+static void get_area(lv_obj_t *obj, lv_area_t *area)
+{
+    int32_t ext = lv_obj_get_ext_draw_size(obj);
+
+    lv_obj_get_coords(obj, area);
+    lv_area_increase(area, ext, ext);
+}
+
+/**
+ * @brief  Pixels flushed inside `area` since the last gui_host_flush_reset()
+ */
+static uint64_t flushed_in(const lv_area_t *area)
+{
+    Gui_Host_Flush_Stats st;
+    gui_host_flush_get(&st);
+    return st.pixels - gui_host_flush_outside(area, 1);
+}
+
+static void play(uint32_t from_ms, uint32_t to_ms, const lv_area_t allowed[3], Play_Result *r)
+{
+    uint32_t window_end = 0;  // 歌词框可以刷新到这个时间 (节拍)
+    int32_t shown = lyric_index;
+    uint32_t changes_px = 0, change_frames = 0;
+
+    gui_host_player.position_ms = from_ms;
+    while (gui_host_player.position_ms < to_ms)
+    {
+        gui_host_flush_reset();
+        gui_host_player.position_ms += STEP_MS;
+        gui_host_advance(STEP_MS, STEP_MS);
+
+        if (lyric_index != shown)
+        {
+            if (verbose && r->changes)
+            {
+                printf("  line %3d at %6u ms: %u frames, %u px\n", (int)shown, gui_host_player.position_ms,
+                       change_frames, changes_px);
+            }
+            shown = lyric_index;
+            r->changes++;
+            window_end = gui_host_tick() + LYRIC_SCROLL_MS + 2 * LV_DEF_REFR_PERIOD;
+            changes_px = change_frames = 0;
+        }
+
+        uint64_t lyric = flushed_in(&allowed[0]);
+        uint64_t bar = flushed_in(&allowed[1]);
+        uint64_t time = flushed_in(&allowed[2]);
+        if (lyric)
+        {
+            r->lyric_frames++;
+            r->lyric_pixels += lyric;
+            changes_px += (uint32_t)lyric;
+            change_frames++;
+            if (gui_host_tick() > window_end) r->lyric_stray++;
+        }
+        if (bar)
+        {
+            r->bar_frames++;
+            r->bar_pixels += bar;
+        }
+        if (time) r->time_frames++;
+        r->other_pixels += gui_host_flush_outside(allowed, 3);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int failed = 0;
+
+    verbose = (argc > 1 && !strcmp(argv[1], "-v"));
+    if (!gui_host_sd_create("gui_player_check")) return 1;
+    uint32_t tags = write_lrc();
+
+    gui_host_init(0);
+    gui_host_player.song_count = 1;
+    gui_host_player.current = 0;
+    gui_host_player.current_name = "song";
+    gui_host_player.track_path = "song.mp3";
+    gui_host_player.duration_ms = SONG_MS;
+    gui_host_player.cover.id = 0;
+    snprintf(gui_host_player.cover.title, sizeof(gui_host_player.cover.title), "Host Check");
+    snprintf(gui_host_player.cover.artist, sizeof(gui_host_player.cover.artist), "gui_host");
+    gui_host_player.cover_seq = 1;
+
+    gui_music_player_open();
+    gui_host_advance(SETTLE_MS, STEP_MS);
+
+    // 允许刷新的区域: 歌词框、进度条、当前时间标签 (宽度按最宽的 "00:00" 之外再留余量, 数字宽度不同)
+    lv_area_t allowed[3];
+    get_area(lyric_box, &allowed[0]);
+    get_area(progress_bar, &allowed[1]);
+    get_area(label_curr_time, &allowed[2]);
+    allowed[2].x2 = allowed[2].x1 + 2 * lv_area_get_width(&allowed[2]);
+
+    printf("lyrics: %u tags in file, %u loaded; lyric box %dx%d, bar %dx%d\n", tags, Music_Lyric_GetCount(),
+           (int)lv_area_get_width(&allowed[0]), (int)lv_area_get_height(&allowed[0]),
+           (int)lv_area_get_width(&allowed[1]), (int)lv_area_get_height(&allowed[1]));
+
+    Play_Result r;
+    memset(&r, 0, sizeof(r));
+    play(0, SONG_MS, allowed, &r);
+
+    printf("play %u s in %u ms steps:\n", SONG_MS / 1000, STEP_MS);
+    printf("  line changes %u, lyric box flushed in %u steps (%.1f per change, %.0f px per change)\n", r.changes,
+           r.lyric_frames, r.changes ? (double)r.lyric_frames / r.changes : 0,
+           r.changes ? (double)r.lyric_pixels / r.changes : 0);
+    printf("  progress bar flushed in %u steps (every %.0f ms, %.0f px each), time label in %u steps\n",
+           r.bar_frames, r.bar_frames ? (double)SONG_MS / r.bar_frames : 0,
+           r.bar_frames ? (double)r.bar_pixels / r.bar_frames : 0, r.time_frames);
+
+    failed |= gui_host_check("lyrics loaded (one entry per time tag)", Music_Lyric_GetCount() == tags);
+    failed |= gui_host_check("LVGL heap intact after loading lyrics", lv_mem_test() == LV_RESULT_OK);
+    failed |= gui_host_check("every line shown (changes == entries)", r.changes == tags);
+    failed |= gui_host_check("nothing flushed outside lyric box / bar / time label", r.other_pixels == 0);
+    failed |= gui_host_check("lyric box flushed only while a line change scrolls", r.lyric_stray == 0);
+    failed |= gui_host_check("progress bar redraws once per pixel step",
+                             r.bar_frames + 1 >= PROGRESS_W && r.bar_frames <= PROGRESS_W);
+    failed |= gui_host_check("time label redraws once per second",
+                             r.time_frames + 1 >= SONG_MS / 1000 && r.time_frames <= SONG_MS / 1000);
+
+    // 定位: 直接切换, 不滚动
+    Play_Result s;
+    memset(&s, 0, sizeof(s));
+    play(SEEK_TO_MS, SEEK_TO_MS + LYRIC_POLL_MS + 2 * LV_DEF_REFR_PERIOD, allowed, &s);
+    printf("seek back to %u ms: lyric box flushed in %u steps\n", SEEK_TO_MS, s.lyric_frames);
+    failed |= gui_host_check("seek switches lines without scrolling",
+                             s.lyric_frames >= 1 && s.lyric_frames <= SEEK_MAX_FRAMES);
+
+    // 二分查找用时
+    uint64_t t0 = gui_host_now_ns();
+    volatile int32_t sink = 0;
+    for (uint32_t i = 0; i < FIND_LOOKUPS; i++) sink += Music_Lyric_Find((i * 7919U) % SONG_MS);
+    double ns = (double)(gui_host_now_ns() - t0) / FIND_LOOKUPS;
+    printf("Music_Lyric_Find: %.1f ns per lookup over %u entries (host)\n", ns, Music_Lyric_GetCount());
+
+    lv_obj_delete(scr_player);
+    failed |= gui_host_check("lyrics freed with the screen", Music_Lyric_GetCount() == 0 && lyric_timer == NULL);
+
+    gui_host_sd_remove();
+    return failed;
+}
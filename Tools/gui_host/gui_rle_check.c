@@ -0,0 +1,165 @@
+/*
+ * gui_rle_check.c
+ * 在电脑上检查 RLE 图标解码器 (gui_image_rle.c): 通过解码器绘制的画面与原始 RGB565 图逐像素一致
+ *
+ * 参考图不经过被测解码器: 按 gui_image_rle.h 中的格式说明在这里单独解压成普通的 RGB565 图片。
+ * 把 Res 中全部 RLE 图标放在屏幕上 (部分超出屏幕边缘), 用 BUF_ROWS 行的渲染缓冲分块渲染,
+ * 先用参考图绘制整屏, 再用 RLE 图标绘制整屏, 两次的画面必须完全相同。共绘制 PASSES 遍:
+ * 第一遍整张解压进缓存 (未命中), 之后命中缓存; 大于 GUI_IMAGE_RLE_CACHE_MAX 的图标
+ * (camera_icon, 80x80) 每次都流式解码。最后检查三种情况都出现过。
+ *
+ * 编译: make (见 Makefile)
+ * 用法:
+ *   ./build/gui_rle_check
+ */
+
+#include "gui_host.h"
+#include "../../Core/App/GUI/gui_image_rle.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUF_ROWS 5  // 比图标行数和流式解码的条带 (GUI_IMAGE_RLE_STRIPE_ROWS) 都小
+#define PASSES 2
+#define BG_COLOR 0x203040
+
+LV_IMG_DECLARE(camera_icon);
+LV_IMG_DECLARE(back_btn);
+LV_IMG_DECLARE(music_list);
+LV_IMG_DECLARE(next_btn);
+LV_IMG_DECLARE(pause_btn);
+LV_IMG_DECLARE(play_music_btn);
+LV_IMG_DECLARE(previous_btn);
+LV_IMG_DECLARE(setting_btn);
+
+typedef struct
+{
+    const char *name;
+    const lv_image_dsc_t *rle;
+    int32_t x, y;  // 屏幕上的位置, 有的超出边缘
+} Icon;
+
+static const Icon icons[] = {
+    {"camera_icon", &camera_icon, -30, 3},       {"back_btn", &back_btn, 100, 100},
+    {"music_list", &music_list, 450, 200},       {"next_btn", &next_btn, 200, 400},
+    {"pause_btn", &pause_btn, 300, 600},         {"play_music_btn", &play_music_btn, 10, 770},
+    {"previous_btn", &previous_btn, 240, 241},   {"setting_btn", &setting_btn, 60, 300},
+};
+#define ICON_COUNT (sizeof(icons) / sizeof(icons[0]))
+
+static lv_image_dsc_t ref[ICON_COUNT];
+static uint16_t screen_ref[GUI_HOST_HOR_RES * GUI_HOST_VER_RES];
+
+/**
+ * @brief  Decode an RLE image into a plain RGB565 image (与被测解码器无关的参考实现)
+ * @retval 0: 成功, -1: 数据格式错误
+ */
+static int ref_decode(const lv_image_dsc_t *src, lv_image_dsc_t *dst)
+{
+    uint32_t w = src->header.w, h = src->header.h;
+    const uint16_t *in = (const uint16_t *)src->data;
+    uint32_t len = src->data_size / 2;
+    uint16_t *out = malloc(w * h * 2);
+
+    if (!out || !(src->header.flags & GUI_IMAGE_RLE_FLAG)) return -1;
+    for (uint32_t y = 0; y < h; y++)
+    {
+        uint32_t pos = in[y];
+        uint32_t x = 0;
+        while (x < w)
+        {
+            if (pos >= len) return -1;
+            uint16_t ctrl = in[pos++];
+            uint32_t count = ctrl & 0x7FFF;
+            if (count == 0 || x + count > w) return -1;
+            if (ctrl & 0x8000)
+            {
+                if (pos >= len) return -1;
+                for (uint32_t i = 0; i < count; i++) out[y * w + x++] = in[pos];
+                pos++;
+            }
+            else
+            {
+                if (pos + count > len) return -1;
+                for (uint32_t i = 0; i < count; i++) out[y * w + x++] = in[pos++];
+            }
+        }
+    }
+
+    memset(dst, 0, sizeof(*dst));
+    dst->header.magic = LV_IMAGE_HEADER_MAGIC;
+    dst->header.cf = LV_COLOR_FORMAT_RGB565;
+    dst->header.w = w;
+    dst->header.h = h;
+    dst->header.stride = w * 2;
+    dst->data_size = w * h * 2;
+    dst->data = (const uint8_t *)out;
+    return 0;
+}
+
+static void draw_all(lv_obj_t *img[], int use_ref)
+{
+    for (uint32_t i = 0; i < ICON_COUNT; i++) lv_image_set_src(img[i], use_ref ? &ref[i] : icons[i].rle);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+int main(void)
+{
+    lv_obj_t *img[ICON_COUNT];
+    uint32_t rle_bytes = 0, raw_bytes = 0;
+    int failed = 0;
+
+    gui_host_init(BUF_ROWS);
+    lv_obj_t *scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(BG_COLOR), 0);
+
+    for (uint32_t i = 0; i < ICON_COUNT; i++)
+    {
+        const lv_image_dsc_t *rle = icons[i].rle;
+        if (ref_decode(rle, &ref[i]) != 0)
+        {
+            printf("%s: bad RLE data\n", icons[i].name);
+            return 1;
+        }
+        printf("  %-16s %3dx%-3d %6u -> %5u bytes (%s)\n", icons[i].name, (int)rle->header.w, (int)rle->header.h,
+               ref[i].data_size, rle->data_size, ref[i].data_size > GUI_IMAGE_RLE_CACHE_MAX ? "stream" : "cache");
+        rle_bytes += rle->data_size;
+        raw_bytes += ref[i].data_size;
+
+        img[i] = lv_image_create(scr);
+        lv_obj_set_pos(img[i], icons[i].x, icons[i].y);
+    }
+    printf("%u icons: %u -> %u bytes, rendered with %d-row buffer\n", (unsigned)ICON_COUNT, raw_bytes, rle_bytes,
+           BUF_ROWS);
+
+    uint32_t diff_total = 0;
+    Gui_Image_Rle_Stats first = {0};
+    for (int pass = 0; pass < PASSES; pass++)
+    {
+        draw_all(img, 1);
+        memcpy(screen_ref, gui_host_fb, sizeof(screen_ref));
+        draw_all(img, 0);
+
+        uint32_t diff = 0;
+        for (uint32_t i = 0; i < GUI_HOST_HOR_RES * GUI_HOST_VER_RES; i++) diff += (gui_host_fb[i] != screen_ref[i]);
+        diff_total += diff;
+
+        Gui_Image_Rle_Stats st;
+        gui_image_rle_get_stats(&st);
+        if (pass == 0) first = st;
+        printf("pass %d: %u px differ; hits %u, misses %u, streams %u, cache %u B\n", pass, diff, st.hits, st.misses,
+               st.streams, st.cache_bytes);
+    }
+
+    Gui_Image_Rle_Stats st;
+    gui_image_rle_get_stats(&st);
+    failed |= gui_host_check("screen identical to the reference decode", diff_total == 0);
+    failed |= gui_host_check("first pass decodes small icons into the cache", first.misses > 0);
+    failed |= gui_host_check("later passes hit the cache", st.hits > first.hits);
+    failed |= gui_host_check("large icon is streamed", st.streams > 0);
+
+    for (uint32_t i = 0; i < ICON_COUNT; i++) free((void *)ref[i].data);
+    return failed;
+}
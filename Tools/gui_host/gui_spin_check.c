@@ -0,0 +1,177 @@
+/*
+ * gui_spin_check.c
+ * 在电脑上检查旋转封面图标的预旋转帧缓存 (gui_cover_spin.c): 画面与 LVGL 自己的旋转比较, 并统计重绘
+ *
+ * 1. 对 ANGLES 中的每个角度, 分别用 lv_image_set_rotation() (量化后的角度) 和帧缓存显示图标,
+ *    比较两者在图标内切圆内部 (去掉抗锯齿的边缘) 的差别, 以 5 位分量的级数计算 RMS,
+ *    超过 RMS_MAX 即失败。差别主要来自 LVGL 的旋转中心在 w/2 而不是像素中心。
+ * 2. 模拟 ANIM_FRAMES 个 GUI 刷新周期 (每周期 FRAME_MS, 转速与播放界面相同: 一圈 10 s),
+ *    分别统计帧缓存和 lv_image_set_rotation() 的重绘次数与刷新像素数。
+ *    帧缓存的重绘次数不能超过经过的角度级数 + 1, 刷新像素数必须少于 LVGL 旋转。
+ * 用时是电脑上的, 只用于相对比较。
+ *
+ * 编译: make (见 Makefile)
+ * 用法:
+ *   ./build/gui_spin_check
+ */
+
+#include "gui_host.h"
+
+/* 被测代码: 直接包含, 以便单独测量生成一帧的用时 */
+#include "../../Core/App/GUI/gui_cover_spin.c"
+
+#include <math.h>
+#include <stdio.h>
+
+#define ICON_Y 160
+#define FRAME_MS 33        // 与 LV_DEF_REFR_PERIOD 相同
+#define ANIM_FRAMES 300    // 约 10 s, 一圈
+#define ANIM_STEP 12       // 每帧转过的角度 (0.1 度), 3600 / ANIM_FRAMES
+#define RMS_MAX 3.5        // 5 位分量的级数
+#define EDGE_PX 3          // 不比较的边缘宽度 (抗锯齿与裁剪)
+#define BUILD_REPEAT 100
+
+LV_IMG_DECLARE(music_player);
+
+typedef struct
+{
+    uint32_t redraws;  // 有刷新的周期数
+    uint64_t pixels;
+} Anim_Result;
+
+static const int32_t angles[] = {0, 450, 900, 1234, 2700, 3500};
+
+/**
+ * @brief  Copy the icon's screen area out of the frame buffer
+ */
+static void grab(const lv_area_t *area, uint16_t *out)
+{
+    int32_t w = lv_area_get_width(area);
+
+    for (int32_t y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(out, &gui_host_fb[y * GUI_HOST_HOR_RES + area->x1], w * sizeof(uint16_t));
+        out += w;
+    }
+}
+
+/**
+ * @brief  RMS difference inside the inscribed circle, in 5-bit levels (绿色按 6 位的一半计算)
+ */
+static double rms_diff(const uint16_t *a, const uint16_t *b, int32_t n)
+{
+    int32_t r = n - 2 * EDGE_PX;
+    double sum = 0;
+    uint32_t count = 0;
+
+    for (int32_t y = 0; y < n; y++)
+    {
+        for (int32_t x = 0; x < n; x++)
+        {
+            int32_t dx = 2 * x - (n - 1), dy = 2 * y - (n - 1);
+            if (dx * dx + dy * dy > r * r) continue;
+
+            uint16_t p = a[y * n + x], q = b[y * n + x];
+            int32_t er = (p >> 11) - (q >> 11);
+            int32_t eg = ((p >> 5) & 63) / 2 - ((q >> 5) & 63) / 2;
+            int32_t eb = (p & 31) - (q & 31);
+            sum += er * er + eg * eg + eb * eb;
+            count++;
+        }
+    }
+    return count ? sqrt(sum / count / 3) : 0;
+}
+
+static void animate(lv_obj_t *img, int spin, Anim_Result *r)
+{
+    memset(r, 0, sizeof(*r));
+    for (int32_t f = 1; f <= ANIM_FRAMES; f++)
+    {
+        Gui_Host_Flush_Stats st;
+
+        gui_host_flush_reset();
+        if (spin) gui_cover_spin_set_angle(f * ANIM_STEP);
+        else lv_image_set_rotation(img, f * ANIM_STEP);
+        gui_host_advance(FRAME_MS, FRAME_MS);
+        gui_host_flush_get(&st);
+        if (st.pixels) r->redraws++;
+        r->pixels += st.pixels;
+    }
+}
+
+int main(void)
+{
+    static uint16_t ref[80 * 80], out[80 * 80];
+    int32_t n = music_player.header.w;
+    int failed = 0;
+
+    if (n > 80)
+    {
+        printf("icon too large: %d\n", (int)n);
+        return 1;
+    }
+
+    gui_host_init(0);
+    lv_obj_t *img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &music_player);
+    lv_obj_align(img, LV_ALIGN_TOP_MID, 0, ICON_Y);
+    lv_refr_now(NULL);
+
+    lv_area_t area;
+    lv_obj_get_coords(img, &area);
+
+    // 1. 画面
+    printf("icon %dx%d, %d angle steps\n", (int)n, (int)n, GUI_COVER_SPIN_FRAMES);
+    double rms_max = 0;
+    for (uint32_t i = 0; i < sizeof(angles) / sizeof(angles[0]); i++)
+    {
+        int32_t step = ((angles[i] * GUI_COVER_SPIN_FRAMES + 1800) / 3600) % GUI_COVER_SPIN_FRAMES;
+        lv_image_set_rotation(img, step * 3600 / GUI_COVER_SPIN_FRAMES);
+        lv_refr_now(NULL);
+        grab(&area, ref);
+
+        lv_image_set_rotation(img, angles[i]);
+        if (!gui_cover_spin_start(img, &music_player))
+        {
+            printf("gui_cover_spin_start failed\n");
+            return 1;
+        }
+        lv_refr_now(NULL);
+        grab(&area, out);
+
+        uint64_t t0 = gui_host_now_ns();
+        for (int k = 0; k < BUILD_REPEAT; k++) spin_build(&spin_slot[0], (int16_t)step);
+        double build_ms = (gui_host_now_ns() - t0) / 1e6 / BUILD_REPEAT;
+
+        double rms = rms_diff(ref, out, n);
+        if (rms > rms_max) rms_max = rms;
+        printf("  angle %4d (step %2d): rms %.2f levels, build %.3f ms (host)\n", (int)angles[i], (int)step, rms,
+               build_ms);
+        gui_cover_spin_stop();
+        lv_image_set_rotation(img, 0);
+    }
+    failed |= gui_host_check("frames match lv_image_set_rotation (rms <= RMS_MAX)", rms_max <= RMS_MAX);
+
+    // 2. 重绘
+    Anim_Result spin, lvgl;
+    memset(&spin_stats, 0, sizeof(spin_stats));  // 不计上面单独测量的生成次数
+    gui_cover_spin_start(img, &music_player);
+    lv_refr_now(NULL);
+    animate(img, 1, &spin);
+    Gui_Cover_Spin_Stats st;
+    gui_cover_spin_get_stats(&st);
+    gui_cover_spin_stop();
+    lv_image_set_rotation(img, 0);
+    lv_refr_now(NULL);
+    animate(img, 0, &lvgl);
+
+    printf("%d frames of %d ms, %d.%d degrees each:\n", ANIM_FRAMES, FRAME_MS, ANIM_STEP / 10, ANIM_STEP % 10);
+    printf("  frame cache            %4u redraws, %8llu px (%u slots, builds %u, hits %u)\n", spin.redraws,
+           (unsigned long long)spin.pixels, st.slots, st.builds, st.hits);
+    printf("  lv_image_set_rotation  %4u redraws, %8llu px\n", lvgl.redraws, (unsigned long long)lvgl.pixels);
+
+    uint32_t steps = ANIM_FRAMES * ANIM_STEP * GUI_COVER_SPIN_FRAMES / 3600;
+    failed |= gui_host_check("frame cache redraws only when the angle step changes", spin.redraws <= steps + 1);
+    failed |= gui_host_check("frame cache flushes fewer pixels than LVGL rotation", spin.pixels < lvgl.pixels);
+    return failed;
+}
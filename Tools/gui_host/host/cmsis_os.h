@@ -0,0 +1,46 @@
+/*
+ * cmsis_os.h (电脑端替身)
+ * 只声明 GUI 与封面代码用到的 CMSIS-RTOS2 接口, 实现在 gui_host.c:
+ * 电脑上没有其他任务, 消息只计数不发送, 系统节拍由测试程序推进 (gui_host_advance())。
+ */
+
+#ifndef GUI_HOST_CMSIS_OS_H_
+#define GUI_HOST_CMSIS_OS_H_
+
+#include <stdint.h>
+
+typedef void *osMessageQueueId_t;
+typedef void *osThreadId_t;
+typedef void *osMutexId_t;
+typedef void *osSemaphoreId_t;
+typedef void (*osThreadFunc_t)(void *argument);
+
+typedef enum
+{
+    osOK = 0,
+    osError = -1,
+} osStatus_t;
+
+typedef enum
+{
+    osPriorityLow = 8,
+    osPriorityNormal = 24,
+} osPriority_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t stack_size;
+    osPriority_t priority;
+} osThreadAttr_t;
+
+#define osWaitForever 0xFFFFFFFFU
+#define osFlagsWaitAny 0x00000000U
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout);
+uint32_t osKernelGetTickCount(void);
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+#endif /* GUI_HOST_CMSIS_OS_H_ */
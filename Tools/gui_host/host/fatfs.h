@@ -0,0 +1,117 @@
+/*
+ * fatfs.h (电脑端替身)
+ * 播放器代码用到的 FatFs 接口映射到 stdio: 路径开头的 "0:" 换成 gui_host_sd_root (模拟 SD 卡的目录)
+ */
+
+#ifndef GUI_HOST_FATFS_H_
+#define GUI_HOST_FATFS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+typedef unsigned int UINT;
+typedef uint8_t BYTE;
+typedef uint32_t DWORD;
+typedef uint32_t FSIZE_t;
+
+typedef enum
+{
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_NO_FILE = 4,
+    FR_EXIST = 8,
+} FRESULT;
+
+typedef struct
+{
+    FILE *fp;
+} FIL;
+
+typedef struct
+{
+    FSIZE_t fsize;
+} FILINFO;
+
+#define FA_READ 0x01
+#define FA_WRITE 0x02
+#define FA_CREATE_ALWAYS 0x08
+
+extern const char *gui_host_sd_root;  // 模拟 SD 卡根目录 ("0:" 对应的电脑目录)
+
+/**
+ * @brief  "0:/music/a.lrc" -> "<gui_host_sd_root>/music/a.lrc" (两个缓冲轮流使用, 供 f_rename 同时转换两个路径)
+ */
+static inline const char *host_path(const char *path)
+{
+    static char buf[2][512];
+    static int next = 0;
+
+    next ^= 1;
+    if (path[0] == '0' && path[1] == ':') path += 2;
+    snprintf(buf[next], sizeof(buf[next]), "%s%s", gui_host_sd_root, path);
+    return buf[next];
+}
+
+static inline FRESULT f_open(FIL *fil, const char *path, BYTE mode)
+{
+    fil->fp = fopen(host_path(path), (mode & FA_WRITE) ? "wb" : "rb");
+    return fil->fp ? FR_OK : FR_NO_FILE;
+}
+
+static inline FRESULT f_close(FIL *fil)
+{
+    int err = fil->fp ? fclose(fil->fp) : 0;
+    fil->fp = NULL;
+    return err ? FR_DISK_ERR : FR_OK;
+}
+
+static inline FRESULT f_read(FIL *fil, void *buff, UINT btr, UINT *br)
+{
+    *br = (UINT)fread(buff, 1, btr, fil->fp);
+    return ferror(fil->fp) ? FR_DISK_ERR : FR_OK;
+}
+
+static inline FRESULT f_write(FIL *fil, const void *buff, UINT btw, UINT *bw)
+{
+    *bw = (UINT)fwrite(buff, 1, btw, fil->fp);
+    return ferror(fil->fp) ? FR_DISK_ERR : FR_OK;
+}
+
+static inline FRESULT f_lseek(FIL *fil, FSIZE_t ofs)
+{
+    return fseek(fil->fp, (long)ofs, SEEK_SET) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+static inline FSIZE_t f_tell(FIL *fil)
+{
+    return (FSIZE_t)ftell(fil->fp);
+}
+
+static inline FRESULT f_stat(const char *path, FILINFO *fno)
+{
+    struct stat st;
+
+    if (stat(host_path(path), &st) != 0) return FR_NO_FILE;
+    fno->fsize = (FSIZE_t)st.st_size;
+    return FR_OK;
+}
+
+static inline FRESULT f_mkdir(const char *path)
+{
+    return mkdir(host_path(path), 0777) == 0 ? FR_OK : FR_EXIST;
+}
+
+static inline FRESULT f_unlink(const char *path)
+{
+    return remove(host_path(path)) == 0 ? FR_OK : FR_NO_FILE;
+}
+
+static inline FRESULT f_rename(const char *path_old, const char *path_new)
+{
+    const char *from = host_path(path_old);
+    const char *to = host_path(path_new);
+    return rename(from, to) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+#endif /* GUI_HOST_FATFS_H_ */
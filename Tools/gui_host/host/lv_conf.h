@@ -0,0 +1,21 @@
+/*
+ * lv_conf.h (电脑端)
+ * 使用固件的 LVGL 配置 (Core/Gui/lv_conf.h), 只改掉电脑上没有的部分:
+ *   LV_USE_OS        不使用 FreeRTOS, 所有代码在一个线程中运行
+ *   LV_USE_FS_FATFS  没有 FatFs 驱动, 封面缩略图 ("S:" 路径) 在电脑上不显示
+ * 堆大小、颜色格式、字体、缓存等保持与固件相同, 测得的 LVGL 堆用量可以直接与板上比较
+ * (64 位电脑上指针更大, 是上限)。
+ */
+
+#ifndef GUI_HOST_LV_CONF_H_
+#define GUI_HOST_LV_CONF_H_
+
+#include "../../../Core/Gui/lv_conf.h"
+
+#undef LV_USE_OS
+#define LV_USE_OS LV_OS_NONE
+
+#undef LV_USE_FS_FATFS
+#define LV_USE_FS_FATFS 0
+
+#endif /* GUI_HOST_LV_CONF_H_ */
@@ -0,0 +1,270 @@
+/*
+ * helix_bench.c
+ * 在电脑上测量 MP3 解码速度、各阶段用时和输出 PCM 校验和
+ *
+ * 默认走播放器的解码路径: Audio_Decoder_MP3 (codec_mp3.c + mp3_decoder.c + Helix), 文件通过 host_stream.c
+ * (stream_reader 接口的 stdio 实现) 读取, 输出与板上 decode_frame() 写入环形缓冲区的数据相同
+ * (已裁剪编码器延迟和结尾填充)。-r 改用 helix_mp3.c 直接解码 (fread, 不裁剪), 作为对照。
+ *
+ * 计时用 CLOCK_MONOTONIC; 各阶段用时来自 Helix 的 MP3GetStageStats(), 电脑上以纳秒计
+ * (mp3dec.c 中 HELIX_STAGE_PROFILE 在没有 USE_HAL_DRIVER 时使用单调时钟)。
+ * 校验和与 audio_decoder.c 的 AUDIO_DEC_PCM_CHECKSUM 相同 (FNV-1a, 每个左右声道对 32 位),
+ * 可以直接和板上打开该开关后 Audio_Decoder_GetChecksum() 的结果比较。
+ * 只比较同一平台上修改前后的结果时, 逐文件对比输出的 crc 列即可。
+ *
+ * 编译:
+ *   gcc -O2 -Ihost -I../../Core/App/Player -I../../Core/App/Player/helix helix_bench.c host_stream.c \
+ *       ../../Core/App/Player/codec_mp3.c ../../Core/App/Player/mp3_decoder.c ../../Core/App/Player/codec_mem.c \
+ *       ../../Core/App/Player/helix/[a-z]*.c -o helix_bench
+ * 用法:
+ *   ./helix_bench [-r] <目录或 .mp3 文件>...
+ *   没有 MP3 文件时可以用 mp3_gen 生成合成码流
+ */
+
+#include <ctype.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "audio_decoder.h"
+#include "codec_mem.h"
+#include "helix_mp3.h"
+#include "host_stream.h"
+#include "mp3dec.h"
+
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+#define BLOCK_SAMPLES 2304  // 与 music_player.c 的 PCM_RING_BLOCK_SAMPLES 相同
+#define MAX_FILES 4096
+
+typedef struct
+{
+    uint64_t frames;                   // 解码的 MP3 帧数
+    uint64_t samples;                  // 输出的采样数 (每声道)
+    uint64_t sample_ns;                // 输出采样对应的播放时长 (ns)
+    uint64_t decode_ns;                // 解码总用时
+    uint64_t stage_ns[MP3_STAGE_COUNT];
+} Bench_Result;
+
+static const char *const stage_names[MP3_STAGE_COUNT] = {"side", "sf", "huff", "dequant", "imdct", "subband"};
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t fnv_pairs(uint32_t h, const int16_t *pcm, int samples)
+{
+    const uint32_t *p = (const uint32_t *)pcm;
+    for (int i = 0; i < samples / 2; i++) h = (h ^ p[i]) * FNV_PRIME;
+    return h;
+}
+
+/**
+ * @brief  Move Helix's 32-bit stage counters into the result (读取后清零, 避免纳秒计数回绕)
+ */
+static void collect_stages(Bench_Result *r)
+{
+    MP3StageStats s;
+
+    MP3GetStageStats(&s);
+    MP3ResetStageStats();
+    r->frames += s.frames;
+    for (int i = 0; i < MP3_STAGE_COUNT; i++) r->stage_ns[i] += s.cycles[i];
+}
+
+/**
+ * @brief  Decode through codec_mp3.c, the same calls the audio task makes
+ */
+static int bench_player(const char *path, Bench_Result *r, uint32_t *crc)
+{
+    static int16_t block[BLOCK_SAMPLES];
+    Audio_Info info;
+
+    Codec_Mem_Reset();
+    if (Stream_Open(path) != FR_OK) return -1;
+    if (Audio_Decoder_MP3.open(&info) != 0)
+    {
+        Stream_Close();
+        return -1;
+    }
+
+    MP3ResetStageStats();
+    while (1)
+    {
+        uint64_t t0 = now_ns();
+        int n = Audio_Decoder_MP3.decode_frame(block, BLOCK_SAMPLES);
+        r->decode_ns += now_ns() - t0;
+
+        collect_stages(r);
+        if (n == AUDIO_DEC_EOF) break;
+        if (n <= 0) continue;
+
+        r->samples += n / 2;
+        *crc = fnv_pairs(*crc, block, n);
+    }
+    r->sample_ns = r->samples * 1000000000U / info.sample_rate;
+
+    Audio_Decoder_MP3.close();
+    Stream_Close();
+    return 0;
+}
+
+static int file_seek(void *user_data, int offset)
+{
+    return fseek(user_data, offset, SEEK_SET);
+}
+
+static size_t file_read(void *user_data, void *buffer, size_t size)
+{
+    return fread(buffer, 1, size, user_data);
+}
+
+/**
+ * @brief  Decode through helix_mp3.c with plain fread I/O
+ */
+static int bench_raw(const char *path, Bench_Result *r, uint32_t *crc)
+{
+    static int16_t pcm[BLOCK_SAMPLES];
+    helix_mp3_t mp3;
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return -1;
+
+    helix_mp3_io_t io = {.seek = file_seek, .read = file_read, .user_data = fp};
+    Codec_Mem_Reset();
+    if (helix_mp3_init(&mp3, &io) != 0)
+    {
+        fclose(fp);
+        return -1;
+    }
+
+    MP3ResetStageStats();
+    while (1)
+    {
+        uint64_t t0 = now_ns();
+        size_t frames = helix_mp3_read_pcm_frames_s16(&mp3, pcm, BLOCK_SAMPLES / 2);
+        r->decode_ns += now_ns() - t0;
+
+        collect_stages(r);
+        if (frames == 0) break;
+
+        r->samples += frames;
+        *crc = fnv_pairs(*crc, pcm, (int)frames * 2);
+    }
+    if (helix_mp3_get_sample_rate(&mp3)) r->sample_ns = r->samples * 1000000000U / helix_mp3_get_sample_rate(&mp3);
+
+    helix_mp3_deinit(&mp3);
+    fclose(fp);
+    return 0;
+}
+
+static void print_result(const char *name, const Bench_Result *r, uint32_t crc)
+{
+    double sec = r->decode_ns / 1e9;
+
+    printf("%-32s %7llu %9.0f %7.1f ", name, (unsigned long long)r->frames, sec > 0 ? r->frames / sec : 0,
+           r->decode_ns ? (double)r->sample_ns / r->decode_ns : 0);
+    for (int i = 0; i < MP3_STAGE_COUNT; i++)
+    {
+        printf("%8.2f", r->frames ? r->stage_ns[i] / 1e3 / r->frames : 0);
+    }
+    printf("  %08x\n", crc);
+}
+
+static int has_mp3_ext(const char *name)
+{
+    const char *dot = strrchr(name, '.');
+    return dot && tolower((unsigned char)dot[1]) == 'm' && tolower((unsigned char)dot[2]) == 'p' && dot[3] == '3' &&
+           dot[4] == '\0';
+}
+
+static int cmp_str(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/**
+ * @brief  Collect .mp3 files from a directory (不递归) or take a file argument as is
+ */
+static int collect_files(const char *arg, char **files, int count)
+{
+    struct stat st;
+    if (stat(arg, &st) != 0) return count;
+
+    if (!S_ISDIR(st.st_mode))
+    {
+        if (count < MAX_FILES) files[count++] = strdup(arg);
+        return count;
+    }
+
+    DIR *dir = opendir(arg);
+    struct dirent *e;
+    int first = count;
+    while (dir && (e = readdir(dir)) != NULL && count < MAX_FILES)
+    {
+        if (!has_mp3_ext(e->d_name)) continue;
+
+        files[count] = malloc(strlen(arg) + strlen(e->d_name) + 2);
+        sprintf(files[count++], "%s/%s", arg, e->d_name);
+    }
+    if (dir) closedir(dir);
+    qsort(files + first, count - first, sizeof(char *), cmp_str);
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    static char *files[MAX_FILES];
+    int count = 0, raw = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-r")) raw = 1;
+        else count = collect_files(argv[i], files, count);
+    }
+    if (count == 0)
+    {
+        fprintf(stderr, "usage: %s [-r] <dir|file.mp3>...\n", argv[0]);
+        return 1;
+    }
+
+    Stream_Init();
+    printf("%-32s %7s %9s %7s ", raw ? "file (helix_mp3)" : "file (codec_mp3)", "frames", "frames/s", "xRT");
+    for (int i = 0; i < MP3_STAGE_COUNT; i++) printf("%8s", stage_names[i]);
+    printf("  crc  (阶段用时: us/帧)\n");
+
+    Bench_Result total = {0};
+    int failed = 0;
+    for (int i = 0; i < count; i++)
+    {
+        Bench_Result r = {0};
+        uint32_t crc = FNV_OFFSET_BASIS;
+        const char *name = strrchr(files[i], '/') ? strrchr(files[i], '/') + 1 : files[i];
+
+        if ((raw ? bench_raw(files[i], &r, &crc) : bench_player(files[i], &r, &crc)) != 0)
+        {
+            printf("%-32s open failed\n", name);
+            failed++;
+            continue;
+        }
+        print_result(name, &r, crc);
+
+        total.frames += r.frames;
+        total.samples += r.samples;
+        total.sample_ns += r.sample_ns;
+        total.decode_ns += r.decode_ns;
+        for (int s = 0; s < MP3_STAGE_COUNT; s++) total.stage_ns[s] += r.stage_ns[s];
+    }
+
+    printf("%-32s %7llu %9.0f %7.1f ", "total", (unsigned long long)total.frames,
+           total.decode_ns ? total.frames / (total.decode_ns / 1e9) : 0,
+           total.decode_ns ? (double)total.sample_ns / total.decode_ns : 0);
+    for (int s = 0; s < MP3_STAGE_COUNT; s++) printf("%8.2f", total.frames ? total.stage_ns[s] / 1e3 / total.frames : 0);
+    printf("\n");
+    return failed ? 1 : 0;
+}
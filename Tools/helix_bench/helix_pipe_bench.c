@@ -0,0 +1,262 @@
+/*
+ * helix_pipe_bench.c
+ * 在电脑上比较 Helix 两级解码 (MP3DecodeEntropy / MP3DecodeSynthesis) 串行执行和双线程流水执行的速度
+ *
+ * 串行: 同一线程依次调用两级, 使用解码器自带的交接缓冲 (与 MP3Decode() 相同), 分别计时两级的用时。
+ * 流水: 主线程做熵解码, 写入两个 MP3AllocFrameData() 交接缓冲中空闲的一个; 合成线程按帧序取出交接缓冲,
+ *       做 IMDCT + 多相滤波后释放, 熵解码第 n+1 帧与合成第 n 帧同时进行。
+ * 两种方式输出的 PCM 校验和 (FNV-1a, 与 helix_bench 相同) 必须一致, 不一致时返回 1:
+ * 这同时检查了合成级确实只读交接缓冲, 没有读到熵解码级正在改写的状态。
+ * 理论加速比为 (熵解码 + 合成) / max(熵解码, 合成), 由串行计时算出, 与实测值一起输出。
+ *
+ * 文件整个读入内存后再解码, 不计 I/O。两个线程会同时累加 Helix 的阶段计数器, 所以编译时关闭
+ * HELIX_STAGE_PROFILE; 各阶段用时用 helix_bench 测量。
+ *
+ * 编译:
+ *   gcc -O2 -pthread -DHELIX_STAGE_PROFILE=0 -Ihost -I../../Core/App/Player -I../../Core/App/Player/helix \
+ *       helix_pipe_bench.c ../../Core/App/Player/codec_mem.c ../../Core/App/Player/helix/[a-z]*.c -o helix_pipe_bench
+ * 用法:
+ *   ./helix_pipe_bench <file.mp3>...
+ */
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "codec_mem.h"
+#include "mp3dec.h"
+
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+#define PIPE_DEPTH 2  // 交接缓冲个数 (双缓冲)
+#define MAX_FRAME_SAMPLES (MAX_NCHAN * MAX_NGRAN * MAX_NSAMP)
+
+typedef struct
+{
+    HMP3FrameData data;
+    int samples;  // 本帧输出的采样数, 0 表示流结束
+} Pipe_Slot;
+
+typedef struct
+{
+    HMP3Decoder dec;
+    Pipe_Slot slot[PIPE_DEPTH];
+    sem_t full;   // 已熵解码、等待合成的交接缓冲数
+    sem_t empty;  // 空闲的交接缓冲数
+    uint32_t crc;
+    uint32_t frames;
+    int error;
+} Pipe;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t fnv_pairs(uint32_t h, const short *pcm, int samples)
+{
+    for (int i = 0; i + 1 < samples; i += 2)
+    {
+        h = (h ^ ((uint32_t)(uint16_t)pcm[i] | ((uint32_t)(uint16_t)pcm[i + 1] << 16))) * FNV_PRIME;
+    }
+    return h;
+}
+
+/**
+ * @brief  Skip an ID3v2 tag at the start of the file
+ */
+static int id3_size(const uint8_t *p, long len)
+{
+    if (len < 10 || memcmp(p, "ID3", 3) != 0) return 0;
+    return 10 + (((p[6] & 0x7F) << 21) | ((p[7] & 0x7F) << 14) | ((p[8] & 0x7F) << 7) | (p[9] & 0x7F));
+}
+
+/**
+ * @brief  Run the entropy stage on the next frame
+ * @retval >0: 本帧输出的采样数, 0: 本帧没有输出 (坏帧或 bit reservoir 不足), -1: 数据结束
+ */
+static int next_frame(HMP3Decoder dec, unsigned char **in, int *left, HMP3FrameData fd)
+{
+    int offset = MP3FindSyncWord(*in, *left);
+    if (offset < 0) return -1;
+    *in += offset;
+    *left -= offset;
+
+    int err = MP3DecodeEntropy(dec, in, left, 0, fd);
+    if (err == ERR_MP3_INDATA_UNDERFLOW) return -1;
+    if (err == ERR_MP3_NONE)
+    {
+        MP3FrameInfo info;
+        MP3GetLastFrameInfo(dec, &info);
+        return info.outputSamps;
+    }
+    if (err != ERR_MP3_MAINDATA_UNDERFLOW && *left > 0)
+    {
+        // 其他错误: 跳过一个字节重新同步 (与 codec_mp3.c 相同)
+        (*in)++;
+        (*left)--;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Both stages back to back on the decoder's own handoff
+ */
+static void run_serial(uint8_t *data, int len, uint32_t *crc, uint32_t *frames, uint64_t *entropy_ns,
+                       uint64_t *synth_ns)
+{
+    static short pcm[MAX_FRAME_SAMPLES];
+    unsigned char *in = data;
+    int left = len;
+
+    Codec_Mem_Reset();
+    HMP3Decoder dec = MP3InitDecoder();
+
+    while (1)
+    {
+        uint64_t t0 = now_ns();
+        int n = next_frame(dec, &in, &left, NULL);
+        uint64_t t1 = now_ns();
+        *entropy_ns += t1 - t0;
+        if (n < 0) break;
+        if (n == 0) continue;
+
+        if (MP3DecodeSynthesis(dec, NULL, pcm) == ERR_MP3_NONE)
+        {
+            *crc = fnv_pairs(*crc, pcm, n);
+            (*frames)++;
+        }
+        *synth_ns += now_ns() - t1;
+    }
+    MP3FreeDecoder(dec);
+}
+
+static void *synth_thread(void *arg)
+{
+    static short pcm[MAX_FRAME_SAMPLES];
+    Pipe *pipe = arg;
+
+    for (uint32_t k = 0;; k++)
+    {
+        Pipe_Slot *s = &pipe->slot[k % PIPE_DEPTH];
+
+        sem_wait(&pipe->full);
+        if (s->samples == 0) break;
+
+        if (MP3DecodeSynthesis(pipe->dec, s->data, pcm) == ERR_MP3_NONE)
+        {
+            pipe->crc = fnv_pairs(pipe->crc, pcm, s->samples);
+            pipe->frames++;
+        }
+        else
+        {
+            pipe->error = 1;
+        }
+        sem_post(&pipe->empty);
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Entropy stage on this thread, synthesis on a second thread, two handoffs in flight
+ */
+static int run_pipelined(uint8_t *data, int len, uint32_t *crc, uint32_t *frames)
+{
+    Pipe pipe = {0};
+    pthread_t tid;
+    unsigned char *in = data;
+    int left = len;
+
+    Codec_Mem_Reset();
+    pipe.dec = MP3InitDecoder();
+    pipe.crc = FNV_OFFSET_BASIS;
+    for (int i = 0; i < PIPE_DEPTH; i++) pipe.slot[i].data = MP3AllocFrameData();
+    sem_init(&pipe.full, 0, 0);
+    sem_init(&pipe.empty, 0, PIPE_DEPTH);
+    pthread_create(&tid, NULL, synth_thread, &pipe);
+
+    for (uint32_t k = 0;; k++)
+    {
+        Pipe_Slot *s = &pipe.slot[k % PIPE_DEPTH];
+        int n;
+
+        sem_wait(&pipe.empty);
+        do n = next_frame(pipe.dec, &in, &left, s->data);
+        while (n == 0);
+
+        s->samples = (n > 0) ? n : 0;
+        sem_post(&pipe.full);
+        if (n < 0) break;
+    }
+
+    pthread_join(tid, NULL);
+    for (int i = 0; i < PIPE_DEPTH; i++) MP3FreeFrameData(pipe.slot[i].data);
+    MP3FreeDecoder(pipe.dec);
+    sem_destroy(&pipe.full);
+    sem_destroy(&pipe.empty);
+
+    *crc = pipe.crc;
+    *frames = pipe.frames;
+    return pipe.error ? -1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    int failed = 0;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <file.mp3>...\n", argv[0]);
+        return 1;
+    }
+
+    printf("%-28s %7s %8s %8s %9s %9s %6s %6s  %-8s %-8s\n", "file", "frames", "ent us", "syn us", "serial/s",
+           "pipe/s", "ideal", "gain", "crc", "pipe crc");
+    for (int i = 1; i < argc; i++)
+    {
+        FILE *fp = fopen(argv[i], "rb");
+        if (!fp)
+        {
+            perror(argv[i]);
+            failed = 1;
+            continue;
+        }
+        fseek(fp, 0, SEEK_END);
+        long size = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        uint8_t *data = malloc(size);
+        size = (long)fread(data, 1, size, fp);
+        fclose(fp);
+
+        int skip = id3_size(data, size);
+        if (skip > size) skip = (int)size;
+
+        uint32_t crc_s = FNV_OFFSET_BASIS, crc_p, frames_s = 0, frames_p;
+        uint64_t ent_ns = 0, syn_ns = 0;
+
+        uint64_t t0 = now_ns();
+        run_serial(data + skip, (int)(size - skip), &crc_s, &frames_s, &ent_ns, &syn_ns);
+        uint64_t t1 = now_ns();
+        int err = run_pipelined(data + skip, (int)(size - skip), &crc_p, &frames_p);
+        uint64_t t2 = now_ns();
+
+        const char *name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i];
+        double serial = frames_s / ((t1 - t0) / 1e9);
+        double piped = frames_p / ((t2 - t1) / 1e9);
+        double ideal = (double)(ent_ns + syn_ns) / (ent_ns > syn_ns ? ent_ns : syn_ns);
+        int ok = !err && crc_s == crc_p && frames_s == frames_p;
+
+        printf("%-28s %7u %8.2f %8.2f %9.0f %9.0f %6.2f %6.2f  %08x %08x%s\n", name, frames_s,
+               frames_s ? ent_ns / 1e3 / frames_s : 0, frames_s ? syn_ns / 1e3 / frames_s : 0, serial, piped, ideal,
+               piped / serial, crc_s, crc_p, ok ? "" : "  MISMATCH");
+        if (!ok) failed = 1;
+        free(data);
+    }
+    return failed;
+}
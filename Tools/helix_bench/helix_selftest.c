@@ -0,0 +1,81 @@
+/*
+ * helix_selftest.c
+ * 在电脑上运行 mp3_selftest.c 的解码器自检, 或重新生成内置码流 mp3_selftest_vector.c
+ *
+ * 电脑上 assembly.h 使用通用 C 版本, 这里的输出就是板上自检的参考: 板上分别以默认方式 (HELIX_ARM_DSP)
+ * 和加 -DHELIX_NO_ARM_DSP 编译、打开 MP3_SELFTEST 运行, mp3_selftest_result.status 都必须为 0。
+ *
+ * 编译:
+ *   gcc -O2 -Ihost -I../../Core/App/Player -I../../Core/App/Player/helix helix_selftest.c \
+ *       ../../Core/App/Player/mp3_selftest.c ../../Core/App/Player/mp3_selftest_vector.c \
+ *       ../../Core/App/Player/codec_mem.c ../../Core/App/Player/helix/[a-z]*.c -o helix_selftest
+ * 用法:
+ *   ./helix_selftest                  解码内置码流, 校验和不符时返回 1
+ *   ./helix_selftest -w in.mp3        输出以 in.mp3 为内置码流的 mp3_selftest_vector.c (期望值为本机结果)
+ *   重新生成: ./mp3_gen -t 0.4 selftest.mp3 && ./helix_selftest -w selftest.mp3 > \
+ *             ../../Core/App/Player/mp3_selftest_vector.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mp3_selftest.h"
+
+static int write_vector(const char *path)
+{
+    MP3_Selftest_Result r;
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        perror(path);
+        return 1;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t *data = malloc(size);
+    size = (long)fread(data, 1, size, fp);
+    fclose(fp);
+
+    if (MP3_Selftest_Decode(data, (uint32_t)size, &r) != MP3_SELFTEST_OK)
+    {
+        fprintf(stderr, "%s: decode error after %u frames\n", path, r.frames);
+        free(data);
+        return 1;
+    }
+
+    printf("/*\n");
+    printf(" * mp3_selftest_vector.c\n");
+    printf(" * MP3 解码器自检的内置码流 (%u 帧) 和期望校验和\n", r.frames);
+    printf(" *\n");
+    printf(" * 由 Tools/helix_bench 生成, 不要手工修改:\n");
+    printf(" *   ./mp3_gen -t 0.4 selftest.mp3 && ./helix_selftest -w selftest.mp3 > mp3_selftest_vector.c\n");
+    printf(" */\n\n");
+    printf("#include \"mp3_selftest.h\"\n\n");
+    printf("const uint32_t mp3_selftest_checksum = 0x%08XU;\n", r.checksum);
+    printf("const uint32_t mp3_selftest_stream_size = %ldU;\n\n", size);
+    printf("const uint8_t mp3_selftest_stream[] = {");
+    for (long i = 0; i < size; i++) printf("%s0x%02X,", (i % 16) ? " " : "\n    ", data[i]);
+    printf("\n};\n");
+
+    free(data);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    MP3_Selftest_Result r;
+
+    if (argc == 3 && !strcmp(argv[1], "-w")) return write_vector(argv[2]);
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [-w in.mp3]\n", argv[0]);
+        return 1;
+    }
+
+    MP3_Selftest_Run(&r);
+    printf("status %d, frames %u, checksum %08x, expected %08x, %.1f us\n", r.status, r.frames, r.checksum, r.expected,
+           r.time / 1e3);
+    return r.status == MP3_SELFTEST_OK ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+/*
+ * cmsis_os.h (电脑端替身)
+ * 播放器头文件只用到 RTOS 句柄类型, 电脑上编译时用空指针代替
+ */
+
+#ifndef HOST_CMSIS_OS_H_
+#define HOST_CMSIS_OS_H_
+
+#include <stdint.h>
+
+typedef void *osMessageQueueId_t;
+typedef void *osThreadId_t;
+typedef void *osMutexId_t;
+typedef void *osSemaphoreId_t;
+
+#endif /* HOST_CMSIS_OS_H_ */
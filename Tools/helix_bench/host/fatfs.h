@@ -0,0 +1,44 @@
+/*
+ * fatfs.h (电脑端替身)
+ * 只提供播放器代码在电脑上编译所需的 FatFs 类型, f_read / f_lseek / f_tell 直接映射到 stdio
+ */
+
+#ifndef HOST_FATFS_H_
+#define HOST_FATFS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef unsigned int UINT;
+typedef uint32_t FSIZE_t;
+
+typedef enum
+{
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_NO_FILE = 4,
+    FR_NOT_ENABLED = 12,
+} FRESULT;
+
+typedef struct
+{
+    FILE *fp;
+} FIL;
+
+static inline FRESULT f_read(FIL *fil, void *buff, UINT btr, UINT *br)
+{
+    *br = (UINT)fread(buff, 1, btr, fil->fp);
+    return ferror(fil->fp) ? FR_DISK_ERR : FR_OK;
+}
+
+static inline FRESULT f_lseek(FIL *fil, FSIZE_t ofs)
+{
+    return fseek(fil->fp, (long)ofs, SEEK_SET) == 0 ? FR_OK : FR_DISK_ERR;
+}
+
+static inline FSIZE_t f_tell(FIL *fil)
+{
+    return (FSIZE_t)ftell(fil->fp);
+}
+
+#endif /* HOST_FATFS_H_ */
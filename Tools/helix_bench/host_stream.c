@@ -0,0 +1,174 @@
+/*
+ * host_stream.c
+ * stream_reader.h 接口在电脑上的实现: 按 STREAM_CHUNK_SIZE 对齐读块, 最多保留 STREAM_CHUNK_COUNT 块,
+ * 与板上读取任务的缓冲方式一致, 但按需同步读取, 不模拟预读和 SD 卡耗时
+ */
+
+#include "host_stream.h"
+
+#include <string.h>
+
+/* Private variables ---------------------------------------------------------*/
+static FILE *stream_fp = NULL;
+static uint32_t stream_size = 0;
+static uint32_t stream_pos = 0;  // 解码器当前读取位置
+
+static uint8_t stream_buf[STREAM_CHUNK_COUNT][STREAM_CHUNK_SIZE];
+static uint32_t chunk_pos[STREAM_CHUNK_COUNT];
+static uint32_t chunk_len[STREAM_CHUNK_COUNT];  // 0 表示空
+static uint32_t chunk_next = 0;                 // 下一次读块替换的位置
+
+static Host_Stream_Counters counters;
+static Stream_Stats stats;
+
+/* Function implementations --------------------------------------------------*/
+
+static void stream_drop_chunks(void)
+{
+    memset(chunk_len, 0, sizeof(chunk_len));
+    chunk_next = 0;
+}
+
+/**
+ * @brief  Find the buffered chunk containing pos
+ * @retval 块序号, -1 表示不在缓冲区内
+ */
+static int stream_find_chunk(uint32_t pos)
+{
+    for (int i = 0; i < STREAM_CHUNK_COUNT; i++)
+    {
+        if (chunk_len[i] && pos >= chunk_pos[i] && pos < chunk_pos[i] + chunk_len[i]) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief  Return the chunk containing pos, reading it if needed
+ * @retval 块序号, -1 表示文件结束
+ */
+static int stream_load_chunk(uint32_t pos)
+{
+    int i = stream_find_chunk(pos);
+    if (i >= 0 || pos >= stream_size) return i;
+
+    i = (int)chunk_next;
+    chunk_next = (chunk_next + 1) % STREAM_CHUNK_COUNT;
+    chunk_pos[i] = pos & ~(uint32_t)(STREAM_CHUNK_SIZE - 1);
+    fseek(stream_fp, (long)chunk_pos[i], SEEK_SET);
+    chunk_len[i] = (uint32_t)fread(stream_buf[i], 1, STREAM_CHUNK_SIZE, stream_fp);
+
+    counters.chunk_loads++;
+    stats.read_count++;
+    stats.bytes_read += chunk_len[i];
+    return chunk_len[i] ? i : -1;
+}
+
+void Stream_Init(void)
+{
+    stats.chunk_size = STREAM_CHUNK_SIZE;
+    stats.chunk_count = STREAM_CHUNK_COUNT;
+}
+
+FRESULT Stream_Open(const char *path)
+{
+    Stream_Close();
+
+    stream_fp = fopen(path, "rb");
+    if (!stream_fp) return FR_NO_FILE;
+
+    fseek(stream_fp, 0, SEEK_END);
+    stream_size = (uint32_t)ftell(stream_fp);
+    stream_pos = 0;
+    stream_drop_chunks();
+    return FR_OK;
+}
+
+void Stream_Close(void)
+{
+    if (stream_fp) fclose(stream_fp);
+    stream_fp = NULL;
+    stream_size = 0;
+    stream_pos = 0;
+    stream_drop_chunks();
+}
+
+const uint8_t *Stream_GetSpan(uint32_t *len)
+{
+    int i = stream_fp ? stream_load_chunk(stream_pos) : -1;
+    if (i < 0)
+    {
+        *len = 0;
+        return NULL;
+    }
+
+    uint32_t off = stream_pos - chunk_pos[i];
+    *len = chunk_len[i] - off;
+    return stream_buf[i] + off;
+}
+
+void Stream_Consume(uint32_t len)
+{
+    stream_pos += len;
+    counters.bytes += len;
+}
+
+uint32_t Stream_Read(void *dst, uint32_t len)
+{
+    uint8_t *p = dst;
+    uint32_t done = 0;
+
+    if (len == 4) counters.header_reads++;
+
+    while (done < len)
+    {
+        uint32_t n;
+        const uint8_t *src = Stream_GetSpan(&n);
+        if (!src) break;
+
+        if (n > len - done) n = len - done;
+        memcpy(p + done, src, n);
+        Stream_Consume(n);
+        done += n;
+    }
+    return done;
+}
+
+FRESULT Stream_Seek(uint32_t pos)
+{
+    if (!stream_fp) return FR_NOT_ENABLED;
+
+    counters.seeks++;
+    if (stream_find_chunk(pos) < 0)
+    {
+        // 板上按块对齐重新预读, 之前的块全部作废
+        counters.seek_reloads++;
+        stream_drop_chunks();
+    }
+    stream_pos = pos;
+    return FR_OK;
+}
+
+uint32_t Stream_Tell(void)
+{
+    return stream_pos;
+}
+
+uint32_t Stream_Size(void)
+{
+    return stream_size;
+}
+
+void Stream_GetStats(Stream_Stats *s)
+{
+    *s = stats;
+}
+
+void Host_Stream_GetCounters(Host_Stream_Counters *c)
+{
+    *c = counters;
+}
+
+void Host_Stream_ResetCounters(void)
+{
+    memset(&counters, 0, sizeof(counters));
+}
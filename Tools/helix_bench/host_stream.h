@@ -0,0 +1,23 @@
+/*
+ * host_stream.h
+ * stream_reader 在电脑上的替身 (stdio), 额外统计定位和读块次数
+ */
+
+#ifndef HOST_STREAM_H_
+#define HOST_STREAM_H_
+
+#include "stream_reader.h"
+
+typedef struct
+{
+    uint32_t chunk_loads;   // 读入的块数 (对应板上一次多扇区读)
+    uint32_t seeks;         // Stream_Seek() 次数
+    uint32_t seek_reloads;  // 目标不在已读入的块内, 需要重新读块的定位次数
+    uint32_t header_reads;  // 4 字节读取次数 (codec_mp3 逐帧扫描时每帧读一次帧头)
+    uint64_t bytes;         // 交给解码器的字节数
+} Host_Stream_Counters;
+
+void Host_Stream_GetCounters(Host_Stream_Counters *c);
+void Host_Stream_ResetCounters(void);
+
+#endif /* HOST_STREAM_H_ */
@@ -0,0 +1,282 @@
+/*
+ * mp3_gen.c
+ * 生成合成的 MPEG-1 Layer III 测试码流 (没有编码器时给 helix_bench / mp3_seek_bench 用)
+ *
+ * 帧头和 side info 按参数随机生成 (联合立体声 MS/强度立体声、长块/短块/起止块随机组合),
+ * 主数据为随机比特: Layer III 的 Huffman 码表是完备前缀码, 随机比特总能解出数值,
+ * 每帧生成后先用 Helix 解一遍, 出错的帧换一组随机数重新生成, 保证整个文件能无错解码。
+ * 输出是噪声, 但覆盖了解码器的全部阶段, 同一种子生成的文件完全相同, 可以用来比较 PCM 校验和。
+ * main_data_begin 总是 0 (不使用 bit reservoir), 每帧只引用自己的主数据。
+ *
+ * -x 在开头加 Xing (VBR) / Info (CBR) 信息帧, 含 100 项 TOC 和 LAME 扩展 (编码器延迟 576, 结尾填充)。
+ *
+ * 编译:
+ *   gcc -O2 -Ihost -I../../Core/App/Player -I../../Core/App/Player/helix mp3_gen.c \
+ *       ../../Core/App/Player/codec_mem.c ../../Core/App/Player/helix/[a-z]*.c -o mp3_gen
+ * 用法:
+ *   ./mp3_gen [-t 秒] [-r 采样率] [-b kbps] [-m] [-v] [-x] [-s 种子] out.mp3
+ *     -r 32000 / 44100 / 48000 (默认 44100)    -b 固定码率 (默认 128)    -m 单声道
+ *     -v 每帧随机码率 (VBR)                      -x 写 Xing/Info 信息帧   -s 随机种子 (默认 1)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "codec_mem.h"
+#include "mp3dec.h"
+
+#define MAX_FRAME_BYTES 1441  // 320kbps @ 32kHz
+#define GEN_RETRIES 1000
+#define XING_TOC_SIZE 100
+#define ENC_DELAY 576
+
+static const uint16_t bitrates[15] = {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320};
+static const uint32_t samplerates[3] = {44100, 48000, 32000};
+
+static uint32_t rng_state = 1;
+
+static uint32_t rnd(uint32_t n)
+{
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return n ? rng_state % n : 0;
+}
+
+typedef struct
+{
+    uint8_t *p;
+    uint32_t bit;
+} Bit_Writer;
+
+static void put_bits(Bit_Writer *w, uint32_t v, int n)
+{
+    while (n-- > 0)
+    {
+        if ((v >> n) & 1) w->p[w->bit >> 3] |= (uint8_t)(0x80 >> (w->bit & 7));
+        w->bit++;
+    }
+}
+
+static int frame_bytes(int br_idx, int sr_idx, int pad)
+{
+    return 144 * bitrates[br_idx] * 1000 / samplerates[sr_idx] + pad;
+}
+
+/**
+ * @brief  Padding bit of the next frame: 与编码器相同, 累计余数使平均帧长等于标称码率
+ */
+static int next_padding(int br_idx, int sr_idx)
+{
+    static uint32_t rest = 0;
+
+    rest += 144U * bitrates[br_idx] * 1000U % samplerates[sr_idx];
+    if (rest < samplerates[sr_idx]) return 0;
+    rest -= samplerates[sr_idx];
+    return 1;
+}
+
+static void write_header(uint8_t *p, int br_idx, int sr_idx, int pad, int mono, int mode_ext)
+{
+    p[0] = 0xFF;
+    p[1] = 0xFB;  // MPEG-1, Layer III, 无 CRC
+    p[2] = (uint8_t)((br_idx << 4) | (sr_idx << 2) | (pad << 1));
+    p[3] = (uint8_t)(mono ? 0xC0 : (0x40 | (mode_ext << 4)));  // 单声道 / 联合立体声
+}
+
+/**
+ * @brief  Build one random audio frame
+ * @retval 帧长 (字节)
+ */
+static int build_frame(uint8_t *p, int br_idx, int sr_idx, int pad, int mono)
+{
+    int nch = mono ? 1 : 2;
+    int len = frame_bytes(br_idx, sr_idx, pad);
+    int si_bytes = mono ? 17 : 32;
+    int main_bits = (len - 4 - si_bytes) * 8;
+    Bit_Writer w = {p + 4, 0};
+
+    memset(p, 0, len);
+    write_header(p, br_idx, sr_idx, pad, mono, (int)rnd(4));
+
+    put_bits(&w, 0, 9);                // main_data_begin
+    put_bits(&w, 0, mono ? 5 : 3);     // private_bits
+    put_bits(&w, 0, 4 * nch);          // scfsi
+    for (int gr = 0; gr < 2; gr++)
+    {
+        for (int ch = 0; ch < nch; ch++)
+        {
+            int avail = main_bits / (2 * nch);
+            int part23 = avail - (int)rnd(avail / 8 + 1);
+            int big_values = (int)rnd((part23 / 12 < 288 ? part23 / 12 : 288) + 1);
+            int table;
+
+            if (part23 > 4095) part23 = 4095;
+            put_bits(&w, part23, 12);
+            put_bits(&w, big_values, 9);
+            put_bits(&w, 150 + rnd(30), 8);  // global_gain: 中等电平, 避免大量削波
+            put_bits(&w, rnd(16), 4);        // scalefac_compress
+            if (rnd(4) == 0)
+            {
+                put_bits(&w, 1, 1);  // window_switching_flag
+                put_bits(&w, 1 + rnd(3), 2);
+                put_bits(&w, 0, 1);  // mixed_block_flag
+                for (int i = 0; i < 2; i++)
+                {
+                    do table = (int)rnd(32);
+                    while (table == 4 || table == 14);
+                    put_bits(&w, table, 5);
+                }
+                for (int i = 0; i < 3; i++) put_bits(&w, rnd(3), 3);  // subblock_gain
+            }
+            else
+            {
+                put_bits(&w, 0, 1);
+                for (int i = 0; i < 3; i++)
+                {
+                    do table = (int)rnd(32);
+                    while (table == 4 || table == 14);
+                    put_bits(&w, table, 5);
+                }
+                put_bits(&w, rnd(16), 4);  // region0_count
+                put_bits(&w, rnd(8), 3);   // region1_count
+            }
+            put_bits(&w, rnd(2), 1);  // preflag
+            put_bits(&w, rnd(2), 1);  // scalefac_scale
+            put_bits(&w, rnd(2), 1);  // count1table_select
+        }
+    }
+
+    for (int i = 4 + si_bytes; i < len; i++) p[i] = (uint8_t)rnd(256);
+    return len;
+}
+
+/**
+ * @brief  Build a random frame that Helix decodes without error
+ */
+static int build_valid_frame(HMP3Decoder dec, uint8_t *p, int br_idx, int sr_idx, int pad, int mono)
+{
+    static short pcm[MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+    static uint8_t copy[MAX_FRAME_BYTES + 4];
+
+    for (int retry = 0; retry < GEN_RETRIES; retry++)
+    {
+        int len = build_frame(p, br_idx, sr_idx, pad, mono);
+        unsigned char *in = copy;
+        int left = len;
+
+        memcpy(copy, p, len);
+        if (MP3Decode(dec, &in, &left, pcm, 0) == ERR_MP3_NONE && left == 0) return len;
+    }
+    fprintf(stderr, "cannot build a decodable frame\n");
+    exit(1);
+}
+
+/**
+ * @brief  Fill the Xing/Info frame
+ * @param  offsets: 每个音频帧相对 Xing 帧的偏移
+ */
+static void build_xing(uint8_t *p, int len, int vbr, uint32_t frames, uint32_t bytes, const uint32_t *offsets,
+                       uint32_t padding, int mono)
+{
+    uint8_t *x = p + 4 + (mono ? 17 : 32);
+
+    memset(p + 4, 0, len - 4);
+    memcpy(x, vbr ? "Xing" : "Info", 4);
+    x[7] = 0x0F;  // frames, bytes, TOC, quality
+    x += 8;
+    for (int i = 0; i < 4; i++) x[i] = (uint8_t)(frames >> (24 - 8 * i));
+    for (int i = 0; i < 4; i++) x[4 + i] = (uint8_t)(bytes >> (24 - 8 * i));
+    x += 8;
+    for (int i = 0; i < XING_TOC_SIZE; i++)
+    {
+        uint32_t f = (uint32_t)((uint64_t)frames * i / XING_TOC_SIZE);
+        uint32_t v = (uint32_t)((uint64_t)offsets[f] * 256 / bytes);
+        x[i] = (uint8_t)(v > 255 ? 255 : v);
+    }
+    x += XING_TOC_SIZE;
+    x[3] = 50;  // quality
+    x += 4;
+
+    memcpy(x, "LAME3.100", 9);
+    x[21] = (uint8_t)(ENC_DELAY >> 4);
+    x[22] = (uint8_t)(((ENC_DELAY & 0x0F) << 4) | ((padding >> 8) & 0x0F));
+    x[23] = (uint8_t)padding;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 10;
+    uint32_t rate = 44100;
+    int kbps = 128, mono = 0, vbr = 0, xing = 0;
+    const char *out = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-t") && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) rate = (uint32_t)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-b") && i + 1 < argc) kbps = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) rng_state = (uint32_t)strtoul(argv[++i], NULL, 0) | 1;
+        else if (!strcmp(argv[i], "-m")) mono = 1;
+        else if (!strcmp(argv[i], "-v")) vbr = 1;
+        else if (!strcmp(argv[i], "-x")) xing = 1;
+        else out = argv[i];
+    }
+
+    int sr_idx = -1, br_idx = -1;
+    for (int i = 0; i < 3; i++)
+        if (samplerates[i] == rate) sr_idx = i;
+    for (int i = 1; i < 15; i++)
+        if (bitrates[i] == kbps) br_idx = i;
+    if (!out || sr_idx < 0 || br_idx < 0)
+    {
+        fprintf(stderr, "usage: %s [-t sec] [-r 32000|44100|48000] [-b kbps] [-m] [-v] [-x] [-s seed] out.mp3\n",
+                argv[0]);
+        return 1;
+    }
+
+    uint32_t samples = (uint32_t)(seconds * rate);
+    uint32_t frames = (samples + ENC_DELAY + 529 + 1151) / 1152;
+    uint32_t padding = frames * 1152 - ENC_DELAY - samples;
+    uint32_t *offsets = malloc(frames * sizeof(uint32_t));
+    FILE *fp = fopen(out, "wb");
+    if (!fp || !offsets)
+    {
+        perror(out);
+        return 1;
+    }
+
+    Codec_Mem_Reset();
+    HMP3Decoder dec = MP3InitDecoder();
+    uint8_t frame[MAX_FRAME_BYTES];
+    int xing_bytes = xing ? frame_bytes(br_idx, sr_idx, 0) : 0;
+    uint32_t pos = (uint32_t)xing_bytes;
+
+    if (xing) fseek(fp, xing_bytes, SEEK_SET);  // 信息帧最后写入
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        int idx = vbr ? 5 + (int)rnd(10) : br_idx;
+        int len = build_valid_frame(dec, frame, idx, sr_idx, next_padding(idx, sr_idx), mono);
+
+        offsets[f] = pos;
+        fwrite(frame, 1, len, fp);
+        pos += len;
+    }
+
+    if (xing)
+    {
+        build_xing(frame, xing_bytes, vbr, frames, pos, offsets, padding, mono);
+        write_header(frame, br_idx, sr_idx, 0, mono, 0);
+        fseek(fp, 0, SEEK_SET);
+        fwrite(frame, 1, xing_bytes, fp);
+    }
+
+    fclose(fp);
+    printf("%s: %u frames, %u bytes, %u Hz %s%s\n", out, frames, pos, rate, mono ? "mono" : "joint stereo",
+           vbr ? ", VBR" : "");
+    free(offsets);
+    return 0;
+}
@@ -0,0 +1,279 @@
+/*
+ * mp3_seek_bench.c
+ * 在电脑上测量 codec_mp3.c 的定位方式: 稀疏帧索引 + 帧头扫描 与 Xing/VBRI TOC (或 CBR) 估算
+ *
+ * 先从头完整解码一遍作为参考 PCM, 然后按三种情况各做一组随机定位 (固定种子, 结果可重复):
+ *   toc    每次重新打开文件后定位到扫描范围之外: 索引只有第 0 帧, 按 TOC (没有 VBR 头时按 CBR) 估算
+ *   scan   每次重新打开文件后定位到扫描范围内 (MP3_SCAN_LIMIT 字节以内): 从第 0 帧逐帧读帧头
+ *   index  完整播放一遍 (索引已建立) 后定位到任意位置: 从最近的索引项开始最多扫描一个索引间隔
+ * 每次定位从调用 seek() 开始, 到 decode_frame() 输出第一个采样结束 (含预解码丢弃的帧), 统计:
+ *   hdr    逐帧扫描读取的帧头数 (每个帧头一次 Stream_Seek + 4 字节读取)
+ *   chunk  读入的 STREAM_CHUNK_SIZE 块数, 对应板上的多扇区读, 是 SD 卡上定位耗时的主要部分
+ *   frames decode_frame() 解码的帧数 (预解码 + 第一帧输出)
+ *   us     电脑上的用时, 只用于相对比较; 板上用 music_player_get_seek_time_us() 读取实际耗时
+ *   exact  定位后输出与参考 PCM 在目标采样处逐位一致的比例
+ *   err    不一致时, 在目标前后 ±256 帧内找到的实际位置与目标相差的帧数 (平均 / 最大);
+ *          Xing TOC 只有 1/256 文件长度的分辨率, 长文件上按 TOC 估算的误差主要来自这里
+ *
+ * 编译:
+ *   gcc -O2 -Ihost -I../../Core/App/Player -I../../Core/App/Player/helix mp3_seek_bench.c host_stream.c \
+ *       ../../Core/App/Player/codec_mp3.c ../../Core/App/Player/mp3_decoder.c ../../Core/App/Player/codec_mem.c \
+ *       ../../Core/App/Player/helix/[a-z]*.c -o mp3_seek_bench
+ * 用法:
+ *   ./mp3_seek_bench [-n 每种情况的定位次数] file.mp3...
+ *   长 VBR 测试文件: ./mp3_gen -t 600 -v -x long_vbr.mp3
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "audio_decoder.h"
+#include "codec_mem.h"
+#include "host_stream.h"
+
+#define BLOCK_SAMPLES 2304  // 与 music_player.c 的 PCM_RING_BLOCK_SAMPLES 相同
+#define CHECK_SAMPLES 1152  // 比较定位后输出的前 CHECK_SAMPLES 个采样 (每声道)
+#define SEARCH_FRAMES 256
+#define SCAN_BYTES (256 * 1024)  // 与 codec_mp3.c 的 MP3_SCAN_LIMIT 相同
+
+typedef enum
+{
+    SEEK_TOC,
+    SEEK_SCAN,
+    SEEK_INDEX,
+    SEEK_MODE_COUNT,
+} Seek_Mode;
+
+typedef struct
+{
+    uint32_t count;
+    uint64_t header_reads;
+    uint64_t chunk_loads;
+    uint64_t frames;
+    uint64_t ns;
+    uint64_t ns_max;
+    uint32_t exact;
+    uint32_t missed;      // 定位失败或在搜索范围内找不到输出
+    uint64_t err_frames;  // 不精确时的位置误差累计 (帧)
+    uint32_t err_max;
+} Seek_Result;
+
+static const char *const mode_names[SEEK_MODE_COUNT] = {"toc", "scan", "index"};
+
+static int16_t *ref_pcm;  // 参考输出, 立体声交错
+static uint32_t ref_samples;
+static Audio_Info info;
+static uint32_t rng_state = 12345;
+
+static uint32_t rnd(uint32_t n)
+{
+    rng_state = rng_state * 1664525U + 1013904223U;
+    return (uint32_t)(((uint64_t)(rng_state >> 8) * n) >> 24);
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
+
+static int open_file(const char *path)
+{
+    Codec_Mem_Reset();
+    if (Stream_Open(path) != FR_OK) return -1;
+    return Audio_Decoder_MP3.open(&info);
+}
+
+/**
+ * @brief  Decode from the current position to the end, optionally keeping the PCM
+ */
+static void decode_to_end(int keep)
+{
+    static int16_t block[BLOCK_SAMPLES];
+    uint32_t cap = 0;
+    int n;
+
+    while ((n = Audio_Decoder_MP3.decode_frame(block, BLOCK_SAMPLES)) != AUDIO_DEC_EOF)
+    {
+        if (n <= 0 || !keep) continue;
+        if ((ref_samples + n / 2) * 2 > cap)
+        {
+            cap = cap ? cap * 2 : 1 << 20;
+            ref_pcm = realloc(ref_pcm, cap * sizeof(int16_t));
+        }
+        memcpy(ref_pcm + ref_samples * 2, block, n * sizeof(int16_t));
+        ref_samples += n / 2;
+    }
+}
+
+/**
+ * @brief  Where the output after a seek actually starts, in frames relative to the target
+ * @retval 0: 精确, >0: 误差帧数, -1: 搜索范围内找不到
+ */
+static int locate_output(uint32_t target, const int16_t *out, uint32_t samples)
+{
+    uint32_t spf = 1152;
+
+    for (int d = 0; d <= SEARCH_FRAMES; d++)
+    {
+        for (int sign = (d ? -1 : 1); sign <= 1; sign += 2)
+        {
+            int64_t pos = (int64_t)target + (int64_t)sign * d * spf;
+            if (pos < 0 || pos + samples > ref_samples) continue;
+            if (memcmp(out, ref_pcm + pos * 2, samples * 2 * sizeof(int16_t)) == 0) return d;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief  Seek, decode up to the first output, and check it against the reference
+ */
+static void seek_once(uint32_t target, Seek_Result *r)
+{
+    static int16_t out[CHECK_SAMPLES * 2 + BLOCK_SAMPLES];
+    Host_Stream_Counters c;
+    uint32_t got = 0;
+    uint32_t frames = 0;
+
+    Host_Stream_ResetCounters();
+    uint64_t t0 = now_ns();
+    int ok = (Audio_Decoder_MP3.seek(target) == 0);
+    uint64_t ns = 0;
+
+    while (ok && got < CHECK_SAMPLES)
+    {
+        int n = Audio_Decoder_MP3.decode_frame(out + got * 2, BLOCK_SAMPLES);
+        if (n == AUDIO_DEC_EOF) break;
+        frames++;
+        if (n > 0 && got == 0)
+        {
+            ns = now_ns() - t0;
+            Host_Stream_GetCounters(&c);
+        }
+        if (n > 0) got += n / 2;
+    }
+
+    r->count++;
+    if (!ok || got == 0)
+    {
+        r->missed++;
+        return;
+    }
+    if (got > CHECK_SAMPLES) got = CHECK_SAMPLES;
+    if (target + got > ref_samples) got = ref_samples - target;
+
+    int d = locate_output(target, out, got);
+    if (d < 0)
+    {
+        r->missed++;
+        return;
+    }
+    if (d == 0) r->exact++;
+    r->err_frames += d;
+    if ((uint32_t)d > r->err_max) r->err_max = d;
+
+    r->header_reads += c.header_reads;
+    r->chunk_loads += c.chunk_loads;
+    r->frames += frames;
+    r->ns += ns;
+    if (ns > r->ns_max) r->ns_max = ns;
+}
+
+/**
+ * @retval 0: 没有可用的定位目标 (文件比扫描范围短时没有 toc 情况)
+ */
+static int run_mode(const char *path, Seek_Mode mode, int count, Seek_Result *r)
+{
+    // 扫描范围按平均码率换算为采样数, 两侧各留 1/8 余量, 避免落在边界附近
+    uint32_t bytes_per_sec = info.bitrate / 8 ? info.bitrate / 8 : 1;
+    uint32_t scan_samples = (uint32_t)((uint64_t)SCAN_BYTES * 7 / 8 * info.sample_rate / bytes_per_sec);
+    uint32_t toc_start = (uint32_t)((uint64_t)SCAN_BYTES * 9 / 8 * info.sample_rate / bytes_per_sec);
+    uint32_t end = ref_samples - CHECK_SAMPLES;
+    if (scan_samples > end) scan_samples = end;
+
+    memset(r, 0, sizeof(*r));
+    if (mode == SEEK_TOC && toc_start >= end) return 0;
+    if (mode == SEEK_INDEX)
+    {
+        open_file(path);
+        decode_to_end(0);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t target;
+        if (mode == SEEK_TOC) target = toc_start + rnd(end - toc_start);
+        else if (mode == SEEK_SCAN) target = rnd(scan_samples);
+        else target = rnd(end);
+
+        if (mode != SEEK_INDEX) open_file(path);
+        seek_once(target, r);
+    }
+    Audio_Decoder_MP3.close();
+    Stream_Close();
+    return 1;
+}
+
+static void print_mode(Seek_Mode mode, const Seek_Result *r)
+{
+    uint32_t ok = r->count - r->missed;
+    uint32_t inexact = ok - r->exact;
+
+    printf("  %-6s %5u %8.1f %7.1f %7.1f %8.1f %8.1f %6.1f%%", mode_names[mode], r->count,
+           ok ? (double)r->header_reads / ok : 0, ok ? (double)r->chunk_loads / ok : 0,
+           ok ? (double)r->frames / ok : 0, ok ? r->ns / 1e3 / ok : 0, r->ns_max / 1e3,
+           r->count ? 100.0 * r->exact / r->count : 0);
+    if (inexact) printf("  %5.1f / %u", (double)r->err_frames / inexact, r->err_max);
+    if (r->missed) printf("  (%u missed)", r->missed);
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    int count = 200;
+    int failed = 0;
+
+    Stream_Init();
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            count = atoi(argv[++i]);
+            continue;
+        }
+
+        const char *path = argv[i];
+        if (open_file(path) != 0)
+        {
+            printf("%s: open failed\n", path);
+            failed = 1;
+            continue;
+        }
+        uint32_t size = Stream_Size();
+        ref_samples = 0;
+        decode_to_end(1);
+        Audio_Decoder_MP3.close();
+        Stream_Close();
+        if (ref_samples <= CHECK_SAMPLES) continue;
+
+        printf("%s: %u Hz, %u kbps avg, %.1f s, %u bytes\n", path, info.sample_rate, info.bitrate / 1000,
+               (double)ref_samples / info.sample_rate, size);
+        printf("  %-6s %5s %8s %7s %7s %8s %8s %7s  %s\n", "mode", "seeks", "hdr", "chunk", "frames", "us avg",
+               "us max", "exact", "err frames avg / max");
+        for (int m = 0; m < SEEK_MODE_COUNT; m++)
+        {
+            Seek_Result r;
+            if (!run_mode(path, (Seek_Mode)m, count, &r)) continue;
+            print_mode((Seek_Mode)m, &r);
+
+            // 索引和逐帧扫描定位必须精确到采样
+            if (m != SEEK_TOC && r.exact != r.count) failed = 1;
+        }
+    }
+    free(ref_pcm);
+    return failed;
+}
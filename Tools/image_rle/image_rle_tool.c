@@ -0,0 +1,504 @@
+/*
+ * image_rle_tool.c
+ * 在电脑上把图标转换为按行 RLE 压缩的 LVGL 图片 (格式与解码器见 Core/App/GUI/gui_image_rle.h)
+ *
+ * 编译:
+ *   gcc -O2 image_rle_tool.c -lz -o image_rle_tool
+ * 用法:
+ *   image_rle_tool <输入> <输出.c> [名称] [--bg RRGGBB]
+ *     输入可以是 PNG (8 位, 不隔行) 或 LVGL 图片转换器生成的 RGB565 C 数组 (Core/App/Res 中原来的格式)。
+ *     名称默认取输出文件名, 即 LV_IMG_DECLARE() 中的变量名; 生成的 .c 直接替换 Res 中的原文件。
+ *     PNG 的透明部分按 --bg 指定的背景色 (默认 FFFFFF) 预先混合, 输出为不透明的 RGB565。
+ *   image_rle_tool --check <文件.c>
+ *     解压已经转换的文件并打印压缩率
+ *
+ * 转换后会用与固件相同的方法解压一遍, 和原图逐像素比较, 不一致时不写输出文件。
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#define RLE_RUN 0x8000U        // 控制字: 重复
+#define RLE_MAX_COUNT 0x7FFFU  // 一个控制字最多的像素数
+#define RLE_MIN_RUN 3          // 至少这么多个相同像素才编码为重复 (重复段占 2 个字, 短于 3 不划算)
+
+typedef struct
+{
+    uint32_t w, h;
+    uint16_t *px;  // RGB565
+} Image;
+
+typedef struct
+{
+    uint16_t *data;
+    uint32_t len;  // uint16_t 个数
+    uint32_t cap;
+} Buf;
+
+static void die(const char *msg, const char *arg)
+{
+    fprintf(stderr, "image_rle_tool: %s%s%s\n", msg, arg ? ": " : "", arg ? arg : "");
+    exit(1);
+}
+
+static uint8_t *read_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) die("无法打开", path);
+
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc((size_t)n + 1);
+    if (!buf || fread(buf, 1, (size_t)n, f) != (size_t)n) die("读取失败", path);
+    fclose(f);
+
+    buf[n] = 0;
+    *size = (size_t)n;
+    return buf;
+}
+
+static void buf_push(Buf *b, uint16_t v)
+{
+    if (b->len == b->cap)
+    {
+        b->cap = b->cap ? b->cap * 2 : 1024;
+        b->data = realloc(b->data, b->cap * sizeof(uint16_t));
+        if (!b->data) die("内存不足", NULL);
+    }
+    b->data[b->len++] = v;
+}
+
+/* PNG ----------------------------------------------------------------------*/
+
+static uint32_t be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return (pb <= pc) ? b : c;
+}
+
+static uint16_t to_rgb565(uint32_t r, uint32_t g, uint32_t b)
+{
+    // 与 lv_color_to_u16() 相同, 直接截断低位
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+static void load_png(const uint8_t *file, size_t size, uint32_t bg, Image *img)
+{
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t depth = 0, type = 0, interlace = 0;
+    uint8_t palette[256 * 4];
+    uint8_t *idat = NULL;
+    size_t idat_len = 0;
+
+    memset(palette, 0xFF, sizeof(palette));
+    if (size < 8 || memcmp(file, sig, 8) != 0) die("不是 PNG 文件", NULL);
+
+    for (size_t pos = 8; pos + 12 <= size;)
+    {
+        uint32_t len = be32(file + pos);
+        const uint8_t *tag = file + pos + 4, *data = file + pos + 8;
+        if (pos + 12 + len > size) die("PNG 文件不完整", NULL);
+
+        if (memcmp(tag, "IHDR", 4) == 0)
+        {
+            img->w = be32(data);
+            img->h = be32(data + 4);
+            depth = data[8];
+            type = data[9];
+            interlace = data[12];
+        }
+        else if (memcmp(tag, "PLTE", 4) == 0)
+        {
+            for (uint32_t i = 0; i < len / 3 && i < 256; i++) memcpy(&palette[i * 4], data + i * 3, 3);
+        }
+        else if (memcmp(tag, "tRNS", 4) == 0 && type == 3)
+        {
+            for (uint32_t i = 0; i < len && i < 256; i++) palette[i * 4 + 3] = data[i];
+        }
+        else if (memcmp(tag, "IDAT", 4) == 0)
+        {
+            idat = realloc(idat, idat_len + len);
+            if (!idat) die("内存不足", NULL);
+            memcpy(idat + idat_len, data, len);
+            idat_len += len;
+        }
+        else if (memcmp(tag, "IEND", 4) == 0)
+        {
+            break;
+        }
+        pos += 12 + len;
+    }
+
+    static const uint8_t channels[7] = {1, 0, 3, 1, 2, 0, 4};
+    if (depth != 8 || type > 6 || !channels[type] || interlace) die("只支持 8 位、不隔行的 PNG", NULL);
+    if (!img->w || !img->h || img->w > 1024 || img->h > 1024) die("图片尺寸不支持", NULL);
+
+    uint32_t bpp = channels[type];
+    uint32_t stride = img->w * bpp;
+    uLongf raw_len = (uLongf)(stride + 1) * img->h;
+    uint8_t *raw = malloc(raw_len);
+    if (!raw || uncompress(raw, &raw_len, idat, idat_len) != Z_OK || raw_len != (uLongf)(stride + 1) * img->h)
+        die("PNG 数据解压失败", NULL);
+
+    // 逐行反滤波 (就地), 第 y 行的数据从 raw + y * (stride + 1) + 1 开始
+    for (uint32_t y = 0; y < img->h; y++)
+    {
+        uint8_t *row = raw + y * (stride + 1);
+        uint8_t *cur = row + 1;
+        const uint8_t *prev = y ? row - stride : NULL;
+
+        for (uint32_t i = 0; i < stride; i++)
+        {
+            uint8_t a = (i >= bpp) ? cur[i - bpp] : 0;
+            uint8_t b = prev ? prev[i] : 0;
+            uint8_t c = (prev && i >= bpp) ? prev[i - bpp] : 0;
+            switch (row[0])
+            {
+                case 0: break;
+                case 1: cur[i] += a; break;
+                case 2: cur[i] += b; break;
+                case 3: cur[i] += (uint8_t)((a + b) / 2); break;
+                case 4: cur[i] += paeth(a, b, c); break;
+                default: die("PNG 滤波类型错误", NULL);
+            }
+        }
+    }
+
+    img->px = malloc(img->w * img->h * sizeof(uint16_t));
+    if (!img->px) die("内存不足", NULL);
+
+    uint32_t bg_rgb[3] = {(bg >> 16) & 0xFF, (bg >> 8) & 0xFF, bg & 0xFF};
+    for (uint32_t y = 0; y < img->h; y++)
+    {
+        const uint8_t *p = raw + y * (stride + 1) + 1;
+        for (uint32_t x = 0; x < img->w; x++, p += bpp)
+        {
+            uint32_t rgba[4];
+            switch (type)
+            {
+                case 0: rgba[0] = rgba[1] = rgba[2] = p[0], rgba[3] = 255; break;
+                case 2: rgba[0] = p[0], rgba[1] = p[1], rgba[2] = p[2], rgba[3] = 255; break;
+                case 3:
+                    for (int i = 0; i < 4; i++) rgba[i] = palette[p[0] * 4 + i];
+                    break;
+                case 4: rgba[0] = rgba[1] = rgba[2] = p[0], rgba[3] = p[1]; break;
+                default: rgba[0] = p[0], rgba[1] = p[1], rgba[2] = p[2], rgba[3] = p[3]; break;
+            }
+            for (int i = 0; i < 3; i++) rgba[i] = (rgba[i] * rgba[3] + bg_rgb[i] * (255 - rgba[3]) + 127) / 255;
+            img->px[y * img->w + x] = to_rgb565(rgba[0], rgba[1], rgba[2]);
+        }
+    }
+
+    free(raw);
+    free(idat);
+}
+
+/* C 数组 --------------------------------------------------------------------*/
+
+static uint32_t c_field(const char *text, const char *field)
+{
+    const char *p = strstr(text, field);
+    if (!p) die("C 文件中没有", field);
+    p = strchr(p, '=');
+    return p ? (uint32_t)strtoul(p + 1, NULL, 0) : 0;
+}
+
+/* 读取 LVGL 转换器生成的 RGB565 数组 (uint8_t, 小端) */
+static void load_c_array(const char *text, Image *img)
+{
+    if (strstr(text, "LV_IMAGE_FLAGS_USER1")) die("输入已经是压缩格式", NULL);
+    if (!strstr(text, "LV_COLOR_FORMAT_RGB565,")) die("只支持 LV_COLOR_FORMAT_RGB565 的 C 数组", NULL);
+
+    img->w = c_field(text, ".header.w");
+    img->h = c_field(text, ".header.h");
+    if (!img->w || !img->h || img->w > 1024 || img->h > 1024) die("图片尺寸不支持", NULL);
+
+    const char *p = strstr(text, "_map[] = {");
+    if (!p) die("C 文件中没有像素数组", NULL);
+    p += 10;
+
+    uint32_t n = img->w * img->h;
+    img->px = malloc(n * sizeof(uint16_t));
+    if (!img->px) die("内存不足", NULL);
+
+    uint8_t *bytes = (uint8_t *)img->px;
+    uint32_t count = 0;
+    while (*p && *p != '}')
+    {
+        if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        {
+            char *end;
+            unsigned long v = strtoul(p, &end, 16);
+            if (count >= n * 2) die("像素数组比图片尺寸长", NULL);
+            bytes[count++] = (uint8_t)v;
+            p = end;
+        }
+        else
+        {
+            p++;
+        }
+    }
+    if (count != n * 2) die("像素数组比图片尺寸短", NULL);
+
+    // 主机是小端, 与数组中的字节顺序相同; 这里统一按小端组合, 不依赖主机字节序
+    for (uint32_t i = 0; i < n; i++) img->px[i] = (uint16_t)(bytes[i * 2] | (bytes[i * 2 + 1] << 8));
+}
+
+/* 读取本工具生成的压缩数组 (uint16_t) */
+static void load_rle_array(const char *text, Buf *out, uint32_t *w, uint32_t *h)
+{
+    if (!strstr(text, "LV_IMAGE_FLAGS_USER1")) die("不是压缩格式的 C 文件", NULL);
+    *w = c_field(text, ".header.w");
+    *h = c_field(text, ".header.h");
+
+    const char *p = strstr(text, "_map[] = {");
+    if (!p) die("C 文件中没有数组", NULL);
+    for (p += 10; *p && *p != '}';)
+    {
+        if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        {
+            char *end;
+            buf_push(out, (uint16_t)strtoul(p, &end, 16));
+            p = end;
+        }
+        else
+        {
+            p++;
+        }
+    }
+}
+
+/* RLE ----------------------------------------------------------------------*/
+
+static void encode_literal(Buf *out, const uint16_t *px, uint32_t n)
+{
+    while (n)
+    {
+        uint32_t k = (n > RLE_MAX_COUNT) ? RLE_MAX_COUNT : n;
+        buf_push(out, (uint16_t)k);
+        for (uint32_t i = 0; i < k; i++) buf_push(out, px[i]);
+        px += k;
+        n -= k;
+    }
+}
+
+static void encode(const Image *img, Buf *out)
+{
+    out->len = 0;
+    for (uint32_t y = 0; y < img->h; y++) buf_push(out, 0);  // 行偏移, 下面填写
+
+    for (uint32_t y = 0; y < img->h; y++)
+    {
+        if (out->len > 0xFFFF) die("压缩后超过 128KB, 行偏移放不下", NULL);
+        out->data[y] = (uint16_t)out->len;
+
+        const uint16_t *row = img->px + y * img->w;
+        uint32_t lit = 0;  // 还没有输出的原样像素的起点
+        uint32_t x = 0;
+        while (x < img->w)
+        {
+            uint32_t run = 1;
+            while (x + run < img->w && row[x + run] == row[x] && run < RLE_MAX_COUNT) run++;
+
+            if (run >= RLE_MIN_RUN)
+            {
+                encode_literal(out, row + lit, x - lit);
+                buf_push(out, (uint16_t)(RLE_RUN | run));
+                buf_push(out, row[x]);
+                x += run;
+                lit = x;
+            }
+            else
+            {
+                x += run;
+            }
+        }
+        encode_literal(out, row + lit, img->w - lit);
+    }
+}
+
+/* 与固件 gui_image_rle.c 中的 rle_decode_row() 相同 (整行) */
+static int decode(const uint16_t *data, uint32_t len, uint32_t w, uint32_t h, uint16_t *px)
+{
+    if (len < h) return -1;
+
+    for (uint32_t y = 0; y < h; y++)
+    {
+        uint32_t pos = data[y], x = 0;
+        while (x < w)
+        {
+            if (pos >= len) return -1;
+            uint16_t ctrl = data[pos++];
+            uint32_t n = ctrl & RLE_MAX_COUNT;
+            if (!n || x + n > w) return -1;
+
+            if (ctrl & RLE_RUN)
+            {
+                if (pos >= len) return -1;
+                for (uint32_t i = 0; i < n; i++) px[y * w + x + i] = data[pos];
+                pos++;
+            }
+            else
+            {
+                if (pos + n > len) return -1;
+                memcpy(&px[y * w + x], &data[pos], n * sizeof(uint16_t));
+                pos += n;
+            }
+            x += n;
+        }
+    }
+    return 0;
+}
+
+/* 输出 ---------------------------------------------------------------------*/
+
+static void write_c(const char *path, const char *name, const Image *img, const Buf *rle)
+{
+    char upper[128];
+    size_t i;
+    for (i = 0; name[i] && i < sizeof(upper) - 1; i++) upper[i] = (char)toupper((unsigned char)name[i]);
+    upper[i] = 0;
+
+    FILE *f = fopen(path, "w");
+    if (!f) die("无法写入", path);
+
+    fprintf(f,
+            "#ifdef __has_include\n"
+            "    #if __has_include(\"lvgl.h\")\n"
+            "        #ifndef LV_LVGL_H_INCLUDE_SIMPLE\n"
+            "            #define LV_LVGL_H_INCLUDE_SIMPLE\n"
+            "        #endif\n"
+            "    #endif\n"
+            "#endif\n"
+            "\n"
+            "#if defined(LV_LVGL_H_INCLUDE_SIMPLE)\n"
+            "    #include \"lvgl.h\"\n"
+            "#else\n"
+            "    #include \"../../../Gui/lvgl/lvgl.h\"\n"
+            "#endif\n"
+            "\n"
+            "\n"
+            "#ifndef LV_ATTRIBUTE_MEM_ALIGN\n"
+            "#define LV_ATTRIBUTE_MEM_ALIGN\n"
+            "#endif\n"
+            "\n"
+            "#ifndef LV_ATTRIBUTE_IMAGE_%s\n"
+            "#define LV_ATTRIBUTE_IMAGE_%s\n"
+            "#endif\n"
+            "\n"
+            "/* %ux%u RGB565, 按行 RLE 压缩 (Tools/image_rle, 格式见 Core/App/GUI/gui_image_rle.h): %u -> %u 字节 */\n"
+            "const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_%s uint16_t %s_map[] = {\n",
+            upper, upper, img->w, img->h, img->w * img->h * 2, rle->len * 2, upper, name);
+
+    for (uint32_t k = 0; k < rle->len; k++)
+    {
+        fprintf(f, "%s0x%04x,%s", (k % 16) ? "" : "  ", rle->data[k], (k % 16 == 15 || k + 1 == rle->len) ? "\n" : " ");
+    }
+
+    fprintf(f,
+            "};\n"
+            "\n"
+            "const lv_image_dsc_t %s = {\n"
+            "  .header.cf = LV_COLOR_FORMAT_RGB565,\n"
+            "  .header.magic = LV_IMAGE_HEADER_MAGIC,\n"
+            "  .header.flags = LV_IMAGE_FLAGS_USER1,\n"
+            "  .header.w = %u,\n"
+            "  .header.h = %u,\n"
+            "  .data_size = %u * 2,\n"
+            "  .data = (const uint8_t *)%s_map,\n"
+            "};\n",
+            name, img->w, img->h, rle->len, name);
+
+    if (fclose(f) != 0) die("写入失败", path);
+}
+
+static void base_name(const char *path, char *name, size_t size)
+{
+    const char *p = strrchr(path, '/');
+    p = p ? p + 1 : path;
+    snprintf(name, size, "%s", p);
+    char *dot = strrchr(name, '.');
+    if (dot) *dot = 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "用法: image_rle_tool <输入.png|输入.c> <输出.c> [名称] [--bg RRGGBB]\n"
+            "      image_rle_tool --check <文件.c>\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 3 && strcmp(argv[1], "--check") == 0)
+    {
+        size_t size;
+        char *text = (char *)read_file(argv[2], &size);
+        Buf rle = {0};
+        uint32_t w, h;
+        load_rle_array(text, &rle, &w, &h);
+
+        uint16_t *px = malloc(w * h * sizeof(uint16_t));
+        if (!px || decode(rle.data, rle.len, w, h, px) != 0) die("解压失败", argv[2]);
+        printf("%s: %ux%u, %u -> %u 字节 (%.1f%%)\n", argv[2], w, h, w * h * 2, rle.len * 2,
+               100.0 * rle.len / (w * h));
+        return 0;
+    }
+
+    const char *in = NULL, *out = NULL, *name_arg = NULL;
+    uint32_t bg = 0xFFFFFF;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--bg") == 0 && i + 1 < argc)
+            bg = (uint32_t)strtoul(argv[++i], NULL, 16);
+        else if (!in)
+            in = argv[i];
+        else if (!out)
+            out = argv[i];
+        else if (!name_arg)
+            name_arg = argv[i];
+        else
+            usage();
+    }
+    if (!in || !out) usage();
+
+    char name[128];
+    if (name_arg)
+        snprintf(name, sizeof(name), "%s", name_arg);
+    else
+        base_name(out, name, sizeof(name));
+
+    size_t size;
+    uint8_t *file = read_file(in, &size);
+    Image img = {0};
+    if (size >= 8 && file[0] == 0x89 && memcmp(file + 1, "PNG", 3) == 0)
+        load_png(file, size, bg, &img);
+    else
+        load_c_array((const char *)file, &img);
+
+    Buf rle = {0};
+    encode(&img, &rle);
+
+    uint16_t *check = malloc(img.w * img.h * sizeof(uint16_t));
+    if (!check || decode(rle.data, rle.len, img.w, img.h, check) != 0 ||
+        memcmp(check, img.px, img.w * img.h * sizeof(uint16_t)) != 0)
+        die("解压校验失败", in);
+
+    write_c(out, name, &img, &rle);
+    printf("%s: %ux%u, %u -> %u 字节 (%.1f%%)\n", name, img.w, img.h, img.w * img.h * 2, rle.len * 2,
+           100.0 * rle.len / (img.w * img.h));
+    return 0;
+}
@@ -0,0 +1,323 @@
+/*
+ * music_index_tool.c
+ * 在电脑上建立 / 校验 SD 卡的曲库索引 (music/library.idx, 格式见 Core/App/Player/music_index.h)
+ *
+ * 编译:
+ *   gcc -O2 -I../../Core/App/Player music_index_tool.c ../../Core/App/Player/music_index.c -o music_index_tool
+ * 用法:
+ *   music_index_tool build  <SD 卡>/music   解析全部文件, 写入 library.idx (卡上几百首歌时比板上快得多)
+ *   music_index_tool verify <SD 卡>/music   检查索引是否完整, 列出板子启动时会重新解析的目录
+ *   music_index_tool list   <SD 卡>/music   打印索引中的曲目
+ *
+ * 目录签名与顺序无关, 但包含 FAT 修改时间: 请直接对挂载的 SD 卡运行, 拷贝到其他文件系统后时间可能变化,
+ * 这时板子会重新解析对应的目录 (结果仍然正确, 只是启动变慢)。
+ */
+
+#include "music_index.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <time.h>
+
+/* 与固件 music_library.h 相同 */
+#define MAX_DEPTH 4
+#define MAX_FOLDERS 64
+#define PROBE_BUF_SIZE 4096
+
+static char root[1024];
+static Music_Index_Folder folders[MAX_FOLDERS];
+static uint32_t folder_count;
+
+static int file_format(const char *name)
+{
+    static const char *const ext[] = {".wav", ".mp3", ".flac", ".ape"};  // MUSIC_INDEX_FMT_* 的顺序
+    const char *dot = strrchr(name, '.');
+
+    if (!dot || name[0] == '.' || strlen(name) >= MUSIC_INDEX_NAME_LEN) return -1;
+    for (int i = 0; i < 4; i++)
+    {
+        if (strcasecmp(dot, ext[i]) == 0) return i;
+    }
+    return -1;
+}
+
+static int make_path(char *buf, size_t size, const char *folder, const char *name)
+{
+    int n = snprintf(buf, size, "%s%s%s%s%s", root, folder[0] ? "/" : "", folder, name ? "/" : "", name ? name : "");
+    return (n > 0 && (size_t)n < size) ? 0 : -1;
+}
+
+static void fat_time(time_t t, uint16_t *fdate, uint16_t *ftime)
+{
+    struct tm *tm = localtime(&t);
+    *fdate = (uint16_t)(((tm->tm_year - 80) << 9) | ((tm->tm_mon + 1) << 5) | tm->tm_mday);
+    *ftime = (uint16_t)((tm->tm_hour << 11) | (tm->tm_min << 5) | (tm->tm_sec / 2));
+}
+
+static uint32_t stdio_read(void *ctx, uint32_t offset, void *buf, uint32_t len)
+{
+    FILE *fp = (FILE *)ctx;
+    if (fseek(fp, (long)offset, SEEK_SET) != 0) return 0;
+    return (uint32_t)fread(buf, 1, len, fp);
+}
+
+/**
+ * @brief  Breadth-first walk with the same limits as the firmware
+ * @param  out: 非 NULL 时解析每个文件并写入曲目记录
+ */
+static int scan(FILE *out, uint32_t *track_count)
+{
+    static uint8_t buf[PROBE_BUF_SIZE];
+    char path[2048];
+
+    folder_count = 1;
+    *track_count = 0;
+    memset(folders, 0, sizeof(folders));
+
+    for (uint32_t i = 0; i < folder_count; i++)
+    {
+        Music_Index_Folder *f = &folders[i];
+        uint32_t depth = f->path[0] ? 1 : 0;
+        for (const char *p = f->path; *p; p++) depth += (*p == '/');
+
+        f->signature = MUSIC_INDEX_FNV_BASIS;
+        f->first_track = *track_count;
+
+        DIR *dir = (make_path(path, sizeof(path), f->path, NULL) == 0) ? opendir(path) : NULL;
+        if (!dir) continue;
+
+        struct dirent *de;
+        while ((de = readdir(dir)) != NULL)
+        {
+            struct stat st;
+            if (de->d_name[0] == '.') continue;
+            if (make_path(path, sizeof(path), f->path, de->d_name) != 0 || stat(path, &st) != 0) continue;
+
+            if (S_ISDIR(st.st_mode))
+            {
+                if (depth >= MAX_DEPTH || folder_count >= MAX_FOLDERS) continue;
+                Music_Index_Folder *sub = &folders[folder_count];
+                int n = snprintf(sub->path, sizeof(sub->path), "%s%s%s", f->path, f->path[0] ? "/" : "", de->d_name);
+                if (n > 0 && n < (int)sizeof(sub->path)) folder_count++;
+                continue;
+            }
+
+            int format = file_format(de->d_name);
+            if (format < 0 || !S_ISREG(st.st_mode)) continue;
+
+            Music_Index_Track t;
+            memset(&t, 0, sizeof(t));
+            strcpy(t.name, de->d_name);
+            t.size = (uint32_t)st.st_size;
+            t.format = (uint8_t)format;
+            t.folder = (uint16_t)i;
+            fat_time(st.st_mtime, &t.fdate, &t.ftime);
+
+            f->signature = Music_Index_FolderSignature(f->signature, t.name, t.size, t.fdate, t.ftime);
+            f->entries++;
+
+            if (out)
+            {
+                FILE *fp = fopen(path, "rb");
+                if (fp)
+                {
+                    if (Music_Index_Probe(&t, stdio_read, fp, buf, sizeof(buf)) != 0)
+                    {
+                        fprintf(stderr, "warning: %s: unrecognized header\n", path);
+                    }
+                    fclose(fp);
+                }
+                if (fwrite(&t, sizeof(t), 1, out) != 1) return -1;
+            }
+            f->track_count++;
+            (*track_count)++;
+        }
+        closedir(dir);
+    }
+    return 0;
+}
+
+static int cmd_build(void)
+{
+    char tmp[1100], idx[1100];
+    Music_Index_Header h;
+    uint32_t tracks;
+
+    snprintf(tmp, sizeof(tmp), "%s/library.tmp", root);
+    snprintf(idx, sizeof(idx), "%s/library.idx", root);
+
+    FILE *out = fopen(tmp, "wb");
+    if (!out)
+    {
+        perror(tmp);
+        return 1;
+    }
+
+    memset(&h, 0, sizeof(h));
+    fwrite(&h, sizeof(h), 1, out);
+    if (scan(out, &tracks) != 0 || fwrite(folders, sizeof(Music_Index_Folder), folder_count, out) != folder_count)
+    {
+        fprintf(stderr, "%s: write failed\n", tmp);
+        fclose(out);
+        remove(tmp);
+        return 1;
+    }
+
+    h.magic = MUSIC_INDEX_MAGIC;
+    h.version = MUSIC_INDEX_VERSION;
+    h.header_size = sizeof(Music_Index_Header);
+    h.track_size = sizeof(Music_Index_Track);
+    h.folder_size = sizeof(Music_Index_Folder);
+    h.track_count = tracks;
+    h.folder_count = folder_count;
+    h.track_offset = sizeof(Music_Index_Header);
+    h.folder_offset = sizeof(Music_Index_Header) + tracks * sizeof(Music_Index_Track);
+    h.checksum = Music_Index_Hash(MUSIC_INDEX_FNV_BASIS, folders, folder_count * sizeof(Music_Index_Folder));
+    fseek(out, 0, SEEK_SET);
+    fwrite(&h, sizeof(h), 1, out);
+    if (fclose(out) != 0 || rename(tmp, idx) != 0)
+    {
+        perror(idx);
+        return 1;
+    }
+
+    printf("%s: %u folders, %u tracks\n", idx, (unsigned)folder_count, (unsigned)tracks);
+    return 0;
+}
+
+/**
+ * @brief  Load library.idx
+ * @retval 文件内容 (调用者释放), 无效时返回 NULL
+ */
+static uint8_t *load_index(Music_Index_Header *h)
+{
+    char idx[1100];
+    long size;
+    uint8_t *data;
+
+    snprintf(idx, sizeof(idx), "%s/library.idx", root);
+    FILE *fp = fopen(idx, "rb");
+    if (!fp)
+    {
+        perror(idx);
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    data = malloc(size > 0 ? (size_t)size : 1);
+    if (!data || fread(data, 1, (size_t)size, fp) != (size_t)size || size < (long)sizeof(*h))
+    {
+        fprintf(stderr, "%s: read failed\n", idx);
+        fclose(fp);
+        free(data);
+        return NULL;
+    }
+    fclose(fp);
+
+    memcpy(h, data, sizeof(*h));
+    if (Music_Index_CheckHeader(h, (uint32_t)size) != 0 || h->folder_count > MAX_FOLDERS ||
+        Music_Index_Hash(MUSIC_INDEX_FNV_BASIS, data + h->folder_offset, h->folder_count * sizeof(Music_Index_Folder)) !=
+            h->checksum)
+    {
+        fprintf(stderr, "%s: invalid header or folder table\n", idx);
+        free(data);
+        return NULL;
+    }
+    return data;
+}
+
+static int cmd_verify(void)
+{
+    Music_Index_Header h;
+    uint32_t tracks;
+    int stale = 0;
+    uint8_t *data = load_index(&h);
+
+    if (!data) return 1;
+    const Music_Index_Folder *old = (const Music_Index_Folder *)(data + h.folder_offset);
+
+    for (uint32_t i = 0; i < h.folder_count; i++)
+    {
+        const Music_Index_Folder *f = &old[i];
+        if (f->first_track + f->track_count > h.track_count)
+        {
+            printf("corrupt: folder \"%s\" track range\n", f->path);
+            stale = 1;
+        }
+    }
+
+    scan(NULL, &tracks);
+    for (uint32_t i = 0; i < folder_count; i++)
+    {
+        uint32_t j = 0;
+        while (j < h.folder_count && strcmp(old[j].path, folders[i].path) != 0) j++;
+        if (j == h.folder_count)
+        {
+            printf("new:     \"%s\" (%u files)\n", folders[i].path, (unsigned)folders[i].entries);
+            stale = 1;
+        }
+        else if (old[j].signature != folders[i].signature || old[j].entries != folders[i].entries)
+        {
+            printf("changed: \"%s\" (%u -> %u files)\n", folders[i].path, (unsigned)old[j].entries,
+                   (unsigned)folders[i].entries);
+            stale = 1;
+        }
+    }
+    if (folder_count != h.folder_count)
+    {
+        printf("folders: %u in index, %u on disk\n", (unsigned)h.folder_count, (unsigned)folder_count);
+        stale = 1;
+    }
+
+    printf("%s: %u folders, %u tracks\n", stale ? "stale" : "ok", (unsigned)h.folder_count, (unsigned)h.track_count);
+    free(data);
+    return stale;
+}
+
+static int cmd_list(void)
+{
+    Music_Index_Header h;
+    uint8_t *data = load_index(&h);
+
+    if (!data) return 1;
+    const Music_Index_Track *t = (const Music_Index_Track *)(data + h.track_offset);
+    const Music_Index_Folder *f = (const Music_Index_Folder *)(data + h.folder_offset);
+
+    for (uint32_t i = 0; i < h.track_count; i++, t++)
+    {
+        const char *dir = (t->folder < h.folder_count) ? f[t->folder].path : "?";
+        printf("%4u  %s%s%s  %u:%02u  %uHz %uch %ukbps  %s / %s / %s", (unsigned)i, dir, dir[0] ? "/" : "",
+               t->name, (unsigned)(t->duration_ms / 60000), (unsigned)(t->duration_ms / 1000 % 60),
+               (unsigned)t->sample_rate, (unsigned)t->channels, (unsigned)(t->bitrate / 1000), t->title, t->artist,
+               t->album);
+        if (t->cover_size) printf("  [cover %u bytes @ %u]", (unsigned)t->cover_size, (unsigned)t->cover_offset);
+        printf("\n");
+    }
+    free(data);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s build|verify|list <sdcard>/music\n", argv[0]);
+        return 2;
+    }
+
+    snprintf(root, sizeof(root), "%s", argv[2]);
+    size_t n = strlen(root);
+    while (n > 1 && root[n - 1] == '/') root[--n] = '\0';
+
+    if (strcmp(argv[1], "build") == 0) return cmd_build();
+    if (strcmp(argv[1], "verify") == 0) return cmd_verify();
+    if (strcmp(argv[1], "list") == 0) return cmd_list();
+
+    fprintf(stderr, "unknown command: %s\n", argv[1]);
+    return 2;
+}
@@ -0,0 +1,312 @@
+/*
+ * pcm_ring_test.c
+ * 在电脑上驱动 pcm_ring.c: 解码时间带抖动的生产者 + 固定速率的消费者 (模拟 I2S DMA 时钟)
+ *
+ * 1. 模拟 (默认): 离散事件模拟, 时间以纳秒计, 结果可重复。
+ *    消费者按 music_player.c 的 DMA 双缓冲方式工作: M0/M1 各占一块, 每个块周期 (1152 个立体声采样 @ 44.1kHz)
+ *    结束时释放刚发完的块, 用 PCM_Ring_PeekReadBlock() 取下一块, 没有数据时发静音并 PCM_Ring_MarkUnderrun()。
+ *    生产者与音频任务相同: 有空闲块时取一块解码, 用时按场景随机 (均匀抖动 + 偶发长时间停顿, 如 SD 卡忙、
+ *    GUI 抢占), 解码完提交; 缓冲区满时等待下一次 DMA 中断。启动前先填 PCM_START_BLOCKS 块。
+ *    每个场景检查:
+ *      - 欠载计数等于模拟中发出静音的块数, 并在场景给定的范围内
+ *      - 最低水位 (min_fill) 在场景给定的范围内
+ *      - blocks_played 加上静音块数等于 DMA 周期数
+ *      - 每块开头写入序号, DMA 取到的块按序号连续, 没有重复或跳过
+ * 2. -t: 两个线程实际并发 (生产者线程 / 以固定周期唤醒的消费者线程), 检查无锁读写下块序号仍然连续;
+ *    欠载次数取决于电脑负载, 只输出不检查。加 -fsanitize=thread 编译时 ThreadSanitizer 应该没有报告。
+ *
+ * 编译:
+ *   gcc -O2 -pthread -I../../Core/App/Player pcm_ring_test.c ../../Core/App/Player/pcm_ring.c -o pcm_ring_test
+ * 用法:
+ *   ./pcm_ring_test [-t 秒]     任何检查失败时返回 1
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pcm_ring.h"
+
+#define BLOCK_SAMPLES 2304  // 与 music_player.c 的 PCM_RING_BLOCK_SAMPLES 相同
+#define BLOCK_COUNT 4       // 与 PCM_RING_BLOCK_COUNT 相同
+#define START_BLOCKS 2      // 与 PCM_START_BLOCKS 相同
+#define BLOCK_NS 26122449U  // 1152 / 44100 秒
+#define SIM_BLOCKS 20000    // 每个场景模拟的 DMA 周期数 (约 8.7 分钟)
+
+typedef struct
+{
+    const char *name;
+    uint32_t decode_permille;  // 平均解码用时, 以块周期的千分比计
+    uint32_t jitter_permille;  // 均匀抖动幅度 (平均值的 ± 千分比)
+    uint32_t stall_every;      // 平均每多少帧出现一次停顿, 0 表示没有
+    uint32_t stall_permille;   // 停顿时长 (块周期的千分比)
+    uint32_t underruns_min;    // 期望的欠载次数范围
+    uint32_t underruns_max;
+    uint16_t min_fill_min;     // 期望的最低水位范围 (块, 含 DMA 占用的块)
+    uint16_t min_fill_max;
+} Scenario;
+
+static const Scenario scenarios[] = {
+    // 解码远快于播放: 缓冲区始终接近满, 释放一块后剩 3 块
+    {"steady", 300, 500, 0, 0, 0, 0, 3, 3},
+    // 停顿 1.5 个块周期: 两块预解码的余量足够, 不欠载, 水位降到只剩 DMA 占用的 2 块
+    {"stall-1.5", 300, 500, 200, 1500, 0, 0, 2, 2},
+    // 停顿 4 个块周期 (约每 500 帧一次): 超出余量, 每次停顿欠载 2~4 块
+    {"stall-4", 300, 500, 500, 4000, SIM_BLOCKS / 500 * 2, SIM_BLOCKS / 500 * 4, 0, 0},
+    // 平均解码 95% 块周期, 抖动 ±20%: 抖动由余量吸收, 不欠载
+    {"heavy", 950, 200, 0, 0, 0, 0, 1, 3},
+    // 解码比播放慢 10%: 持续欠载, 约每 11 块缺 1 块 (1 - 1/1.1)
+    {"overload", 1100, 100, 0, 0, SIM_BLOCKS * 8 / 100, SIM_BLOCKS * 10 / 100, 0, 0},
+};
+
+static int16_t pool[BLOCK_SAMPLES * BLOCK_COUNT] __attribute__((aligned(4)));
+static PCM_Ring_TypeDef ring;
+static uint32_t rng_state = 1;
+
+static uint32_t rnd(uint32_t n)
+{
+    rng_state = rng_state * 1664525U + 1013904223U;
+    return (uint32_t)(((uint64_t)(rng_state >> 8) * n) >> 24);
+}
+
+/* 每块开头 2 个采样存放 32 位序号 */
+static void block_put_seq(int16_t *block, uint32_t seq)
+{
+    memcpy(block, &seq, sizeof(seq));
+}
+
+static uint32_t block_get_seq(const int16_t *block)
+{
+    uint32_t seq;
+    memcpy(&seq, block, sizeof(seq));
+    return seq;
+}
+
+/* ---------------------------------------------------------------------------
+ * 离散事件模拟
+ * ------------------------------------------------------------------------- */
+
+typedef struct
+{
+    uint8_t owned[2];   // 与 music_player.c 的 dma_target_owned 相同
+    uint32_t next_seq;  // DMA 应该取到的下一个序号
+    uint32_t silent;    // 发出的静音块数
+    uint32_t seq_errors;
+} Sim_Dma;
+
+static uint64_t decode_time(const Scenario *s)
+{
+    uint64_t mean = (uint64_t)BLOCK_NS * s->decode_permille / 1000;
+    uint64_t jitter = mean * s->jitter_permille / 1000;
+    uint64_t t = mean - jitter + rnd((uint32_t)(2 * jitter + 1));
+
+    if (s->stall_every && rnd(s->stall_every) == 0) t += (uint64_t)BLOCK_NS * s->stall_permille / 1000;
+    return t;
+}
+
+/**
+ * @brief  audio_dma_next_block(): 另一个目标持有的块之后的那一块, 没有时发静音
+ */
+static void sim_next_block(Sim_Dma *dma, uint8_t target)
+{
+    const int16_t *block = PCM_Ring_PeekReadBlock(&ring, dma->owned[target ^ 1]);
+
+    if (!block)
+    {
+        dma->owned[target] = 0;
+        dma->silent++;
+        PCM_Ring_MarkUnderrun(&ring);
+        return;
+    }
+
+    dma->owned[target] = 1;
+    if (block_get_seq(block) != dma->next_seq) dma->seq_errors++;
+    dma->next_seq = block_get_seq(block) + 1;
+}
+
+/**
+ * @brief  audio_dma_target_done(): 释放刚发完的块, 再为该目标取下一块
+ */
+static void sim_target_done(Sim_Dma *dma, uint8_t target)
+{
+    if (dma->owned[target])
+    {
+        PCM_Ring_ReleaseRead(&ring);
+        dma->owned[target] = 0;
+    }
+    sim_next_block(dma, target);
+}
+
+static int run_scenario(const Scenario *s)
+{
+    Sim_Dma dma = {{0}, 0, 0, 0};
+    uint32_t produced = 0;
+    uint64_t fill_sum = 0;
+    int16_t *writing = NULL;  // 生产者正在解码的块
+    uint64_t decode_done = 0;
+
+    PCM_Ring_Init(&ring, pool, BLOCK_SAMPLES, BLOCK_COUNT);
+    rng_state = 1;
+
+    // audio_start_dma(): 先解码两块, 再把 M0/M1 指向它们
+    for (int i = 0; i < START_BLOCKS; i++)
+    {
+        block_put_seq(PCM_Ring_GetWriteBlock(&ring), produced++);
+        PCM_Ring_CommitWrite(&ring);
+    }
+    sim_next_block(&dma, 0);
+    sim_next_block(&dma, 1);
+
+    for (uint32_t k = 1; k <= SIM_BLOCKS; k++)
+    {
+        uint64_t dma_time = (uint64_t)k * BLOCK_NS;
+
+        // 生产者在下一次 DMA 中断之前能完成的解码
+        for (uint64_t now = (k - 1) * (uint64_t)BLOCK_NS;;)
+        {
+            if (!writing)
+            {
+                writing = PCM_Ring_GetWriteBlock(&ring);
+                if (!writing) break;  // 已满, 等待 DMA 中断释放信号量
+                decode_done = now + decode_time(s);
+            }
+            if (decode_done > dma_time) break;
+
+            block_put_seq(writing, produced++);
+            PCM_Ring_CommitWrite(&ring);
+            writing = NULL;
+            now = decode_done;
+        }
+
+        // M0 和 M1 交替发送完毕
+        sim_target_done(&dma, (uint8_t)((k - 1) & 1));
+        fill_sum += PCM_Ring_GetFill(&ring);
+    }
+
+    PCM_Ring_Stats st;
+    PCM_Ring_GetStats(&ring, &st);
+
+    // 启动时 M0/M1 已取走的两块之外, 每个周期要么释放一块并取下一块, 要么发静音
+    uint32_t fed = st.blocks_played + dma.owned[0] + dma.owned[1] - START_BLOCKS;
+    int ok = 1;
+    ok &= st.underruns == dma.silent;
+    ok &= fed + dma.silent == SIM_BLOCKS;
+    ok &= dma.seq_errors == 0;
+    ok &= st.underruns >= s->underruns_min && st.underruns <= s->underruns_max;
+    ok &= st.min_fill >= s->min_fill_min && st.min_fill <= s->min_fill_max;
+    ok &= st.fill <= st.capacity;
+
+    printf("%-10s %6u %8u %8u %9.2f %4u    [%u, %u]  [%u, %u]  %s\n", s->name, SIM_BLOCKS, st.blocks_played,
+           st.underruns, (double)fill_sum / SIM_BLOCKS, st.min_fill, s->underruns_min, s->underruns_max,
+           s->min_fill_min, s->min_fill_max, ok ? "ok" : (dma.seq_errors ? "FAIL (sequence)" : "FAIL"));
+    return ok ? 0 : 1;
+}
+
+/* ---------------------------------------------------------------------------
+ * 双线程: 检查无锁读写
+ * ------------------------------------------------------------------------- */
+
+#define THREAD_BLOCK_NS 1000000U  // 消费者周期 1ms, 比实际快, 增加交错次数
+
+static int thread_stop = 0;
+
+static void *producer_thread(void *arg)
+{
+    uint32_t seq = 0;
+    uint32_t state = 7;
+
+    (void)arg;
+    while (!__atomic_load_n(&thread_stop, __ATOMIC_RELAXED))
+    {
+        int16_t *block = PCM_Ring_GetWriteBlock(&ring);
+        if (!block) continue;
+
+        // 先写块内数据 (序号 + 由序号决定的内容), 再提交
+        state = seq * 2654435761U;
+        for (int i = 2; i < BLOCK_SAMPLES; i++) block[i] = (int16_t)(state >> (i & 15));
+        block_put_seq(block, seq++);
+
+        // 解码用时抖动: 0 ~ 1.6 个消费者周期的忙等
+        struct timespec t0, t1;
+        uint64_t spin = (uint64_t)THREAD_BLOCK_NS * (rnd(1600) + 1) / 1000;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        do clock_gettime(CLOCK_MONOTONIC, &t1);
+        while ((uint64_t)(t1.tv_sec - t0.tv_sec) * 1000000000U + t1.tv_nsec - t0.tv_nsec < spin);
+
+        PCM_Ring_CommitWrite(&ring);
+    }
+    return NULL;
+}
+
+static int run_threads(int seconds)
+{
+    pthread_t tid;
+    struct timespec next;
+    uint32_t next_seq = 0, seq_errors = 0, data_errors = 0, periods = 0;
+
+    PCM_Ring_Init(&ring, pool, BLOCK_SAMPLES, BLOCK_COUNT);
+    pthread_create(&tid, NULL, producer_thread, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    for (periods = 0; periods < (uint32_t)seconds * (1000000000U / THREAD_BLOCK_NS); periods++)
+    {
+        next.tv_nsec += THREAD_BLOCK_NS;
+        if (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+        const int16_t *block = PCM_Ring_GetReadBlock(&ring);
+        if (!block)
+        {
+            PCM_Ring_MarkUnderrun(&ring);
+            continue;
+        }
+
+        uint32_t seq = block_get_seq(block);
+        uint32_t state = seq * 2654435761U;
+        for (int i = 2; i < BLOCK_SAMPLES; i++)
+        {
+            if (block[i] != (int16_t)(state >> (i & 15)))
+            {
+                data_errors++;
+                break;
+            }
+        }
+        if (seq != next_seq) seq_errors++;
+        next_seq = seq + 1;
+        PCM_Ring_ReleaseRead(&ring);
+    }
+
+    __atomic_store_n(&thread_stop, 1, __ATOMIC_RELAXED);
+    pthread_join(tid, NULL);
+
+    PCM_Ring_Stats st;
+    PCM_Ring_GetStats(&ring, &st);
+    int ok = seq_errors == 0 && data_errors == 0 && st.blocks_played + st.underruns == periods;
+    printf("threads    %6u %8u %8u  seq errors %u, data errors %u  %s\n", periods, st.blocks_played, st.underruns,
+           seq_errors, data_errors, ok ? "ok" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    int failed = 0;
+
+    if (argc == 3 && !strcmp(argv[1], "-t")) return run_threads(atoi(argv[2]));
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [-t seconds]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%-10s %6s %8s %8s %9s %4s    %-8s  %-6s\n", "scenario", "blocks", "played", "underrun", "avg fill",
+           "min", "expect", "min");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) failed |= run_scenario(&scenarios[i]);
+    return failed;
+}